@@ -51,11 +51,58 @@ enum {
   MM_LastAction_EEPROMWRITE_ENA = 10, /**< \brief EEPROM write enable action */
   MM_LastAction_EEPROMWRITE_DIS = 11, /**< \brief EEPROM write disable action */
   MM_LastAction_NOOP            = 12, /**< \brief No-op action */
-  MM_LastAction_RESET           = 13  /**< \brief Reset counters action */
+  MM_LastAction_RESET           = 13, /**< \brief Reset counters action */
+  MM_LastAction_DUMP_TO_TLM     = 14, /**< \brief Dump to telemetry action */
+  MM_LastAction_DUMP_INTLM      = 15, /**< \brief Dump in telemetry action */
+  MM_LastAction_LOAD_CHUNKS     = 16, /**< \brief Chunked load action */
+  MM_LastAction_CHECKSUM        = 17, /**< \brief Memory checksum action */
+  MM_LastAction_SCRUB_INDEX     = 18, /**< \brief Build scrub index action */
+  MM_LastAction_SCRUB_COMPARE   = 19, /**< \brief Compare scrub index action */
+  MM_LastAction_MEM_TEST        = 20, /**< \brief Memory test action */
+  MM_LastAction_BATCH_PEEK      = 21, /**< \brief Batch peek action */
+  MM_LastAction_BATCH_POKE      = 22, /**< \brief Batch poke action */
+  MM_LastAction_MASKED_POKE     = 23, /**< \brief Masked poke action */
+  MM_LastAction_COND_POKE       = 24  /**< \brief Conditional poke action */
 };
 
 typedef uint8 MM_LastAction_Enum_t;
 
+/**
+ * @brief Scrub Region Status Identifiers
+ */
+enum {
+  MM_ScrubStatus_UNUSED     = 0, /**< \brief Scrub region is not defined */
+  MM_ScrubStatus_PENDING    = 1, /**< \brief Scrub region has not completed a pass yet */
+  MM_ScrubStatus_GOOD       = 2, /**< \brief Last pass matched the golden CRC */
+  MM_ScrubStatus_BAD        = 3, /**< \brief Last pass didn't match the golden CRC */
+  MM_ScrubStatus_READ_ERROR = 4  /**< \brief Last pass couldn't read the region */
+};
+
+typedef uint8 MM_ScrubStatus_Enum_t;
+
+/**
+ * @brief Load and Dump File CRC Types
+ */
+enum {
+  MM_CrcType_DEFAULT   = 0, /**< \brief Configured cFE CRC type for load or dump files */
+  MM_CrcType_CRC16_ARC = 1, /**< \brief 16-bit CRC, reflected polynomial 0xA001 */
+  MM_CrcType_CRC32     = 2, /**< \brief 32-bit CRC, reflected polynomial 0xEDB88320 */
+  MM_CrcType_CRC32C    = 3  /**< \brief 32-bit Castagnoli CRC, reflected polynomial 0x82F63B78 */
+};
+
+typedef uint8 MM_CrcType_Enum_t;
+
+/**
+ * @brief Memory Test Pattern Identifiers, combined as a bit mask
+ */
+enum {
+  MM_MemTestPattern_MARCH_C      = 0x01, /**< \brief March C- over the whole region */
+  MM_MemTestPattern_WALKING_ONES = 0x02, /**< \brief A single one bit walked through each word */
+  MM_MemTestPattern_ADDRESS      = 0x04  /**< \brief Address of each word, then its complement, as data */
+};
+
+typedef uint8 MM_MemTestPattern_Enum_t;
+
 /**
  *  \brief Memory Types
  */
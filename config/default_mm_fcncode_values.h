@@ -52,6 +52,29 @@ enum MM_FunctionCode {
   MM_FunctionCode_SYMTBL_TO_FILE = 10,
   MM_FunctionCode_ENABLE_EEPROM_WRITE = 11,
   MM_FunctionCode_DISABLE_EEPROM_WRITE = 12,
+  MM_FunctionCode_SET_CPU_BUDGET = 13,
+  MM_FunctionCode_DUMP_MEM_TO_COMPRESSED_FILE = 14,
+  MM_FunctionCode_DUMP_REGIONS_TO_FILE = 15,
+  MM_FunctionCode_DUMP_MEM_TO_TLM = 16,
+  MM_FunctionCode_DUMP_IN_TLM = 17,
+  MM_FunctionCode_LOAD_BEGIN = 18,
+  MM_FunctionCode_LOAD_DATA = 19,
+  MM_FunctionCode_LOAD_COMMIT = 20,
+  MM_FunctionCode_LOAD_RAM_COMMIT = 21,
+  MM_FunctionCode_CHECKSUM_MEM = 22,
+  MM_FunctionCode_SET_SCRUB_REGION = 23,
+  MM_FunctionCode_CLEAR_SCRUB_REGION = 24,
+  MM_FunctionCode_BUILD_SCRUB_INDEX = 25,
+  MM_FunctionCode_COMPARE_SCRUB_INDEX = 26,
+  MM_FunctionCode_SET_DUMP_CRC_TYPE = 27,
+  MM_FunctionCode_MEM_TEST = 28,
+  MM_FunctionCode_BATCH_PEEK = 29,
+  MM_FunctionCode_BATCH_POKE = 30,
+  MM_FunctionCode_SET_WATCH_ENTRY = 31,
+  MM_FunctionCode_CLEAR_WATCH_ENTRY = 32,
+  MM_FunctionCode_SET_SAMPLE_PERIOD = 33,
+  MM_FunctionCode_MASKED_POKE = 34,
+  MM_FunctionCode_CONDITIONAL_POKE = 35,
 };
 
 #endif /* DEFAULT_MM_FCNCODE_VALUES_H */
\ No newline at end of file
@@ -40,6 +40,8 @@
  * file can be reloaded back into memory if desired (providing a memory save
  * and restore capability). This MM header is the secondary header, the
  * standard cFE file header is primary header for all load and dump files.
+ * Files written before the CrcType field was added hold zero there, which is
+ * #MM_CrcType_DEFAULT, so they still load.
  */
 typedef struct {
   MM_SymAddr_t SymAddress;   /**< \brief Symbolic load address or fully resolved
@@ -47,7 +49,33 @@ typedef struct {
   uint32 NumOfBytes;         /**< \brief Bytes to load or bytes dumped      */
   uint32 Crc;                /**< \brief CRC value for load or dump data    */
   MM_MemType_Enum_t MemType; /**< \brief Memory type used                   */
-  uint8 Spare[3];            /**< \brief Structure Padding                  */
+  MM_CrcType_Enum_t CrcType; /**< \brief Algorithm used for the Crc field    */
+  uint8 Spare[2];            /**< \brief Structure Padding                  */
 } MM_LoadDumpFileHeader_t;
 
+/*
+ * A region file (cFE file header sub-type #MM_INTERNAL_CFE_HDR_REGION_SUBTYPE)
+ * holds several memory regions. The MM secondary header is followed by a
+ * region directory, an array of one #MM_LoadDumpFileHeader_t per region,
+ * then the data bytes of each region in directory order. The secondary
+ * header NumOfBytes is the size of the directory in bytes and its Crc covers
+ * the directory, the Crc of each directory entry covers the data of that
+ * region. The secondary header CrcType applies to the directory and to
+ * every region.
+ */
+
+/**
+ * \brief MM patch load file run header structure
+ * A patch load file (cFE file header sub-type
+ * #MM_INTERNAL_CFE_HDR_PATCH_SUBTYPE) holds a list of runs instead of one
+ * contiguous image. Each run is this header immediately followed by Length
+ * data bytes, which are loaded Offset bytes past the load address in the MM
+ * secondary header. The secondary header NumOfBytes and Crc cover all of the
+ * runs, headers included.
+ */
+typedef struct {
+  uint32 Offset; /**< \brief Byte offset of the run from the load address */
+  uint32 Length; /**< \brief Number of data bytes in the run             */
+} MM_PatchRunHeader_t;
+
 #endif
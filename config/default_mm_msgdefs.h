@@ -98,14 +98,128 @@ typedef struct {
                                             */
 } MM_DumpMemToFileCmd_Payload_t;
 
+/**
+ *  \brief Dump Regions To File Command Region
+ */
+typedef struct {
+  MM_MemType_Enum_t MemType;  /**< \brief Memory dump type */
+  MM_MemSize_t NumOfBytes;    /**< \brief Number of bytes to be dumped */
+  MM_SymAddr_t SrcSymAddress; /**< \brief Symbol plus optional offset  */
+} MM_DumpRegion_t;
+
+/**
+ *  \brief Dump Regions To File Command Payload
+ */
+typedef struct {
+  uint32 NumRegions; /**< \brief Number of regions to be dumped */
+  uint8 Padding[4];  /**< \brief Structure padding             */
+  MM_DumpRegion_t Regions[MM_INTERFACE_MAX_DUMP_REGIONS]; /**< \brief Regions
+                                                           to be dumped */
+  char FileName[CFE_MISSION_MAX_PATH_LEN]; /**< \brief Name of memory dump file
+                                            */
+} MM_DumpRegionsToFileCmd_Payload_t;
+
+/**
+ *  \brief Dump Memory To Telemetry Command Payload
+ */
+typedef struct {
+  MM_MemType_Enum_t MemType;  /**< \brief Memory dump type */
+  MM_MemSize_t NumOfBytes;    /**< \brief Number of bytes to be dumped */
+  MM_SymAddr_t SrcSymAddress; /**< \brief Symbol plus optional offset  */
+} MM_DumpMemToTlmCmd_Payload_t;
+
+/**
+ *  \brief Dump In Telemetry Command Payload
+ */
+typedef struct {
+  MM_MemType_Enum_t MemType;  /**< \brief Memory dump type */
+  MM_MemSize_t NumOfBytes;    /**< \brief Number of bytes to be dumped */
+  MM_SymAddr_t SrcSymAddress; /**< \brief Symbol plus optional offset  */
+} MM_DumpInTlmCmd_Payload_t;
+
+/**
+ *  \brief Load Begin Command Payload
+ */
+typedef struct {
+  MM_MemType_Enum_t MemType;   /**< \brief Memory type to load            */
+  MM_MemSize_t NumOfBytes;     /**< \brief Number of bytes to be loaded   */
+  uint32 Crc;                  /**< \brief CRC of all the load data       */
+  uint8 Padding[4];            /**< \brief Structure padding              */
+  MM_SymAddr_t DestSymAddress; /**< \brief Symbol plus optional offset    */
+} MM_LoadBeginCmd_Payload_t;
+
+/**
+ *  \brief Load Data Command Payload
+ */
+typedef struct {
+  MM_MemSize_t Offset;     /**< \brief Offset of the chunk in the load data */
+  MM_MemSize_t NumOfBytes; /**< \brief Number of bytes in the chunk */
+  uint8 DataArray[MM_INTERFACE_MAX_LOAD_CHUNK_DATA]; /**< \brief Chunk data */
+} MM_LoadDataCmd_Payload_t;
+
+/**
+ *  \brief Memory Checksum Command Payload
+ */
+typedef struct {
+  MM_MemType_Enum_t MemType;  /**< \brief Memory type to checksum */
+  MM_MemSize_t NumOfBytes;    /**< \brief Number of bytes to checksum */
+  MM_SymAddr_t SrcSymAddress; /**< \brief Symbol plus optional offset */
+} MM_ChecksumMemCmd_Payload_t;
+
+/**
+ *  \brief Set Scrub Region Command Payload
+ */
+typedef struct {
+  uint8 RegionNum;            /**< \brief Scrub region number */
+  uint8 Padding;              /**< \brief Structure padding */
+  uint16 Padding2;            /**< \brief Structure padding */
+  MM_MemType_Enum_t MemType;  /**< \brief Memory type of the region */
+  MM_MemSize_t NumOfBytes;    /**< \brief Number of bytes in the region */
+  uint32 GoldenCrc;           /**< \brief Expected CRC of the region */
+  MM_SymAddr_t SrcSymAddress; /**< \brief Symbol plus optional offset */
+} MM_SetScrubRegionCmd_Payload_t;
+
+/**
+ *  \brief Clear Scrub Region Command Payload
+ */
+typedef struct {
+  uint8 RegionNum; /**< \brief Scrub region number */
+  uint8 Padding;   /**< \brief Structure padding */
+  uint16 Padding2; /**< \brief Structure padding */
+} MM_ClearScrubRegionCmd_Payload_t;
+
+/**
+ *  \brief Build Scrub Index Command Payload
+ */
+typedef struct {
+  uint8 RegionNum; /**< \brief Scrub region number */
+  uint8 Padding;   /**< \brief Structure padding */
+  uint16 Padding2; /**< \brief Structure padding */
+} MM_BuildScrubIndexCmd_Payload_t;
+
+/**
+ *  \brief Compare Scrub Index Command Payload
+ */
+typedef struct {
+  uint8 RegionNum; /**< \brief Scrub region number */
+  uint8 Padding;   /**< \brief Structure padding */
+  uint16 Padding2; /**< \brief Structure padding */
+} MM_CompareScrubIndexCmd_Payload_t;
+
 /**
  *  \brief Memory Fill Command Payload
  */
 typedef struct {
   MM_MemType_Enum_t MemType;   /**< \brief Memory type                  */
   MM_MemSize_t NumOfBytes;     /**< \brief Number of bytes to fill      */
-  uint32 FillPattern;          /**< \brief Fill pattern to use          */
-  uint8 Padding[4];            /**< \brief Structure padding            */
+  uint32 FillPattern;          /**< \brief Fill pattern to use, the low
+                                    32 bits of a 64-bit pattern        */
+  uint32 FillPatternHigh;      /**< \brief High 32 bits of a 64-bit fill
+                                    pattern                            */
+  uint8 PatternSize;           /**< \brief Bytes in the repeating pattern
+                                    (1, 2, 4, or 8), zero for the access
+                                    width of the memory type          */
+  uint8 Padding[7];            /**< \brief Structure padding            */
   MM_SymAddr_t DestSymAddress; /**< \brief Symbol plus optional offset  */
 } MM_FillMemCmd_Payload_t;
 
@@ -138,6 +252,108 @@ typedef struct {
   uint32 Bank; /**< \brief EEPROM bank number to write-disable */
 } MM_EepromWriteDisCmd_Payload_t;
 
+/**
+ *  \brief Set CPU Budget Command Payload
+ */
+typedef struct {
+  uint32 CpuBudget; /**< \brief Microseconds of CPU time a load, dump, or
+                         fill may use before giving up the CPU */
+} MM_SetCpuBudgetCmd_Payload_t;
+
+/**
+ *  \brief Set Dump CRC Type Command Payload
+ */
+typedef struct {
+  MM_CrcType_Enum_t CrcType; /**< \brief CRC type for later dump files */
+  uint8 Padding[3];          /**< \brief Structure padding           */
+} MM_SetDumpCrcTypeCmd_Payload_t;
+
+/**
+ *  \brief Memory Test Command Payload
+ */
+typedef struct {
+  MM_MemType_Enum_t MemType;   /**< \brief Memory type to test           */
+  MM_MemSize_t NumOfBytes;     /**< \brief Number of bytes to test       */
+  uint8 Patterns;              /**< \brief Patterns to run, a mask of
+                                    #MM_MemTestPattern_Enum_t values    */
+  uint8 Padding[7];            /**< \brief Structure padding             */
+  MM_SymAddr_t TestSymAddress; /**< \brief Symbol plus optional offset   */
+} MM_MemTestCmd_Payload_t;
+
+/**
+ *  \brief Batch Peek Command Payload
+ */
+typedef struct {
+  uint32 NumEntries; /**< \brief Number of valid entries in Entries */
+  uint8 Padding[4];  /**< \brief Structure padding */
+  MM_PeekCmd_Payload_t Entries[MM_INTERFACE_MAX_BATCH_PEEK_ENTRIES]; /**<
+                          \brief Addresses to read */
+} MM_BatchPeekCmd_Payload_t;
+
+/**
+ *  \brief Batch Poke Command Payload
+ */
+typedef struct {
+  uint32 NumEntries; /**< \brief Number of valid entries in Entries */
+  uint8 Padding[4];  /**< \brief Structure padding */
+  MM_PokeCmd_Payload_t Entries[MM_INTERFACE_MAX_BATCH_POKE_ENTRIES]; /**<
+                          \brief Addresses and data to write, in order */
+} MM_BatchPokeCmd_Payload_t;
+
+/**
+ *  \brief Set Watch Entry Command Payload
+ */
+typedef struct {
+  uint8 EntryNum;             /**< \brief Watch entry number */
+  uint8 Padding;              /**< \brief Structure padding */
+  uint16 Padding2;            /**< \brief Structure padding */
+  MM_MemType_Enum_t MemType;  /**< \brief Memory type to sample */
+  MM_MemSize_t DataSize;      /**< \brief Size of the data to read in bits */
+  uint32 Padding3;            /**< \brief Structure padding */
+  MM_SymAddr_t SrcSymAddress; /**< \brief Symbol plus optional offset */
+} MM_SetWatchEntryCmd_Payload_t;
+
+/**
+ *  \brief Clear Watch Entry Command Payload
+ */
+typedef struct {
+  uint8 EntryNum;  /**< \brief Watch entry number */
+  uint8 Padding;   /**< \brief Structure padding */
+  uint16 Padding2; /**< \brief Structure padding */
+} MM_ClearWatchEntryCmd_Payload_t;
+
+/**
+ *  \brief Set Sample Period Command Payload
+ */
+typedef struct {
+  uint32 Period; /**< \brief Housekeeping requests between samples of the
+                      watch list, zero stops the sampler */
+} MM_SetSamplePeriodCmd_Payload_t;
+
+/**
+ *  \brief Masked Poke Command Payload
+ */
+typedef struct {
+  MM_MemSize_t DataSize;       /**< \brief Size of the data to be written */
+  MM_MemType_Enum_t MemType;   /**< \brief Memory type to poke data to */
+  uint32 Data;                 /**< \brief Data to be written */
+  uint32 Mask;                 /**< \brief Bits of Data to write, the other
+                                    bits keep their current value */
+  MM_SymAddr_t DestSymAddress; /**< \brief Symbolic destination poke address */
+} MM_MaskedPokeCmd_Payload_t;
+
+/**
+ *  \brief Conditional Poke Command Payload
+ */
+typedef struct {
+  MM_MemSize_t DataSize;       /**< \brief Size of the data to be written */
+  MM_MemType_Enum_t MemType;   /**< \brief Memory type to poke data to */
+  uint32 Expected;             /**< \brief Value the address must hold for
+                                    Data to be written */
+  uint32 Data;                 /**< \brief Data to be written */
+  MM_SymAddr_t DestSymAddress; /**< \brief Symbolic destination poke address */
+} MM_ConditionalPokeCmd_Payload_t;
+
 /**
  *  \brief Housekeeping Packet Payload Structure
  */
@@ -145,18 +361,131 @@ typedef struct {
   uint8 CmdCounter;          /**< \brief MM Application Command Counter */
   uint8 ErrCounter;          /**< \brief MM Application Command Error Counter */
   uint8 LastAction;          /**< \brief Last command action executed */
-  uint8 Padding;             /**< \brief Last command action executed */
+  MM_CrcType_Enum_t DumpCrcType; /**< \brief CRC type for dump files */
   MM_MemType_Enum_t MemType; /**< \brief Memory type for last command */
   MM_MemAddress_t
       Address;      /**< \brief Fully resolved address used for last command */
-  uint32 DataValue; /**< \brief Last command data (fill pattern or peek/poke
-                       value) */
+  uint32 DataValue; /**< \brief Last command data (fill pattern, peek/poke
+                       value, or memory checksum) */
   MM_MemSize_t BytesProcessed; /**< \brief Bytes processed for last command */
   char FileName[CFE_MISSION_MAX_PATH_LEN]; /**< \brief Name of the data file
                                               used for last command, where
                                               applicable */
+  uint32 CpuBudget; /**< \brief Load, dump, and fill CPU time budget in
+                         microseconds */
+  uint32 EepromBytesWritten; /**< \brief EEPROM bytes that differed and were
+                                  written */
+  uint32 EepromBytesSkipped; /**< \brief EEPROM bytes that already held the
+                                  new data and were not written */
+  uint32 ScrubMismatches; /**< \brief Scrub passes that didn't match the
+                               golden CRC */
+  MM_ScrubStatus_Enum_t
+      ScrubStatus[MM_INTERFACE_MAX_SCRUB_REGIONS]; /**< \brief Status of each
+                                                      scrub region */
 } MM_HkTlm_Payload_t;
 
+/**
+ *  \brief Dump Telemetry Packet Payload Structure
+ */
+typedef struct {
+  MM_MemAddress_t Address;     /**< \brief Address of the first data byte */
+  MM_MemType_Enum_t MemType;   /**< \brief Memory type dumped */
+  uint32 Sequence;             /**< \brief Packet sequence number, zero for the
+                                    first packet of each dump */
+  MM_MemSize_t BytesRemaining; /**< \brief Dump bytes still to be sent after
+                                    this packet, zero for the last packet */
+  uint32 NumOfBytes;           /**< \brief Number of valid data bytes */
+  uint32 Crc;                  /**< \brief CRC of the valid data bytes */
+  uint8 Data[MM_INTERFACE_MAX_DUMP_TLM_DATA]; /**< \brief Dump data */
+} MM_DumpTlm_Payload_t;
+
+/**
+ *  \brief Dump In Telemetry Packet Payload Structure
+ */
+typedef struct {
+  MM_MemAddress_t Address;   /**< \brief Address of the first data byte */
+  MM_MemType_Enum_t MemType; /**< \brief Memory type dumped */
+  uint8 Padding[3];          /**< \brief Structure padding */
+  uint32 NumOfBytes;         /**< \brief Number of valid data bytes */
+  uint8 Data[MM_INTERFACE_MAX_DUMP_TLM_DATA]; /**< \brief Dump data */
+} MM_DumpInTlm_Payload_t;
+
+/**
+ *  \brief Scrub Index Packet Payload Structure
+ */
+typedef struct {
+  MM_MemAddress_t Address;   /**< \brief Address of the scrub region */
+  uint8 RegionNum;           /**< \brief Scrub region number */
+  MM_MemType_Enum_t MemType; /**< \brief Memory type of the scrub region */
+  uint16 NumReported;        /**< \brief Number of valid entries in
+                                  BlockIndex */
+  uint32 BlockSize;          /**< \brief Bytes covered by each block, the
+                                  last block may be shorter */
+  uint32 NumBlocks;          /**< \brief Number of blocks in the index */
+  uint32 NumMismatches;      /**< \brief Number of blocks that didn't match
+                                  the index */
+  uint32 IndexRoot;          /**< \brief Root CRC of the block index */
+  uint32 CalculatedRoot;     /**< \brief Root CRC of the blocks as they are
+                                  in memory now */
+  uint16 BlockIndex[MM_INTERFACE_MAX_SCRUB_MISMATCH_BLOCKS]; /**< \brief
+                                  Indices of the first mismatching blocks */
+} MM_ScrubIndexTlm_Payload_t;
+
+/**
+ *  \brief Memory Test Failure
+ */
+typedef struct {
+  MM_MemAddress_t Address; /**< \brief Address of the failing word */
+  uint32 Expected;         /**< \brief Value written to the word */
+  uint32 Actual;           /**< \brief Value read back from the word */
+} MM_MemTestFailure_t;
+
+/**
+ *  \brief Memory Test Packet Payload Structure
+ */
+typedef struct {
+  MM_MemAddress_t Address;   /**< \brief Address of the tested region */
+  MM_MemType_Enum_t MemType; /**< \brief Memory type of the tested region */
+  uint32 NumOfBytes;         /**< \brief Number of bytes tested */
+  uint32 NumFailures;        /**< \brief Number of reads that didn't return
+                                  the value written */
+  uint8 Patterns;            /**< \brief Patterns that were run */
+  uint8 FailedPatterns;      /**< \brief Patterns that found a failure */
+  uint16 NumReported;        /**< \brief Number of valid entries in
+                                  Failures */
+  MM_MemTestFailure_t Failures[MM_INTERFACE_MAX_MEM_TEST_FAILURES]; /**<
+                                  \brief The first failing reads */
+} MM_MemTestTlm_Payload_t;
+
+/**
+ *  \brief Batch Peek Result
+ */
+typedef struct {
+  MM_MemAddress_t Address; /**< \brief Fully resolved address read */
+  MM_MemSize_t DataSize;   /**< \brief Size of the data read in bits */
+  uint32 DataValue;        /**< \brief Value read */
+} MM_BatchPeekResult_t;
+
+/**
+ *  \brief Batch Peek Packet Payload Structure
+ */
+typedef struct {
+  uint32 NumEntries; /**< \brief Number of valid entries in Results */
+  uint8 Padding[4];  /**< \brief Structure padding */
+  MM_BatchPeekResult_t Results[MM_INTERFACE_MAX_BATCH_PEEK_ENTRIES]; /**<
+                          \brief Values read, in command entry order */
+} MM_BatchPeekTlm_Payload_t;
+
+/**
+ *  \brief Watch Packet Payload Structure
+ */
+typedef struct {
+  uint32 Sequence;  /**< \brief Sample number, counts up from zero */
+  uint32 ValidMask; /**< \brief Bit N is set when Values[N] was read */
+  uint32 Values[MM_INTERFACE_MAX_WATCH_ENTRIES]; /**< \brief Value of each
+                                                    watch entry */
+} MM_WatchTlm_Payload_t;
+
 #endif /* DEFAULT_MM_MSGDEFS_H */
 
 /**\}*/
\ No newline at end of file
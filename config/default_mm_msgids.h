@@ -50,6 +50,12 @@
  */
 
 #define MM_HK_TLM_MID MM_TLM_PLATFORM_MIDVAL(HK_TLM)
+#define MM_DUMP_TLM_MID MM_TLM_PLATFORM_MIDVAL(DUMP_TLM)
+#define MM_DUMP_INTLM_MID MM_TLM_PLATFORM_MIDVAL(DUMP_INTLM)
+#define MM_SCRUB_INDEX_TLM_MID MM_TLM_PLATFORM_MIDVAL(SCRUB_INDEX_TLM)
+#define MM_MEM_TEST_TLM_MID MM_TLM_PLATFORM_MIDVAL(MEM_TEST_TLM)
+#define MM_BATCH_PEEK_TLM_MID MM_TLM_PLATFORM_MIDVAL(BATCH_PEEK_TLM)
+#define MM_WATCH_TLM_MID MM_TLM_PLATFORM_MIDVAL(WATCH_TLM)
 
 #endif /* DEFAULT_MM_MSGIDS_H */
 
@@ -163,6 +163,234 @@ typedef struct {
   MM_EepromWriteDisCmd_Payload_t Payload;
 } MM_EepromWriteDisCmd_t;
 
+/**
+ *  \brief Set CPU Budget Command
+ *
+ *  For command details see #MM_SET_CPU_BUDGET_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_SetCpuBudgetCmd_Payload_t Payload;
+} MM_SetCpuBudgetCmd_t;
+
+/**
+ *  \brief Dump Memory To Compressed File Command
+ *
+ *  For command details see #MM_DUMP_MEM_TO_COMPRESSED_FILE_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_DumpMemToFileCmd_Payload_t Payload;
+} MM_DumpMemToCompressedFileCmd_t;
+
+/**
+ *  \brief Dump Regions To File Command
+ *
+ *  For command details see #MM_DUMP_REGIONS_TO_FILE_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_DumpRegionsToFileCmd_Payload_t Payload;
+} MM_DumpRegionsToFileCmd_t;
+
+/**
+ *  \brief Dump Memory To Telemetry Command
+ *
+ *  For command details see #MM_DUMP_MEM_TO_TLM_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_DumpMemToTlmCmd_Payload_t Payload;
+} MM_DumpMemToTlmCmd_t;
+
+/**
+ *  \brief Dump In Telemetry Command
+ *
+ *  For command details see #MM_DUMP_IN_TLM_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_DumpInTlmCmd_Payload_t Payload;
+} MM_DumpInTlmCmd_t;
+
+/**
+ *  \brief Load Begin Command
+ *
+ *  For command details see #MM_LOAD_BEGIN_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_LoadBeginCmd_Payload_t Payload;
+} MM_LoadBeginCmd_t;
+
+/**
+ *  \brief Load Data Command
+ *
+ *  For command details see #MM_LOAD_DATA_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_LoadDataCmd_Payload_t Payload;
+} MM_LoadDataCmd_t;
+
+/**
+ *  \brief Load Commit Command
+ *
+ *  For command details see #MM_LOAD_COMMIT_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} MM_LoadCommitCmd_t;
+
+/**
+ *  \brief Load RAM Commit Command
+ *
+ *  For command details see #MM_LOAD_RAM_COMMIT_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} MM_LoadRAMCommitCmd_t;
+
+/**
+ *  \brief Memory Checksum Command
+ *
+ *  For command details see #MM_CHECKSUM_MEM_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_ChecksumMemCmd_Payload_t Payload;
+} MM_ChecksumMemCmd_t;
+
+/**
+ *  \brief Set Scrub Region Command
+ *
+ *  For command details see #MM_SET_SCRUB_REGION_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_SetScrubRegionCmd_Payload_t Payload;
+} MM_SetScrubRegionCmd_t;
+
+/**
+ *  \brief Clear Scrub Region Command
+ *
+ *  For command details see #MM_CLEAR_SCRUB_REGION_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_ClearScrubRegionCmd_Payload_t Payload;
+} MM_ClearScrubRegionCmd_t;
+
+/**
+ *  \brief Build Scrub Index Command
+ *
+ *  For command details see #MM_BUILD_SCRUB_INDEX_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_BuildScrubIndexCmd_Payload_t Payload;
+} MM_BuildScrubIndexCmd_t;
+
+/**
+ *  \brief Compare Scrub Index Command
+ *
+ *  For command details see #MM_COMPARE_SCRUB_INDEX_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_CompareScrubIndexCmd_Payload_t Payload;
+} MM_CompareScrubIndexCmd_t;
+
+/**
+ *  \brief Set Dump CRC Type Command
+ *
+ *  For command details see #MM_SET_DUMP_CRC_TYPE_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_SetDumpCrcTypeCmd_Payload_t Payload;
+} MM_SetDumpCrcTypeCmd_t;
+
+/**
+ *  \brief Memory Test Command
+ *
+ *  For command details see #MM_MEM_TEST_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_MemTestCmd_Payload_t Payload;
+} MM_MemTestCmd_t;
+
+/**
+ *  \brief Batch Peek Command
+ *
+ *  For command details see #MM_BATCH_PEEK_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_BatchPeekCmd_Payload_t Payload;
+} MM_BatchPeekCmd_t;
+
+/**
+ *  \brief Batch Poke Command
+ *
+ *  For command details see #MM_BATCH_POKE_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_BatchPokeCmd_Payload_t Payload;
+} MM_BatchPokeCmd_t;
+
+/**
+ *  \brief Set Watch Entry Command
+ *
+ *  For command details see #MM_SET_WATCH_ENTRY_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_SetWatchEntryCmd_Payload_t Payload;
+} MM_SetWatchEntryCmd_t;
+
+/**
+ *  \brief Clear Watch Entry Command
+ *
+ *  For command details see #MM_CLEAR_WATCH_ENTRY_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_ClearWatchEntryCmd_Payload_t Payload;
+} MM_ClearWatchEntryCmd_t;
+
+/**
+ *  \brief Set Sample Period Command
+ *
+ *  For command details see #MM_SET_SAMPLE_PERIOD_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_SetSamplePeriodCmd_Payload_t Payload;
+} MM_SetSamplePeriodCmd_t;
+
+/**
+ *  \brief Masked Poke Command
+ *
+ *  For command details see #MM_MASKED_POKE_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_MaskedPokeCmd_Payload_t Payload;
+} MM_MaskedPokeCmd_t;
+
+/**
+ *  \brief Conditional Poke Command
+ *
+ *  For command details see #MM_CONDITIONAL_POKE_CC
+ */
+typedef struct {
+  CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+  MM_ConditionalPokeCmd_Payload_t Payload;
+} MM_ConditionalPokeCmd_t;
+
 /**
  *  \brief Housekeeping Packet Structure
  */
@@ -171,6 +399,54 @@ typedef struct {
   MM_HkTlm_Payload_t Payload;
 } MM_HkTlm_t;
 
+/**
+ *  \brief Dump Telemetry Packet Structure
+ */
+typedef struct {
+  CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry header */
+  MM_DumpTlm_Payload_t Payload;
+} MM_DumpTlm_t;
+
+/**
+ *  \brief Dump In Telemetry Packet Structure
+ */
+typedef struct {
+  CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry header */
+  MM_DumpInTlm_Payload_t Payload;
+} MM_DumpInTlm_t;
+
+/**
+ *  \brief Scrub Index Packet Structure
+ */
+typedef struct {
+  CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry header */
+  MM_ScrubIndexTlm_Payload_t Payload;
+} MM_ScrubIndexTlm_t;
+
+/**
+ *  \brief Memory Test Packet Structure
+ */
+typedef struct {
+  CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry header */
+  MM_MemTestTlm_Payload_t Payload;
+} MM_MemTestTlm_t;
+
+/**
+ *  \brief Batch Peek Packet Structure
+ */
+typedef struct {
+  CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry header */
+  MM_BatchPeekTlm_Payload_t Payload;
+} MM_BatchPeekTlm_t;
+
+/**
+ *  \brief Watch Packet Structure
+ */
+typedef struct {
+  CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry header */
+  MM_WatchTlm_Payload_t Payload;
+} MM_WatchTlm_t;
+
 /**
  * \brief Housekeeping Request Command
  */
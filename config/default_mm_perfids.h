@@ -31,5 +31,10 @@
 #define MM_EEPROM_FILELOAD_PERF_ID                                             \
   33                              /**< \brief EEPROM file load performance ID */
 #define MM_EEPROM_FILL_PERF_ID 34 /**< \brief EEPROM fill performance ID */
+#define MM_WORKER_PERF_ID 35      /**< \brief Worker task job performance ID */
+#define MM_SCRUB_PERF_ID 36       /**< \brief Background scrub performance ID */
+#define MM_FILE_CRC_PERF_ID 37    /**< \brief File CRC performance ID */
+#define MM_MEM_TEST_PERF_ID 38    /**< \brief Memory test performance ID */
+#define MM_SAMPLER_PERF_ID 39     /**< \brief Peek sampler performance ID */
 
 #endif /* DEFAULT_MM_PERFIDS_H */
\ No newline at end of file
@@ -696,7 +696,8 @@
  *  This event message is issued when a call to one of the CFE_PSP_MemWrite
  * functions
  *  (#CFE_PSP_MemWrite8, #CFE_PSP_MemWrite16, #CFE_PSP_MemWrite32) returns
- * something other than CFE_PSP_SUCCESS.
+ * something other than CFE_PSP_SUCCESS. The batch, masked, and conditional
+ * poke commands also issue it when an EEPROM write fails.
  */
 #define MM_PSP_WRITE_ERR_EID 57
 
@@ -760,6 +761,571 @@
  */
 #define MM_FILL_MEM16_ALIGN_WARN_INF_EID 64
 
+/**
+ * \brief MM Worker Task Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the command mutex, the worker job
+ *  queue, or the worker child task can't be created during application
+ *  initialization, or when the worker task can't read its job queue and
+ *  exits.
+ */
+#define MM_WORKER_ERR_EID 65
+
+/**
+ * \brief MM Worker Job Queue Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a load, dump, or fill command can't
+ *  be handed to the worker task, typically because the job queue is full.
+ */
+#define MM_WORKER_QUEUE_ERR_EID 66
+
+/**
+ * \brief MM Set CPU Budget Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued upon successful processing of the set CPU
+ *  budget command.
+ */
+#define MM_CPU_BUDGET_INF_EID 67
+
+/**
+ * \brief MM Set CPU Budget Command Out Of Range Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the set CPU budget command requests a
+ *  budget greater than #MM_INTERNAL_MAX_CPU_BUDGET.
+ */
+#define MM_CPU_BUDGET_ERR_EID 68
+
+/**
+ * \brief MM Load File Too Large To Stage Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a load file that must be staged, such
+ *  as a patch load file, has more than #MM_INTERNAL_MAX_STAGED_LOAD_BYTES
+ *  load bytes.
+ */
+#define MM_STAGE_SIZE_ERR_EID 69
+
+/**
+ * \brief MM Patch Load File Run Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a patch load file has no runs, a run
+ *  that extends past the end of the file, a zero length run, or a run that
+ *  fails the load parameter checks. No memory is written.
+ */
+#define MM_PATCH_RUN_ERR_EID 70
+
+/**
+ * \brief MM Compressed Load File Ended Early Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a compressed load file can't be read
+ *  or ends before the number of load bytes in its header has been
+ *  decompressed.
+ */
+#define MM_DECOMPRESS_ERR_EID 71
+
+/**
+ * \brief MM Compressed Dump Memory Type Not Supported Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a dump to compressed file command
+ *  specifies a memory type other than RAM or EEPROM.
+ */
+#define MM_COMPRESS_MEMTYPE_ERR_EID 72
+
+/**
+ * \brief MM Region File Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a region load file has a directory
+ *  with no entries, a partial entry, or more than
+ *  #MM_INTERNAL_MAX_FILE_REGIONS entries, when a region fails the load
+ *  parameter checks or its CRC check, or when the regions together have
+ *  more than #MM_INTERNAL_MAX_STAGED_LOAD_BYTES data bytes. No memory is
+ *  written.
+ *
+ *  This event message is also issued when a dump regions to file command
+ *  specifies no regions, more than #MM_INTERFACE_MAX_DUMP_REGIONS regions,
+ *  or a region that fails the dump parameter checks. No file is written.
+ */
+#define MM_REGION_ERR_EID 73
+
+/**
+ * \brief MM Dump To Telemetry Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a dump memory to telemetry command has
+ *  been accepted. The dump telemetry packets are sent on the following
+ *  housekeeping requests.
+ */
+#define MM_DUMP_TLM_INF_EID 74
+
+/**
+ * \brief MM Dump To Telemetry Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a dump memory to telemetry command is
+ *  received while another dump to telemetry is still in progress, or when
+ *  a memory read error ends a dump to telemetry early.
+ */
+#define MM_DUMP_TLM_ERR_EID 75
+
+/**
+ * \brief MM Dump In Telemetry Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued after a dump in telemetry command has
+ *  sent its dump in telemetry packet.
+ */
+#define MM_DUMP_INTLM_DBG_EID 76
+
+/**
+ * \brief MM Load Begin Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a load begin command has started a
+ *  chunked load.
+ */
+#define MM_LOAD_BEGIN_INF_EID 77
+
+/**
+ * \brief MM Load Data Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a load data command chunk has been
+ *  stored in the chunked load buffer.
+ */
+#define MM_LOAD_DATA_DBG_EID 78
+
+/**
+ * \brief MM Load Commit Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a load commit command has written
+ *  the chunked load data to memory.
+ */
+#define MM_LOAD_COMMIT_INF_EID 79
+
+/**
+ * \brief MM Chunked Load Command Rejected Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a load begin command asks for more
+ *  than #MM_INTERNAL_MAX_CHUNK_LOAD_BYTES bytes, when a load data command
+ *  chunk does not fit in the chunked load, when a load data or load
+ *  commit command is received while no chunked load is in progress, or
+ *  when a load begin or load data command is received while a load commit
+ *  is still waiting for the worker task.
+ */
+#define MM_LOAD_CHUNK_ERR_EID 80
+
+/**
+ * \brief MM Chunked Load CRC Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the CRC of the reassembled chunked
+ *  load data does not match the CRC given in the load begin command. No
+ *  memory is written and the chunked load stays open so missing chunks
+ *  can be sent again.
+ */
+#define MM_LOAD_COMMIT_CRC_ERR_EID 81
+
+/**
+ * \brief MM Load RAM Commit Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a load RAM commit command has
+ *  written the chunked load data to memory. The event reports how long
+ *  the copy took.
+ */
+#define MM_LOAD_RAM_COMMIT_INF_EID 82
+
+/**
+ * \brief MM Load RAM Commit Command Rejected Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a load RAM commit command is
+ *  received for a chunked load that isn't a RAM load or that has more
+ *  than #MM_INTERNAL_MAX_RAM_COMMIT_BYTES bytes.
+ */
+#define MM_LOAD_RAM_COMMIT_ERR_EID 83
+
+/**
+ * \brief MM Checksum Memory Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a checksum memory command has
+ *  computed the CRC of the requested memory range.
+ */
+#define MM_CHECKSUM_MEM_INF_EID 84
+
+/**
+ * \brief MM Scrub Region Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a set scrub region or clear scrub
+ *  region command has been executed.
+ */
+#define MM_SCRUB_REGION_INF_EID 85
+
+/**
+ * \brief MM Scrub Region Number Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a scrub region or scrub index
+ *  command specifies a region number that is not less than
+ *  #MM_INTERFACE_MAX_SCRUB_REGIONS.
+ */
+#define MM_SCRUB_REGION_ERR_EID 86
+
+/**
+ * \brief MM Scrub CRC Mismatch Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the background scrubber finds that
+ *  the CRC of a scrub region no longer matches its golden CRC. It is
+ *  issued once each time the region status changes to
+ *  #MM_ScrubStatus_BAD.
+ */
+#define MM_SCRUB_MISMATCH_ERR_EID 87
+
+/**
+ * \brief MM Scrub CRC Match Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the CRC of a scrub region that had
+ *  a mismatch or read error matches its golden CRC again.
+ */
+#define MM_SCRUB_MATCH_INF_EID 88
+
+/**
+ * \brief MM Build Scrub Index Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a build scrub index command has been
+ *  executed.
+ */
+#define MM_SCRUB_INDEX_INF_EID 89
+
+/**
+ * \brief MM Scrub Index Unavailable Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a build scrub index command
+ *  specifies a scrub region that is not defined, or a compare scrub index
+ *  command specifies a region without a block index or whose block index
+ *  no longer matches its root CRC.
+ */
+#define MM_SCRUB_INDEX_ERR_EID 90
+
+/**
+ * \brief MM Compare Scrub Index Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a compare scrub index command has
+ *  been executed and the scrub index packet has been sent.
+ */
+#define MM_SCRUB_COMPARE_INF_EID 91
+
+/**
+ * \brief MM Set Dump CRC Type Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued upon successful processing of a set dump
+ *  CRC type command.
+ */
+#define MM_DUMP_CRC_TYPE_INF_EID 92
+
+/**
+ * \brief MM Set Dump CRC Type Command Invalid Type Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the set dump CRC type command
+ *  requests a CRC type greater than #MM_CRC_MAX_FILE_TYPE.
+ */
+#define MM_DUMP_CRC_TYPE_ERR_EID 93
+
+/**
+ * \brief MM Load File CRC Type Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the MM secondary header of a load
+ *  file holds a CRC type greater than #MM_CRC_MAX_FILE_TYPE.
+ */
+#define MM_FILE_CRC_TYPE_ERR_EID 94
+
+/**
+ * \brief MM Fill Pattern Size Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a fill memory command pattern size
+ *  is not zero and doesn't divide #MM_FILL_MAX_PATTERN_SIZE.
+ */
+#define MM_FILL_PATTERN_ERR_EID 95
+
+/**
+ * \brief MM Memory Test Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a memory test command completes,
+ *  whether or not the test found failures. The number of failing reads
+ *  is included in the message.
+ */
+#define MM_MEM_TEST_INF_EID 96
+
+/**
+ * \brief MM Memory Test Command Invalid Parameter Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a memory test command selects no
+ *  pattern or an unknown pattern, or asks to test EEPROM.
+ */
+#define MM_MEM_TEST_ERR_EID 97
+
+/**
+ * \brief MM Batch Peek Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a batch peek command has read all
+ *  of its entries and sent the batch peek packet.
+ */
+#define MM_BATCH_PEEK_INF_EID 98
+
+/**
+ * \brief MM Batch Peek Command Invalid Entry Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a batch peek command has no entries
+ *  or more than #MM_INTERFACE_MAX_BATCH_PEEK_ENTRIES entries, or when one
+ *  of its entries fails the peek parameter checks. No entry is read.
+ */
+#define MM_BATCH_PEEK_ERR_EID 99
+
+/**
+ * \brief MM Batch Poke Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a batch poke command has written all
+ *  of its entries.
+ */
+#define MM_BATCH_POKE_INF_EID 100
+
+/**
+ * \brief MM Batch Poke Command Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a batch poke command has no entries
+ *  or more than #MM_INTERFACE_MAX_BATCH_POKE_ENTRIES entries, when one of
+ *  its entries fails the poke parameter checks, or after the entries
+ *  already written have been restored because a write failed.
+ */
+#define MM_BATCH_POKE_ERR_EID 101
+
+/**
+ * \brief MM Set or Clear Watch Entry Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a watch list entry has been set or
+ *  cleared.
+ */
+#define MM_WATCH_ENTRY_INF_EID 102
+
+/**
+ * \brief MM Watch Entry Number Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a set or clear watch entry command
+ *  specifies an entry number that is not less than
+ *  #MM_INTERFACE_MAX_WATCH_ENTRIES.
+ */
+#define MM_WATCH_ENTRY_ERR_EID 103
+
+/**
+ * \brief MM Set Sample Period Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the peek sampler period has been
+ *  set.
+ */
+#define MM_SAMPLE_PERIOD_INF_EID 104
+
+/**
+ * \brief MM Masked Poke Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a masked poke command has written
+ *  the masked bits of its data into the current value of the address.
+ */
+#define MM_MASKED_POKE_INF_EID 105
+
+/**
+ * \brief MM Conditional Poke Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a conditional poke command
+ *  found the expected value at the address and wrote its data.
+ */
+#define MM_COND_POKE_INF_EID 106
+
+/**
+ * \brief MM Conditional Poke Mismatch Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a conditional poke command
+ *  found a value other than the expected one at the address. Nothing is
+ *  written.
+ */
+#define MM_COND_POKE_ERR_EID 107
+
+/**
+ * \brief MM Direct Load Incomplete Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a read fails part way through a load
+ *  memory from file command that reads the file straight into the
+ *  destination (see #MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD). The load data
+ *  before the failed read, and possibly part of the failed segment, has
+ *  already been written, so the destination is partly loaded.
+ */
+#define MM_DIRECT_LOAD_ERR_EID 108
+
 /**\}*/
 
 #endif
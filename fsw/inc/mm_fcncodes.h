@@ -79,6 +79,9 @@
  *       the following telemetry:
  *       - #MM_HkTlm_Payload_t.CmdCounter will be cleared
  *       - #MM_HkTlm_Payload_t.ErrCounter will be cleared
+ *       - #MM_HkTlm_Payload_t.EepromBytesWritten will be cleared
+ *       - #MM_HkTlm_Payload_t.EepromBytesSkipped will be cleared
+ *       - #MM_HkTlm_Payload_t.ScrubMismatches will be cleared
  *       - The #MM_RESET_INF_EID informational event message will be
  *         generated when the command is executed
  *
@@ -290,6 +293,48 @@
  *       Reprograms processor memory with the data contained within the given
  *       input file
  *
+ *       Load files with no more than #MM_INTERNAL_MAX_STAGED_LOAD_BYTES data
+ *       bytes are staged: the file data is read once, the CRC is computed as
+ *       it is read, and memory is only written once the CRC matches.
+ *       Larger RAM and EEPROM loads are read straight into the destination
+ *       after the CRC has been verified when
+ *       #MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD is defined. The file size is
+ *       checked again before the first write, but a read error during a
+ *       direct load leaves memory partly loaded and is reported with
+ *       #MM_DIRECT_LOAD_ERR_EID.
+ *
+ *       A patch load file (cFE file header sub-type
+ *       #MM_INTERNAL_CFE_HDR_PATCH_SUBTYPE) holds a list of
+ *       #MM_PatchRunHeader_t runs relative to the load address instead of
+ *       one contiguous image. Patch load files are always staged, every run
+ *       is checked before any memory is written, and only the runs are
+ *       loaded.
+ *
+ *       A compressed load file (cFE file header sub-type
+ *       #MM_INTERNAL_CFE_HDR_COMPRESSED_SUBTYPE) holds run-length encoded
+ *       data, such as a file written by #MM_DUMP_MEM_TO_COMPRESSED_FILE_CC.
+ *       The MM file header byte count and CRC describe the decompressed
+ *       data. Compressed load files are never staged, the data is
+ *       decompressed one segment at a time to verify the CRC and again to
+ *       load memory. The compressed size must be possible for the byte
+ *       count, and the last record must end exactly at the end of the load
+ *       data and of the file.
+ *
+ *       A region load file (cFE file header sub-type
+ *       #MM_INTERNAL_CFE_HDR_REGION_SUBTYPE) holds a directory of up to
+ *       #MM_INTERNAL_MAX_FILE_REGIONS regions, each with its own address,
+ *       memory type, size, and CRC, followed by the data of each region.
+ *       The file size is checked against the directory before any region
+ *       data is read. The directory and all of the region data are read
+ *       once, in order,
+ *       into the staging buffer and every region is checked before any
+ *       memory is written. For a region load file the housekeeping memory
+ *       type and address are those of the first region and the byte count
+ *       is the total of all regions.
+ *
+ *       The command is executed by the MM worker task. Telemetry and
+ *       events for the command are generated when the worker completes it.
+ *
  *  \par Command Structure
  *       #MM_LoadMemFromFileCmd_t
  *
@@ -311,6 +356,7 @@
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
+ *       - The worker task job queue is full
  *       - Command specified filename is invalid
  *       - #OS_OpenCreate call fails
  *       - #OS_close call fails
@@ -324,10 +370,18 @@
  *       - The specified data size is invalid
  *       - The address and data size are not properly aligned
  *       - The specified memory type is invalid
+ *       - A PSP write of staged data fails
+ *       - A patch load file is too large to stage
+ *       - A patch load file has no runs or a malformed run
+ *       - A compressed load file ends before all of its data is decompressed
+ *       - A region load file directory is invalid, or a region fails its
+ *         parameter or CRC check, or the regions are too large to stage
+ *       - A region load file size doesn't match its directory
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #MM_HkTlm_Payload_t.ErrCounter will increment
  *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_WORKER_QUEUE_ERR_EID
  *       - Error specific event message #MM_OS_OPEN_ERR_EID
  *       - Error specific event message #MM_OS_CLOSE_ERR_EID
  *       - Error specific event message #MM_OS_READ_EXP_ERR_EID
@@ -335,13 +389,19 @@
  *       - Error specific event message #MM_LOAD_FILE_CRC_ERR_EID
  *       - Error specific event message #MM_SYMNAME_ERR_EID
  *       - Error specific event message #MM_FILE_LOAD_PARAMS_ERR_EID
+ *       - Error specific event message #MM_STAGE_SIZE_ERR_EID
+ *       - Error specific event message #MM_PATCH_RUN_ERR_EID
+ *       - Error specific event message #MM_DECOMPRESS_ERR_EID
+ *       - Error specific event message #MM_REGION_ERR_EID
  *       - Error specific event message #MM_CFE_FS_READHDR_ERR_EID
  *       - Error specific event message #MM_OS_READ_ERR_EID
+ *       - Error specific event message #MM_DIRECT_LOAD_ERR_EID
  *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
  *       - Error specific event message #MM_DATA_SIZE_BYTES_ERR_EID
  *       - Error specific event message #MM_ALIGN32_ERR_EID
  *       - Error specific event message #MM_ALIGN16_ERR_EID
  *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *       - Error specific event message #MM_PSP_WRITE_ERR_EID
  *
  *  \par Criticality
  *       It is the responsibility of the user to verify the  contents of the
@@ -368,6 +428,12 @@
  *       Dumps the input number of bytes from processor memory
  *       to a file
  *
+ *       The file header CRC is computed from the data as it is dumped, so
+ *       the dump file is never read back.
+ *
+ *       The command is executed by the MM worker task. Telemetry and
+ *       events for the command are generated when the worker completes it.
+ *
  *  \par Command Structure
  *       #MM_DumpMemToFileCmd_t
  *
@@ -389,6 +455,7 @@
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
+ *       - The worker task job queue is full
  *       - Command specified filename is invalid
  *       - A symbol name was specified that can't be resolved
  *       - #OS_OpenCreate call fails
@@ -396,7 +463,6 @@
  *       - #OS_close call fails
  *       - #OS_write doesn't write the expected number of bytes
  *         or returns an error code
- *       - The #MM_ComputeCRCFromFile call fails
  *       - The address range fails validation check
  *       - The specified data size is invalid
  *       - The address and data size are not properly aligned
@@ -405,12 +471,13 @@
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #MM_HkTlm_Payload_t.ErrCounter will increment
  *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_WORKER_QUEUE_ERR_EID
  *       - Error specific event message #MM_SYMNAME_ERR_EID
  *       - Error specific event message #MM_OS_CREAT_ERR_EID
  *       - Error specific event message #MM_CFE_FS_WRITEHDR_ERR_EID
  *       - Error specific event message #MM_OS_CLOSE_ERR_EID
  *       - Error specific event message #MM_OS_WRITE_EXP_ERR_EID
- *       - Error specific event message #MM_COMPUTECRCFROMFILE_ERR_EID
+ *       - Error specific event message #MM_PSP_READ_ERR_EID
  *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
  *       - Error specific event message #MM_DATA_SIZE_BYTES_ERR_EID
  *       - Error specific event message #MM_ALIGN32_ERR_EID
@@ -496,6 +563,13 @@
  *       Reprograms processor memory with the fill pattern contained
  *       within the command message
  *
+ *       The pattern may be 1, 2, 4, or 8 bytes long and repeats across
+ *       the filled memory. A pattern size of zero uses the access width
+ *       of the memory type, which matches the fill of earlier versions.
+ *
+ *       The command is executed by the MM worker task. Telemetry and
+ *       events for the command are generated when the worker completes it.
+ *
  *  \par Command Structure
  *       #MM_FillMemCmd_t
  *
@@ -516,21 +590,25 @@
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
+ *       - The worker task job queue is full
  *       - A symbol name was specified that can't be resolved
  *       - The address range fails validation check
  *       - The specified data size is invalid
  *       - The address and data size are not properly aligned
  *       - The specified memory type is invalid
+ *       - The pattern size is invalid
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #MM_HkTlm_Payload_t.ErrCounter will increment
  *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_WORKER_QUEUE_ERR_EID
  *       - Error specific event message #MM_SYMNAME_ERR_EID
  *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
  *       - Error specific event message #MM_DATA_SIZE_BYTES_ERR_EID
  *       - Error specific event message #MM_ALIGN32_ERR_EID
  *       - Error specific event message #MM_ALIGN16_ERR_EID
  *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *       - Error specific event message #MM_FILL_PATTERN_ERR_EID
  *
  *  \par Criticality
  *       It is the responsibility of the user to verify the
@@ -704,6 +782,1277 @@
  */
 #define MM_EEPROM_WRITE_DIS_CC MM_CCVAL(DISABLE_EEPROM_WRITE)
 
+/**
+ * \brief Set CPU Budget
+ *
+ *  \par Description
+ *       Sets how many microseconds of CPU time load, dump, and fill
+ *       operations may use before the MM worker task gives up the CPU.
+ *       Segments are processed back to back until the budget is spent,
+ *       so a larger budget gives higher throughput at the cost of other
+ *       tasks. A budget of zero gives up the CPU after every segment.
+ *
+ *  \par Command Structure
+ *       #MM_SetCpuBudgetCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.CpuBudget will be set to the commanded budget
+ *       - The #MM_CPU_BUDGET_INF_EID informational event message will
+ *         be generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Budget is greater than #MM_INTERNAL_MAX_CPU_BUDGET
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_CPU_BUDGET_ERR_EID
+ *
+ *  \par Criticality
+ *       A large budget lets MM load, dump, and fill operations starve
+ *       lower priority tasks for up to the budgeted time.
+ */
+#define MM_SET_CPU_BUDGET_CC MM_CCVAL(SET_CPU_BUDGET)
+
+/**
+ * \brief Memory Dump To Compressed File
+ *
+ *  \par Description
+ *       Dumps the input number of bytes from processor memory to a
+ *       run-length encoded file with cFE file header sub-type
+ *       #MM_INTERNAL_CFE_HDR_COMPRESSED_SUBTYPE. Memory is encoded one dump
+ *       segment at a time as it is written, so long runs of repeated bytes
+ *       such as erased or zeroed memory take little file space. The MM file
+ *       header byte count and CRC describe the uncompressed data, so the
+ *       file can be loaded with #MM_LOAD_MEM_FROM_FILE_CC.
+ *
+ *       Only RAM and EEPROM can be dumped to a compressed file.
+ *
+ *       The command is executed by the MM worker task. Telemetry and
+ *       events for the command are generated when the worker completes it.
+ *
+ *  \par Command Structure
+ *       #MM_DumpMemToCompressedFileCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.LastAction will be set to
+ * #MM_LastAction_DUMP_TO_FILE
+ *       - #MM_HkTlm_Payload_t.MemType will be set to the commanded memory type
+ *       - #MM_HkTlm_Payload_t.Address will be set to the fully resolved source
+ * memory address
+ *       - #MM_HkTlm_Payload_t.BytesProcessed will be set to the number of bytes
+ * dumped
+ *       - #MM_HkTlm_Payload_t.FileName will be set to the dump file name
+ *       - The #MM_DMP_MEM_FILE_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The worker task job queue is full
+ *       - Command specified filename is invalid
+ *       - A symbol name was specified that can't be resolved
+ *       - The specified memory type is not RAM or EEPROM
+ *       - #OS_OpenCreate call fails
+ *       - #CFE_FS_WriteHeader call fails
+ *       - #OS_close call fails
+ *       - #OS_write doesn't write the expected number of bytes
+ *         or returns an error code
+ *       - The address range fails validation check
+ *       - The specified data size is invalid
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_WORKER_QUEUE_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_COMPRESS_MEMTYPE_ERR_EID
+ *       - Error specific event message #MM_OS_CREAT_ERR_EID
+ *       - Error specific event message #MM_CFE_FS_WRITEHDR_ERR_EID
+ *       - Error specific event message #MM_OS_CLOSE_ERR_EID
+ *       - Error specific event message #MM_OS_WRITE_EXP_ERR_EID
+ *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
+ *       - Error specific event message #MM_DATA_SIZE_BYTES_ERR_EID
+ *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *
+ *  \par Criticality
+ *       The same cautions as #MM_DUMP_MEM_TO_FILE_CC apply.
+ *
+ *  \sa #MM_DUMP_MEM_TO_FILE_CC, #MM_LOAD_MEM_FROM_FILE_CC
+ */
+#define MM_DUMP_MEM_TO_COMPRESSED_FILE_CC                                      \
+  MM_CCVAL(DUMP_MEM_TO_COMPRESSED_FILE)
+
+/**
+ * \brief Dump Regions To File
+ *
+ *  \par Description
+ *       Dumps up to #MM_INTERFACE_MAX_DUMP_REGIONS address ranges, each
+ *       with its own memory type, to one region file with cFE file header
+ *       sub-type #MM_INTERNAL_CFE_HDR_REGION_SUBTYPE. The file holds a
+ *       region directory with the fully resolved address, memory type,
+ *       size, and CRC of each region, followed by the data of each region
+ *       in command order. Every region is checked before the file is
+ *       created. The file can be loaded with #MM_LOAD_MEM_FROM_FILE_CC.
+ *
+ *       The command is executed by the MM worker task. Telemetry and
+ *       events for the command are generated when the worker completes it.
+ *
+ *  \par Command Structure
+ *       #MM_DumpRegionsToFileCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.LastAction will be set to
+ * #MM_LastAction_DUMP_TO_FILE
+ *       - #MM_HkTlm_Payload_t.MemType will be set to the memory type of the
+ *         first region
+ *       - #MM_HkTlm_Payload_t.Address will be set to the fully resolved
+ *         address of the first region
+ *       - #MM_HkTlm_Payload_t.BytesProcessed will be set to the number of bytes
+ * dumped from all regions
+ *       - #MM_HkTlm_Payload_t.FileName will be set to the dump file name
+ *       - The #MM_DMP_MEM_FILE_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The worker task job queue is full
+ *       - Command specified filename is invalid
+ *       - The number of regions is zero or too large
+ *       - A symbol name was specified that can't be resolved
+ *       - A region fails the address range, data size, alignment, or
+ *         memory type checks
+ *       - #OS_OpenCreate call fails
+ *       - #CFE_FS_WriteHeader call fails
+ *       - #OS_close call fails
+ *       - #OS_write doesn't write the expected number of bytes
+ *         or returns an error code
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_WORKER_QUEUE_ERR_EID
+ *       - Error specific event message #MM_REGION_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_OS_CREAT_ERR_EID
+ *       - Error specific event message #MM_CFE_FS_WRITEHDR_ERR_EID
+ *       - Error specific event message #MM_OS_CLOSE_ERR_EID
+ *       - Error specific event message #MM_OS_WRITE_EXP_ERR_EID
+ *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
+ *       - Error specific event message #MM_DATA_SIZE_BYTES_ERR_EID
+ *       - Error specific event message #MM_ALIGN32_ERR_EID
+ *       - Error specific event message #MM_ALIGN16_ERR_EID
+ *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *
+ *  \par Criticality
+ *       The same cautions as #MM_DUMP_MEM_TO_FILE_CC apply.
+ *
+ *  \sa #MM_DUMP_MEM_TO_FILE_CC, #MM_LOAD_MEM_FROM_FILE_CC
+ */
+#define MM_DUMP_REGIONS_TO_FILE_CC MM_CCVAL(DUMP_REGIONS_TO_FILE)
+
+/**
+ * \brief Dump Memory To Telemetry
+ *
+ *  \par Description
+ *       Dumps up to #MM_INTERNAL_MAX_DUMP_FILE_DATA_RAM bytes (or the
+ *       dump limit of the specified memory type) in binary dump telemetry
+ *       packets (#MM_DumpTlm_t). Each packet carries up to
+ *       #MM_INTERFACE_MAX_DUMP_TLM_DATA bytes, the address of its first
+ *       byte, a sequence number starting at zero, the number of dump bytes
+ *       still to be sent, and the CRC of its data. No file is written.
+ *
+ *       The command only starts the dump. Up to
+ *       #MM_INTERNAL_DUMP_TLM_PACKETS_PER_CYCLE packets are sent on each
+ *       following housekeeping request until the whole range has been
+ *       sent. Only one dump to telemetry can be in progress at a time.
+ *
+ *  \par Command Structure
+ *       #MM_DumpMemToTlmCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.LastAction will be set to
+ * #MM_LastAction_DUMP_TO_TLM
+ *       - #MM_HkTlm_Payload_t.MemType will be set to the commanded memory
+ * type
+ *       - #MM_HkTlm_Payload_t.Address will be set to the fully resolved source
+ * memory address
+ *       - #MM_HkTlm_Payload_t.BytesProcessed will be set to the number of bytes
+ * to be dumped
+ *       - The #MM_DUMP_TLM_INF_EID informational event message will
+ *         be generated
+ *       - Dump telemetry packets will follow the next housekeeping requests,
+ *         the last one with #MM_DumpTlm_Payload_t.BytesRemaining set to zero
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Another dump to telemetry is still in progress
+ *       - The symbol name can't be resolved
+ *       - The address range, data size, alignment, or memory type checks
+ *         fail
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_DUMP_TLM_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
+ *       - Error specific event message #MM_DATA_SIZE_BYTES_ERR_EID
+ *       - Error specific event message #MM_ALIGN32_ERR_EID
+ *       - Error specific event message #MM_ALIGN16_ERR_EID
+ *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *
+ *       A memory read error while the packets are sent ends the dump with
+ *       the #MM_PSP_READ_ERR_EID and #MM_DUMP_TLM_ERR_EID event messages.
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #MM_DUMP_MEM_TO_FILE_CC, #MM_DUMP_IN_EVENT_CC
+ */
+#define MM_DUMP_MEM_TO_TLM_CC MM_CCVAL(DUMP_MEM_TO_TLM)
+
+/**
+ * \brief Dump In Telemetry
+ *
+ *  \par Description
+ *       Quick look dump of up to #MM_INTERFACE_MAX_DUMP_TLM_DATA bytes.
+ *       The raw bytes are sent right away in a single binary dump in
+ *       telemetry packet (#MM_DumpInTlm_t). Unlike #MM_DUMP_IN_EVENT_CC
+ *       no text formatting is done and the size is not limited by the
+ *       event message length.
+ *
+ *  \par Command Structure
+ *       #MM_DumpInTlmCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.LastAction will be set to
+ * #MM_LastAction_DUMP_INTLM
+ *       - #MM_HkTlm_Payload_t.MemType will be set to the commanded memory
+ * type
+ *       - #MM_HkTlm_Payload_t.Address will be set to the fully resolved source
+ * memory address
+ *       - #MM_HkTlm_Payload_t.BytesProcessed will be set to the number of bytes
+ * dumped
+ *       - A dump in telemetry packet will be sent
+ *       - The #MM_DUMP_INTLM_DBG_EID debug event message will be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The symbol name can't be resolved
+ *       - The address range, data size, alignment, or memory type checks
+ *         fail
+ *       - The memory can't be read
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
+ *       - Error specific event message #MM_DATA_SIZE_BYTES_ERR_EID
+ *       - Error specific event message #MM_ALIGN32_ERR_EID
+ *       - Error specific event message #MM_ALIGN16_ERR_EID
+ *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *       - Error specific event message #MM_PSP_READ_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #MM_DUMP_IN_EVENT_CC, #MM_DUMP_MEM_TO_TLM_CC
+ */
+#define MM_DUMP_IN_TLM_CC MM_CCVAL(DUMP_IN_TLM)
+
+/**
+ * \brief Load Begin
+ *
+ *  \par Description
+ *       Starts a chunked load of up to #MM_INTERNAL_MAX_CHUNK_LOAD_BYTES
+ *       bytes. The command gives the destination, the memory type, the
+ *       number of bytes, and the CRC of all the load data. The load data
+ *       follows in #MM_LOAD_DATA_CC commands and is written to memory by
+ *       #MM_LOAD_COMMIT_CC, so a load larger than
+ *       #MM_INTERFACE_MAX_UNINTERRUPTIBLE_DATA does not need a load file.
+ *
+ *       A chunked load that is already in progress is discarded. The
+ *       command is rejected while a load commit is waiting for the worker
+ *       task.
+ *
+ *  \par Command Structure
+ *       #MM_LoadBeginCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - The #MM_LOAD_BEGIN_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The symbol name can't be resolved
+ *       - The address range, data size, alignment, or memory type checks
+ *         fail
+ *       - The load is larger than #MM_INTERNAL_MAX_CHUNK_LOAD_BYTES
+ *       - A load commit is still waiting for the worker task
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
+ *       - Error specific event message #MM_DATA_SIZE_BYTES_ERR_EID
+ *       - Error specific event message #MM_ALIGN32_ERR_EID
+ *       - Error specific event message #MM_ALIGN16_ERR_EID
+ *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *       - Error specific event message #MM_LOAD_CHUNK_ERR_EID
+ *
+ *  \par Criticality
+ *       None, memory is not written until #MM_LOAD_COMMIT_CC
+ *
+ *  \sa #MM_LOAD_DATA_CC, #MM_LOAD_COMMIT_CC
+ */
+#define MM_LOAD_BEGIN_CC MM_CCVAL(LOAD_BEGIN)
+
+/**
+ * \brief Load Data
+ *
+ *  \par Description
+ *       Stores one chunk of up to #MM_INTERFACE_MAX_LOAD_CHUNK_DATA bytes
+ *       at the given offset of the chunked load started by
+ *       #MM_LOAD_BEGIN_CC. Chunks may be sent in any order and may be sent
+ *       again.
+ *
+ *  \par Command Structure
+ *       #MM_LoadDataCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - The #MM_LOAD_DATA_DBG_EID debug event message will be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - No chunked load is in progress
+ *       - A load commit is still waiting for the worker task
+ *       - The chunk is empty, too large, or does not fit in the load
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_LOAD_CHUNK_ERR_EID
+ *
+ *  \par Criticality
+ *       None, memory is not written until #MM_LOAD_COMMIT_CC
+ *
+ *  \sa #MM_LOAD_BEGIN_CC, #MM_LOAD_COMMIT_CC
+ */
+#define MM_LOAD_DATA_CC MM_CCVAL(LOAD_DATA)
+
+/**
+ * \brief Load Commit
+ *
+ *  \par Description
+ *       Checks the CRC of the reassembled chunked load data and, if it
+ *       matches the CRC given in #MM_LOAD_BEGIN_CC, writes the data to
+ *       memory and ends the chunked load. If the CRC does not match the
+ *       chunked load stays open so missing chunks can be sent again.
+ *
+ *       Memory is written by the worker task. Load begin and load data
+ *       commands are rejected from the time the commit is queued until
+ *       the worker has run it.
+ *
+ *  \par Command Structure
+ *       #MM_LoadCommitCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.LastAction will be set to
+ * #MM_LastAction_LOAD_CHUNKS
+ *       - #MM_HkTlm_Payload_t.MemType will be set to the memory type loaded
+ *       - #MM_HkTlm_Payload_t.Address will be set to the fully resolved
+ * destination memory address
+ *       - #MM_HkTlm_Payload_t.BytesProcessed will be set to the number of bytes
+ * loaded
+ *       - The #MM_LOAD_COMMIT_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - No chunked load is in progress
+ *       - The computed CRC doesn't match the load begin command value
+ *       - The memory can't be written
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_LOAD_CHUNK_ERR_EID
+ *       - Error specific event message #MM_LOAD_COMMIT_CRC_ERR_EID
+ *       - Error specific event message #MM_PSP_WRITE_ERR_EID
+ *
+ *  \par Criticality
+ *       The same cautions as #MM_LOAD_MEM_WID_CC apply.
+ *
+ *  \sa #MM_LOAD_BEGIN_CC, #MM_LOAD_DATA_CC
+ */
+#define MM_LOAD_COMMIT_CC MM_CCVAL(LOAD_COMMIT)
+
+/**
+ * \brief Load RAM Commit
+ *
+ *  \par Description
+ *       Checks the CRC of the reassembled chunked load data and, if it
+ *       matches the CRC given in #MM_LOAD_BEGIN_CC, copies the data to
+ *       RAM with a single memcpy and ends the chunked load. The CRC is
+ *       checked before the copy, so the window in which the destination
+ *       is partly written is only as long as the copy itself. The time
+ *       spent copying is reported in the completion event.
+ *
+ *       The copy is not atomic. Interrupts are not disabled and other
+ *       tasks may run, and see a partly written destination, while it is
+ *       in progress. Load begin and load data commands are rejected from
+ *       the time the commit is queued until the worker has run it.
+ *
+ *       If the CRC does not match the chunked load stays open so missing
+ *       chunks can be sent again.
+ *
+ *       Memory is written by the worker task.
+ *
+ *  \par Command Structure
+ *       #MM_LoadRAMCommitCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.LastAction will be set to
+ * #MM_LastAction_LOAD_CHUNKS
+ *       - #MM_HkTlm_Payload_t.MemType will be set to #MM_MemType_RAM
+ *       - #MM_HkTlm_Payload_t.Address will be set to the fully resolved
+ * destination memory address
+ *       - #MM_HkTlm_Payload_t.BytesProcessed will be set to the number of bytes
+ * loaded
+ *       - The #MM_LOAD_RAM_COMMIT_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - No chunked load is in progress
+ *       - The chunked load memory type isn't #MM_MemType_RAM
+ *       - The chunked load has more than #MM_INTERNAL_MAX_RAM_COMMIT_BYTES
+ *         bytes
+ *       - The computed CRC doesn't match the load begin command value
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_LOAD_CHUNK_ERR_EID
+ *       - Error specific event message #MM_LOAD_RAM_COMMIT_ERR_EID
+ *       - Error specific event message #MM_LOAD_COMMIT_CRC_ERR_EID
+ *
+ *  \par Criticality
+ *       The same cautions as #MM_LOAD_MEM_WID_CC apply.
+ *
+ *  \sa #MM_LOAD_BEGIN_CC, #MM_LOAD_DATA_CC, #MM_LOAD_COMMIT_CC
+ */
+#define MM_LOAD_RAM_COMMIT_CC MM_CCVAL(LOAD_RAM_COMMIT)
+
+/**
+ * \brief Checksum Memory
+ *
+ *  \par Description
+ *       Computes the CRC of the input number of bytes of processor memory
+ *       in place, without writing a dump file. The memory is read one dump
+ *       segment at a time, using the 8, 16, or 32 bit reads the optional
+ *       memory types require, with a segment break between segments so
+ *       large ranges stay within the CPU budget.
+ *
+ *       The command is executed by the MM worker task. Telemetry and
+ *       events for the command are generated when the worker completes it.
+ *
+ *  \par Command Structure
+ *       #MM_ChecksumMemCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.LastAction will be set to #MM_LastAction_CHECKSUM
+ *       - #MM_HkTlm_Payload_t.MemType will be set to the commanded memory type
+ *       - #MM_HkTlm_Payload_t.Address will be set to the fully resolved source
+ * memory address
+ *       - #MM_HkTlm_Payload_t.DataValue will be set to the computed CRC
+ *       - #MM_HkTlm_Payload_t.BytesProcessed will be set to the number of bytes
+ * checksummed
+ *       - The #MM_CHECKSUM_MEM_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The worker task job queue is full
+ *       - A symbol name was specified that can't be resolved
+ *       - The address range fails validation check
+ *       - The specified data size is invalid
+ *       - The address and data size are not properly aligned
+ *       - The specified memory type is invalid
+ *       - A PSP memory read fails
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_WORKER_QUEUE_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
+ *       - Error specific event message #MM_DATA_SIZE_BYTES_ERR_EID
+ *       - Error specific event message #MM_ALIGN32_ERR_EID
+ *       - Error specific event message #MM_ALIGN16_ERR_EID
+ *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *       - Error specific event message #MM_PSP_READ_ERR_EID
+ *
+ *  \par Criticality
+ *       It is possible to generate a machine check exception when accessing
+ * I/O memory addresses/registers and other types of memory.  The user is
+ * cautioned to use extreme care.
+ *
+ *  \sa #MM_DUMP_MEM_TO_FILE_CC
+ */
+#define MM_CHECKSUM_MEM_CC MM_CCVAL(CHECKSUM_MEM)
+
+/**
+ * \brief Set Scrub Region
+ *
+ *  \par Description
+ *       Defines one region of the background scrubber table. Each time the
+ *       MM main task wakes up the scrubber recomputes a few more segments
+ *       of the CRC of the defined regions, and compares the CRC of each
+ *       region to its golden CRC when a pass over it completes. The
+ *       result of the last pass over each region is reported in
+ *       #MM_HkTlm_Payload_t.ScrubStatus.
+ *
+ *       The golden CRC must be computed the same way as
+ *       #MM_CHECKSUM_MEM_CC, which can be used to obtain it.
+ *
+ *  \par Command Structure
+ *       #MM_SetScrubRegionCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.ScrubStatus of the region will be set to
+ *         #MM_ScrubStatus_PENDING
+ *       - The #MM_SCRUB_REGION_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The region number is not less than #MM_INTERFACE_MAX_SCRUB_REGIONS
+ *       - A symbol name was specified that can't be resolved
+ *       - The address range fails validation check
+ *       - The specified data size is invalid
+ *       - The address and data size are not properly aligned
+ *       - The specified memory type is invalid
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_SCRUB_REGION_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
+ *       - Error specific event message #MM_DATA_SIZE_BYTES_ERR_EID
+ *       - Error specific event message #MM_ALIGN32_ERR_EID
+ *       - Error specific event message #MM_ALIGN16_ERR_EID
+ *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *
+ *  \par Criticality
+ *       The scrubber reads the region periodically. It is possible to
+ *       generate a machine check exception when accessing I/O memory
+ *       addresses/registers and other types of memory.
+ *
+ *  \sa #MM_CLEAR_SCRUB_REGION_CC, #MM_CHECKSUM_MEM_CC
+ */
+#define MM_SET_SCRUB_REGION_CC MM_CCVAL(SET_SCRUB_REGION)
+
+/**
+ * \brief Clear Scrub Region
+ *
+ *  \par Description
+ *       Removes one region from the background scrubber table.
+ *
+ *  \par Command Structure
+ *       #MM_ClearScrubRegionCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.ScrubStatus of the region will be set to
+ *         #MM_ScrubStatus_UNUSED
+ *       - The #MM_SCRUB_REGION_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The region number is not less than #MM_INTERFACE_MAX_SCRUB_REGIONS
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_SCRUB_REGION_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #MM_SET_SCRUB_REGION_CC
+ */
+#define MM_CLEAR_SCRUB_REGION_CC MM_CCVAL(CLEAR_SCRUB_REGION)
+
+/**
+ * \brief Build Scrub Index
+ *
+ *  \par Description
+ *       Builds the block index of a scrub region from the current memory
+ *       contents. The region is divided into blocks of at least
+ *       #MM_INTERNAL_SCRUB_BLOCK_SIZE bytes, and no more than
+ *       #MM_INTERNAL_MAX_SCRUB_BLOCKS blocks. The index holds the CRC of
+ *       each block, computed the same way as #MM_CHECKSUM_MEM_CC, and a
+ *       root CRC of the block CRCs.
+ *
+ *       The index should be built while the region is known to be good,
+ *       for example right after it has been loaded and its scrub region
+ *       set. Ground can check the root CRC against the root computed from
+ *       the reference image. Setting or clearing the scrub region discards
+ *       its index. The stored index is only replaced when the build
+ *       succeeds, so a failed build leaves the previous index in place.
+ *
+ *       The command is executed by the MM worker task. Telemetry and
+ *       events for the command are generated when the worker completes it.
+ *
+ *  \par Command Structure
+ *       #MM_BuildScrubIndexCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.LastAction will be set to
+ * #MM_LastAction_SCRUB_INDEX
+ *       - #MM_HkTlm_Payload_t.MemType will be set to the region memory type
+ *       - #MM_HkTlm_Payload_t.Address will be set to the region address
+ *       - #MM_HkTlm_Payload_t.DataValue will be set to the root CRC
+ *       - #MM_HkTlm_Payload_t.BytesProcessed will be set to the region size
+ *       - The #MM_SCRUB_INDEX_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The worker task job queue is full
+ *       - The region number is not less than #MM_INTERFACE_MAX_SCRUB_REGIONS
+ *       - The scrub region is not defined
+ *       - A PSP memory read fails
+ *       - The scrub region is set or cleared while the index is built
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_WORKER_QUEUE_ERR_EID
+ *       - Error specific event message #MM_SCRUB_REGION_ERR_EID
+ *       - Error specific event message #MM_SCRUB_INDEX_ERR_EID
+ *       - Error specific event message #MM_PSP_READ_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #MM_COMPARE_SCRUB_INDEX_CC, #MM_SET_SCRUB_REGION_CC
+ */
+#define MM_BUILD_SCRUB_INDEX_CC MM_CCVAL(BUILD_SCRUB_INDEX)
+
+/**
+ * \brief Compare Scrub Index
+ *
+ *  \par Description
+ *       Recomputes the CRC of each block of a scrub region and compares
+ *       it to the block index of the region. The result is sent in a
+ *       scrub index packet (#MM_ScrubIndexTlm_t), which holds the number
+ *       of mismatching blocks and the indices of the first
+ *       #MM_INTERFACE_MAX_SCRUB_MISMATCH_BLOCKS of them. Ground can then
+ *       dump only the damaged blocks, so triage is proportional to the
+ *       damage rather than to the region size.
+ *
+ *       The root CRC of the index is checked first, so a corrupted index
+ *       is rejected rather than reported as memory damage.
+ *
+ *       The command is executed by the MM worker task. Telemetry and
+ *       events for the command are generated when the worker completes it.
+ *
+ *  \par Command Structure
+ *       #MM_CompareScrubIndexCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.LastAction will be set to
+ * #MM_LastAction_SCRUB_COMPARE
+ *       - #MM_HkTlm_Payload_t.MemType will be set to the region memory type
+ *       - #MM_HkTlm_Payload_t.Address will be set to the region address
+ *       - #MM_HkTlm_Payload_t.DataValue will be set to the number of
+ *         mismatching blocks
+ *       - #MM_HkTlm_Payload_t.BytesProcessed will be set to the region size
+ *       - A scrub index packet will be sent
+ *       - The #MM_SCRUB_COMPARE_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The worker task job queue is full
+ *       - The region number is not less than #MM_INTERFACE_MAX_SCRUB_REGIONS
+ *       - The scrub region has no block index
+ *       - The block index doesn't match its root CRC
+ *       - A PSP memory read fails
+ *       - The scrub region is set or cleared while the blocks are compared
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_WORKER_QUEUE_ERR_EID
+ *       - Error specific event message #MM_SCRUB_REGION_ERR_EID
+ *       - Error specific event message #MM_SCRUB_INDEX_ERR_EID
+ *       - Error specific event message #MM_PSP_READ_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #MM_BUILD_SCRUB_INDEX_CC
+ */
+#define MM_COMPARE_SCRUB_INDEX_CC MM_CCVAL(COMPARE_SCRUB_INDEX)
+
+/**
+ * \brief Set Dump CRC Type
+ *
+ *  \par Description
+ *       Selects the CRC algorithm used to compute the integrity field of
+ *       the files written by later dump to file, dump to compressed file,
+ *       and dump regions to file commands. The selected type is recorded
+ *       in each dump file header so the file can be verified on the
+ *       ground or loaded back without knowing the setting.
+ *
+ *  \par Command Structure
+ *       #MM_SetDumpCrcTypeCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.DumpCrcType will be set to the commanded type
+ *       - The #MM_DUMP_CRC_TYPE_INF_EID informational event message will
+ *         be generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - CRC type is not a known #MM_CrcType_Enum_t value
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_DUMP_CRC_TYPE_ERR_EID
+ *
+ *  \par Criticality
+ *       Dump files written with a CRC type other than
+ *       #MM_CrcType_DEFAULT can't be checked by ground tools that only
+ *       know the cFE default CRC.
+ */
+#define MM_SET_DUMP_CRC_TYPE_CC MM_CCVAL(SET_DUMP_CRC_TYPE)
+
+/**
+ * \brief Memory Test
+ *
+ *  \par Description
+ *       Runs destructive test patterns over a region of RAM or of an
+ *       optional MEM8, MEM16, or MEM32 memory type. The patterns are
+ *       selected by a mask of #MM_MemTestPattern_Enum_t values:
+ *       - #MM_MemTestPattern_MARCH_C runs March C-, which finds stuck-at,
+ *         transition, and most coupling faults
+ *       - #MM_MemTestPattern_WALKING_ONES walks a single one bit through
+ *         each word, which finds stuck or shorted data bits
+ *       - #MM_MemTestPattern_ADDRESS writes the address of each word, and
+ *         then its complement, as data, which finds address line faults
+ *
+ *       MEM8, MEM16, and MEM32 memory is accessed with the matching PSP
+ *       accessors. RAM is accessed 32 bits at a time when the address and
+ *       size are 32-bit aligned, and a byte at a time otherwise.
+ *
+ *       The test runs in segments of #MM_INTERNAL_MAX_FILL_DATA_SEG bytes
+ *       of accesses within the load, dump, and fill CPU budget. The result
+ *       is sent in a memory test packet (#MM_MemTestTlm_t), which holds
+ *       the number of failing reads and the address, expected value, and
+ *       actual value of the first #MM_INTERFACE_MAX_MEM_TEST_FAILURES of
+ *       them.
+ *
+ *       The command is executed by the MM worker task. Telemetry and
+ *       events for the command are generated when the worker completes it.
+ *
+ *  \par Command Structure
+ *       #MM_MemTestCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.LastAction will be set to
+ * #MM_LastAction_MEM_TEST
+ *       - #MM_HkTlm_Payload_t.MemType will be set to the commanded memory
+ *         type
+ *       - #MM_HkTlm_Payload_t.Address will be set to the region address
+ *       - #MM_HkTlm_Payload_t.DataValue will be set to the number of
+ *         failing reads
+ *       - #MM_HkTlm_Payload_t.BytesProcessed will be set to the number of
+ *         bytes tested
+ *       - A memory test packet will be sent
+ *       - The #MM_MEM_TEST_INF_EID informational event message will be
+ *         generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The worker task job queue is full
+ *       - Symbol name can't be resolved
+ *       - The region fails the fill memory range and alignment checks
+ *       - No pattern, or an unknown pattern, is selected
+ *       - The memory type is EEPROM
+ *       - A PSP memory read or write fails
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_WORKER_QUEUE_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_MEM_TEST_ERR_EID
+ *       - Error specific event message #MM_PSP_READ_ERR_EID
+ *       - Error specific event message #MM_PSP_WRITE_ERR_EID
+ *
+ *  \par Criticality
+ *       The contents of the region are destroyed. The command mutex is
+ *       given up between segments, so commands that write the region
+ *       while the test runs show up as test failures.
+ */
+#define MM_MEM_TEST_CC MM_CCVAL(MEM_TEST)
+
+/**
+ * \brief Batch Memory Peek
+ *
+ *  \par Description
+ *       Reads 8, 16, or 32 bits of data from each of up to
+ *       #MM_INTERFACE_MAX_BATCH_PEEK_ENTRIES memory addresses and reports
+ *       the values, in entry order, in one batch peek packet
+ *       (#MM_BatchPeekTlm_t). Each entry has the same parameters as the
+ *       #MM_PEEK_CC command.
+ *
+ *       Every entry is resolved and checked before any is read, so an
+ *       invalid entry rejects the whole command.
+ *
+ *  \par Command Structure
+ *       #MM_BatchPeekCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.LastAction will be set to
+ * #MM_LastAction_BATCH_PEEK
+ *       - #MM_HkTlm_Payload_t.MemType will be set to the memory type of the
+ *         first entry
+ *       - #MM_HkTlm_Payload_t.Address will be set to the fully resolved
+ *         address of the first entry
+ *       - #MM_HkTlm_Payload_t.DataValue will be set to the number of entries
+ *       - #MM_HkTlm_Payload_t.BytesProcessed will be set to the number of
+ *         bytes read
+ *       - A batch peek packet will be sent
+ *       - The #MM_BATCH_PEEK_INF_EID informational event message will be
+ *         generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The number of entries is zero or too large
+ *       - A symbol name was specified that can't be resolved
+ *       - An entry fails the peek parameter checks
+ *       - A PSP memory read fails
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_BATCH_PEEK_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_DATA_SIZE_BITS_ERR_EID
+ *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
+ *       - Error specific event message #MM_ALIGN16_ERR_EID
+ *       - Error specific event message #MM_ALIGN32_ERR_EID
+ *       - Error specific event message #MM_PSP_READ_ERR_EID
+ *
+ *  \par Criticality
+ *       The same cautions as for #MM_PEEK_CC apply to each entry.
+ *
+ *  \sa #MM_PEEK_CC
+ */
+#define MM_BATCH_PEEK_CC MM_CCVAL(BATCH_PEEK)
+
+/**
+ * \brief Batch Memory Poke
+ *
+ *  \par Description
+ *       Writes 8, 16, or 32 bits of data to each of up to
+ *       #MM_INTERFACE_MAX_BATCH_POKE_ENTRIES memory addresses as one
+ *       transaction. Each entry has the same parameters as the
+ *       #MM_POKE_CC command.
+ *
+ *       Every entry is resolved and checked, and the current value at
+ *       every address is read into an undo buffer, before any is written.
+ *       The entries are then written in order. If a write fails, the
+ *       entries already written are restored from the undo buffer in
+ *       reverse order, so entries that write the same address end up
+ *       holding the original value.
+ *
+ *       EEPROM entries, and their restores, skip the write when the
+ *       EEPROM already holds the data and count toward the EEPROM bytes
+ *       written or skipped, the same as #MM_POKE_CC. They don't generate
+ *       poke events, the batch is reported as a whole. When the batch
+ *       fails the last action data is cleared.
+ *
+ *  \par Command Structure
+ *       #MM_BatchPokeCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.LastAction will be set to
+ * #MM_LastAction_BATCH_POKE
+ *       - #MM_HkTlm_Payload_t.MemType will be set to the memory type of the
+ *         first entry
+ *       - #MM_HkTlm_Payload_t.Address will be set to the fully resolved
+ *         address of the first entry
+ *       - #MM_HkTlm_Payload_t.DataValue will be set to the number of entries
+ *       - #MM_HkTlm_Payload_t.BytesProcessed will be set to the number of
+ *         bytes written
+ *       - The #MM_BATCH_POKE_INF_EID informational event message will be
+ *         generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The number of entries is zero or too large
+ *       - A symbol name was specified that can't be resolved
+ *       - An entry fails the poke parameter checks
+ *       - A PSP memory read of an entry's current value fails
+ *       - A PSP memory or EEPROM write fails
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_BATCH_POKE_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_DATA_SIZE_BITS_ERR_EID
+ *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
+ *       - Error specific event message #MM_ALIGN16_ERR_EID
+ *       - Error specific event message #MM_ALIGN32_ERR_EID
+ *       - Error specific event message #MM_PSP_READ_ERR_EID
+ *       - Error specific event message #MM_PSP_WRITE_ERR_EID
+ *
+ *  \par Criticality
+ *       The same cautions as for #MM_POKE_CC apply to each entry. The
+ *       writes are not atomic with respect to other tasks, which can see
+ *       a partly applied batch, and a restore write can itself fail. The
+ *       #MM_BATCH_POKE_ERR_EID event reports how many entries were
+ *       restored.
+ *
+ *  \sa #MM_POKE_CC, #MM_BATCH_PEEK_CC
+ */
+#define MM_BATCH_POKE_CC MM_CCVAL(BATCH_POKE)
+
+/**
+ * \brief Set Watch Entry
+ *
+ *  \par Description
+ *       Defines one entry of the peek sampler watch list. The symbol is
+ *       resolved and the entry is checked like a #MM_PEEK_CC command
+ *       once, here, so sampling the entry costs only the memory read.
+ *
+ *       While the sample period set by #MM_SET_SAMPLE_PERIOD_CC is not
+ *       zero, the sampler reads every defined entry once every sample
+ *       period and sends the values in a watch packet (#MM_WatchTlm_t).
+ *
+ *  \par Command Structure
+ *       #MM_SetWatchEntryCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - The #MM_WATCH_ENTRY_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The entry number is not less than #MM_INTERFACE_MAX_WATCH_ENTRIES
+ *       - A symbol name was specified that can't be resolved
+ *       - The specified data size is invalid
+ *       - The specified memory type is invalid
+ *       - The address range fails validation check
+ *       - The address and data size are not properly aligned
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_WATCH_ENTRY_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_DATA_SIZE_BITS_ERR_EID
+ *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
+ *       - Error specific event message #MM_ALIGN16_ERR_EID
+ *       - Error specific event message #MM_ALIGN32_ERR_EID
+ *
+ *  \par Criticality
+ *       The sampler reads the entry periodically. It is possible to
+ *       generate a machine check exception when accessing I/O memory
+ *       addresses/registers and other types of memory. Reading some
+ *       device registers has side effects.
+ *
+ *  \sa #MM_CLEAR_WATCH_ENTRY_CC, #MM_SET_SAMPLE_PERIOD_CC
+ */
+#define MM_SET_WATCH_ENTRY_CC MM_CCVAL(SET_WATCH_ENTRY)
+
+/**
+ * \brief Clear Watch Entry
+ *
+ *  \par Description
+ *       Removes one entry from the peek sampler watch list.
+ *
+ *  \par Command Structure
+ *       #MM_ClearWatchEntryCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - The #MM_WATCH_ENTRY_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The entry number is not less than #MM_INTERFACE_MAX_WATCH_ENTRIES
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_WATCH_ENTRY_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #MM_SET_WATCH_ENTRY_CC
+ */
+#define MM_CLEAR_WATCH_ENTRY_CC MM_CCVAL(CLEAR_WATCH_ENTRY)
+
+/**
+ * \brief Set Sample Period
+ *
+ *  \par Description
+ *       Sets the number of housekeeping requests between samples of the
+ *       watch list. The sampler runs on the housekeeping request, so it
+ *       samples at most once per housekeeping cycle. A period of zero
+ *       stops the sampler. The next sample is taken one full period
+ *       after the command.
+ *
+ *  \par Command Structure
+ *       #MM_SetSamplePeriodCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - The #MM_SAMPLE_PERIOD_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #MM_SET_WATCH_ENTRY_CC
+ */
+#define MM_SET_SAMPLE_PERIOD_CC MM_CCVAL(SET_SAMPLE_PERIOD)
+
+/**
+ * \brief Masked Memory Poke
+ *
+ *  \par Description
+ *       Changes selected bits of 8, 16, or 32 bits of memory. The current
+ *       value is read and the new value (Data & Mask) | (Old & ~Mask) is
+ *       written back, so bits that are clear in the mask keep their
+ *       current value.
+ *
+ *       The read and the write are separate accesses, the command is not
+ *       an atomic read-modify-write. An EEPROM write is skipped and
+ *       counted the same way as by #MM_POKE_CC, but no poke event is
+ *       generated for it.
+ *
+ *  \par Command Structure
+ *       #MM_MaskedPokeCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.LastAction will be set to
+ * #MM_LastAction_MASKED_POKE
+ *       - #MM_HkTlm_Payload_t.MemType will be set to the commanded memory type
+ *       - #MM_HkTlm_Payload_t.Address will be set to the fully resolved
+ *         destination address
+ *       - #MM_HkTlm_Payload_t.DataValue will be set to the value written
+ *       - #MM_HkTlm_Payload_t.BytesProcessed will be set to the byte size of
+ *         the poke operation (1, 2, or 4)
+ *       - The #MM_MASKED_POKE_INF_EID informational event message will be
+ *         generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - A symbol name was specified that can't be resolved
+ *       - The specified data size is invalid
+ *       - The specified memory type is invalid
+ *       - The address range fails validation check
+ *       - The address and data size are not properly aligned
+ *       - A PSP memory read of the current value fails
+ *       - A PSP memory or EEPROM write fails
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_DATA_SIZE_BITS_ERR_EID
+ *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
+ *       - Error specific event message #MM_ALIGN16_ERR_EID
+ *       - Error specific event message #MM_ALIGN32_ERR_EID
+ *       - Error specific event message #MM_PSP_READ_ERR_EID
+ *       - Error specific event message #MM_PSP_WRITE_ERR_EID
+ *
+ *  \par Criticality
+ *       The same cautions as for #MM_POKE_CC apply. The read and the write
+ *       are done while holding the MM command mutex, so no other MM
+ *       command or the scrubber and sampler can run in between, but other
+ *       tasks and interrupt handlers can.
+ *
+ *  \sa #MM_POKE_CC, #MM_CONDITIONAL_POKE_CC
+ */
+#define MM_MASKED_POKE_CC MM_CCVAL(MASKED_POKE)
+
+/**
+ * \brief Conditional Memory Poke
+ *
+ *  \par Description
+ *       Writes 8, 16, or 32 bits of data to a memory address only if the
+ *       address currently holds the expected value. The current value is
+ *       read and compared first, and nothing is written if it differs.
+ *
+ *       The compare and the write are separate accesses, the command is
+ *       not an atomic compare-and-swap. An EEPROM write is skipped and
+ *       counted the same way as by #MM_POKE_CC, but no poke event is
+ *       generated for it.
+ *
+ *  \par Command Structure
+ *       #MM_ConditionalPokeCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkTlm_Payload_t.CmdCounter will increment
+ *       - #MM_HkTlm_Payload_t.LastAction will be set to
+ * #MM_LastAction_COND_POKE
+ *       - #MM_HkTlm_Payload_t.MemType will be set to the commanded memory type
+ *       - #MM_HkTlm_Payload_t.Address will be set to the fully resolved
+ *         destination address
+ *       - #MM_HkTlm_Payload_t.DataValue will be set to the value written
+ *       - #MM_HkTlm_Payload_t.BytesProcessed will be set to the byte size of
+ *         the poke operation (1, 2, or 4)
+ *       - The #MM_COND_POKE_INF_EID informational event message will be
+ *         generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - A symbol name was specified that can't be resolved
+ *       - The specified data size is invalid
+ *       - The specified memory type is invalid
+ *       - The address range fails validation check
+ *       - The address and data size are not properly aligned
+ *       - A PSP memory read of the current value fails
+ *       - The current value is not the expected value
+ *       - A PSP memory or EEPROM write fails
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkTlm_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_DATA_SIZE_BITS_ERR_EID
+ *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
+ *       - Error specific event message #MM_ALIGN16_ERR_EID
+ *       - Error specific event message #MM_ALIGN32_ERR_EID
+ *       - Error specific event message #MM_PSP_READ_ERR_EID
+ *       - Error specific event message #MM_COND_POKE_ERR_EID
+ *       - Error specific event message #MM_PSP_WRITE_ERR_EID
+ *
+ *  \par Criticality
+ *       The same cautions as for #MM_MASKED_POKE_CC apply.
+ *
+ *  \sa #MM_POKE_CC, #MM_MASKED_POKE_CC
+ */
+#define MM_CONDITIONAL_POKE_CC MM_CCVAL(CONDITIONAL_POKE)
+
 /** \} */
 
 #endif /* MM_FCNCODES_H */
\ No newline at end of file
@@ -52,4 +52,148 @@
   MM_INTERFACE_CFGVAL(MAX_UNINTERRUPTIBLE_DATA)
 #define DEFAULT_MM_INTERFACE_MAX_UNINTERRUPTIBLE_DATA 200
 
+/**
+ * \brief Maximum number of regions in a region dump
+ *
+ *  \par Description:
+ *       Maximum number of memory regions that can be dumped to one
+ *       file with the "dump regions to file" (#MM_DUMP_REGIONS_TO_FILE_CC)
+ *       command.
+ *
+ *  \par Limits:
+ *       This value must be greater than zero and can't be greater than
+ *       #MM_INTERNAL_MAX_FILE_REGIONS. Each region adds one
+ *       #MM_DumpRegion_t to the size of the command message, so it should
+ *       be kept small enough to avoid packet segmentation for the command
+ *       protocol being used.
+ */
+#define MM_INTERFACE_MAX_DUMP_REGIONS MM_INTERFACE_CFGVAL(MAX_DUMP_REGIONS)
+#define DEFAULT_MM_INTERFACE_MAX_DUMP_REGIONS 16
+
+/**
+ * \brief Maximum number of data bytes in a dump telemetry packet
+ *
+ *  \par Description:
+ *       Size of the data area of the dump telemetry packet
+ *       (#MM_DumpTlm_t) sent by the "dump memory to telemetry"
+ *       (#MM_DUMP_MEM_TO_TLM_CC) command.
+ *
+ *  \par Limits:
+ *       This value must be greater than zero and longword aligned. It
+ *       should be kept small enough to avoid packet segmentation for the
+ *       telemetry protocol being used.
+ */
+#define MM_INTERFACE_MAX_DUMP_TLM_DATA MM_INTERFACE_CFGVAL(MAX_DUMP_TLM_DATA)
+#define DEFAULT_MM_INTERFACE_MAX_DUMP_TLM_DATA 256
+
+/**
+ * \brief Maximum number of data bytes in a load data command
+ *
+ *  \par Description:
+ *       Size of the data array of the "load data" (#MM_LOAD_DATA_CC)
+ *       command that carries one chunk of a chunked load.
+ *
+ *  \par Limits:
+ *       This value must be greater than zero. It should be kept small
+ *       enough to avoid packet segmentation for the command protocol
+ *       being used.
+ */
+#define MM_INTERFACE_MAX_LOAD_CHUNK_DATA                                       \
+  MM_INTERFACE_CFGVAL(MAX_LOAD_CHUNK_DATA)
+#define DEFAULT_MM_INTERFACE_MAX_LOAD_CHUNK_DATA 200
+
+/**
+ * \brief Maximum number of scrub regions
+ *
+ *  \par Description:
+ *       Number of memory regions the background scrubber can check
+ *       against a golden CRC. The status of each region is reported in
+ *       housekeeping telemetry.
+ *
+ *  \par Limits:
+ *       This value must be greater than zero, no greater than 255, and
+ *       longword aligned. Each region adds one byte to the housekeeping
+ *       telemetry packet.
+ */
+#define MM_INTERFACE_MAX_SCRUB_REGIONS MM_INTERFACE_CFGVAL(MAX_SCRUB_REGIONS)
+#define DEFAULT_MM_INTERFACE_MAX_SCRUB_REGIONS 8
+
+/**
+ * \brief Maximum number of block indices in a scrub index packet
+ *
+ *  \par Description:
+ *       Number of mismatching block indices reported by the compare
+ *       scrub index (#MM_COMPARE_SCRUB_INDEX_CC) command in the scrub
+ *       index telemetry packet (#MM_ScrubIndexTlm_t). The total number
+ *       of mismatching blocks is always reported.
+ *
+ *  \par Limits:
+ *       This value must be greater than zero and a multiple of two.
+ */
+#define MM_INTERFACE_MAX_SCRUB_MISMATCH_BLOCKS                                 \
+  MM_INTERFACE_CFGVAL(MAX_SCRUB_MISMATCH_BLOCKS)
+#define DEFAULT_MM_INTERFACE_MAX_SCRUB_MISMATCH_BLOCKS 64
+
+/**
+ * \brief Maximum number of failures in a memory test packet
+ *
+ *  \par Description:
+ *       Number of failing reads reported by the memory test
+ *       (#MM_MEM_TEST_CC) command in the memory test telemetry packet
+ *       (#MM_MemTestTlm_t). The total number of failing reads is always
+ *       reported.
+ *
+ *  \par Limits:
+ *       This value must be greater than zero.
+ */
+#define MM_INTERFACE_MAX_MEM_TEST_FAILURES                                     \
+  MM_INTERFACE_CFGVAL(MAX_MEM_TEST_FAILURES)
+#define DEFAULT_MM_INTERFACE_MAX_MEM_TEST_FAILURES 16
+
+/**
+ * \brief Maximum number of entries in a batch peek
+ *
+ *  \par Description:
+ *       Number of addresses that can be read by one batch peek
+ *       (#MM_BATCH_PEEK_CC) command. The values are returned in the
+ *       batch peek telemetry packet (#MM_BatchPeekTlm_t).
+ *
+ *  \par Limits:
+ *       This value must be greater than zero. Each entry adds a peek
+ *       command payload to the command and 16 bytes to the packet.
+ */
+#define MM_INTERFACE_MAX_BATCH_PEEK_ENTRIES                                    \
+  MM_INTERFACE_CFGVAL(MAX_BATCH_PEEK_ENTRIES)
+#define DEFAULT_MM_INTERFACE_MAX_BATCH_PEEK_ENTRIES 16
+
+/**
+ * \brief Maximum number of entries in a batch poke
+ *
+ *  \par Description:
+ *       Number of addresses that can be written by one batch poke
+ *       (#MM_BATCH_POKE_CC) command.
+ *
+ *  \par Limits:
+ *       This value must be greater than zero. Each entry adds a poke
+ *       command payload to the command and 4 bytes of undo data to the
+ *       MM main task stack.
+ */
+#define MM_INTERFACE_MAX_BATCH_POKE_ENTRIES                                    \
+  MM_INTERFACE_CFGVAL(MAX_BATCH_POKE_ENTRIES)
+#define DEFAULT_MM_INTERFACE_MAX_BATCH_POKE_ENTRIES 16
+
+/**
+ * \brief Number of watch list entries
+ *
+ *  \par Description:
+ *       Number of addresses the peek sampler can watch. The value of each
+ *       entry is sent in the watch telemetry packet (#MM_WatchTlm_t).
+ *
+ *  \par Limits:
+ *       This value must be greater than zero and no greater than 32, the
+ *       number of bits in the valid mask of the watch packet.
+ */
+#define MM_INTERFACE_MAX_WATCH_ENTRIES MM_INTERFACE_CFGVAL(MAX_WATCH_ENTRIES)
+#define DEFAULT_MM_INTERFACE_MAX_WATCH_ENTRIES 16
+
 #endif /* MM_INTERFACE_CFG_H */
\ No newline at end of file
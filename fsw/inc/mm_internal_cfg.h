@@ -62,6 +62,60 @@
 #define MM_INTERNAL_CFE_HDR_SUBTYPE MM_INTERNAL_CFGVAL(CFE_HDR_SUBTYPE)
 #define DEFAULT_MM_INTERNAL_CFE_HDR_SUBTYPE 0x4D4D5354
 
+/**
+ *  \brief Memory Management Patch File -- cFE file header sub-type
+ *
+ *  \par Description:
+ *       This parameter defines the value that is used to identify a
+ *       Memory Management patch load file, which holds a list of
+ *       #MM_PatchRunHeader_t runs instead of one contiguous image.
+ *
+ *  \par Limits:
+ *       The file header data type for the value is 32 bits unsigned,
+ *       thus the value can be anything from zero to 4,294,967,295.
+ *       It must be different from #MM_INTERNAL_CFE_HDR_SUBTYPE.
+ */
+#define MM_INTERNAL_CFE_HDR_PATCH_SUBTYPE                                      \
+  MM_INTERNAL_CFGVAL(CFE_HDR_PATCH_SUBTYPE)
+#define DEFAULT_MM_INTERNAL_CFE_HDR_PATCH_SUBTYPE 0x4D4D5350
+
+/**
+ *  \brief Memory Management Compressed File -- cFE file header sub-type
+ *
+ *  \par Description:
+ *       This parameter defines the value that is used to identify a
+ *       Memory Management run-length compressed load or dump file.
+ *
+ *  \par Limits:
+ *       The file header data type for the value is 32 bits unsigned,
+ *       thus the value can be anything from zero to 4,294,967,295.
+ *       It must be different from #MM_INTERNAL_CFE_HDR_SUBTYPE and
+ *       #MM_INTERNAL_CFE_HDR_PATCH_SUBTYPE.
+ */
+#define MM_INTERNAL_CFE_HDR_COMPRESSED_SUBTYPE                                 \
+  MM_INTERNAL_CFGVAL(CFE_HDR_COMPRESSED_SUBTYPE)
+#define DEFAULT_MM_INTERNAL_CFE_HDR_COMPRESSED_SUBTYPE 0x4D4D535A
+
+/**
+ *  \brief Memory Management Region File -- cFE file header sub-type
+ *
+ *  \par Description:
+ *       This parameter defines the value that is used to identify a
+ *       Memory Management region file, which holds a directory of
+ *       #MM_LoadDumpFileHeader_t region entries followed by the data of
+ *       each region.
+ *
+ *  \par Limits:
+ *       The file header data type for the value is 32 bits unsigned,
+ *       thus the value can be anything from zero to 4,294,967,295.
+ *       It must be different from #MM_INTERNAL_CFE_HDR_SUBTYPE,
+ *       #MM_INTERNAL_CFE_HDR_PATCH_SUBTYPE, and
+ *       #MM_INTERNAL_CFE_HDR_COMPRESSED_SUBTYPE.
+ */
+#define MM_INTERNAL_CFE_HDR_REGION_SUBTYPE                                     \
+  MM_INTERNAL_CFGVAL(CFE_HDR_REGION_SUBTYPE)
+#define DEFAULT_MM_INTERNAL_CFE_HDR_REGION_SUBTYPE 0x4D4D5352
+
 /**
  *  \brief Memory Management File -- cFE file header description
  *
@@ -130,6 +184,137 @@
 #define MM_INTERNAL_MAX_LOAD_DATA_SEG MM_INTERNAL_CFGVAL(MAX_LOAD_DATA_SEG)
 #define DEFAULT_MM_INTERNAL_MAX_LOAD_DATA_SEG 200
 
+/**
+ * \brief Maximum number of bytes for a staged file load
+ *
+ *  \par Description:
+ *       Load files with no more than this many data bytes are read
+ *       into a staging buffer in a single pass, computing the CRC as
+ *       each segment is read, and are only written to the destination
+ *       once the CRC matches. Larger load files are read twice: once
+ *       to verify the CRC and once to load memory.
+ *
+ *  \par Limits:
+ *       This value must be longword aligned and greater than zero.
+ *       This value determines the size of the staging buffer in the MM
+ *       global data, so it directly increases the MM memory footprint.
+ */
+#define MM_INTERNAL_MAX_STAGED_LOAD_BYTES                                      \
+  MM_INTERNAL_CFGVAL(MAX_STAGED_LOAD_BYTES)
+#define DEFAULT_MM_INTERNAL_MAX_STAGED_LOAD_BYTES (64 * 1024)
+
+/**
+ * \brief Maximum chunked load size
+ *
+ *  \par Description:
+ *       Maximum number of bytes a chunked load (#MM_LOAD_BEGIN_CC,
+ *       #MM_LOAD_DATA_CC, #MM_LOAD_COMMIT_CC) can write. The chunks are
+ *       reassembled in a buffer of this size before the CRC is checked
+ *       and memory is written.
+ *
+ *  \par Limits:
+ *       This value must be longword aligned and greater than zero.
+ *       This value determines the size of the chunked load buffer in the
+ *       MM global data, so it directly increases the MM memory footprint.
+ */
+#define MM_INTERNAL_MAX_CHUNK_LOAD_BYTES                                       \
+  MM_INTERNAL_CFGVAL(MAX_CHUNK_LOAD_BYTES)
+#define DEFAULT_MM_INTERNAL_MAX_CHUNK_LOAD_BYTES (16 * 1024)
+
+/**
+ * \brief Maximum load RAM commit size
+ *
+ *  \par Description:
+ *       Maximum number of bytes a chunked load can write with
+ *       #MM_LOAD_RAM_COMMIT_CC. The data is copied to memory in one
+ *       pass, so this value bounds how long the destination is partly
+ *       written.
+ *
+ *  \par Limits:
+ *       This value must be greater than zero and can't be greater than
+ *       #MM_INTERNAL_MAX_CHUNK_LOAD_BYTES.
+ */
+#define MM_INTERNAL_MAX_RAM_COMMIT_BYTES MM_INTERNAL_CFGVAL(MAX_RAM_COMMIT_BYTES)
+#define DEFAULT_MM_INTERNAL_MAX_RAM_COMMIT_BYTES (4 * 1024)
+
+/**
+ * \brief Maximum number of regions in a region file
+ *
+ *  \par Description:
+ *       Maximum number of entries in the region directory of a region
+ *       file. The directory is read into the MM global data in one
+ *       piece, so every region can be checked before any data is read.
+ *
+ *  \par Limits:
+ *       This value must be greater than zero. Each region adds one
+ *       #MM_LoadDumpFileHeader_t to the MM memory footprint.
+ */
+#define MM_INTERNAL_MAX_FILE_REGIONS MM_INTERNAL_CFGVAL(MAX_FILE_REGIONS)
+#define DEFAULT_MM_INTERNAL_MAX_FILE_REGIONS 16
+
+/**
+ * \brief Direct file load compiler switch
+ *
+ *  \par Description:
+ *       When defined, RAM and EEPROM loads that are too large to be staged
+ *       read the load file straight into the destination memory once the
+ *       file CRC has been verified, instead of copying each segment through
+ *       the load i/o buffer. The file is read in segments of
+ *       #MM_INTERNAL_MAX_DIRECT_LOAD_DATA_SEG bytes.
+ *
+ *       The size of the rest of the open file is checked against the load
+ *       byte count before the first read. A read error after that point
+ *       leaves the destination partly loaded, since the CRC has already
+ *       been verified and there is no copy of the original contents; this
+ *       is reported with #MM_DIRECT_LOAD_ERR_EID.
+ *
+ *       Comment out this line to use the segmented load through the
+ *       i/o buffer, for example on targets where the file system can't
+ *       read directly into the destination memory.
+ *
+ *  \par Limits:
+ *       n/a
+ */
+#define MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD
+
+/**
+ * \brief Maximum number of bytes per direct file load segment
+ *
+ *  \par Description:
+ *       Maximum number of bytes MM will read from a load file straight
+ *       into the destination per task cycle when
+ *       #MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD is defined.
+ *
+ *  \par Limits:
+ *       This value must be longword aligned and can't be less than
+ *       #MM_INTERNAL_MAX_LOAD_DATA_SEG.
+ *       Setting this value to a large number will decrease the amount of
+ *       time available for other tasks to execute during load operations.
+ */
+#define MM_INTERNAL_MAX_DIRECT_LOAD_DATA_SEG                                   \
+  MM_INTERNAL_CFGVAL(MAX_DIRECT_LOAD_DATA_SEG)
+#define DEFAULT_MM_INTERNAL_MAX_DIRECT_LOAD_DATA_SEG 4096
+
+/**
+ * \brief EEPROM compare before write compiler switch
+ *
+ *  \par Description:
+ *       When defined, file loads, fills, and pokes to EEPROM read the
+ *       current contents first and skip the 32 bit words that already
+ *       hold the new data. Each run of changed words is written with a
+ *       single copy. The bytes written and skipped are reported in
+ *       housekeeping telemetry. EEPROM file loads are copied through the
+ *       load i/o buffer even when #MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD
+ *       is defined, so each segment can be compared before it is written.
+ *
+ *       Comment out this line to write every byte, for example on targets
+ *       where EEPROM can't be read back while it is write-enabled.
+ *
+ *  \par Limits:
+ *       n/a
+ */
+#define MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+
 /**
  * \brief Maximum number of bytes for a file dump from RAM memory
  *
@@ -252,6 +437,8 @@
  *       However, setting this value to a large number will decrease
  *       the amount of time available for other tasks to execute and
  *       increase MM CPU utilization during memory fill operations.
+ *       Must be a multiple of 8 so every segment starts at the beginning
+ *       of a 64-bit fill pattern.
  */
 #define MM_INTERNAL_MAX_FILL_DATA_SEG MM_INTERNAL_CFGVAL(MAX_FILL_DATA_SEG)
 #define DEFAULT_MM_INTERNAL_MAX_FILL_DATA_SEG 200
@@ -462,21 +649,139 @@
  * \brief Segment break processor delay
  *
  *  \par Description:
- *       How many milliseconds to delay between segments for dump, load,
- *       and fill operations. A value of zero cycles through the
- *       OS scheduler, giving up what's left of the current timeslice.
+ *       How many milliseconds to delay when a dump, load, or fill
+ *       operation has used up its CPU time budget (see
+ *       #MM_INTERNAL_DEFAULT_CPU_BUDGET). A value of zero cycles through
+ *       the OS scheduler, giving up what's left of the current timeslice.
  *
  *  \par Limits:
  *       The MM app does not place a limit on this parameter.
  *       However, setting this value to a large number will increase the
  *       time required to process load, dump, and fill requests.
- *       It will also increase the likelyhood of MM being late responding
- *       to housekeeping requests since it cannot process such a request
- *       while a memory operation is in progress.
+ *       Housekeeping requests are serviced by the MM main task while
+ *       the worker task is delayed, so this value does not bound
+ *       housekeeping latency.
  */
 #define MM_INTERNAL_PROCESSOR_CYCLE MM_INTERNAL_CFGVAL(PROCESSOR_CYCLE)
 #define DEFAULT_MM_INTERNAL_PROCESSOR_CYCLE 0
 
+/**
+ * \brief Default load, dump, and fill CPU time budget
+ *
+ *  \par Description:
+ *       How many microseconds of CPU time a dump, load, or fill operation
+ *       may use before the MM worker task gives up the CPU for
+ *       #MM_INTERNAL_PROCESSOR_CYCLE milliseconds. Segments are processed
+ *       back to back until the budget is spent. The budget can be changed
+ *       at run time with the #MM_SET_CPU_BUDGET_CC command.
+ *
+ *  \par Limits:
+ *       This value can't be greater than #MM_INTERNAL_MAX_CPU_BUDGET.
+ *       A value of zero gives up the CPU after every segment.
+ */
+#define MM_INTERNAL_DEFAULT_CPU_BUDGET MM_INTERNAL_CFGVAL(DEFAULT_CPU_BUDGET)
+#define DEFAULT_MM_INTERNAL_DEFAULT_CPU_BUDGET 5000
+
+/**
+ * \brief Maximum load, dump, and fill CPU time budget
+ *
+ *  \par Description:
+ *       Largest CPU time budget, in microseconds, that the
+ *       #MM_SET_CPU_BUDGET_CC command will accept.
+ *
+ *  \par Limits:
+ *       This parameter is limited only by the maximum value of the
+ *       uint32 type.
+ *       However, setting this value to a large number allows MM to
+ *       starve lower priority tasks for a long time.
+ */
+#define MM_INTERNAL_MAX_CPU_BUDGET MM_INTERNAL_CFGVAL(MAX_CPU_BUDGET)
+#define DEFAULT_MM_INTERNAL_MAX_CPU_BUDGET 100000
+
+/**
+ * \brief Worker child task name
+ *
+ *  \par Description:
+ *       Name of the MM child task that executes file loads, file dumps,
+ *       and memory fills in the background.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot exceed
+ *       #OS_MAX_API_NAME.  (limit is not verified)
+ */
+#define MM_INTERNAL_WORKER_TASK_NAME MM_INTERNAL_CFGVAL(WORKER_TASK_NAME)
+#define DEFAULT_MM_INTERNAL_WORKER_TASK_NAME "MM_WORKER"
+
+/**
+ * \brief Worker child task stack size
+ *
+ *  \par Description:
+ *       Stack size in bytes allocated for the MM worker child task.
+ *
+ *  \par Limits:
+ *       The MM app does not place a limit on this parameter, but the
+ *       stack must be large enough to hold the local data of the load,
+ *       dump, and fill command handlers.
+ */
+#define MM_INTERNAL_WORKER_STACK_SIZE MM_INTERNAL_CFGVAL(WORKER_STACK_SIZE)
+#define DEFAULT_MM_INTERNAL_WORKER_STACK_SIZE 16384
+
+/**
+ * \brief Worker child task priority
+ *
+ *  \par Description:
+ *       Execution priority of the MM worker child task.
+ *
+ *  \par Limits:
+ *       Must be a lower priority (numerically greater) than the MM main
+ *       task so that housekeeping requests and short commands preempt
+ *       background memory operations.
+ */
+#define MM_INTERNAL_WORKER_PRIORITY MM_INTERNAL_CFGVAL(WORKER_PRIORITY)
+#define DEFAULT_MM_INTERNAL_WORKER_PRIORITY 200
+
+/**
+ * \brief Worker job queue name
+ *
+ *  \par Description:
+ *       Name of the OSAL queue used to hand memory operations from the
+ *       MM main task to the worker child task.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot exceed
+ *       #OS_MAX_API_NAME.  (limit is not verified)
+ */
+#define MM_INTERNAL_WORKER_QUEUE_NAME MM_INTERNAL_CFGVAL(WORKER_QUEUE_NAME)
+#define DEFAULT_MM_INTERNAL_WORKER_QUEUE_NAME "MM_WORKER_Q"
+
+/**
+ * \brief Worker job queue depth
+ *
+ *  \par Description:
+ *       Maximum number of load, dump, and fill commands that may be
+ *       waiting for the worker task. Commands received while the queue
+ *       is full are rejected.
+ *
+ *  \par Limits:
+ *       Must be greater than zero and supported by #OS_QueueCreate.
+ */
+#define MM_INTERNAL_WORKER_QUEUE_DEPTH MM_INTERNAL_CFGVAL(WORKER_QUEUE_DEPTH)
+#define DEFAULT_MM_INTERNAL_WORKER_QUEUE_DEPTH 4
+
+/**
+ * \brief Command mutex name
+ *
+ *  \par Description:
+ *       Name of the OSAL mutex that serializes command processing between
+ *       the MM main task and the worker child task.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot exceed
+ *       #OS_MAX_API_NAME.  (limit is not verified)
+ */
+#define MM_INTERNAL_CMD_MUTEX_NAME MM_INTERNAL_CFGVAL(CMD_MUTEX_NAME)
+#define DEFAULT_MM_INTERNAL_CMD_MUTEX_NAME "MM_CMD_MUTEX"
+
 /**
  * \brief Mission specific version number for MM application
  *
@@ -513,15 +818,72 @@
   ((CFE_MISSION_EVS_MAX_MESSAGE_LENGTH - (13 + 33)) / 5)
 
 /**
- * \brief Dump in an event scratch string size
+ * \brief Dump telemetry packets per housekeeping cycle
+ *
+ *  \par Description:
+ *       Maximum number of dump telemetry packets MM will send each time
+ *       a housekeeping request is received while a "dump memory to
+ *       telemetry" (#MM_DUMP_MEM_TO_TLM_CC) command is in progress.
  *
- * This macro defines the size of the scratch buffer used to build
- * the dump in event message string. Set it to the size of the
- * largest piece shown above including room for a NUL terminator.
+ *  \par Limits:
+ *       This value must be greater than zero. Setting this value to a
+ *       large number will increase the telemetry bandwidth used by a dump
+ *       and the time MM spends handling each housekeeping request.
  */
-#define MM_INTERNAL_DUMPINEVENT_TEMP_CHARS                                     \
-  MM_INTERNAL_CFGVAL(DUMPINEVENT_TEMP_CHARS)
-#define DEFAULT_MM_INTERNAL_DUMPINEVENT_TEMP_CHARS 36
+#define MM_INTERNAL_DUMP_TLM_PACKETS_PER_CYCLE                                 \
+  MM_INTERNAL_CFGVAL(DUMP_TLM_PACKETS_PER_CYCLE)
+#define DEFAULT_MM_INTERNAL_DUMP_TLM_PACKETS_PER_CYCLE 4
+
+/**
+ * \brief Scrub bytes per cycle
+ *
+ *  \par Description:
+ *       Number of bytes of the scrub regions the background scrubber
+ *       folds into their CRCs each time the MM main task wakes up,
+ *       either to process a message or because the pipe read timed
+ *       out. Memory is read one #MM_INTERNAL_MAX_DUMP_DATA_SEG segment at
+ *       a time, so the last segment of a cycle may go past this value.
+ *
+ *  \par Limits:
+ *       This value must be greater than zero. Setting this value to a
+ *       large number will shorten the time it takes to detect a
+ *       corrupted region but increase MM CPU utilization.
+ */
+#define MM_INTERNAL_SCRUB_BYTES_PER_CYCLE                                      \
+  MM_INTERNAL_CFGVAL(SCRUB_BYTES_PER_CYCLE)
+#define DEFAULT_MM_INTERNAL_SCRUB_BYTES_PER_CYCLE 4096
+
+/**
+ * \brief Maximum number of blocks in a scrub index
+ *
+ *  \par Description:
+ *       Number of block CRCs kept in the block index of each scrub
+ *       region. Regions larger than this many
+ *       #MM_INTERNAL_SCRUB_BLOCK_SIZE blocks are indexed with larger
+ *       blocks.
+ *
+ *  \par Limits:
+ *       This value must be greater than zero and no greater than 65536.
+ *       Each block adds four bytes per scrub region to the MM global
+ *       data.
+ */
+#define MM_INTERNAL_MAX_SCRUB_BLOCKS MM_INTERNAL_CFGVAL(MAX_SCRUB_BLOCKS)
+#define DEFAULT_MM_INTERNAL_MAX_SCRUB_BLOCKS 256
+
+/**
+ * \brief Minimum scrub index block size
+ *
+ *  \par Description:
+ *       Smallest number of bytes covered by one block CRC of a scrub
+ *       index.
+ *
+ *  \par Limits:
+ *       This value must be greater than zero and longword aligned.
+ *       Smaller blocks localize corruption more precisely but need more
+ *       CRCs to cover a region.
+ */
+#define MM_INTERNAL_SCRUB_BLOCK_SIZE MM_INTERNAL_CFGVAL(SCRUB_BLOCK_SIZE)
+#define DEFAULT_MM_INTERNAL_SCRUB_BLOCK_SIZE 1024
 
 /**
  * \brief CRC type for dump files
@@ -537,6 +899,20 @@
 #define MM_INTERNAL_DUMP_FILE_CRC_TYPE MM_INTERNAL_CFGVAL(DUMP_FILE_CRC_TYPE)
 #define DEFAULT_MM_INTERNAL_DUMP_FILE_CRC_TYPE CFE_MISSION_ES_DEFAULT_CRC
 
+/**
+ * \brief CRC type for memory checksums
+ *
+ *  \par Description:
+ *       CFE CRC type to use when processing the "checksum memory"
+ *       (#MM_CHECKSUM_MEM_CC) command.
+ *
+ *  \par Limits:
+ *       This must be one of the CRC types supported by the
+ *       #CFE_ES_CalculateCRC function.
+ */
+#define MM_INTERNAL_CHECKSUM_CRC_TYPE MM_INTERNAL_CFGVAL(CHECKSUM_CRC_TYPE)
+#define DEFAULT_MM_INTERNAL_CHECKSUM_CRC_TYPE CFE_MISSION_ES_DEFAULT_CRC
+
 /**
  * \brief CRC type for interrupts disabled loads
  *
@@ -565,6 +941,21 @@
 #define MM_INTERNAL_LOAD_FILE_CRC_TYPE MM_INTERNAL_CFGVAL(LOAD_FILE_CRC_TYPE)
 #define DEFAULT_MM_INTERNAL_LOAD_FILE_CRC_TYPE CFE_MISSION_ES_DEFAULT_CRC
 
+/**
+ * \brief File CRC read size
+ *
+ *  \par Description:
+ *       Number of bytes read from a file at a time when computing the
+ *       CRC of the data in a load file.
+ *
+ *  \par Limits:
+ *       This value must be greater than zero. Larger reads take fewer
+ *       file system calls per file but use a larger static buffer.
+ */
+#define MM_INTERNAL_FILE_CRC_BUFFER_SIZE                                       \
+  MM_INTERNAL_CFGVAL(FILE_CRC_BUFFER_SIZE)
+#define DEFAULT_MM_INTERNAL_FILE_CRC_BUFFER_SIZE 4096
+
 /**
  * \brief Misc Initialization Values
  */
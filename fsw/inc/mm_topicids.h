@@ -32,4 +32,22 @@
 #define MM_MISSION_HK_TLM_TOPICID MM_MISSION_TIDVAL(HK_TLM)
 #define DEFAULT_MM_MISSION_HK_TLM_TOPICID 0x87
 
+#define MM_MISSION_DUMP_TLM_TOPICID MM_MISSION_TIDVAL(DUMP_TLM)
+#define DEFAULT_MM_MISSION_DUMP_TLM_TOPICID 0x8A
+
+#define MM_MISSION_DUMP_INTLM_TOPICID MM_MISSION_TIDVAL(DUMP_INTLM)
+#define DEFAULT_MM_MISSION_DUMP_INTLM_TOPICID 0x8B
+
+#define MM_MISSION_SCRUB_INDEX_TLM_TOPICID MM_MISSION_TIDVAL(SCRUB_INDEX_TLM)
+#define DEFAULT_MM_MISSION_SCRUB_INDEX_TLM_TOPICID 0x8C
+
+#define MM_MISSION_MEM_TEST_TLM_TOPICID MM_MISSION_TIDVAL(MEM_TEST_TLM)
+#define DEFAULT_MM_MISSION_MEM_TEST_TLM_TOPICID 0x8D
+
+#define MM_MISSION_BATCH_PEEK_TLM_TOPICID MM_MISSION_TIDVAL(BATCH_PEEK_TLM)
+#define DEFAULT_MM_MISSION_BATCH_PEEK_TLM_TOPICID 0x8E
+
+#define MM_MISSION_WATCH_TLM_TOPICID MM_MISSION_TIDVAL(WATCH_TLM)
+#define DEFAULT_MM_MISSION_WATCH_TLM_TOPICID 0x8F
+
 #endif /* MM_TOPICIDS_H */
\ No newline at end of file
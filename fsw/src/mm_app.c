@@ -34,9 +34,11 @@
 #include "mm_msgids.h"
 #include "mm_perfids.h"
 #include "mm_platform_cfg.h"
+#include "mm_scrub.h"
 #include "mm_utils.h"
 #include "mm_verify.h"
 #include "mm_version.h"
+#include "mm_worker.h"
 #include <string.h>
 
 /************************************************************************
@@ -52,6 +54,7 @@ MM_AppData_t MM_AppData;
 void MM_AppMain(void) {
   CFE_Status_t Status = CFE_SUCCESS;
   CFE_SB_Buffer_t *BufPtr = NULL;
+  CFE_SB_MsgId_t MsgId = CFE_SB_INVALID_MSG_ID;
 
   /*
   ** Create the first Performance Log entry
@@ -91,8 +94,19 @@ void MM_AppMain(void) {
     if ((Status == CFE_SUCCESS) && (BufPtr != NULL)) {
       /* Process Software Bus message */
       MM_TaskPipe(BufPtr);
+
+      /*
+      ** Housekeeping requests alone may keep the pipe read from timing
+      ** out, so the scheduler wakeup also scrubs memory. Ground commands
+      ** do not, which keeps a burst of them from driving the scrub rate.
+      */
+      CFE_MSG_GetMsgId(&BufPtr->Msg, &MsgId);
+      if (CFE_SB_MsgIdToValue(MsgId) == MM_SEND_HK_MID) {
+        MM_ScrubStep();
+      }
     } else if (Status == CFE_SB_TIME_OUT) {
-      /* No action, but also no error */
+      /* No message to process, scrub memory */
+      MM_ScrubStep();
     } else {
       /*
       ** Exit on pipe read error
@@ -159,6 +173,41 @@ CFE_Status_t MM_AppInit(void) {
   CFE_MSG_Init(CFE_MSG_PTR(MM_AppData.HkTlm.TelemetryHeader),
                CFE_SB_ValueToMsgId(MM_HK_TLM_MID), sizeof(MM_HkTlm_t));
 
+  /*
+  ** Initialize the dump telemetry packets
+  */
+  CFE_MSG_Init(CFE_MSG_PTR(MM_AppData.DumpTlm.TelemetryHeader),
+               CFE_SB_ValueToMsgId(MM_DUMP_TLM_MID), sizeof(MM_DumpTlm_t));
+  CFE_MSG_Init(CFE_MSG_PTR(MM_AppData.DumpInTlm.TelemetryHeader),
+               CFE_SB_ValueToMsgId(MM_DUMP_INTLM_MID), sizeof(MM_DumpInTlm_t));
+
+  /*
+  ** Initialize the scrub index telemetry packet
+  */
+  CFE_MSG_Init(CFE_MSG_PTR(MM_AppData.ScrubIndexTlm.TelemetryHeader),
+               CFE_SB_ValueToMsgId(MM_SCRUB_INDEX_TLM_MID),
+               sizeof(MM_ScrubIndexTlm_t));
+
+  /*
+  ** Initialize the memory test telemetry packet
+  */
+  CFE_MSG_Init(CFE_MSG_PTR(MM_AppData.MemTestTlm.TelemetryHeader),
+               CFE_SB_ValueToMsgId(MM_MEM_TEST_TLM_MID),
+               sizeof(MM_MemTestTlm_t));
+
+  /*
+  ** Initialize the batch peek telemetry packet
+  */
+  CFE_MSG_Init(CFE_MSG_PTR(MM_AppData.BatchPeekTlm.TelemetryHeader),
+               CFE_SB_ValueToMsgId(MM_BATCH_PEEK_TLM_MID),
+               sizeof(MM_BatchPeekTlm_t));
+
+  /*
+  ** Initialize the watch telemetry packet
+  */
+  CFE_MSG_Init(CFE_MSG_PTR(MM_AppData.WatchTlm.TelemetryHeader),
+               CFE_SB_ValueToMsgId(MM_WATCH_TLM_MID), sizeof(MM_WatchTlm_t));
+
   /*
   ** Create Software Bus message pipe
   */
@@ -195,6 +244,14 @@ CFE_Status_t MM_AppInit(void) {
     return Status;
   }
 
+  /*
+  ** Start the worker task that executes load, dump, and fill commands
+  */
+  Status = MM_WorkerInit();
+  if (Status != CFE_SUCCESS) {
+    return Status;
+  }
+
   /*
   ** MM doesn't use tables. If this changes add table registration
   ** and initialization here as shown in the qq_app.c template
@@ -209,6 +266,8 @@ CFE_Status_t MM_AppInit(void) {
   ** Initialize MM housekeeping information
   */
   MM_ResetHk();
+  MM_AppData.HkTlm.Payload.CpuBudget = MM_INTERNAL_DEFAULT_CPU_BUDGET;
+  MM_AppData.HkTlm.Payload.DumpCrcType = MM_CrcType_DEFAULT;
 
   /*
   ** Application startup event message
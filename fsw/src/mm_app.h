@@ -28,9 +28,11 @@
  * Includes
  ************************************************************************/
 #include "cfe.h"
+#include "mm_filedefs.h"
 #include "mm_mission_cfg.h"
 #include "mm_msg.h"
 #include "mm_platform_cfg.h"
+#include "mm_rle.h"
 
 /************************************************************************
  * Macro Definitions
@@ -46,6 +48,7 @@
 #define MM_VERIFY_FILL 3  /**< \brief Verify fill parameters */
 #define MM_VERIFY_WID                                                          \
   4 /**< \brief Verify write interrupts disabled parameters */
+#define MM_VERIFY_INTLM 5 /**< \brief Verify dump in telemetry parameters */
 /**\}*/
 
 #define MM_MAX_MEM_TYPE_STR_LEN                                                \
@@ -55,22 +58,139 @@
  * Type Definitions
  ************************************************************************/
 
+/**
+ *  \brief Dump to telemetry progress
+ */
+typedef struct {
+  cpuaddr Address;           /**< \brief Address of the next byte to send */
+  MM_MemType_Enum_t MemType; /**< \brief Memory type being dumped */
+  uint32 BytesRemaining;     /**< \brief Bytes still to be sent, zero when no
+                                  dump to telemetry is in progress */
+  uint32 Sequence;           /**< \brief Sequence number of the next packet */
+} MM_DumpTlmState_t;
+
+/**
+ *  \brief Chunked load progress
+ */
+typedef struct {
+  bool InProgress;           /**< \brief A chunked load has been started */
+  MM_MemType_Enum_t MemType; /**< \brief Memory type to load */
+  cpuaddr DestAddress;       /**< \brief Fully resolved destination address */
+  uint32 NumOfBytes;         /**< \brief Number of bytes to load */
+  uint32 Crc;                /**< \brief Expected CRC of the load data */
+  uint32 BytesReceived;      /**< \brief Chunk bytes stored so far, counting
+                                  chunks that were sent again */
+  uint32 CommitsQueued;      /**< \brief Commits queued or running on the
+                                  worker task, the load buffer can't be
+                                  changed while this is not zero */
+} MM_ChunkLoadState_t;
+
+/**
+ *  \brief Scrub region
+ */
+typedef struct {
+  MM_MemType_Enum_t MemType; /**< \brief Memory type of the region */
+  cpuaddr Address;           /**< \brief Fully resolved region address */
+  uint32 NumOfBytes;         /**< \brief Region size, zero when the region
+                                  is not defined */
+  uint32 GoldenCrc;          /**< \brief Expected CRC of the region */
+} MM_ScrubRegion_t;
+
+/**
+ *  \brief Scrub region block index
+ */
+typedef struct {
+  uint32 BlockSize; /**< \brief Bytes covered by each block */
+  uint32 NumBlocks; /**< \brief Number of blocks, zero when the region has
+                         no index */
+  uint32 RootCrc;   /**< \brief CRC of the block CRCs */
+  uint32 BlockCrc[MM_INTERNAL_MAX_SCRUB_BLOCKS]; /**< \brief CRC of each
+                                                    block */
+} MM_ScrubIndex_t;
+
+/**
+ *  \brief Background scrubber progress
+ */
+typedef struct {
+  MM_ScrubRegion_t Regions[MM_INTERFACE_MAX_SCRUB_REGIONS]; /**< \brief Scrub
+                                                               regions */
+  MM_ScrubIndex_t Index[MM_INTERFACE_MAX_SCRUB_REGIONS];    /**< \brief Block
+                                                               index of each
+                                                               region */
+  uint32 Generation[MM_INTERFACE_MAX_SCRUB_REGIONS]; /**< \brief Times each
+                                                        region has been
+                                                        restarted */
+  uint32 Region; /**< \brief Region being scrubbed */
+  uint32 Offset; /**< \brief Bytes of the region already folded into Crc */
+  uint32 Crc;    /**< \brief Running CRC of the region being scrubbed */
+} MM_ScrubState_t;
+
+/**
+ *  \brief Watch list entry
+ */
+typedef struct {
+  MM_MemType_Enum_t MemType; /**< \brief Memory type to sample */
+  cpuaddr Address;           /**< \brief Fully resolved address to sample */
+  uint32 DataSize;           /**< \brief Bits to read, zero when the entry
+                                  is not defined */
+} MM_WatchEntry_t;
+
+/**
+ *  \brief Peek sampler progress
+ */
+typedef struct {
+  MM_WatchEntry_t Entries[MM_INTERFACE_MAX_WATCH_ENTRIES]; /**< \brief Watch
+                                                              list */
+  uint32 Period;   /**< \brief Housekeeping requests between samples, zero
+                        when the sampler is stopped */
+  uint32 Count;    /**< \brief Housekeeping requests since the last sample */
+  uint32 Sequence; /**< \brief Sequence number of the next packet */
+} MM_SamplerState_t;
+
 /**
  *  \brief MM global data structure
  */
 typedef struct {
   MM_HkTlm_t HkTlm; /**< \brief Housekeeping telemetry packet */
+  MM_DumpTlm_t DumpTlm; /**< \brief Dump telemetry packet */
+  MM_DumpTlmState_t DumpTlmState; /**< \brief Dump to telemetry progress */
+  MM_DumpInTlm_t DumpInTlm; /**< \brief Dump in telemetry packet */
+  MM_ScrubIndexTlm_t ScrubIndexTlm; /**< \brief Scrub index packet */
+  MM_MemTestTlm_t MemTestTlm; /**< \brief Memory test packet */
+  MM_BatchPeekTlm_t BatchPeekTlm; /**< \brief Batch peek packet */
+  MM_WatchTlm_t WatchTlm; /**< \brief Watch packet */
+  MM_ChunkLoadState_t ChunkLoad; /**< \brief Chunked load progress */
+  MM_ScrubState_t Scrub; /**< \brief Background scrubber progress */
+  MM_SamplerState_t Sampler; /**< \brief Peek sampler progress */
 
   CFE_SB_PipeId_t CmdPipe; /**< \brief Command pipe ID */
 
   uint32 RunStatus; /**< \brief Application run status */
 
+  osal_id_t CmdMutex;    /**< \brief Serializes main and worker task commands */
+  osal_id_t WorkerQueue; /**< \brief Worker task job queue */
+  CFE_ES_TaskId_t WorkerTaskId; /**< \brief Worker child task ID */
+
   size_t LoadBuffer[MM_INTERNAL_MAX_LOAD_DATA_SEG /
                     4]; /**< \brief Load file i/o buffer */
   size_t DumpBuffer[MM_INTERNAL_MAX_DUMP_DATA_SEG /
                     4]; /**< \brief Dump file i/o buffer */
   size_t FillBuffer[MM_INTERNAL_MAX_FILL_DATA_SEG /
                     4]; /**< \brief Fill memory buffer   */
+  uint32 StageBuffer[MM_INTERNAL_MAX_STAGED_LOAD_BYTES /
+                     sizeof(uint32)]; /**< \brief Staged load buffer */
+  uint32 ChunkLoadBuffer[MM_INTERNAL_MAX_CHUNK_LOAD_BYTES /
+                         sizeof(uint32)]; /**< \brief Chunked load buffer */
+  uint32 ScrubBuffer[MM_INTERNAL_MAX_DUMP_DATA_SEG /
+                     sizeof(uint32)]; /**< \brief Scrubber read buffer */
+  MM_ScrubIndex_t ScrubIndexBuffer; /**< \brief Scrub index being built or
+                                         compared by the worker task */
+  uint8 CodecBuffer[MM_RLE_MAX_ENCODED_SIZE(
+      MM_INTERNAL_MAX_DUMP_DATA_SEG)]; /**< \brief Compressed file i/o buffer */
+  MM_LoadDumpFileHeader_t
+      RegionDir[MM_INTERNAL_MAX_FILE_REGIONS]; /**< \brief Region directory */
+
+  OS_time_t SegmentStartTime; /**< \brief Start of the current CPU budget */
 } MM_AppData_t;
 
 /** \brief Memory Manager application global */
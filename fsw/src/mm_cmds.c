@@ -22,6 +22,7 @@
 
 #include "mm_cmds.h"
 #include "mm_app.h"
+#include "mm_crc.h"
 #include "mm_dump.h"
 #include "mm_eventids.h"
 #include "mm_extern_typedefs.h"
@@ -29,7 +30,10 @@
 #include "mm_interface_cfg.h"
 #include "mm_internal_cfg.h"
 #include "mm_load.h"
+#include "mm_memtest.h"
 #include "mm_msg.h"
+#include "mm_sampler.h"
+#include "mm_scrub.h"
 #include "mm_utils.h"
 #include "mm_version.h"
 
@@ -63,6 +67,16 @@ CFE_Status_t MM_SendHkCmd(const MM_SendHkCmd_t *Msg) {
   CFE_SB_TimeStampMsg(CFE_MSG_PTR(MM_AppData.HkTlm.TelemetryHeader));
   CFE_SB_TransmitMsg(CFE_MSG_PTR(MM_AppData.HkTlm.TelemetryHeader), true);
 
+  /*
+  ** Continue any dump to telemetry in progress
+  */
+  MM_SendDumpTlm();
+
+  /*
+  ** Sample the watch list when it is due
+  */
+  MM_SamplerStep();
+
   /*
   ** This command does not affect the command execution counter
   */
@@ -97,6 +111,9 @@ CFE_Status_t MM_ResetCountersCmd(const MM_ResetCountersCmd_t *Msg) {
   MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_RESET;
   MM_AppData.HkTlm.Payload.CmdCounter = 0;
   MM_AppData.HkTlm.Payload.ErrCounter = 0;
+  MM_AppData.HkTlm.Payload.EepromBytesWritten = 0;
+  MM_AppData.HkTlm.Payload.EepromBytesSkipped = 0;
+  MM_AppData.HkTlm.Payload.ScrubMismatches = 0;
 
   CFE_EVS_SendEvent(MM_RESET_INF_EID, CFE_EVS_EventType_INFORMATION,
                     "Reset counters command received");
@@ -346,8 +363,8 @@ CFE_Status_t MM_LoadMemWIDCmd(const MM_LoadMemWIDCmd_t *Msg) {
                                 MM_VERIFY_WID) == CFE_PSP_SUCCESS) {
       /* Verify data integrity check value */
       ComputedCRC =
-          CFE_ES_CalculateCRC(Msg->Payload.DataArray, Msg->Payload.NumOfBytes,
-                              0, MM_INTERNAL_LOAD_WID_CRC_TYPE);
+          MM_CalculateCRC(Msg->Payload.DataArray, Msg->Payload.NumOfBytes, 0,
+                          MM_INTERNAL_LOAD_WID_CRC_TYPE);
       /*
       ** If the CRC matches do the load
       */
@@ -404,7 +421,11 @@ CFE_Status_t MM_LoadMemFromFileCmd(const MM_LoadMemFromFileCmd_t *Msg) {
   MM_LoadDumpFileHeader_t MMFileHeader;
   uint32 ComputedCRC;
   int32 LSeekSize;
+  bool Staged;
+  bool Patch;
+  bool Compressed;
 
+  memset(&CFEFileHeader, 0, sizeof(CFEFileHeader));
   memset(&MMFileHeader, 0, sizeof(MMFileHeader));
 
   /* Make sure string is null terminated before attempting to process it */
@@ -418,26 +439,73 @@ CFE_Status_t MM_LoadMemFromFileCmd(const MM_LoadMemFromFileCmd_t *Msg) {
     /* Read in the file headers */
     Status =
         MM_ReadFileHeaders(FileName, FileHandle, &CFEFileHeader, &MMFileHeader);
-    if (Status == OS_SUCCESS) {
-      /* Verify the file size is correct */
-      Status = MM_VerifyLoadFileSize(FileName, &MMFileHeader);
+    if ((Status == OS_SUCCESS) &&
+        (CFEFileHeader.SubType == MM_INTERNAL_CFE_HDR_REGION_SUBTYPE)) {
+      /*
+      ** Region files are checked and loaded in one sequential read of the
+      ** region directory and the region data
+      */
+      Status = MM_LoadRegionsFromFile(FileHandle, FileName, &MMFileHeader);
+      if (Status == OS_SUCCESS) {
+        MM_AppData.HkTlm.Payload.CmdCounter++;
+        CFE_EVS_SendEvent(
+            MM_LD_MEM_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+            "Load Memory From File Command: Loaded %d bytes in %u regions "
+            "from file '%s'",
+            (int)MM_AppData.HkTlm.Payload.BytesProcessed,
+            (unsigned int)(MMFileHeader.NumOfBytes /
+                           sizeof(MM_LoadDumpFileHeader_t)),
+            FileName);
+      } else {
+        MM_AppData.HkTlm.Payload.ErrCounter++;
+      }
+    } else if (Status == OS_SUCCESS) {
+      Patch = (CFEFileHeader.SubType == MM_INTERNAL_CFE_HDR_PATCH_SUBTYPE);
+      Compressed =
+          (CFEFileHeader.SubType == MM_INTERNAL_CFE_HDR_COMPRESSED_SUBTYPE);
+
+      /*
+      ** Verify the file size is correct, the size of a compressed file
+      ** depends on its contents
+      */
+      if (!Compressed) {
+        Status = MM_VerifyLoadFileSize(FileName, &MMFileHeader);
+      }
       if (Status == OS_SUCCESS) {
-        /* Verify data integrity check value */
-        Status = MM_ComputeCRCFromFile(FileHandle, &ComputedCRC,
-                                       MM_INTERNAL_LOAD_FILE_CRC_TYPE);
+        /*
+        ** Load files that fit in the staging buffer are read only once, the
+        ** CRC is computed as the data is staged. Larger load files are read
+        ** once to verify the CRC and then again to load memory. Patch load
+        ** files are always staged. Compressed load files are decompressed
+        ** one segment at a time on both reads.
+        */
+        Staged = Patch || (!Compressed && (MMFileHeader.NumOfBytes <=
+                                           MM_INTERNAL_MAX_STAGED_LOAD_BYTES));
+        if (Staged) {
+          Status = MM_StageLoadFile(FileHandle, FileName, &MMFileHeader,
+                                    &ComputedCRC);
+        } else if (Compressed) {
+          Status = MM_LoadMemFromCompressedFile(
+              FileHandle, FileName, &MMFileHeader, 0, false, &ComputedCRC);
+        } else {
+          /* Verify data integrity check value */
+          Status = MM_ComputeCRCFromFile(FileHandle, &ComputedCRC,
+                                         MMFileHeader.CrcType);
+        }
         if (Status == OS_SUCCESS) {
-          /*
-          ** Reset the file pointer to the start of the load data, need to do
-          *this
-          ** because MM_ComputeCRCFromFile reads to the end of file
-          */
-          LSeekSize = OS_lseek(
-              FileHandle,
-              (sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t)),
-              OS_SEEK_SET);
-          if (LSeekSize !=
-              (sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t))) {
-            Status = OS_ERROR;
+          if (!Staged) {
+            /*
+            ** Reset the file pointer to the start of the load data, need to
+            ** do this because the CRC pass reads to the end of the load data
+            */
+            LSeekSize = OS_lseek(
+                FileHandle,
+                (sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t)),
+                OS_SEEK_SET);
+            if (LSeekSize !=
+                (sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t))) {
+              Status = OS_ERROR;
+            }
           }
 
           /* Check the computed CRC against the file header CRC */
@@ -447,47 +515,68 @@ CFE_Status_t MM_LoadMemFromFileCmd(const MM_LoadMemFromFileCmd_t *Msg) {
                 MM_ResolveSymAddr(&(MMFileHeader.SymAddress), &DestAddress);
 
             if (Status == OS_SUCCESS) {
-              /* Run necessary checks on command parameters */
-              Status = MM_VerifyLoadDumpParams(
-                  DestAddress, MMFileHeader.MemType, MMFileHeader.NumOfBytes,
-                  MM_VERIFY_LOAD);
+              /*
+              ** Run necessary checks on command parameters, the runs of a
+              ** patch file are checked individually when they are applied
+              */
+              if (!Patch) {
+                Status = MM_VerifyLoadDumpParams(
+                    DestAddress, MMFileHeader.MemType, MMFileHeader.NumOfBytes,
+                    MM_VERIFY_LOAD);
+              }
               if (Status == CFE_PSP_SUCCESS) {
-                /* Call the load routine for the specified memory type */
-                switch (MMFileHeader.MemType) {
-                case MM_MemType_RAM:
-                case MM_MemType_EEPROM:
-                  Status = MM_LoadMemFromFile(FileHandle, FileName,
-                                              &MMFileHeader, DestAddress);
-                  break;
+                if (Patch) {
+                  /* Apply the verified patch runs to memory */
+                  Status = MM_LoadPatchFromStage(FileName, &MMFileHeader,
+                                                 DestAddress);
+                } else if (Staged) {
+                  /* Commit the verified staged data to memory */
+                  Status = MM_LoadMemFromStage(FileName, &MMFileHeader,
+                                               DestAddress);
+                } else if (Compressed) {
+                  /* Decompress the load data again, this time into memory */
+                  Status = MM_LoadMemFromCompressedFile(
+                      FileHandle, FileName, &MMFileHeader, DestAddress, true,
+                      &ComputedCRC);
+                } else {
+                  /* Call the load routine for the specified memory type */
+                  switch (MMFileHeader.MemType) {
+                  case MM_MemType_RAM:
+                  case MM_MemType_EEPROM:
+                    Status = MM_LoadMemFromFile(FileHandle, FileName,
+                                                &MMFileHeader, DestAddress);
+                    break;
 
 #ifdef MM_INTERNAL_OPT_CODE_MEM32_MEMTYPE
-                case MM_MemType_MEM32:
-                  Status = MM_LoadMem32FromFile(FileHandle, FileName,
-                                                &MMFileHeader, DestAddress);
-                  break;
+                  case MM_MemType_MEM32:
+                    Status = MM_LoadMem32FromFile(FileHandle, FileName,
+                                                  &MMFileHeader, DestAddress);
+                    break;
 #endif /* MM_INTERNAL_OPT_CODE_MEM32_MEMTYPE */
 
 #ifdef MM_INTERNAL_OPT_CODE_MEM16_MEMTYPE
-                case MM_MemType_MEM16:
-                  Status = MM_LoadMem16FromFile(FileHandle, FileName,
-                                                &MMFileHeader, DestAddress);
-                  break;
+                  case MM_MemType_MEM16:
+                    Status = MM_LoadMem16FromFile(FileHandle, FileName,
+                                                  &MMFileHeader, DestAddress);
+                    break;
 #endif /* MM_INTERNAL_OPT_CODE_MEM16_MEMTYPE */
 
 #ifdef MM_INTERNAL_OPT_CODE_MEM8_MEMTYPE
-                case MM_MemType_MEM8:
-                  Status = MM_LoadMem8FromFile(FileHandle, FileName,
-                                               &MMFileHeader, DestAddress);
-                  break;
+                  case MM_MemType_MEM8:
+                    Status = MM_LoadMem8FromFile(FileHandle, FileName,
+                                                 &MMFileHeader, DestAddress);
+                    break;
 #endif /* MM_INTERNAL_OPT_CODE_MEM8_MEMTYPE */
 
-                /*
-                ** We don't need a default case, a bad MemType will get caught
-                ** in the MM_VerifyFileLoadParams function and we won't get here
-                */
-                default:
-                  Status = OS_ERROR;
-                  break;
+                  /*
+                  ** We don't need a default case, a bad MemType will get
+                  ** caught in the MM_VerifyFileLoadParams function and we
+                  ** won't get here
+                  */
+                  default:
+                    Status = OS_ERROR;
+                    break;
+                  }
                 }
 
                 if (Status == OS_SUCCESS) {
@@ -527,8 +616,11 @@ CFE_Status_t MM_LoadMemFromFileCmd(const MM_LoadMemFromFileCmd_t *Msg) {
                               (unsigned int)ComputedCRC, FileName);
           }
 
-        } /* end MM_ComputeCRCFromFile if */
-        else {
+        } /* end MM_StageLoadFile/MM_ComputeCRCFromFile if */
+        else if (Staged || Compressed) {
+          /* The read error has already been reported */
+          MM_AppData.HkTlm.Payload.ErrCounter++;
+        } else {
           MM_AppData.HkTlm.Payload.ErrCounter++;
           CFE_EVS_SendEvent(
               MM_COMPUTECRCFROMFILE_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -576,9 +668,10 @@ CFE_Status_t MM_FillMemCmd(const MM_FillMemCmd_t *Msg) {
   /* Resolve symbolic address */
   if (MM_ResolveSymAddr(&(DestSymAddress), &DestAddress) == OS_SUCCESS) {
     /* Run necessary checks on command parameters */
-    if (MM_VerifyLoadDumpParams(DestAddress, Msg->Payload.MemType,
-                                Msg->Payload.NumOfBytes,
-                                MM_VERIFY_FILL) == CFE_SUCCESS) {
+    if ((MM_VerifyLoadDumpParams(DestAddress, Msg->Payload.MemType,
+                                 Msg->Payload.NumOfBytes,
+                                 MM_VERIFY_FILL) == CFE_SUCCESS) &&
+        (MM_VerifyFillPattern(&Msg->Payload) == OS_SUCCESS)) {
       switch (Msg->Payload.MemType) {
       case MM_MemType_RAM:
       case MM_MemType_EEPROM:
@@ -690,10 +783,12 @@ CFE_Status_t MM_PeekCmd(const MM_PeekCmd_t *Msg) {
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Dump memory to file command                                      */
+/* Dump memory to a plain or compressed file, shared by the dump   */
+/* to file commands                                                */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-CFE_Status_t MM_DumpMemToFileCmd(const MM_DumpMemToFileCmd_t *Msg) {
+static void MM_DumpMemToFileCommon(const MM_DumpMemToFileCmd_Payload_t *Payload,
+                                   bool Compress) {
   int32 Status;
   osal_id_t FileHandle = OS_OBJECT_ID_UNDEFINED;
   cpuaddr SrcAddress = 0;
@@ -702,26 +797,37 @@ CFE_Status_t MM_DumpMemToFileCmd(const MM_DumpMemToFileCmd_t *Msg) {
   CFE_FS_Header_t CFEFileHeader;
   MM_LoadDumpFileHeader_t MMFileHeader;
 
-  SrcSymAddress = Msg->Payload.SrcSymAddress;
+  SrcSymAddress = Payload->SrcSymAddress;
 
   /* Make sure strings are null terminated before attempting to process them */
-  CFE_SB_MessageStringGet(FileName, Msg->Payload.FileName, NULL,
-                          sizeof(FileName), sizeof(Msg->Payload.FileName));
+  CFE_SB_MessageStringGet(FileName, Payload->FileName, NULL,
+                          sizeof(FileName), sizeof(Payload->FileName));
 
   /* Resolve the symbolic address in command message */
   Status = MM_ResolveSymAddr(&(SrcSymAddress), &SrcAddress);
 
   if (Status == OS_SUCCESS) {
     /* Run necessary checks on command parameters */
-    Status = MM_VerifyLoadDumpParams(SrcAddress, Msg->Payload.MemType,
-                                     Msg->Payload.NumOfBytes, MM_VERIFY_DUMP);
+    Status = MM_VerifyLoadDumpParams(SrcAddress, Payload->MemType,
+                                     Payload->NumOfBytes, MM_VERIFY_DUMP);
+
+    /* Only byte addressable memory can be dumped to a compressed file */
+    if ((Status == OS_SUCCESS) && Compress &&
+        (Payload->MemType != MM_MemType_RAM) &&
+        (Payload->MemType != MM_MemType_EEPROM)) {
+      Status = OS_ERROR;
+      CFE_EVS_SendEvent(MM_COMPRESS_MEMTYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Compressed dump not supported for MemType = %d",
+                        (int)Payload->MemType);
+    }
 
     if (Status == OS_SUCCESS) {
       /*
       ** Initialize the cFE primary file header structure
       */
       CFE_FS_InitHeader(&CFEFileHeader, MM_INTERNAL_CFE_HDR_DESCRIPTION,
-                        MM_INTERNAL_CFE_HDR_SUBTYPE);
+                        Compress ? MM_INTERNAL_CFE_HDR_COMPRESSED_SUBTYPE
+                                 : MM_INTERNAL_CFE_HDR_SUBTYPE);
 
       /*
       ** Initialize the MM secondary file header structure
@@ -733,8 +839,9 @@ CFE_Status_t MM_DumpMemToFileCmd(const MM_DumpMemToFileCmd_t *Msg) {
       ** Copy command data to file secondary header
       */
       MMFileHeader.SymAddress.Offset = CFE_ES_MEMADDRESS_C(SrcAddress);
-      MMFileHeader.MemType = Msg->Payload.MemType;
-      MMFileHeader.NumOfBytes = Msg->Payload.NumOfBytes;
+      MMFileHeader.MemType = Payload->MemType;
+      MMFileHeader.CrcType = MM_AppData.HkTlm.Payload.DumpCrcType;
+      MMFileHeader.NumOfBytes = Payload->NumOfBytes;
 
       /*
       ** Create and open dump file
@@ -750,24 +857,33 @@ CFE_Status_t MM_DumpMemToFileCmd(const MM_DumpMemToFileCmd_t *Msg) {
           switch (MMFileHeader.MemType) {
           case MM_MemType_RAM:
           case MM_MemType_EEPROM:
-            Status = MM_DumpMemToFile(FileHandle, FileName, &MMFileHeader);
+            if (Compress) {
+              Status = MM_DumpMemToCompressedFile(
+                  FileHandle, FileName, &MMFileHeader, &MMFileHeader.Crc);
+            } else {
+              Status = MM_DumpMemToFile(FileHandle, FileName, &MMFileHeader,
+                                        &MMFileHeader.Crc);
+            }
             break;
 
 #ifdef MM_INTERNAL_OPT_CODE_MEM32_MEMTYPE
           case MM_MemType_MEM32:
-            Status = MM_DumpMem32ToFile(FileHandle, FileName, &MMFileHeader);
+            Status = MM_DumpMem32ToFile(FileHandle, FileName, &MMFileHeader,
+                                        &MMFileHeader.Crc);
             break;
 #endif /* MM_INTERNAL_OPT_CODE_MEM32_MEMTYPE */
 
 #ifdef MM_INTERNAL_OPT_CODE_MEM16_MEMTYPE
           case MM_MemType_MEM16:
-            Status = MM_DumpMem16ToFile(FileHandle, FileName, &MMFileHeader);
+            Status = MM_DumpMem16ToFile(FileHandle, FileName, &MMFileHeader,
+                                        &MMFileHeader.Crc);
             break;
 #endif /* MM_INTERNAL_OPT_CODE_MEM16_MEMTYPE */
 
 #ifdef MM_INTERNAL_OPT_CODE_MEM8_MEMTYPE
           case MM_MemType_MEM8:
-            Status = MM_DumpMem8ToFile(FileHandle, FileName, &MMFileHeader);
+            Status = MM_DumpMem8ToFile(FileHandle, FileName, &MMFileHeader,
+                                       &MMFileHeader.Crc);
             break;
 #endif /* MM_INTERNAL_OPT_CODE_MEM8_MEMTYPE */
           default:
@@ -780,61 +896,34 @@ CFE_Status_t MM_DumpMemToFileCmd(const MM_DumpMemToFileCmd_t *Msg) {
 
           if (Status == CFE_PSP_SUCCESS) {
             /*
-            ** Compute CRC of dumped data
+            ** Rewrite the file headers with the CRC computed while the data
+            ** was dumped. The subfunctions will take care of moving the file
+            ** pointer to the beginning of the file so we don't need to do it
+            ** here.
             */
-            Status = OS_lseek(
-                FileHandle,
-                (sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t)),
-                OS_SEEK_SET);
-            if (Status !=
-                (sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t))) {
-              MM_AppData.HkTlm.Payload.ErrCounter++;
+            Status = MM_WriteFileHeaders(FileName, FileHandle, &CFEFileHeader,
+                                         &MMFileHeader);
+            if (Status == OS_SUCCESS) {
+              /*
+              ** Update last action statistics
+              */
+              MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_DUMP_TO_FILE;
+              MM_AppData.HkTlm.Payload.MemType = Payload->MemType;
+              MM_AppData.HkTlm.Payload.Address =
+                  CFE_ES_MEMADDRESS_C(SrcAddress);
+              MM_AppData.HkTlm.Payload.BytesProcessed = Payload->NumOfBytes;
+              snprintf(MM_AppData.HkTlm.Payload.FileName,
+                       CFE_MISSION_MAX_PATH_LEN, "%s", FileName);
+
+              MM_AppData.HkTlm.Payload.CmdCounter++;
+              CFE_EVS_SendEvent(
+                  MM_DMP_MEM_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                  "Dump Memory To File Command: Dumped %d bytes from "
+                  "address %p to file '%s'",
+                  (int)MM_AppData.HkTlm.Payload.BytesProcessed,
+                  (void *)SrcAddress, FileName);
             } else {
-              Status = MM_ComputeCRCFromFile(FileHandle, &MMFileHeader.Crc,
-                                             MM_INTERNAL_DUMP_FILE_CRC_TYPE);
-              if (Status == OS_SUCCESS) {
-                /*
-                ** Rewrite the file headers. The subfunctions will take care of
-                *moving
-                ** the file pointer to the beginning of the file so we don't
-                *need to do it
-                ** here.
-                */
-                Status = MM_WriteFileHeaders(FileName, FileHandle,
-                                             &CFEFileHeader, &MMFileHeader);
-                if (Status == OS_SUCCESS) {
-                  /*
-                  ** Update last action statistics
-                  */
-                  MM_AppData.HkTlm.Payload.LastAction =
-                      MM_LastAction_DUMP_TO_FILE;
-                  MM_AppData.HkTlm.Payload.MemType = Msg->Payload.MemType;
-                  MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(SrcAddress);
-                  MM_AppData.HkTlm.Payload.BytesProcessed =
-                      Msg->Payload.NumOfBytes;
-                  snprintf(MM_AppData.HkTlm.Payload.FileName,
-                           CFE_MISSION_MAX_PATH_LEN, "%s", FileName);
-
-                  MM_AppData.HkTlm.Payload.CmdCounter++;
-                  CFE_EVS_SendEvent(
-                      MM_DMP_MEM_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
-                      "Dump Memory To File Command: Dumped %d bytes from "
-                      "address %p to file '%s'",
-                      (int)MM_AppData.HkTlm.Payload.BytesProcessed,
-                      (void *)SrcAddress, FileName);
-                } else {
-                  MM_AppData.HkTlm.Payload.ErrCounter++;
-                }
-
-              } /* end MM_ComputeCRCFromFile if */
-              else {
-                MM_AppData.HkTlm.Payload.ErrCounter++;
-                CFE_EVS_SendEvent(MM_COMPUTECRCFROMFILE_ERR_EID,
-                                  CFE_EVS_EventType_ERROR,
-                                  "MM_ComputeCRCFromFile error received: RC = "
-                                  "0x%08X File = '%s'",
-                                  (unsigned int)Status, FileName);
-              }
+              MM_AppData.HkTlm.Payload.ErrCounter++;
             }
           } else {
             MM_AppData.HkTlm.Payload.ErrCounter++;
@@ -868,6 +957,150 @@ CFE_Status_t MM_DumpMemToFileCmd(const MM_DumpMemToFileCmd_t *Msg) {
                       "Symbolic address can't be resolved: Name = '%s'",
                       SrcSymAddress.SymName);
   }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump memory to file command                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_DumpMemToFileCmd(const MM_DumpMemToFileCmd_t *Msg) {
+  MM_DumpMemToFileCommon(&Msg->Payload, false);
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump memory to compressed file command                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t
+MM_DumpMemToCompressedFileCmd(const MM_DumpMemToCompressedFileCmd_t *Msg) {
+  MM_DumpMemToFileCommon(&Msg->Payload, true);
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump regions to file command                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_DumpRegionsToFileCmd(const MM_DumpRegionsToFileCmd_t *Msg) {
+  int32 Status = OS_SUCCESS;
+  osal_id_t FileHandle = OS_OBJECT_ID_UNDEFINED;
+  cpuaddr SrcAddress = 0;
+  char FileName[CFE_MISSION_MAX_PATH_LEN];
+  MM_SymAddr_t SrcSymAddress;
+  CFE_FS_Header_t CFEFileHeader;
+  MM_LoadDumpFileHeader_t MMFileHeader;
+  MM_LoadDumpFileHeader_t *Region = &MM_AppData.RegionDir[0];
+  const MM_DumpRegion_t *CmdRegion;
+  uint32 NumRegions = Msg->Payload.NumRegions;
+  uint32 TotalBytes = 0;
+  uint32 i;
+
+  /* Make sure strings are null terminated before attempting to process them */
+  CFE_SB_MessageStringGet(FileName, Msg->Payload.FileName, NULL,
+                          sizeof(FileName), sizeof(Msg->Payload.FileName));
+
+  if ((NumRegions == 0) || (NumRegions > MM_INTERFACE_MAX_DUMP_REGIONS)) {
+    Status = OS_ERROR;
+    CFE_EVS_SendEvent(MM_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Region dump count invalid: Regions = %u Max = %u",
+                      (unsigned int)NumRegions,
+                      (unsigned int)MM_INTERFACE_MAX_DUMP_REGIONS);
+  }
+
+  /*
+  ** Resolve and check every region before the dump file is created, the
+  ** region directory holds the fully resolved addresses
+  */
+  for (i = 0; (Status == OS_SUCCESS) && (i < NumRegions); i++) {
+    CmdRegion = &Msg->Payload.Regions[i];
+    SrcSymAddress = CmdRegion->SrcSymAddress;
+
+    if (MM_ResolveSymAddr(&(SrcSymAddress), &SrcAddress) != OS_SUCCESS) {
+      Status = OS_ERROR;
+      CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Symbolic address can't be resolved: Name = '%s'",
+                        SrcSymAddress.SymName);
+    } else if (MM_VerifyLoadDumpParams(SrcAddress, CmdRegion->MemType,
+                                       CmdRegion->NumOfBytes,
+                                       MM_VERIFY_DUMP) != OS_SUCCESS) {
+      Status = OS_ERROR;
+      CFE_EVS_SendEvent(MM_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Region %u failed parameters check: File = '%s'",
+                        (unsigned int)i, FileName);
+    } else {
+      memset(&Region[i], 0, sizeof(Region[i]));
+      Region[i].SymAddress.SymName[0] = MM_INTERNAL_CLEAR_SYMNAME;
+      Region[i].SymAddress.Offset = CFE_ES_MEMADDRESS_C(SrcAddress);
+      Region[i].MemType = CmdRegion->MemType;
+      Region[i].CrcType = MM_AppData.HkTlm.Payload.DumpCrcType;
+      Region[i].NumOfBytes = CmdRegion->NumOfBytes;
+      TotalBytes += CmdRegion->NumOfBytes;
+    }
+  }
+
+  if (Status == OS_SUCCESS) {
+    CFE_FS_InitHeader(&CFEFileHeader, MM_INTERNAL_CFE_HDR_DESCRIPTION,
+                      MM_INTERNAL_CFE_HDR_REGION_SUBTYPE);
+
+    /* The secondary header describes the region directory */
+    memset(&MMFileHeader, 0, sizeof(MMFileHeader));
+    MMFileHeader.SymAddress.SymName[0] = MM_INTERNAL_CLEAR_SYMNAME;
+    MMFileHeader.CrcType = MM_AppData.HkTlm.Payload.DumpCrcType;
+    MMFileHeader.NumOfBytes = NumRegions * sizeof(MM_LoadDumpFileHeader_t);
+
+    Status = OS_OpenCreate(&FileHandle, FileName,
+                           OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                           OS_READ_WRITE);
+    if (Status == OS_SUCCESS) {
+      Status = MM_DumpRegionsToFile(FileHandle, FileName, &CFEFileHeader,
+                                    &MMFileHeader);
+      if (Status == OS_SUCCESS) {
+        /*
+        ** Update last action statistics, the address is that of the first
+        ** region
+        */
+        MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_DUMP_TO_FILE;
+        MM_AppData.HkTlm.Payload.MemType = Region[0].MemType;
+        MM_AppData.HkTlm.Payload.Address = Region[0].SymAddress.Offset;
+        MM_AppData.HkTlm.Payload.BytesProcessed = TotalBytes;
+        snprintf(MM_AppData.HkTlm.Payload.FileName, CFE_MISSION_MAX_PATH_LEN,
+                 "%s", FileName);
+
+        MM_AppData.HkTlm.Payload.CmdCounter++;
+        CFE_EVS_SendEvent(MM_DMP_MEM_FILE_INF_EID,
+                          CFE_EVS_EventType_INFORMATION,
+                          "Dump Memory To File Command: Dumped %d bytes in %u "
+                          "regions to file '%s'",
+                          (int)MM_AppData.HkTlm.Payload.BytesProcessed,
+                          (unsigned int)NumRegions, FileName);
+      } else {
+        MM_AppData.HkTlm.Payload.ErrCounter++;
+      }
+
+      /* Close dump file */
+      if ((Status = OS_close(FileHandle)) != OS_SUCCESS) {
+        MM_AppData.HkTlm.Payload.ErrCounter++;
+        CFE_EVS_SendEvent(MM_OS_CLOSE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "OS_close error received: RC = 0x%08X File = '%s'",
+                          (unsigned int)Status, FileName);
+      }
+    } else {
+      MM_AppData.HkTlm.Payload.ErrCounter++;
+      CFE_EVS_SendEvent(MM_OS_CREAT_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "OS_OpenCreate error received: RC = %d File = '%s'",
+                        (int)Status, FileName);
+    }
+  } else {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+  }
 
   /* Nothing atypical needs to be done so return success */
   return CFE_SUCCESS;
@@ -879,11 +1112,8 @@ CFE_Status_t MM_DumpMemToFileCmd(const MM_DumpMemToFileCmd_t *Msg) {
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 CFE_Status_t MM_DumpInEventCmd(const MM_DumpInEventCmd_t *Msg) {
-  uint32 i;
-  int32 EventStringTotalLength = 0;
+  size_t EventStringTotalLength = 0;
   cpuaddr SrcAddress = 0;
-  uint8 *BytePtr;
-  char TempString[MM_INTERNAL_DUMPINEVENT_TEMP_CHARS];
   const char HeaderString[] = "Memory Dump: ";
   static char EventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
   MM_SymAddr_t SrcSymAddress;
@@ -915,43 +1145,29 @@ CFE_Status_t MM_DumpInEventCmd(const MM_DumpInEventCmd_t *Msg) {
         ** Prepare event message string header
         ** 13 characters, not counting NUL terminator
         */
-        CFE_SB_MessageStringGet(
-            &EventString[EventStringTotalLength], HeaderString, NULL,
-            sizeof(EventString) - EventStringTotalLength, sizeof(HeaderString));
-        EventStringTotalLength =
-            OS_strnlen(EventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+        EventStringTotalLength = sizeof(HeaderString) - 1;
+        memcpy(EventString, HeaderString, EventStringTotalLength);
 
         /*
         ** Build dump data string
         ** Each byte of data requires 5 characters of string space
         ** Note this really only allows up to ~15 bytes using default config
         */
-        BytePtr = (uint8 *)DumpBuffer;
-        for (i = 0; i < Msg->Payload.NumOfBytes; i++) {
-          /* SAD: No need to check snprintf return; CFE_SB_MessageStringGet()
-           * handles safe concatenation and prevents overflow */
-          snprintf(TempString, MM_INTERNAL_DUMPINEVENT_TEMP_CHARS, "0x%02X ",
-                   *BytePtr);
-          CFE_SB_MessageStringGet(
-              &EventString[EventStringTotalLength], TempString, NULL,
-              sizeof(EventString) - EventStringTotalLength, sizeof(TempString));
-          EventStringTotalLength =
-              OS_strnlen(EventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-          BytePtr++;
-        }
+        EventStringTotalLength += MM_FormatHexBytes(
+            &EventString[EventStringTotalLength],
+            sizeof(EventString) - EventStringTotalLength, (uint8 *)DumpBuffer,
+            Msg->Payload.NumOfBytes);
 
         /*
         ** Append tail
         ** This adds up to 33 characters depending on pointer representation
-        *including the NUL terminator
+        ** including the NUL terminator
         */
-        /* SAD: No need to check snprintf return; CFE_SB_MessageStringGet()
-         * handles safe concatenation and prevents overflow */
-        snprintf(TempString, MM_INTERNAL_DUMPINEVENT_TEMP_CHARS,
+        /* SAD: No need to check snprintf return; truncation of the tail
+         * only shortens the event message */
+        snprintf(&EventString[EventStringTotalLength],
+                 sizeof(EventString) - EventStringTotalLength,
                  "from address: %p", (void *)SrcAddress);
-        CFE_SB_MessageStringGet(
-            &EventString[EventStringTotalLength], TempString, NULL,
-            sizeof(EventString) - EventStringTotalLength, sizeof(TempString));
 
         /* Send it out */
         CFE_EVS_SendEvent(MM_DUMP_INEVENT_INF_EID,
@@ -979,4 +1195,1367 @@ CFE_Status_t MM_DumpInEventCmd(const MM_DumpInEventCmd_t *Msg) {
 
   /* Nothing atypical needs to be done so return success */
   return CFE_SUCCESS;
-}
\ No newline at end of file
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump memory to telemetry command                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_DumpMemToTlmCmd(const MM_DumpMemToTlmCmd_t *Msg) {
+  MM_DumpTlmState_t *State = &MM_AppData.DumpTlmState;
+  cpuaddr SrcAddress = 0;
+  MM_SymAddr_t SrcSymAddress;
+  uint32 NumPackets;
+  int32 Status;
+
+  SrcSymAddress = Msg->Payload.SrcSymAddress;
+
+  if (State->BytesRemaining != 0) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_DUMP_TLM_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Dump to telemetry already in progress: Bytes "
+                      "remaining = %u",
+                      (unsigned int)State->BytesRemaining);
+  } else {
+    /* Resolve the symbolic source address in the command message */
+    Status = MM_ResolveSymAddr(&(SrcSymAddress), &SrcAddress);
+
+    if (Status == OS_SUCCESS) {
+      /* Run necessary checks on command parameters */
+      Status = MM_VerifyLoadDumpParams(SrcAddress, Msg->Payload.MemType,
+                                       Msg->Payload.NumOfBytes, MM_VERIFY_DUMP);
+
+      if (Status == OS_SUCCESS) {
+        /* The packets are sent on the following housekeeping requests */
+        State->Address = SrcAddress;
+        State->MemType = Msg->Payload.MemType;
+        State->BytesRemaining = Msg->Payload.NumOfBytes;
+        State->Sequence = 0;
+
+        NumPackets = (Msg->Payload.NumOfBytes + MM_INTERFACE_MAX_DUMP_TLM_DATA -
+                      1) /
+                     MM_INTERFACE_MAX_DUMP_TLM_DATA;
+
+        /* Update telemetry */
+        MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_DUMP_TO_TLM;
+        MM_AppData.HkTlm.Payload.MemType = Msg->Payload.MemType;
+        MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(SrcAddress);
+        MM_AppData.HkTlm.Payload.BytesProcessed = Msg->Payload.NumOfBytes;
+        MM_AppData.HkTlm.Payload.CmdCounter++;
+
+        CFE_EVS_SendEvent(MM_DUMP_TLM_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Dump Memory To Telemetry Command: Dumping %u bytes "
+                          "from address %p in %u packets",
+                          (unsigned int)Msg->Payload.NumOfBytes,
+                          (void *)SrcAddress, (unsigned int)NumPackets);
+      } else {
+        MM_AppData.HkTlm.Payload.ErrCounter++;
+      } /* end MM_VerifyLoadDumpParams if */
+    } else {
+      MM_AppData.HkTlm.Payload.ErrCounter++;
+      CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Symbolic address can't be resolved: Name = '%s'",
+                        SrcSymAddress.SymName);
+    } /* end MM_ResolveSymAddr if */
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump in telemetry command                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_DumpInTlmCmd(const MM_DumpInTlmCmd_t *Msg) {
+  MM_DumpInTlm_Payload_t *Payload = &MM_AppData.DumpInTlm.Payload;
+  cpuaddr SrcAddress = 0;
+  MM_SymAddr_t SrcSymAddress;
+  int32 Status;
+
+  SrcSymAddress = Msg->Payload.SrcSymAddress;
+
+  /* Resolve the symbolic source address in the command message */
+  Status = MM_ResolveSymAddr(&(SrcSymAddress), &SrcAddress);
+
+  if (Status == OS_SUCCESS) {
+    /* Run necessary checks on command parameters */
+    Status = MM_VerifyLoadDumpParams(SrcAddress, Msg->Payload.MemType,
+                                     Msg->Payload.NumOfBytes, MM_VERIFY_INTLM);
+
+    if (Status == CFE_PSP_SUCCESS) {
+      /* Read the raw dump bytes straight into the packet */
+      memset(Payload->Data, 0, sizeof(Payload->Data));
+      Status = MM_ReadMemToBuffer(SrcAddress, Msg->Payload.MemType,
+                                  Msg->Payload.NumOfBytes, Payload->Data);
+
+      if (Status == CFE_PSP_SUCCESS) {
+        Payload->Address = CFE_ES_MEMADDRESS_C(SrcAddress);
+        Payload->MemType = Msg->Payload.MemType;
+        Payload->NumOfBytes = Msg->Payload.NumOfBytes;
+
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(MM_AppData.DumpInTlm.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(MM_AppData.DumpInTlm.TelemetryHeader),
+                           true);
+
+        /* Update telemetry */
+        MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_DUMP_INTLM;
+        MM_AppData.HkTlm.Payload.MemType = Msg->Payload.MemType;
+        MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(SrcAddress);
+        MM_AppData.HkTlm.Payload.BytesProcessed = Msg->Payload.NumOfBytes;
+        MM_AppData.HkTlm.Payload.CmdCounter++;
+
+        CFE_EVS_SendEvent(MM_DUMP_INTLM_DBG_EID, CFE_EVS_EventType_DEBUG,
+                          "Dump In Telemetry Command: Sent %u bytes from "
+                          "address %p",
+                          (unsigned int)Msg->Payload.NumOfBytes,
+                          (void *)SrcAddress);
+      } else {
+        MM_AppData.HkTlm.Payload.ErrCounter++;
+      } /* end MM_ReadMemToBuffer if */
+    } else {
+      MM_AppData.HkTlm.Payload.ErrCounter++;
+    } /* end MM_VerifyLoadDumpParams if */
+  } else {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Symbolic address can't be resolved: Name = '%s'",
+                      SrcSymAddress.SymName);
+  } /* end MM_ResolveSymAddr if */
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Load begin command                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_LoadBeginCmd(const MM_LoadBeginCmd_t *Msg) {
+  MM_ChunkLoadState_t *State = &MM_AppData.ChunkLoad;
+  cpuaddr DestAddress = 0;
+  MM_SymAddr_t DestSymAddress;
+  int32 Status;
+
+  DestSymAddress = Msg->Payload.DestSymAddress;
+
+  /* The load buffer belongs to the queued commit until the worker runs it */
+  if (State->CommitsQueued != 0) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_LOAD_CHUNK_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Load begin rejected: Load commit pending");
+  } else {
+    /* Resolve the symbolic destination address in the command message */
+    Status = MM_ResolveSymAddr(&(DestSymAddress), &DestAddress);
+
+    if (Status == OS_SUCCESS) {
+      /* Run necessary checks on command parameters */
+      Status = MM_VerifyLoadDumpParams(DestAddress, Msg->Payload.MemType,
+                                       Msg->Payload.NumOfBytes, MM_VERIFY_LOAD);
+
+      if (Status != CFE_PSP_SUCCESS) {
+        MM_AppData.HkTlm.Payload.ErrCounter++;
+      } else if (Msg->Payload.NumOfBytes > MM_INTERNAL_MAX_CHUNK_LOAD_BYTES) {
+        MM_AppData.HkTlm.Payload.ErrCounter++;
+        CFE_EVS_SendEvent(MM_LOAD_CHUNK_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Chunked load too large: Bytes = %u Max = %u",
+                          (unsigned int)Msg->Payload.NumOfBytes,
+                          (unsigned int)MM_INTERNAL_MAX_CHUNK_LOAD_BYTES);
+      } else {
+        /* Any chunked load already in progress is discarded */
+        State->InProgress = true;
+        State->MemType = Msg->Payload.MemType;
+        State->DestAddress = DestAddress;
+        State->NumOfBytes = Msg->Payload.NumOfBytes;
+        State->Crc = Msg->Payload.Crc;
+        State->BytesReceived = 0;
+
+        /* Chunks that never arrive show up as a CRC failure on commit */
+        memset(MM_AppData.ChunkLoadBuffer, 0, State->NumOfBytes);
+
+        MM_AppData.HkTlm.Payload.CmdCounter++;
+        CFE_EVS_SendEvent(
+            MM_LOAD_BEGIN_INF_EID, CFE_EVS_EventType_INFORMATION,
+            "Load Begin Command: Expecting %u bytes for address %p",
+            (unsigned int)State->NumOfBytes, (void *)DestAddress);
+      } /* end MM_VerifyLoadDumpParams if */
+    } else {
+      MM_AppData.HkTlm.Payload.ErrCounter++;
+      CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Symbolic address can't be resolved: Name = '%s'",
+                        DestSymAddress.SymName);
+    } /* end MM_ResolveSymAddr if */
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Load data command                                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_LoadDataCmd(const MM_LoadDataCmd_t *Msg) {
+  MM_ChunkLoadState_t *State = &MM_AppData.ChunkLoad;
+  uint32 Offset = Msg->Payload.Offset;
+  uint32 NumOfBytes = Msg->Payload.NumOfBytes;
+
+  if (!State->InProgress) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_LOAD_CHUNK_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Load data rejected: No chunked load in progress");
+  } else if (State->CommitsQueued != 0) {
+    /* The load buffer belongs to the queued commit until the worker runs it */
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_LOAD_CHUNK_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Load data rejected: Load commit pending");
+  } else if ((NumOfBytes == 0) ||
+             (NumOfBytes > MM_INTERFACE_MAX_LOAD_CHUNK_DATA) ||
+             (Offset > State->NumOfBytes) ||
+             (NumOfBytes > (State->NumOfBytes - Offset))) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_LOAD_CHUNK_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Load data rejected: Offset = %u Bytes = %u Load size "
+                      "= %u",
+                      (unsigned int)Offset, (unsigned int)NumOfBytes,
+                      (unsigned int)State->NumOfBytes);
+  } else {
+    memcpy((uint8 *)MM_AppData.ChunkLoadBuffer + Offset,
+           Msg->Payload.DataArray, NumOfBytes);
+    State->BytesReceived += NumOfBytes;
+
+    MM_AppData.HkTlm.Payload.CmdCounter++;
+    CFE_EVS_SendEvent(MM_LOAD_DATA_DBG_EID, CFE_EVS_EventType_DEBUG,
+                      "Load Data Command: Stored %u bytes at offset %u",
+                      (unsigned int)NumOfBytes, (unsigned int)Offset);
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify the CRC of the chunked load buffer                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool MM_VerifyChunkLoadCRC(void) {
+  const MM_ChunkLoadState_t *State = &MM_AppData.ChunkLoad;
+  uint32 ComputedCRC;
+  bool Valid;
+
+  /* The whole load is verified once, before any memory is written */
+  ComputedCRC = MM_CalculateCRC(MM_AppData.ChunkLoadBuffer, State->NumOfBytes,
+                                0, MM_INTERNAL_LOAD_FILE_CRC_TYPE);
+
+  Valid = (ComputedCRC == State->Crc);
+  if (!Valid) {
+    /* The chunked load stays open so missing chunks can be sent again */
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_LOAD_COMMIT_CRC_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Chunked load CRC failure: Expected = 0x%X "
+                      "Calculated = 0x%X Bytes received = %u",
+                      (unsigned int)State->Crc, (unsigned int)ComputedCRC,
+                      (unsigned int)State->BytesReceived);
+  }
+
+  return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Load commit command                                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_LoadCommitCmd(const MM_LoadCommitCmd_t *Msg) {
+  MM_ChunkLoadState_t *State = &MM_AppData.ChunkLoad;
+  CFE_Status_t PSP_Status;
+
+  if (!State->InProgress) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_LOAD_CHUNK_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Load commit rejected: No chunked load in progress");
+  } else if (MM_VerifyChunkLoadCRC()) {
+    State->InProgress = false;
+
+    PSP_Status = MM_WriteMemFromBuffer(
+        State->DestAddress, State->MemType,
+        (const uint8 *)MM_AppData.ChunkLoadBuffer, State->NumOfBytes);
+
+    if (PSP_Status == CFE_PSP_SUCCESS) {
+      /* Update last action statistics */
+      MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_LOAD_CHUNKS;
+      MM_AppData.HkTlm.Payload.MemType = State->MemType;
+      MM_AppData.HkTlm.Payload.Address =
+          CFE_ES_MEMADDRESS_C(State->DestAddress);
+      MM_AppData.HkTlm.Payload.BytesProcessed = State->NumOfBytes;
+
+      MM_AppData.HkTlm.Payload.CmdCounter++;
+      CFE_EVS_SendEvent(MM_LOAD_COMMIT_INF_EID, CFE_EVS_EventType_INFORMATION,
+                        "Load Commit Command: Wrote %u bytes to address %p",
+                        (unsigned int)State->NumOfBytes,
+                        (void *)State->DestAddress);
+    } else {
+      /* The write error has already been reported */
+      MM_AppData.HkTlm.Payload.ErrCounter++;
+    }
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Load RAM commit command                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_LoadRAMCommitCmd(const MM_LoadRAMCommitCmd_t *Msg) {
+  MM_ChunkLoadState_t *State = &MM_AppData.ChunkLoad;
+  OS_time_t StartTime;
+  OS_time_t EndTime;
+  int64 CopyTime;
+
+  if (!State->InProgress) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_LOAD_CHUNK_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Load commit rejected: No chunked load in progress");
+  } else if ((State->MemType != MM_MemType_RAM) ||
+             (State->NumOfBytes > MM_INTERNAL_MAX_RAM_COMMIT_BYTES)) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_LOAD_RAM_COMMIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Load RAM commit rejected: MemType = %d Bytes = %u "
+                      "Max = %u",
+                      (int)State->MemType, (unsigned int)State->NumOfBytes,
+                      (unsigned int)MM_INTERNAL_MAX_RAM_COMMIT_BYTES);
+  } else if (MM_VerifyChunkLoadCRC()) {
+    State->InProgress = false;
+
+    /*
+    ** Everything has already been checked so the copy is a single
+    ** memcpy without segment breaks. Interrupts and other tasks are not
+    ** held off while it runs.
+    */
+    OS_GetLocalTime(&StartTime);
+    memcpy((void *)State->DestAddress, MM_AppData.ChunkLoadBuffer,
+           State->NumOfBytes);
+    OS_GetLocalTime(&EndTime);
+
+    CopyTime = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime));
+
+    /* Update last action statistics */
+    MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_LOAD_CHUNKS;
+    MM_AppData.HkTlm.Payload.MemType = MM_MemType_RAM;
+    MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(State->DestAddress);
+    MM_AppData.HkTlm.Payload.BytesProcessed = State->NumOfBytes;
+
+    MM_AppData.HkTlm.Payload.CmdCounter++;
+    CFE_EVS_SendEvent(MM_LOAD_RAM_COMMIT_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Load RAM Commit Command: Wrote %u bytes to address %p "
+                      "in %u usec",
+                      (unsigned int)State->NumOfBytes,
+                      (void *)State->DestAddress, (unsigned int)CopyTime);
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Checksum memory command                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_ChecksumMemCmd(const MM_ChecksumMemCmd_t *Msg) {
+  cpuaddr SrcAddress = 0;
+  MM_SymAddr_t SrcSymAddress;
+  uint32 ComputedCRC = 0;
+
+  SrcSymAddress = Msg->Payload.SrcSymAddress;
+
+  /* Resolve the symbolic source address in the command message */
+  if (MM_ResolveSymAddr(&(SrcSymAddress), &SrcAddress) == OS_SUCCESS) {
+    /* Run necessary checks on command parameters */
+    if (MM_VerifyLoadDumpParams(SrcAddress, Msg->Payload.MemType,
+                                Msg->Payload.NumOfBytes,
+                                MM_VERIFY_DUMP) == CFE_PSP_SUCCESS) {
+      if (MM_ChecksumMem(SrcAddress, Msg->Payload.MemType,
+                         Msg->Payload.NumOfBytes,
+                         &ComputedCRC) == CFE_PSP_SUCCESS) {
+        /* Update last action statistics */
+        MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_CHECKSUM;
+        MM_AppData.HkTlm.Payload.MemType = Msg->Payload.MemType;
+        MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(SrcAddress);
+        MM_AppData.HkTlm.Payload.DataValue = ComputedCRC;
+        MM_AppData.HkTlm.Payload.BytesProcessed = Msg->Payload.NumOfBytes;
+
+        MM_AppData.HkTlm.Payload.CmdCounter++;
+        CFE_EVS_SendEvent(MM_CHECKSUM_MEM_INF_EID,
+                          CFE_EVS_EventType_INFORMATION,
+                          "Checksum Memory Command: CRC = 0x%08X for %u bytes "
+                          "at address %p",
+                          (unsigned int)ComputedCRC,
+                          (unsigned int)Msg->Payload.NumOfBytes,
+                          (void *)SrcAddress);
+      } else {
+        /* The read error has already been reported */
+        MM_AppData.HkTlm.Payload.ErrCounter++;
+      }
+    } else {
+      MM_AppData.HkTlm.Payload.ErrCounter++;
+    }
+  } else {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Symbolic address can't be resolved: Name = '%s'",
+                      SrcSymAddress.SymName);
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set scrub region command                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_SetScrubRegionCmd(const MM_SetScrubRegionCmd_t *Msg) {
+  cpuaddr SrcAddress = 0;
+  MM_SymAddr_t SrcSymAddress;
+  MM_ScrubRegion_t *Region;
+
+  SrcSymAddress = Msg->Payload.SrcSymAddress;
+
+  if (Msg->Payload.RegionNum >= MM_INTERFACE_MAX_SCRUB_REGIONS) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_SCRUB_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Scrub region number invalid: Region = %u Max = %u",
+                      (unsigned int)Msg->Payload.RegionNum,
+                      (unsigned int)MM_INTERFACE_MAX_SCRUB_REGIONS);
+  }
+  /* Resolve the symbolic source address in the command message */
+  else if (MM_ResolveSymAddr(&(SrcSymAddress), &SrcAddress) != OS_SUCCESS) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Symbolic address can't be resolved: Name = '%s'",
+                      SrcSymAddress.SymName);
+  }
+  /* Run necessary checks on command parameters */
+  else if (MM_VerifyLoadDumpParams(SrcAddress, Msg->Payload.MemType,
+                                   Msg->Payload.NumOfBytes,
+                                   MM_VERIFY_DUMP) != CFE_PSP_SUCCESS) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+  } else {
+    Region = &MM_AppData.Scrub.Regions[Msg->Payload.RegionNum];
+
+    Region->MemType = Msg->Payload.MemType;
+    Region->Address = SrcAddress;
+    Region->NumOfBytes = Msg->Payload.NumOfBytes;
+    Region->GoldenCrc = Msg->Payload.GoldenCrc;
+
+    MM_ScrubRestartRegion(Msg->Payload.RegionNum);
+
+    MM_AppData.HkTlm.Payload.CmdCounter++;
+    CFE_EVS_SendEvent(
+        MM_SCRUB_REGION_INF_EID, CFE_EVS_EventType_INFORMATION,
+        "Set Scrub Region Command: Region = %u Addr = %p Bytes = %u "
+        "Golden CRC = 0x%08X",
+        (unsigned int)Msg->Payload.RegionNum, (void *)SrcAddress,
+        (unsigned int)Msg->Payload.NumOfBytes,
+        (unsigned int)Msg->Payload.GoldenCrc);
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Clear scrub region command                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_ClearScrubRegionCmd(const MM_ClearScrubRegionCmd_t *Msg) {
+  if (Msg->Payload.RegionNum >= MM_INTERFACE_MAX_SCRUB_REGIONS) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_SCRUB_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Scrub region number invalid: Region = %u Max = %u",
+                      (unsigned int)Msg->Payload.RegionNum,
+                      (unsigned int)MM_INTERFACE_MAX_SCRUB_REGIONS);
+  } else {
+    memset(&MM_AppData.Scrub.Regions[Msg->Payload.RegionNum], 0,
+           sizeof(MM_AppData.Scrub.Regions[Msg->Payload.RegionNum]));
+
+    MM_ScrubRestartRegion(Msg->Payload.RegionNum);
+
+    MM_AppData.HkTlm.Payload.CmdCounter++;
+    CFE_EVS_SendEvent(MM_SCRUB_REGION_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Clear Scrub Region Command: Region = %u",
+                      (unsigned int)Msg->Payload.RegionNum);
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compute the CRC of one block of a scrub region                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 MM_CalculateScrubBlockCrc(const MM_ScrubRegion_t *Region,
+                                       uint32 BlockSize, uint32 Block,
+                                       uint32 *CrcPtr) {
+  uint32 Offset = Block * BlockSize;
+  uint32 NumBytes = Region->NumOfBytes - Offset;
+
+  /* Only the last block may be shorter than the block size */
+  if (NumBytes > BlockSize) {
+    NumBytes = BlockSize;
+  }
+
+  return MM_ChecksumMem(Region->Address + Offset, Region->MemType, NumBytes,
+                        CrcPtr);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Build scrub index command                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_BuildScrubIndexCmd(const MM_BuildScrubIndexCmd_t *Msg) {
+  MM_ScrubRegion_t Region;
+  MM_ScrubIndex_t *Index = &MM_AppData.ScrubIndexBuffer;
+  uint32 Generation;
+  uint32 BlockSize;
+  uint32 NumBlocks;
+  uint32 Block;
+  int32 PSP_Status = CFE_PSP_SUCCESS;
+
+  if (Msg->Payload.RegionNum >= MM_INTERFACE_MAX_SCRUB_REGIONS) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_SCRUB_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Scrub region number invalid: Region = %u Max = %u",
+                      (unsigned int)Msg->Payload.RegionNum,
+                      (unsigned int)MM_INTERFACE_MAX_SCRUB_REGIONS);
+  } else if (MM_AppData.Scrub.Regions[Msg->Payload.RegionNum].NumOfBytes ==
+             0) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_SCRUB_INDEX_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Build scrub index error: Region %u is not defined",
+                      (unsigned int)Msg->Payload.RegionNum);
+  } else {
+    /*
+    ** Work from a copy, the region may be set again during a segment
+    ** break. The index is built in the worker buffer and only replaces
+    ** the stored one once the region is known not to have restarted.
+    */
+    Region = MM_AppData.Scrub.Regions[Msg->Payload.RegionNum];
+    Generation = MM_AppData.Scrub.Generation[Msg->Payload.RegionNum];
+
+    /* Use larger blocks when the region doesn't fit in the index */
+    BlockSize = (Region.NumOfBytes + MM_INTERNAL_MAX_SCRUB_BLOCKS - 1) /
+                MM_INTERNAL_MAX_SCRUB_BLOCKS;
+    BlockSize = (BlockSize + 3) & ~((uint32)3);
+    if (BlockSize < MM_INTERNAL_SCRUB_BLOCK_SIZE) {
+      BlockSize = MM_INTERNAL_SCRUB_BLOCK_SIZE;
+    }
+    NumBlocks = (Region.NumOfBytes + BlockSize - 1) / BlockSize;
+
+    for (Block = 0; (Block < NumBlocks) && (PSP_Status == CFE_PSP_SUCCESS);
+         Block++) {
+      PSP_Status = MM_CalculateScrubBlockCrc(&Region, BlockSize, Block,
+                                             &Index->BlockCrc[Block]);
+
+      /* Prevent CPU hogging between blocks */
+      if ((PSP_Status == CFE_PSP_SUCCESS) && ((Block + 1) < NumBlocks)) {
+        MM_SegmentBreak();
+      }
+    }
+
+    if (PSP_Status != CFE_PSP_SUCCESS) {
+      /* The read error has already been reported */
+      MM_AppData.HkTlm.Payload.ErrCounter++;
+    } else if (Generation !=
+               MM_AppData.Scrub.Generation[Msg->Payload.RegionNum]) {
+      MM_AppData.HkTlm.Payload.ErrCounter++;
+      CFE_EVS_SendEvent(MM_SCRUB_INDEX_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Build scrub index error: Region %u changed during "
+                        "the build",
+                        (unsigned int)Msg->Payload.RegionNum);
+    } else {
+      Index->BlockSize = BlockSize;
+      Index->NumBlocks = NumBlocks;
+      Index->RootCrc =
+          MM_CalculateCRC(Index->BlockCrc, NumBlocks * sizeof(uint32), 0,
+                          MM_INTERNAL_CHECKSUM_CRC_TYPE);
+      MM_AppData.Scrub.Index[Msg->Payload.RegionNum] = *Index;
+
+      /* Update last action statistics */
+      MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_SCRUB_INDEX;
+      MM_AppData.HkTlm.Payload.MemType = Region.MemType;
+      MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(Region.Address);
+      MM_AppData.HkTlm.Payload.DataValue = Index->RootCrc;
+      MM_AppData.HkTlm.Payload.BytesProcessed = Region.NumOfBytes;
+
+      MM_AppData.HkTlm.Payload.CmdCounter++;
+      CFE_EVS_SendEvent(MM_SCRUB_INDEX_INF_EID, CFE_EVS_EventType_INFORMATION,
+                        "Build Scrub Index Command: Region = %u Blocks = %u "
+                        "Block size = %u Root = 0x%08X",
+                        (unsigned int)Msg->Payload.RegionNum,
+                        (unsigned int)NumBlocks, (unsigned int)BlockSize,
+                        (unsigned int)Index->RootCrc);
+    }
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compare the blocks of a scrub region to its block index         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 MM_CompareScrubBlocks(const MM_ScrubRegion_t *Region,
+                                   const MM_ScrubIndex_t *Index,
+                                   MM_ScrubIndexTlm_Payload_t *Payload) {
+  uint32 Block;
+  uint32 Crc;
+  int32 PSP_Status = CFE_PSP_SUCCESS;
+
+  for (Block = 0;
+       (Block < Index->NumBlocks) && (PSP_Status == CFE_PSP_SUCCESS);
+       Block++) {
+    Crc = 0;
+    PSP_Status =
+        MM_CalculateScrubBlockCrc(Region, Index->BlockSize, Block, &Crc);
+
+    if (PSP_Status == CFE_PSP_SUCCESS) {
+      Payload->CalculatedRoot =
+          MM_CalculateCRC(&Crc, sizeof(Crc), Payload->CalculatedRoot,
+                          MM_INTERNAL_CHECKSUM_CRC_TYPE);
+
+      if (Crc != Index->BlockCrc[Block]) {
+        if (Payload->NumReported < MM_INTERFACE_MAX_SCRUB_MISMATCH_BLOCKS) {
+          Payload->BlockIndex[Payload->NumReported] = (uint16)Block;
+          Payload->NumReported++;
+        }
+        Payload->NumMismatches++;
+      }
+
+      /* Prevent CPU hogging between blocks */
+      if ((Block + 1) < Index->NumBlocks) {
+        MM_SegmentBreak();
+      }
+    }
+  }
+
+  return PSP_Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compare scrub index command                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_CompareScrubIndexCmd(const MM_CompareScrubIndexCmd_t *Msg) {
+  MM_ScrubIndexTlm_Payload_t *Payload = &MM_AppData.ScrubIndexTlm.Payload;
+  MM_ScrubRegion_t Region;
+  MM_ScrubIndex_t *Index = &MM_AppData.ScrubIndexBuffer;
+  uint32 Generation;
+
+  if (Msg->Payload.RegionNum >= MM_INTERFACE_MAX_SCRUB_REGIONS) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_SCRUB_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Scrub region number invalid: Region = %u Max = %u",
+                      (unsigned int)Msg->Payload.RegionNum,
+                      (unsigned int)MM_INTERFACE_MAX_SCRUB_REGIONS);
+  } else {
+    /*
+    ** Work from copies, the region may be set again and its index
+    ** dropped during a segment break
+    */
+    Region = MM_AppData.Scrub.Regions[Msg->Payload.RegionNum];
+    *Index = MM_AppData.Scrub.Index[Msg->Payload.RegionNum];
+    Generation = MM_AppData.Scrub.Generation[Msg->Payload.RegionNum];
+
+    if (Index->NumBlocks == 0) {
+      MM_AppData.HkTlm.Payload.ErrCounter++;
+      CFE_EVS_SendEvent(MM_SCRUB_INDEX_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Compare scrub index error: Region %u has no index",
+                        (unsigned int)Msg->Payload.RegionNum);
+    }
+    /* Don't blame memory for a corrupted index */
+    else if (MM_CalculateCRC(Index->BlockCrc,
+                             Index->NumBlocks * sizeof(uint32), 0,
+                             MM_INTERNAL_CHECKSUM_CRC_TYPE) != Index->RootCrc) {
+      MM_AppData.HkTlm.Payload.ErrCounter++;
+      CFE_EVS_SendEvent(MM_SCRUB_INDEX_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Compare scrub index error: Region %u index doesn't "
+                        "match its root CRC",
+                        (unsigned int)Msg->Payload.RegionNum);
+    } else {
+      memset(Payload, 0, sizeof(*Payload));
+
+      if (MM_CompareScrubBlocks(&Region, Index, Payload) != CFE_PSP_SUCCESS) {
+        /* The read error has already been reported */
+        MM_AppData.HkTlm.Payload.ErrCounter++;
+      } else if (Generation !=
+                 MM_AppData.Scrub.Generation[Msg->Payload.RegionNum]) {
+        MM_AppData.HkTlm.Payload.ErrCounter++;
+        CFE_EVS_SendEvent(MM_SCRUB_INDEX_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Compare scrub index error: Region %u changed "
+                          "during the compare",
+                          (unsigned int)Msg->Payload.RegionNum);
+      } else {
+        Payload->Address = CFE_ES_MEMADDRESS_C(Region.Address);
+        Payload->RegionNum = Msg->Payload.RegionNum;
+        Payload->MemType = Region.MemType;
+        Payload->BlockSize = Index->BlockSize;
+        Payload->NumBlocks = Index->NumBlocks;
+        Payload->IndexRoot = Index->RootCrc;
+
+        CFE_SB_TimeStampMsg(
+            CFE_MSG_PTR(MM_AppData.ScrubIndexTlm.TelemetryHeader));
+        CFE_SB_TransmitMsg(
+            CFE_MSG_PTR(MM_AppData.ScrubIndexTlm.TelemetryHeader), true);
+
+        /* Update last action statistics */
+        MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_SCRUB_COMPARE;
+        MM_AppData.HkTlm.Payload.MemType = Region.MemType;
+        MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(Region.Address);
+        MM_AppData.HkTlm.Payload.DataValue = Payload->NumMismatches;
+        MM_AppData.HkTlm.Payload.BytesProcessed = Region.NumOfBytes;
+
+        MM_AppData.HkTlm.Payload.CmdCounter++;
+        CFE_EVS_SendEvent(MM_SCRUB_COMPARE_INF_EID,
+                          CFE_EVS_EventType_INFORMATION,
+                          "Compare Scrub Index Command: Region = %u "
+                          "Mismatched blocks = %u of %u",
+                          (unsigned int)Msg->Payload.RegionNum,
+                          (unsigned int)Payload->NumMismatches,
+                          (unsigned int)Index->NumBlocks);
+      }
+    }
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set load, dump, and fill CPU budget command                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_SetCpuBudgetCmd(const MM_SetCpuBudgetCmd_t *Msg) {
+  if (Msg->Payload.CpuBudget <= MM_INTERNAL_MAX_CPU_BUDGET) {
+    MM_AppData.HkTlm.Payload.CpuBudget = Msg->Payload.CpuBudget;
+
+    MM_AppData.HkTlm.Payload.CmdCounter++;
+    CFE_EVS_SendEvent(MM_CPU_BUDGET_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "CPU budget set to %u usec",
+                      (unsigned int)Msg->Payload.CpuBudget);
+  } else {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_CPU_BUDGET_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "CPU budget %u usec exceeds maximum %u usec",
+                      (unsigned int)Msg->Payload.CpuBudget,
+                      (unsigned int)MM_INTERNAL_MAX_CPU_BUDGET);
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set dump file CRC type command                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_SetDumpCrcTypeCmd(const MM_SetDumpCrcTypeCmd_t *Msg) {
+  if (Msg->Payload.CrcType <= MM_CRC_MAX_FILE_TYPE) {
+    MM_AppData.HkTlm.Payload.DumpCrcType = Msg->Payload.CrcType;
+
+    MM_AppData.HkTlm.Payload.CmdCounter++;
+    CFE_EVS_SendEvent(MM_DUMP_CRC_TYPE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Dump CRC type set to %u",
+                      (unsigned int)Msg->Payload.CrcType);
+  } else {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_DUMP_CRC_TYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Dump CRC type %u exceeds maximum %u",
+                      (unsigned int)Msg->Payload.CrcType,
+                      (unsigned int)MM_CRC_MAX_FILE_TYPE);
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Memory test command                                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_MemTestCmd(const MM_MemTestCmd_t *Msg) {
+  MM_MemTestTlm_Payload_t *Payload = &MM_AppData.MemTestTlm.Payload;
+  cpuaddr TestAddress = 0;
+  MM_SymAddr_t TestSymAddress = Msg->Payload.TestSymAddress;
+
+  /* Resolve the symbolic address in the command message */
+  if (MM_ResolveSymAddr(&(TestSymAddress), &TestAddress) == OS_SUCCESS) {
+    if ((Msg->Payload.Patterns == 0) ||
+        ((Msg->Payload.Patterns & ~MM_MEM_TEST_ALL_PATTERNS) != 0)) {
+      MM_AppData.HkTlm.Payload.ErrCounter++;
+      CFE_EVS_SendEvent(MM_MEM_TEST_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Memory test error: Patterns = 0x%02X invalid",
+                        (unsigned int)Msg->Payload.Patterns);
+    }
+    /* EEPROM writes are slow and wear the part */
+    else if (Msg->Payload.MemType == MM_MemType_EEPROM) {
+      MM_AppData.HkTlm.Payload.ErrCounter++;
+      CFE_EVS_SendEvent(MM_MEM_TEST_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Memory test error: EEPROM can't be tested");
+    }
+    /* Run necessary checks on command parameters */
+    else if (MM_VerifyLoadDumpParams(TestAddress, Msg->Payload.MemType,
+                                     Msg->Payload.NumOfBytes,
+                                     MM_VERIFY_FILL) != CFE_PSP_SUCCESS) {
+      MM_AppData.HkTlm.Payload.ErrCounter++;
+    } else if (MM_MemTest(TestAddress, Msg->Payload.MemType,
+                          Msg->Payload.NumOfBytes, Msg->Payload.Patterns,
+                          Payload) != CFE_PSP_SUCCESS) {
+      /* The read or write error has already been reported */
+      MM_AppData.HkTlm.Payload.ErrCounter++;
+    } else {
+      CFE_SB_TimeStampMsg(CFE_MSG_PTR(MM_AppData.MemTestTlm.TelemetryHeader));
+      CFE_SB_TransmitMsg(CFE_MSG_PTR(MM_AppData.MemTestTlm.TelemetryHeader),
+                         true);
+
+      /* Update last action statistics */
+      MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_MEM_TEST;
+      MM_AppData.HkTlm.Payload.MemType = Msg->Payload.MemType;
+      MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(TestAddress);
+      MM_AppData.HkTlm.Payload.DataValue = Payload->NumFailures;
+      MM_AppData.HkTlm.Payload.BytesProcessed = Payload->NumOfBytes;
+
+      MM_AppData.HkTlm.Payload.CmdCounter++;
+      CFE_EVS_SendEvent(MM_MEM_TEST_INF_EID, CFE_EVS_EventType_INFORMATION,
+                        "Memory Test Command: %u failures in %u bytes at "
+                        "address %p",
+                        (unsigned int)Payload->NumFailures,
+                        (unsigned int)Payload->NumOfBytes,
+                        (void *)TestAddress);
+    }
+  } else {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Symbolic address can't be resolved: Name = '%s'",
+                      TestSymAddress.SymName);
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Batch peek command                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_BatchPeekCmd(const MM_BatchPeekCmd_t *Msg) {
+  MM_BatchPeekTlm_Payload_t *Payload = &MM_AppData.BatchPeekTlm.Payload;
+  const MM_PeekCmd_Payload_t *Entry;
+  cpuaddr SrcAddress[MM_INTERFACE_MAX_BATCH_PEEK_ENTRIES] = {0};
+  MM_SymAddr_t SrcSymAddress;
+  uint32 NumEntries = Msg->Payload.NumEntries;
+  uint32 BytesProcessed = 0;
+  uint32 i = 0;
+  int32 Status = OS_SUCCESS;
+
+  if ((NumEntries == 0) || (NumEntries > MM_INTERFACE_MAX_BATCH_PEEK_ENTRIES)) {
+    Status = CFE_PSP_ERROR;
+    CFE_EVS_SendEvent(MM_BATCH_PEEK_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Batch peek error: NumEntries = %u, max = %u",
+                      (unsigned int)NumEntries,
+                      (unsigned int)MM_INTERFACE_MAX_BATCH_PEEK_ENTRIES);
+  }
+
+  /*
+  ** Resolve and check every entry before any is read so a bad entry
+  ** doesn't leave a partial result
+  */
+  for (i = 0; (Status == OS_SUCCESS) && (i < NumEntries); i++) {
+    Entry = &Msg->Payload.Entries[i];
+    SrcSymAddress = Entry->SrcSymAddress;
+
+    Status = MM_ResolveSymAddr(&SrcSymAddress, &SrcAddress[i]);
+    if (Status != OS_SUCCESS) {
+      CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Symbolic address can't be resolved: Name = '%s'",
+                        SrcSymAddress.SymName);
+    } else {
+      Status = MM_VerifyPeekPokeParams(SrcAddress[i], Entry->MemType,
+                                       Entry->DataSize);
+    }
+
+    if (Status != OS_SUCCESS) {
+      CFE_EVS_SendEvent(MM_BATCH_PEEK_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Batch peek error: Entry %u of %u rejected",
+                        (unsigned int)i, (unsigned int)NumEntries);
+    }
+  }
+
+  /* Read each entry into the batch peek packet */
+  for (i = 0; (Status == OS_SUCCESS) && (i < NumEntries); i++) {
+    Entry = &Msg->Payload.Entries[i];
+
+    Payload->Results[i].Address = CFE_ES_MEMADDRESS_C(SrcAddress[i]);
+    Payload->Results[i].DataSize = Entry->DataSize;
+    Payload->Results[i].DataValue = 0;
+
+    Status = MM_PeekValue(SrcAddress[i], Entry->DataSize,
+                          &Payload->Results[i].DataValue);
+    if (Status != CFE_PSP_SUCCESS) {
+      CFE_EVS_SendEvent(MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "PSP read memory error: RC=%d, Address=%p, "
+                        "MemType=MEM%u",
+                        (int)Status, (void *)SrcAddress[i],
+                        (unsigned int)Entry->DataSize);
+    } else {
+      BytesProcessed += Entry->DataSize / 8;
+    }
+  }
+
+  if (Status == OS_SUCCESS) {
+    Payload->NumEntries = NumEntries;
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(MM_AppData.BatchPeekTlm.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(MM_AppData.BatchPeekTlm.TelemetryHeader),
+                       true);
+
+    /* Update last action statistics, the address is the first entry's */
+    MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_BATCH_PEEK;
+    MM_AppData.HkTlm.Payload.MemType = Msg->Payload.Entries[0].MemType;
+    MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(SrcAddress[0]);
+    MM_AppData.HkTlm.Payload.DataValue = NumEntries;
+    MM_AppData.HkTlm.Payload.BytesProcessed = BytesProcessed;
+
+    MM_AppData.HkTlm.Payload.CmdCounter++;
+    CFE_EVS_SendEvent(MM_BATCH_PEEK_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Batch Peek Command: %u entries, %u bytes read",
+                      (unsigned int)NumEntries, (unsigned int)BytesProcessed);
+  } else {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write a poke value without reporting it as a poke               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 MM_WritePokeValue(cpuaddr DestAddress, MM_MemType_Enum_t MemType,
+                               uint32 DataSize, uint32 DataValue) {
+  int32 Status;
+
+  if (MemType == MM_MemType_EEPROM) {
+    /* Skips the write when the EEPROM already holds the data */
+    Status = MM_WriteEepromValue(DestAddress, DataSize, DataValue);
+  } else {
+    Status = MM_PokeValue(DestAddress, MemType, DataSize, DataValue);
+  }
+
+  if (Status != CFE_PSP_SUCCESS) {
+    CFE_EVS_SendEvent(
+        MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+        "PSP write memory error: RC=0x%08X, Address=%p, MemType=MEM%u",
+        (unsigned int)Status, (void *)DestAddress, (unsigned int)DataSize);
+  }
+
+  return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Restore the batch poke entries already written, newest first    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 MM_BatchPokeRollback(const MM_BatchPokeCmd_Payload_t *Payload,
+                                   const cpuaddr *DestAddress,
+                                   const uint32 *OldValue,
+                                   uint32 NumWritten) {
+  uint32 NumRestored = 0;
+  uint32 i;
+
+  for (i = NumWritten; i > 0; i--) {
+    if (MM_WritePokeValue(DestAddress[i - 1], Payload->Entries[i - 1].MemType,
+                          Payload->Entries[i - 1].DataSize,
+                          OldValue[i - 1]) == CFE_PSP_SUCCESS) {
+      NumRestored++;
+    }
+  }
+
+  return NumRestored;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Batch poke command                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_BatchPokeCmd(const MM_BatchPokeCmd_t *Msg) {
+  const MM_PokeCmd_Payload_t *Entry;
+  cpuaddr DestAddress[MM_INTERFACE_MAX_BATCH_POKE_ENTRIES] = {0};
+  uint32 OldValue[MM_INTERFACE_MAX_BATCH_POKE_ENTRIES] = {0};
+  MM_SymAddr_t DestSymAddress;
+  uint32 NumEntries = Msg->Payload.NumEntries;
+  uint32 NumWritten = 0;
+  uint32 NumRestored = 0;
+  uint32 BytesProcessed = 0;
+  uint32 i = 0;
+  int32 Status = OS_SUCCESS;
+
+  if ((NumEntries == 0) || (NumEntries > MM_INTERFACE_MAX_BATCH_POKE_ENTRIES)) {
+    Status = CFE_PSP_ERROR;
+    CFE_EVS_SendEvent(MM_BATCH_POKE_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Batch poke error: NumEntries = %u, max = %u",
+                      (unsigned int)NumEntries,
+                      (unsigned int)MM_INTERFACE_MAX_BATCH_POKE_ENTRIES);
+  }
+
+  /* Resolve and check every entry before any is written */
+  for (i = 0; (Status == OS_SUCCESS) && (i < NumEntries); i++) {
+    Entry = &Msg->Payload.Entries[i];
+    DestSymAddress = Entry->DestSymAddress;
+
+    Status = MM_ResolveSymAddr(&DestSymAddress, &DestAddress[i]);
+    if (Status != OS_SUCCESS) {
+      CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Symbolic address can't be resolved: Name = '%s'",
+                        DestSymAddress.SymName);
+    } else {
+      Status = MM_VerifyPeekPokeParams(DestAddress[i], Entry->MemType,
+                                       Entry->DataSize);
+    }
+
+    if (Status != OS_SUCCESS) {
+      CFE_EVS_SendEvent(MM_BATCH_POKE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Batch poke error: Entry %u of %u rejected",
+                        (unsigned int)i, (unsigned int)NumEntries);
+    }
+  }
+
+  /* Save the current value of every entry into the undo buffer */
+  for (i = 0; (Status == OS_SUCCESS) && (i < NumEntries); i++) {
+    Entry = &Msg->Payload.Entries[i];
+
+    Status = MM_PeekValue(DestAddress[i], Entry->DataSize, &OldValue[i]);
+    if (Status != CFE_PSP_SUCCESS) {
+      CFE_EVS_SendEvent(MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "PSP read memory error: RC=%d, Address=%p, "
+                        "MemType=MEM%u",
+                        (int)Status, (void *)DestAddress[i],
+                        (unsigned int)Entry->DataSize);
+    }
+  }
+
+  /* Write every entry, stopping at the first failure */
+  for (i = 0; (Status == OS_SUCCESS) && (i < NumEntries); i++) {
+    Entry = &Msg->Payload.Entries[i];
+
+    Status = MM_WritePokeValue(DestAddress[i], Entry->MemType,
+                               Entry->DataSize, Entry->Data);
+    if (Status == CFE_PSP_SUCCESS) {
+      NumWritten++;
+      BytesProcessed += Entry->DataSize / 8;
+    }
+  }
+
+  if (Status == OS_SUCCESS) {
+    /* Update last action statistics, the address is the first entry's */
+    MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_BATCH_POKE;
+    MM_AppData.HkTlm.Payload.MemType = Msg->Payload.Entries[0].MemType;
+    MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(DestAddress[0]);
+    MM_AppData.HkTlm.Payload.DataValue = NumEntries;
+    MM_AppData.HkTlm.Payload.BytesProcessed = BytesProcessed;
+
+    MM_AppData.HkTlm.Payload.CmdCounter++;
+    CFE_EVS_SendEvent(MM_BATCH_POKE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Batch Poke Command: %u entries, %u bytes written",
+                      (unsigned int)NumEntries, (unsigned int)BytesProcessed);
+  } else {
+    /* A failed batch must not look like the last poke that went through */
+    MM_ResetHk();
+
+    if (NumWritten > 0) {
+      NumRestored = MM_BatchPokeRollback(&Msg->Payload, DestAddress,
+                                         OldValue, NumWritten);
+      CFE_EVS_SendEvent(MM_BATCH_POKE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Batch poke error: Entry %u write failed, %u of %u "
+                        "written entries restored",
+                        (unsigned int)NumWritten, (unsigned int)NumRestored,
+                        (unsigned int)NumWritten);
+    }
+
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set watch entry command                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_SetWatchEntryCmd(const MM_SetWatchEntryCmd_t *Msg) {
+  cpuaddr SrcAddress = 0;
+  MM_SymAddr_t SrcSymAddress;
+  MM_WatchEntry_t *Entry;
+
+  SrcSymAddress = Msg->Payload.SrcSymAddress;
+
+  if (Msg->Payload.EntryNum >= MM_INTERFACE_MAX_WATCH_ENTRIES) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_WATCH_ENTRY_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Watch entry number invalid: Entry = %u Max = %u",
+                      (unsigned int)Msg->Payload.EntryNum,
+                      (unsigned int)MM_INTERFACE_MAX_WATCH_ENTRIES);
+  }
+  /* Resolve the symbolic source address in the command message */
+  else if (MM_ResolveSymAddr(&(SrcSymAddress), &SrcAddress) != OS_SUCCESS) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Symbolic address can't be resolved: Name = '%s'",
+                      SrcSymAddress.SymName);
+  }
+  /* Run the peek checks once so the sampler doesn't have to */
+  else if (MM_VerifyPeekPokeParams(SrcAddress, Msg->Payload.MemType,
+                                   Msg->Payload.DataSize) != OS_SUCCESS) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+  } else {
+    Entry = &MM_AppData.Sampler.Entries[Msg->Payload.EntryNum];
+
+    Entry->MemType = Msg->Payload.MemType;
+    Entry->Address = SrcAddress;
+    Entry->DataSize = Msg->Payload.DataSize;
+
+    MM_AppData.HkTlm.Payload.CmdCounter++;
+    CFE_EVS_SendEvent(MM_WATCH_ENTRY_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Set Watch Entry Command: Entry = %u Addr = %p "
+                      "Size = %u bits",
+                      (unsigned int)Msg->Payload.EntryNum, (void *)SrcAddress,
+                      (unsigned int)Msg->Payload.DataSize);
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Clear watch entry command                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_ClearWatchEntryCmd(const MM_ClearWatchEntryCmd_t *Msg) {
+  if (Msg->Payload.EntryNum >= MM_INTERFACE_MAX_WATCH_ENTRIES) {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_WATCH_ENTRY_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Watch entry number invalid: Entry = %u Max = %u",
+                      (unsigned int)Msg->Payload.EntryNum,
+                      (unsigned int)MM_INTERFACE_MAX_WATCH_ENTRIES);
+  } else {
+    memset(&MM_AppData.Sampler.Entries[Msg->Payload.EntryNum], 0,
+           sizeof(MM_AppData.Sampler.Entries[Msg->Payload.EntryNum]));
+
+    MM_AppData.HkTlm.Payload.CmdCounter++;
+    CFE_EVS_SendEvent(MM_WATCH_ENTRY_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Clear Watch Entry Command: Entry = %u",
+                      (unsigned int)Msg->Payload.EntryNum);
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set sample period command                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_SetSamplePeriodCmd(const MM_SetSamplePeriodCmd_t *Msg) {
+  MM_AppData.Sampler.Period = Msg->Payload.Period;
+
+  /* Start a full period from now */
+  MM_AppData.Sampler.Count = 0;
+
+  MM_AppData.HkTlm.Payload.CmdCounter++;
+  CFE_EVS_SendEvent(MM_SAMPLE_PERIOD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                    "Set Sample Period Command: Period = %u",
+                    (unsigned int)Msg->Payload.Period);
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Resolve and check a poke address and read its current value     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 MM_ReadPokeAddress(const MM_SymAddr_t *SymAddr,
+                                MM_MemType_Enum_t MemType, uint32 DataSize,
+                                cpuaddr *DestAddress, uint32 *OldValue) {
+  MM_SymAddr_t DestSymAddress = *SymAddr;
+  int32 Status;
+
+  Status = MM_ResolveSymAddr(&DestSymAddress, DestAddress);
+  if (Status != OS_SUCCESS) {
+    CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Symbolic address can't be resolved: Name = '%s'",
+                      DestSymAddress.SymName);
+  } else {
+    /* Checking for the poke also covers the read of the same address */
+    Status = MM_VerifyPeekPokeParams(*DestAddress, MemType, DataSize);
+  }
+
+  if (Status == OS_SUCCESS) {
+    Status = MM_PeekValue(*DestAddress, DataSize, OldValue);
+    if (Status != CFE_PSP_SUCCESS) {
+      CFE_EVS_SendEvent(MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "PSP read memory error: RC=%d, Address=%p, "
+                        "MemType=MEM%u",
+                        (int)Status, (void *)*DestAddress,
+                        (unsigned int)DataSize);
+    }
+  }
+
+  return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write a value computed on board and update last action stats    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 MM_WritePokeAddress(cpuaddr DestAddress,
+                                 MM_MemType_Enum_t MemType, uint32 DataSize,
+                                 uint32 DataValue,
+                                 MM_LastAction_Enum_t LastAction) {
+  int32 Status;
+
+  Status = MM_WritePokeValue(DestAddress, MemType, DataSize, DataValue);
+  if (Status == CFE_PSP_SUCCESS) {
+    MM_AppData.HkTlm.Payload.LastAction = LastAction;
+    MM_AppData.HkTlm.Payload.MemType = MemType;
+    MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(DestAddress);
+    MM_AppData.HkTlm.Payload.DataValue = DataValue;
+    MM_AppData.HkTlm.Payload.BytesProcessed = DataSize / 8;
+  }
+
+  return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Masked poke command                                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_MaskedPokeCmd(const MM_MaskedPokeCmd_t *Msg) {
+  cpuaddr DestAddress = 0;
+  uint32 DataSize = Msg->Payload.DataSize;
+  uint32 OldValue = 0;
+  uint32 NewValue = 0;
+  int32 Status;
+
+  Status = MM_ReadPokeAddress(&Msg->Payload.DestSymAddress,
+                              Msg->Payload.MemType, DataSize, &DestAddress,
+                              &OldValue);
+
+  if (Status == OS_SUCCESS) {
+    /* Merge the masked data bits into the current value */
+    NewValue = (Msg->Payload.Data & Msg->Payload.Mask) |
+               (OldValue & ~Msg->Payload.Mask);
+    NewValue &= 0xFFFFFFFFu >> (32 - DataSize);
+
+    Status = MM_WritePokeAddress(DestAddress, Msg->Payload.MemType, DataSize,
+                                 NewValue, MM_LastAction_MASKED_POKE);
+  }
+
+  if (Status == OS_SUCCESS) {
+    MM_AppData.HkTlm.Payload.CmdCounter++;
+    CFE_EVS_SendEvent(MM_MASKED_POKE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Masked Poke Command: Addr = %p Size = %u bits "
+                      "Old = 0x%08X New = 0x%08X",
+                      (void *)DestAddress, (unsigned int)DataSize,
+                      (unsigned int)OldValue, (unsigned int)NewValue);
+  } else {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Conditional poke command                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_ConditionalPokeCmd(const MM_ConditionalPokeCmd_t *Msg) {
+  cpuaddr DestAddress = 0;
+  uint32 DataSize = Msg->Payload.DataSize;
+  uint32 WidthMask = 0;
+  uint32 OldValue = 0;
+  uint32 NewValue = 0;
+  int32 Status;
+
+  Status = MM_ReadPokeAddress(&Msg->Payload.DestSymAddress,
+                              Msg->Payload.MemType, DataSize, &DestAddress,
+                              &OldValue);
+
+  if (Status == OS_SUCCESS) {
+    /* Only the bits that are read and written take part */
+    WidthMask = 0xFFFFFFFFu >> (32 - DataSize);
+    NewValue = Msg->Payload.Data & WidthMask;
+
+    if (OldValue != (Msg->Payload.Expected & WidthMask)) {
+      Status = CFE_PSP_ERROR;
+      CFE_EVS_SendEvent(MM_COND_POKE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Conditional Poke not written: Addr = %p "
+                        "Expected = 0x%08X Actual = 0x%08X",
+                        (void *)DestAddress,
+                        (unsigned int)(Msg->Payload.Expected & WidthMask),
+                        (unsigned int)OldValue);
+    } else {
+      Status =
+          MM_WritePokeAddress(DestAddress, Msg->Payload.MemType, DataSize,
+                              NewValue, MM_LastAction_COND_POKE);
+    }
+  }
+
+  if (Status == OS_SUCCESS) {
+    MM_AppData.HkTlm.Payload.CmdCounter++;
+    CFE_EVS_SendEvent(MM_COND_POKE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Conditional Poke Command: Addr = %p Size = %u bits "
+                      "Old = 0x%08X New = 0x%08X",
+                      (void *)DestAddress, (unsigned int)DataSize,
+                      (unsigned int)OldValue, (unsigned int)NewValue);
+  } else {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+  }
+
+  /* Nothing atypical needs to be done so return success */
+  return CFE_SUCCESS;
+}
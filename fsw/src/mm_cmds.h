@@ -281,6 +281,47 @@ CFE_Status_t MM_PeekCmd(const MM_PeekCmd_t *Msg);
  */
 CFE_Status_t MM_DumpMemToFileCmd(const MM_DumpMemToFileCmd_t *Msg);
 
+/**
+ * \brief Process memory dump to compressed file command
+ *
+ * \par Description
+ *      Processes the memory dump to compressed file command that will
+ *      read a address range of RAM or EEPROM and store the data run-length
+ *      encoded in a command specified file.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      None
+ *
+ * \param[in] Msg Pointer to Memory Dump To Compressed File command struct
+ *
+ * \sa #MM_DUMP_MEM_TO_COMPRESSED_FILE_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t
+MM_DumpMemToCompressedFileCmd(const MM_DumpMemToCompressedFileCmd_t *Msg);
+
+/**
+ * \brief Process dump regions to file command
+ *
+ * \par Description
+ *      Processes the dump regions to file command that will read
+ *      several address ranges, of any memory type, and store them
+ *      in one region file with a CRC for each region.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      None
+ *
+ * \param[in] Msg Pointer to Dump Regions To File command struct
+ *
+ * \sa #MM_DUMP_REGIONS_TO_FILE_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_DumpRegionsToFileCmd(const MM_DumpRegionsToFileCmd_t *Msg);
+
 /**
  * \brief Process memory dump in event command
  *
@@ -301,4 +342,414 @@ CFE_Status_t MM_DumpMemToFileCmd(const MM_DumpMemToFileCmd_t *Msg);
  */
 CFE_Status_t MM_DumpInEventCmd(const MM_DumpInEventCmd_t *Msg);
 
+/**
+ * \brief Process memory dump to telemetry command
+ *
+ * \par Description
+ *      Processes the memory dump to telemetry command that starts sending
+ *      an address range in dump telemetry packets. The packets are sent on
+ *      the following housekeeping requests.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      Only one dump to telemetry can be in progress at a time
+ *
+ * \param[in] Msg Pointer to Dump Memory To Telemetry command struct
+ *
+ * \sa #MM_DUMP_MEM_TO_TLM_CC, #MM_INTERNAL_DUMP_TLM_PACKETS_PER_CYCLE
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_DumpMemToTlmCmd(const MM_DumpMemToTlmCmd_t *Msg);
+
+/**
+ * \brief Process memory dump in telemetry command
+ *
+ * \par Description
+ *      Processes the memory dump in telemetry command that will read
+ *      up to #MM_INTERFACE_MAX_DUMP_TLM_DATA bytes from memory and send
+ *      the raw data in a dump in telemetry packet.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      None
+ *
+ * \param[in] Msg Pointer to Dump In Telemetry command struct
+ *
+ * \sa #MM_DUMP_IN_TLM_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_DumpInTlmCmd(const MM_DumpInTlmCmd_t *Msg);
+
+/**
+ * \brief Load begin command
+ *
+ * \par Description
+ *      Processes the load begin command that verifies the destination of
+ *      a chunked load and clears the chunked load buffer.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      Any chunked load already in progress is discarded
+ *
+ * \param[in] Msg Pointer to Load Begin command struct
+ *
+ * \sa #MM_LOAD_BEGIN_CC, #MM_INTERNAL_MAX_CHUNK_LOAD_BYTES
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_LoadBeginCmd(const MM_LoadBeginCmd_t *Msg);
+
+/**
+ * \brief Load data command
+ *
+ * \par Description
+ *      Processes the load data command that stores one chunk in the
+ *      chunked load buffer.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      None
+ *
+ * \param[in] Msg Pointer to Load Data command struct
+ *
+ * \sa #MM_LOAD_DATA_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_LoadDataCmd(const MM_LoadDataCmd_t *Msg);
+
+/**
+ * \brief Load commit command
+ *
+ * \par Description
+ *      Processes the load commit command that checks the CRC of the
+ *      chunked load buffer and writes it to memory.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      Executed by the worker task
+ *
+ * \param[in] Msg Pointer to Load Commit command struct
+ *
+ * \sa #MM_LOAD_COMMIT_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_LoadCommitCmd(const MM_LoadCommitCmd_t *Msg);
+
+/**
+ * \brief Load RAM commit command
+ *
+ * \par Description
+ *      Processes the load RAM commit command that checks the CRC of the
+ *      chunked load buffer and copies it to RAM with a single memcpy.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      Executed by the worker task
+ *
+ * \param[in] Msg Pointer to Load RAM Commit command struct
+ *
+ * \sa #MM_LOAD_RAM_COMMIT_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_LoadRAMCommitCmd(const MM_LoadRAMCommitCmd_t *Msg);
+
+/**
+ * \brief Checksum memory command
+ *
+ * \par Description
+ *      Processes the checksum memory command that computes the CRC of a
+ *      memory range in place and reports it in housekeeping telemetry.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      Executed by the worker task
+ *
+ * \param[in] Msg Pointer to Checksum Memory command struct
+ *
+ * \sa #MM_CHECKSUM_MEM_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_ChecksumMemCmd(const MM_ChecksumMemCmd_t *Msg);
+
+/**
+ * \brief Set scrub region command
+ *
+ * \par Description
+ *      Processes the set scrub region command that defines a memory
+ *      region, and its golden CRC, for the background scrubber.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      None
+ *
+ * \param[in] Msg Pointer to Set Scrub Region command struct
+ *
+ * \sa #MM_SET_SCRUB_REGION_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_SetScrubRegionCmd(const MM_SetScrubRegionCmd_t *Msg);
+
+/**
+ * \brief Clear scrub region command
+ *
+ * \par Description
+ *      Processes the clear scrub region command that removes a memory
+ *      region from the background scrubber.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      None
+ *
+ * \param[in] Msg Pointer to Clear Scrub Region command struct
+ *
+ * \sa #MM_CLEAR_SCRUB_REGION_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_ClearScrubRegionCmd(const MM_ClearScrubRegionCmd_t *Msg);
+
+/**
+ * \brief Build scrub index command
+ *
+ * \par Description
+ *      Processes the build scrub index command that records the CRC of
+ *      each block of a scrub region, and a root CRC of the block CRCs.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      Executed by the worker task
+ *
+ * \param[in] Msg Pointer to Build Scrub Index command struct
+ *
+ * \sa #MM_BUILD_SCRUB_INDEX_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_BuildScrubIndexCmd(const MM_BuildScrubIndexCmd_t *Msg);
+
+/**
+ * \brief Compare scrub index command
+ *
+ * \par Description
+ *      Processes the compare scrub index command that checks each block
+ *      of a scrub region against its block index and reports the
+ *      mismatching blocks in the scrub index packet.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      Executed by the worker task
+ *
+ * \param[in] Msg Pointer to Compare Scrub Index command struct
+ *
+ * \sa #MM_COMPARE_SCRUB_INDEX_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_CompareScrubIndexCmd(const MM_CompareScrubIndexCmd_t *Msg);
+
+/**
+ * \brief Set CPU budget command
+ *
+ * \par Description
+ *      Processes the set CPU budget command that sets how many
+ *      microseconds of CPU time load, dump, and fill operations may use
+ *      before giving up the CPU.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      The new budget takes effect at the next segment break
+ *
+ * \param[in] Msg Pointer to Set CPU Budget command struct
+ *
+ * \sa #MM_SET_CPU_BUDGET_CC, #MM_INTERNAL_MAX_CPU_BUDGET
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_SetCpuBudgetCmd(const MM_SetCpuBudgetCmd_t *Msg);
+
+/**
+ * \brief Set dump CRC type command
+ *
+ * \par Description
+ *      Processes the set dump CRC type command that selects the CRC
+ *      algorithm used for the integrity field of later dump files.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      Dumps already queued to the worker task use the type that is set
+ *      when they run
+ *
+ * \param[in] Msg Pointer to Set Dump CRC Type command struct
+ *
+ * \sa #MM_SET_DUMP_CRC_TYPE_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_SetDumpCrcTypeCmd(const MM_SetDumpCrcTypeCmd_t *Msg);
+
+/**
+ * \brief Memory test command
+ *
+ * \par Description
+ *      Processes the memory test command that runs the selected test
+ *      patterns over a region of memory and reports the first failing
+ *      reads in a memory test packet.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      Executed by the worker task, which holds the command mutex
+ *
+ * \param[in] Msg Pointer to Memory Test command struct
+ *
+ * \sa #MM_MEM_TEST_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_MemTestCmd(const MM_MemTestCmd_t *Msg);
+
+/**
+ * \brief Batch peek command
+ *
+ * \par Description
+ *      Processes the batch peek command that reads up to
+ *      #MM_INTERFACE_MAX_BATCH_PEEK_ENTRIES memory locations and reports
+ *      the values in one batch peek packet.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      Every entry is resolved and checked before any is read. No packet
+ *      is sent unless every entry is read.
+ *
+ * \param[in] Msg Pointer to Batch Peek command struct
+ *
+ * \sa #MM_BATCH_PEEK_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_BatchPeekCmd(const MM_BatchPeekCmd_t *Msg);
+
+/**
+ * \brief Batch poke command
+ *
+ * \par Description
+ *      Processes the batch poke command that writes up to
+ *      #MM_INTERFACE_MAX_BATCH_POKE_ENTRIES memory locations, restoring
+ *      the locations already written if a write fails.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      Every entry is resolved and checked, and its current value saved,
+ *      before any is written.
+ *
+ * \param[in] Msg Pointer to Batch Poke command struct
+ *
+ * \sa #MM_BATCH_POKE_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_BatchPokeCmd(const MM_BatchPokeCmd_t *Msg);
+
+/**
+ * \brief Set watch entry command
+ *
+ * \par Description
+ *      Processes the set watch entry command that resolves and checks a
+ *      memory location and adds it to the peek sampler watch list.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      None
+ *
+ * \param[in] Msg Pointer to Set Watch Entry command struct
+ *
+ * \sa #MM_SET_WATCH_ENTRY_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_SetWatchEntryCmd(const MM_SetWatchEntryCmd_t *Msg);
+
+/**
+ * \brief Clear watch entry command
+ *
+ * \par Description
+ *      Processes the clear watch entry command that removes a memory
+ *      location from the peek sampler watch list.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      None
+ *
+ * \param[in] Msg Pointer to Clear Watch Entry command struct
+ *
+ * \sa #MM_CLEAR_WATCH_ENTRY_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_ClearWatchEntryCmd(const MM_ClearWatchEntryCmd_t *Msg);
+
+/**
+ * \brief Set sample period command
+ *
+ * \par Description
+ *      Processes the set sample period command that starts, stops, or
+ *      changes the rate of the peek sampler.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      None
+ *
+ * \param[in] Msg Pointer to Set Sample Period command struct
+ *
+ * \sa #MM_SET_SAMPLE_PERIOD_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_SetSamplePeriodCmd(const MM_SetSamplePeriodCmd_t *Msg);
+
+/**
+ * \brief Masked poke command
+ *
+ * \par Description
+ *      Processes the masked poke command that reads a memory address and
+ *      writes back the commanded bits of data merged with the bits of the
+ *      current value that are clear in the mask.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      The read and the write are not atomic
+ *
+ * \param[in] Msg Pointer to Masked Poke command struct
+ *
+ * \sa #MM_MASKED_POKE_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_MaskedPokeCmd(const MM_MaskedPokeCmd_t *Msg);
+
+/**
+ * \brief Conditional poke command
+ *
+ * \par Description
+ *      Processes the conditional poke command that writes a memory
+ *      address only if it holds the expected value.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      The compare and the write are not atomic
+ *
+ * \param[in] Msg Pointer to Conditional Poke command struct
+ *
+ * \sa #MM_CONDITIONAL_POKE_CC
+ *
+ * \return Exuection status
+ * \retval CFE_SUCCESS: Command was successfully handled
+ */
+CFE_Status_t MM_ConditionalPokeCmd(const MM_ConditionalPokeCmd_t *Msg);
+
 #endif /* MM_CMDS_H */
\ No newline at end of file
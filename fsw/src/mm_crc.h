@@ -0,0 +1,100 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Manager CRC engine. The engine
+ *   computes the same CRCs as #CFE_ES_CalculateCRC, using a slice-by-8
+ *   table kernel for CRC-16/ARC so that large files and memory areas are
+ *   processed eight bytes per step instead of one. Load and dump files may
+ *   also use CRC-32 or CRC-32C, computed by the same kind of kernel.
+ */
+#ifndef MM_CRC_H
+#define MM_CRC_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+#include "mm_extern_typedefs.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/**
+ * \brief Highest valid load and dump file CRC type
+ */
+#define MM_CRC_MAX_FILE_TYPE MM_CrcType_CRC32C
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Calculate a CRC
+ *
+ *  \par Description
+ *       Drop-in replacement for #CFE_ES_CalculateCRC. CRC-16/ARC, the
+ *       cFE default CRC, is computed by the table kernel. Other CRC
+ *       types are passed on to #CFE_ES_CalculateCRC.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The result is bit for bit the one #CFE_ES_CalculateCRC returns
+ *       for the same arguments, so a CRC can be continued by either
+ *       function
+ *
+ *  \param [in]  DataPtr     Pointer to the data
+ *  \param [in]  DataLength  Number of bytes of data
+ *  \param [in]  InputCRC    Starting CRC, or the CRC of the data before
+ *                           this piece when calculating a CRC in pieces
+ *  \param [in]  TypeCRC     CRC type to calculate
+ *
+ *  \return Calculated CRC
+ */
+uint32 MM_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC,
+                       CFE_ES_CrcType_Enum_t TypeCRC);
+
+/**
+ * \brief Calculate the CRC of load or dump file data
+ *
+ *  \par Description
+ *       Calculates the CRC selected by the CrcType field of a load or
+ *       dump file header. #MM_CrcType_DEFAULT selects the configured cFE
+ *       CRC type of the file, which keeps files written before the field
+ *       existed valid.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A running CRC starts from zero for every CRC type. CrcType must
+ *       not be greater than #MM_CRC_MAX_FILE_TYPE, larger values are
+ *       treated as #MM_CrcType_DEFAULT.
+ *
+ *  \param [in]  DataPtr      Pointer to the data
+ *  \param [in]  DataLength   Number of bytes of data
+ *  \param [in]  InputCRC     Zero, or the CRC of the data before this
+ *                            piece when calculating a CRC in pieces
+ *  \param [in]  CrcType      CRC type from the file header
+ *  \param [in]  DefaultType  cFE CRC type used for #MM_CrcType_DEFAULT
+ *
+ *  \return Calculated CRC
+ */
+uint32 MM_CalculateFileCRC(const void *DataPtr, size_t DataLength,
+                           uint32 InputCRC, MM_CrcType_Enum_t CrcType,
+                           CFE_ES_CrcType_Enum_t DefaultType);
+
+#endif
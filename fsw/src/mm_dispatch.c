@@ -32,6 +32,7 @@
 #include "mm_msg.h"
 #include "mm_msgids.h"
 #include "mm_utils.h"
+#include "mm_worker.h"
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
@@ -112,13 +113,13 @@ void MM_ProcessGroundCommand(const CFE_SB_Buffer_t *BufPtr) {
 
   case MM_LOAD_MEM_FROM_FILE_CC:
     if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_LoadMemFromFileCmd_t))) {
-      MM_LoadMemFromFileCmd((MM_LoadMemFromFileCmd_t *)BufPtr);
+      MM_WorkerSubmit(BufPtr, sizeof(MM_LoadMemFromFileCmd_t));
     }
     break;
 
   case MM_DUMP_MEM_TO_FILE_CC:
     if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_DumpMemToFileCmd_t))) {
-      MM_DumpMemToFileCmd((MM_DumpMemToFileCmd_t *)BufPtr);
+      MM_WorkerSubmit(BufPtr, sizeof(MM_DumpMemToFileCmd_t));
     }
     break;
 
@@ -128,9 +129,75 @@ void MM_ProcessGroundCommand(const CFE_SB_Buffer_t *BufPtr) {
     }
     break;
 
+  case MM_DUMP_MEM_TO_TLM_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_DumpMemToTlmCmd_t))) {
+      MM_DumpMemToTlmCmd((MM_DumpMemToTlmCmd_t *)BufPtr);
+    }
+    break;
+
+  case MM_DUMP_IN_TLM_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_DumpInTlmCmd_t))) {
+      MM_DumpInTlmCmd((MM_DumpInTlmCmd_t *)BufPtr);
+    }
+    break;
+
+  case MM_LOAD_BEGIN_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_LoadBeginCmd_t))) {
+      MM_LoadBeginCmd((MM_LoadBeginCmd_t *)BufPtr);
+    }
+    break;
+
+  case MM_LOAD_DATA_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_LoadDataCmd_t))) {
+      MM_LoadDataCmd((MM_LoadDataCmd_t *)BufPtr);
+    }
+    break;
+
+  case MM_LOAD_COMMIT_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_LoadCommitCmd_t))) {
+      MM_WorkerSubmit(BufPtr, sizeof(MM_LoadCommitCmd_t));
+    }
+    break;
+
+  case MM_LOAD_RAM_COMMIT_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_LoadRAMCommitCmd_t))) {
+      MM_WorkerSubmit(BufPtr, sizeof(MM_LoadRAMCommitCmd_t));
+    }
+    break;
+
+  case MM_CHECKSUM_MEM_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_ChecksumMemCmd_t))) {
+      MM_WorkerSubmit(BufPtr, sizeof(MM_ChecksumMemCmd_t));
+    }
+    break;
+
+  case MM_SET_SCRUB_REGION_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_SetScrubRegionCmd_t))) {
+      MM_SetScrubRegionCmd((MM_SetScrubRegionCmd_t *)BufPtr);
+    }
+    break;
+
+  case MM_CLEAR_SCRUB_REGION_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_ClearScrubRegionCmd_t))) {
+      MM_ClearScrubRegionCmd((MM_ClearScrubRegionCmd_t *)BufPtr);
+    }
+    break;
+
+  case MM_BUILD_SCRUB_INDEX_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_BuildScrubIndexCmd_t))) {
+      MM_WorkerSubmit(BufPtr, sizeof(MM_BuildScrubIndexCmd_t));
+    }
+    break;
+
+  case MM_COMPARE_SCRUB_INDEX_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_CompareScrubIndexCmd_t))) {
+      MM_WorkerSubmit(BufPtr, sizeof(MM_CompareScrubIndexCmd_t));
+    }
+    break;
+
   case MM_FILL_MEM_CC:
     if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_FillMemCmd_t))) {
-      MM_FillMemCmd((MM_FillMemCmd_t *)BufPtr);
+      MM_WorkerSubmit(BufPtr, sizeof(MM_FillMemCmd_t));
     }
     break;
 
@@ -158,6 +225,79 @@ void MM_ProcessGroundCommand(const CFE_SB_Buffer_t *BufPtr) {
     }
     break;
 
+  case MM_SET_CPU_BUDGET_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_SetCpuBudgetCmd_t))) {
+      MM_SetCpuBudgetCmd((MM_SetCpuBudgetCmd_t *)BufPtr);
+    }
+    break;
+
+  case MM_DUMP_MEM_TO_COMPRESSED_FILE_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg,
+                           sizeof(MM_DumpMemToCompressedFileCmd_t))) {
+      MM_WorkerSubmit(BufPtr, sizeof(MM_DumpMemToCompressedFileCmd_t));
+    }
+    break;
+
+  case MM_DUMP_REGIONS_TO_FILE_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_DumpRegionsToFileCmd_t))) {
+      MM_WorkerSubmit(BufPtr, sizeof(MM_DumpRegionsToFileCmd_t));
+    }
+    break;
+
+  case MM_SET_DUMP_CRC_TYPE_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_SetDumpCrcTypeCmd_t))) {
+      MM_SetDumpCrcTypeCmd((MM_SetDumpCrcTypeCmd_t *)BufPtr);
+    }
+    break;
+
+  case MM_MEM_TEST_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_MemTestCmd_t))) {
+      MM_WorkerSubmit(BufPtr, sizeof(MM_MemTestCmd_t));
+    }
+    break;
+
+  case MM_BATCH_PEEK_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_BatchPeekCmd_t))) {
+      MM_BatchPeekCmd((MM_BatchPeekCmd_t *)BufPtr);
+    }
+    break;
+
+  case MM_BATCH_POKE_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_BatchPokeCmd_t))) {
+      MM_BatchPokeCmd((MM_BatchPokeCmd_t *)BufPtr);
+    }
+    break;
+
+  case MM_SET_WATCH_ENTRY_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_SetWatchEntryCmd_t))) {
+      MM_SetWatchEntryCmd((MM_SetWatchEntryCmd_t *)BufPtr);
+    }
+    break;
+
+  case MM_CLEAR_WATCH_ENTRY_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_ClearWatchEntryCmd_t))) {
+      MM_ClearWatchEntryCmd((MM_ClearWatchEntryCmd_t *)BufPtr);
+    }
+    break;
+
+  case MM_SET_SAMPLE_PERIOD_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_SetSamplePeriodCmd_t))) {
+      MM_SetSamplePeriodCmd((MM_SetSamplePeriodCmd_t *)BufPtr);
+    }
+    break;
+
+  case MM_MASKED_POKE_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_MaskedPokeCmd_t))) {
+      MM_MaskedPokeCmd((MM_MaskedPokeCmd_t *)BufPtr);
+    }
+    break;
+
+  case MM_CONDITIONAL_POKE_CC:
+    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_ConditionalPokeCmd_t))) {
+      MM_ConditionalPokeCmd((MM_ConditionalPokeCmd_t *)BufPtr);
+    }
+    break;
+
   default:
     MM_AppData.HkTlm.Payload.ErrCounter++;
     CFE_EVS_SendEvent(MM_CC_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -180,7 +320,13 @@ void MM_TaskPipe(const CFE_SB_Buffer_t *BufPtr) {
 
   switch (CFE_SB_MsgIdToValue(MsgId)) {
   case MM_CMD_MID:
+    /*
+    ** Wait for the worker task to reach a segment break if it is
+    ** processing a command
+    */
+    OS_MutSemTake(MM_AppData.CmdMutex);
     MM_ProcessGroundCommand(BufPtr);
+    OS_MutSemGive(MM_AppData.CmdMutex);
     break;
 
   case MM_SEND_HK_MID:
@@ -26,11 +26,13 @@
 *************************************************************************/
 #include "mm_dump.h"
 #include "mm_app.h"
+#include "mm_crc.h"
 #include "mm_eventids.h"
 #include "mm_mem16.h"
 #include "mm_mem32.h"
 #include "mm_mem8.h"
 #include "mm_mission_cfg.h"
+#include "mm_rle.h"
 #include "mm_utils.h"
 #include <string.h>
 
@@ -44,51 +46,24 @@ extern MM_AppData_t MM_AppData;
 /* Read 8,16, or 32 bits of data from any given input address      */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-int32 MM_PeekMem(const MM_PeekCmd_t *CmdPtr, cpuaddr SrcAddress) {
+int32 MM_PeekValue(cpuaddr SrcAddress, uint32 DataSize, uint32 *DataValue) {
   uint8 ByteValue = 0;
   uint16 WordValue = 0;
-  uint32 DWordValue = 0;
   int32 PSP_Status = CFE_PSP_ERROR_NOT_IMPLEMENTED;
-  size_t BytesProcessed = 0;
-  uint32 DataValue = 0;
-  size_t DataSize = 0;
-  uint32 EventID = 0;
 
-  /*
-  ** Read the requested number of bytes and report in an event message
-  */
-  switch (CmdPtr->Payload.DataSize) {
+  switch (DataSize) {
   case MM_INTERNAL_BYTE_BIT_WIDTH:
-
     PSP_Status = CFE_PSP_MemRead8(SrcAddress, &ByteValue);
-    DataSize = 8;
-    if (PSP_Status == CFE_PSP_SUCCESS) {
-      DataValue = (uint32)ByteValue;
-      BytesProcessed = sizeof(uint8);
-      EventID = MM_PEEK_BYTE_INF_EID;
-    }
+    *DataValue = (uint32)ByteValue;
     break;
 
   case MM_INTERNAL_WORD_BIT_WIDTH:
-
     PSP_Status = CFE_PSP_MemRead16(SrcAddress, &WordValue);
-    DataSize = 16;
-    if (PSP_Status == CFE_PSP_SUCCESS) {
-      DataValue = (uint32)WordValue;
-      BytesProcessed = sizeof(uint16);
-      EventID = MM_PEEK_WORD_INF_EID;
-    }
+    *DataValue = (uint32)WordValue;
     break;
 
   case MM_INTERNAL_DWORD_BIT_WIDTH:
-
-    PSP_Status = CFE_PSP_MemRead32(SrcAddress, &DWordValue);
-    DataSize = 32;
-    if (PSP_Status == CFE_PSP_SUCCESS) {
-      DataValue = DWordValue;
-      BytesProcessed = sizeof(uint32);
-      EventID = MM_PEEK_DWORD_INF_EID;
-    }
+    PSP_Status = CFE_PSP_MemRead32(SrcAddress, DataValue);
     break;
 
   /*
@@ -99,11 +74,38 @@ int32 MM_PeekMem(const MM_PeekCmd_t *CmdPtr, cpuaddr SrcAddress) {
     break;
   }
 
+  return PSP_Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read 8,16, or 32 bits of data and report it in an event         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_PeekMem(const MM_PeekCmd_t *CmdPtr, cpuaddr SrcAddress) {
+  int32 PSP_Status;
+  uint32 DataValue = 0;
+  size_t DataSize = CmdPtr->Payload.DataSize;
+  uint32 EventID;
+
+  /*
+  ** Read the requested number of bytes and report in an event message
+  */
+  PSP_Status = MM_PeekValue(SrcAddress, DataSize, &DataValue);
+
   if (PSP_Status == CFE_PSP_SUCCESS) {
+    if (DataSize == MM_INTERNAL_BYTE_BIT_WIDTH) {
+      EventID = MM_PEEK_BYTE_INF_EID;
+    } else if (DataSize == MM_INTERNAL_WORD_BIT_WIDTH) {
+      EventID = MM_PEEK_WORD_INF_EID;
+    } else {
+      EventID = MM_PEEK_DWORD_INF_EID;
+    }
+
     MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_PEEK;
     MM_AppData.HkTlm.Payload.MemType = CmdPtr->Payload.MemType;
     MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(SrcAddress);
-    MM_AppData.HkTlm.Payload.BytesProcessed = BytesProcessed;
+    MM_AppData.HkTlm.Payload.BytesProcessed = DataSize / 8;
     MM_AppData.HkTlm.Payload.DataValue = DataValue;
 
     CFE_EVS_SendEvent(EventID, CFE_EVS_EventType_INFORMATION,
@@ -126,11 +128,13 @@ int32 MM_PeekMem(const MM_PeekCmd_t *CmdPtr, cpuaddr SrcAddress) {
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 int32 MM_DumpMemToFile(osal_id_t FileHandle, const char *FileName,
-                       const MM_LoadDumpFileHeader_t *FileHeader) {
+                       const MM_LoadDumpFileHeader_t *FileHeader,
+                       uint32 *CrcPtr) {
   int32 OS_Status = OS_SUCCESS;
   uint32 BytesRemaining = FileHeader->NumOfBytes;
   size_t BytesProcessed = 0;
   size_t SegmentSize = MM_INTERNAL_MAX_DUMP_DATA_SEG;
+  uint32 TempCrc = 0;
   uint8 *SourcePtr = CFE_ES_MEMADDRESS_TO_PTR(FileHeader->SymAddress.Offset);
   uint8 *ioBuffer = (uint8 *)&MM_AppData.DumpBuffer[0];
 
@@ -143,6 +147,11 @@ int32 MM_DumpMemToFile(osal_id_t FileHandle, const char *FileName,
 
     OS_Status = OS_write(FileHandle, ioBuffer, SegmentSize);
     if (OS_Status == SegmentSize) {
+      /* Fold the segment into the running CRC */
+      TempCrc = MM_CalculateFileCRC(ioBuffer, SegmentSize, TempCrc,
+                                    FileHeader->CrcType,
+                                    MM_INTERNAL_DUMP_FILE_CRC_TYPE);
+
       SourcePtr += SegmentSize;
       BytesRemaining -= SegmentSize;
       BytesProcessed += SegmentSize;
@@ -164,6 +173,7 @@ int32 MM_DumpMemToFile(osal_id_t FileHandle, const char *FileName,
 
   /* Update last action statistics */
   if (BytesProcessed == FileHeader->NumOfBytes) {
+    *CrcPtr = TempCrc;
     MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_DUMP_TO_FILE;
     MM_AppData.HkTlm.Payload.MemType = FileHeader->MemType;
     MM_AppData.HkTlm.Payload.Address = FileHeader->SymAddress.Offset;
@@ -177,6 +187,182 @@ int32 MM_DumpMemToFile(osal_id_t FileHandle, const char *FileName,
   return OS_Status;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump memory to a compressed file, encoding one dump segment at  */
+/* a time                                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_DumpMemToCompressedFile(osal_id_t FileHandle, const char *FileName,
+                                 const MM_LoadDumpFileHeader_t *FileHeader,
+                                 uint32 *CrcPtr) {
+  int32 OS_Status = OS_SUCCESS;
+  uint32 BytesRemaining = FileHeader->NumOfBytes;
+  size_t BytesProcessed = 0;
+  size_t SegmentSize = MM_INTERNAL_MAX_DUMP_DATA_SEG;
+  size_t EncodedSize;
+  uint32 TempCrc = 0;
+  uint8 *SourcePtr = CFE_ES_MEMADDRESS_TO_PTR(FileHeader->SymAddress.Offset);
+  uint8 *ioBuffer = (uint8 *)&MM_AppData.DumpBuffer[0];
+
+  while (BytesRemaining != 0) {
+    if (BytesRemaining < MM_INTERNAL_MAX_DUMP_DATA_SEG) {
+      SegmentSize = BytesRemaining;
+    }
+
+    /*
+    ** Encode and CRC a copy of the segment so both see the same data
+    ** if memory changes during the dump
+    */
+    memcpy(ioBuffer, SourcePtr, SegmentSize);
+    EncodedSize = MM_RleEncode(ioBuffer, SegmentSize, MM_AppData.CodecBuffer);
+
+    OS_Status = OS_write(FileHandle, MM_AppData.CodecBuffer, EncodedSize);
+    if (OS_Status == EncodedSize) {
+      /* Fold the uncompressed segment into the running CRC */
+      TempCrc = MM_CalculateFileCRC(ioBuffer, SegmentSize, TempCrc,
+                                    FileHeader->CrcType,
+                                    MM_INTERNAL_DUMP_FILE_CRC_TYPE);
+
+      SourcePtr += SegmentSize;
+      BytesRemaining -= SegmentSize;
+      BytesProcessed += SegmentSize;
+
+      /* Prevent CPU hogging between dump segments */
+      if (BytesRemaining != 0) {
+        MM_SegmentBreak();
+      }
+
+      OS_Status = OS_SUCCESS;
+    } else {
+      BytesRemaining = 0;
+      CFE_EVS_SendEvent(
+          MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+          "OS_write error received: RC = %d, Expected = %u, File = '%s'",
+          (int)OS_Status, (unsigned int)EncodedSize, FileName);
+    }
+  }
+
+  /* Update last action statistics */
+  if (BytesProcessed == FileHeader->NumOfBytes) {
+    *CrcPtr = TempCrc;
+    MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_DUMP_TO_FILE;
+    MM_AppData.HkTlm.Payload.MemType = FileHeader->MemType;
+    MM_AppData.HkTlm.Payload.Address = FileHeader->SymAddress.Offset;
+    MM_AppData.HkTlm.Payload.BytesProcessed = BytesProcessed;
+    strncpy(MM_AppData.HkTlm.Payload.FileName, FileName,
+            CFE_MISSION_MAX_PATH_LEN);
+  } else {
+    OS_Status = OS_ERROR;
+  }
+
+  return OS_Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write the file headers and the region directory of a region     */
+/* file                                                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 MM_WriteRegionFileHeaders(const char *FileName,
+                                       osal_id_t FileHandle,
+                                       CFE_FS_Header_t *CFEHeader,
+                                       const MM_LoadDumpFileHeader_t *MMHeader) {
+  int32 OS_Status;
+
+  OS_Status = MM_WriteFileHeaders(FileName, FileHandle, CFEHeader, MMHeader);
+  if (OS_Status == OS_SUCCESS) {
+    OS_Status =
+        OS_write(FileHandle, MM_AppData.RegionDir, MMHeader->NumOfBytes);
+    if (OS_Status != MMHeader->NumOfBytes) {
+      CFE_EVS_SendEvent(
+          MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+          "OS_write error received: RC = %d Expected = %u File = '%s'",
+          (int)OS_Status, (unsigned int)MMHeader->NumOfBytes, FileName);
+      OS_Status = OS_ERR_INVALID_SIZE;
+    } else {
+      OS_Status = OS_SUCCESS;
+    }
+  }
+
+  return OS_Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump every region in the region directory to a region file      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_DumpRegionsToFile(osal_id_t FileHandle, const char *FileName,
+                           CFE_FS_Header_t *CFEHeader,
+                           MM_LoadDumpFileHeader_t *MMHeader) {
+  MM_LoadDumpFileHeader_t *Region = &MM_AppData.RegionDir[0];
+  uint32 NumRegions = MMHeader->NumOfBytes / sizeof(MM_LoadDumpFileHeader_t);
+  uint32 i;
+  int32 OS_Status;
+
+  /*
+  ** Write the headers and directory first to position the region data, the
+  ** CRCs aren't known until the regions have been dumped
+  */
+  OS_Status =
+      MM_WriteRegionFileHeaders(FileName, FileHandle, CFEHeader, MMHeader);
+
+  for (i = 0; (OS_Status == OS_SUCCESS) && (i < NumRegions); i++) {
+    switch (Region[i].MemType) {
+    case MM_MemType_RAM:
+    case MM_MemType_EEPROM:
+      OS_Status =
+          MM_DumpMemToFile(FileHandle, FileName, &Region[i], &Region[i].Crc);
+      break;
+
+#ifdef MM_INTERNAL_OPT_CODE_MEM32_MEMTYPE
+    case MM_MemType_MEM32:
+      OS_Status =
+          MM_DumpMem32ToFile(FileHandle, FileName, &Region[i], &Region[i].Crc);
+      break;
+#endif /* MM_INTERNAL_OPT_CODE_MEM32_MEMTYPE */
+
+#ifdef MM_INTERNAL_OPT_CODE_MEM16_MEMTYPE
+    case MM_MemType_MEM16:
+      OS_Status =
+          MM_DumpMem16ToFile(FileHandle, FileName, &Region[i], &Region[i].Crc);
+      break;
+#endif /* MM_INTERNAL_OPT_CODE_MEM16_MEMTYPE */
+
+#ifdef MM_INTERNAL_OPT_CODE_MEM8_MEMTYPE
+    case MM_MemType_MEM8:
+      OS_Status =
+          MM_DumpMem8ToFile(FileHandle, FileName, &Region[i], &Region[i].Crc);
+      break;
+#endif /* MM_INTERNAL_OPT_CODE_MEM8_MEMTYPE */
+
+    /*
+    ** The memory type has already been verified, this is not expected
+    */
+    default:
+      OS_Status = OS_ERROR;
+      break;
+    }
+  }
+
+  /*
+  ** Rewrite the headers and directory with the region CRCs and the CRC of
+  ** the directory, writing the cFE header moves the file pointer back to the
+  ** beginning of the file
+  */
+  if (OS_Status == OS_SUCCESS) {
+    MMHeader->Crc = MM_CalculateFileCRC(Region, MMHeader->NumOfBytes, 0,
+                                        MMHeader->CrcType,
+                                        MM_INTERNAL_DUMP_FILE_CRC_TYPE);
+    OS_Status =
+        MM_WriteRegionFileHeaders(FileName, FileHandle, CFEHeader, MMHeader);
+  }
+
+  return OS_Status;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Write the cFE primary and MM secondary file headers         */
@@ -223,12 +409,12 @@ int32 MM_WriteFileHeaders(const char *FileName, osal_id_t FileHandle,
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Fill a buffer with data to be dumped in an event message string */
+/* Read memory into a buffer using the access width required by    */
+/* the memory type                                                 */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-int32 MM_FillDumpInEventBuffer(cpuaddr SrcAddress,
-                               const MM_DumpInEventCmd_t *CmdPtr,
-                               void *DumpBuffer) {
+int32 MM_ReadMemToBuffer(cpuaddr SrcAddress, MM_MemType_Enum_t MemType,
+                         size_t NumBytes, void *DumpBuffer) {
 #if defined(MM_INTERNAL_OPT_CODE_MEM8_MEMTYPE) ||                              \
     defined(MM_INTERNAL_OPT_CODE_MEM16_MEMTYPE) ||                             \
     defined(MM_INTERNAL_OPT_CODE_MEM32_MEMTYPE)
@@ -237,20 +423,17 @@ int32 MM_FillDumpInEventBuffer(cpuaddr SrcAddress,
   /* cppcheck-suppress unusedVariable */
   int32 PSP_Status;
 
-  /* Initialize buffer */
-  memset(DumpBuffer, 0, MM_INTERNAL_MAX_DUMP_INEVENT_BYTES);
-
-  switch (CmdPtr->Payload.MemType) {
+  switch (MemType) {
   case MM_MemType_RAM:
   case MM_MemType_EEPROM:
-    memcpy((void *)DumpBuffer, (void *)SrcAddress, CmdPtr->Payload.NumOfBytes);
+    memcpy((void *)DumpBuffer, (void *)SrcAddress, NumBytes);
     PSP_Status = CFE_PSP_SUCCESS;
 
     break;
 
 #ifdef MM_INTERNAL_OPT_CODE_MEM32_MEMTYPE
   case MM_MemType_MEM32:
-    for (i = 0; i < (CmdPtr->Payload.NumOfBytes / 4); i++) {
+    for (i = 0; i < (NumBytes / 4); i++) {
       PSP_Status = CFE_PSP_MemRead32(SrcAddress, (uint32 *)DumpBuffer);
       if (PSP_Status == CFE_PSP_SUCCESS) {
         SrcAddress += sizeof(uint32);
@@ -270,7 +453,7 @@ int32 MM_FillDumpInEventBuffer(cpuaddr SrcAddress,
 
 #ifdef MM_INTERNAL_OPT_CODE_MEM16_MEMTYPE
   case MM_MemType_MEM16:
-    for (i = 0; i < (CmdPtr->Payload.NumOfBytes / 2); i++) {
+    for (i = 0; i < (NumBytes / 2); i++) {
       PSP_Status = CFE_PSP_MemRead16(SrcAddress, (uint16 *)DumpBuffer);
       if (PSP_Status == CFE_PSP_SUCCESS) {
         SrcAddress += sizeof(uint16);
@@ -290,7 +473,7 @@ int32 MM_FillDumpInEventBuffer(cpuaddr SrcAddress,
 
 #ifdef MM_INTERNAL_OPT_CODE_MEM8_MEMTYPE
   case MM_MemType_MEM8:
-    for (i = 0; i < CmdPtr->Payload.NumOfBytes; i++) {
+    for (i = 0; i < NumBytes; i++) {
       PSP_Status = CFE_PSP_MemRead8(SrcAddress, (uint8 *)DumpBuffer);
       if (PSP_Status == CFE_PSP_SUCCESS) {
         SrcAddress++;
@@ -308,13 +491,143 @@ int32 MM_FillDumpInEventBuffer(cpuaddr SrcAddress,
     break;
 #endif /* MM_INTERNAL_OPT_CODE_MEM8_MEMTYPE */
   default:
-    /* This branch will never be executed. CmdPtr->Payload.MemType will always
+    /* This branch will never be executed. MemType will always
      * be valid value for this switch statement it is verified via
      * MM_VerifyFileLoadDumpParams */
     PSP_Status = CFE_PSP_ERROR;
     break;
 
-  } /* end CmdPtr->Payload.MemType switch */
+  } /* end MemType switch */
+
+  return PSP_Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Fill a buffer with data to be dumped in an event message string */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_FillDumpInEventBuffer(cpuaddr SrcAddress,
+                               const MM_DumpInEventCmd_t *CmdPtr,
+                               void *DumpBuffer) {
+  /* Initialize buffer */
+  memset(DumpBuffer, 0, MM_INTERNAL_MAX_DUMP_INEVENT_BYTES);
+
+  return MM_ReadMemToBuffer(SrcAddress, CmdPtr->Payload.MemType,
+                            CmdPtr->Payload.NumOfBytes, DumpBuffer);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send the next dump telemetry packets                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SendDumpTlm(void) {
+  MM_DumpTlmState_t *State = &MM_AppData.DumpTlmState;
+  MM_DumpTlm_Payload_t *Payload = &MM_AppData.DumpTlm.Payload;
+  uint32 PacketCount = 0;
+  size_t NumBytes;
+  int32 PSP_Status;
+
+  while ((State->BytesRemaining != 0) &&
+         (PacketCount < MM_INTERNAL_DUMP_TLM_PACKETS_PER_CYCLE)) {
+    NumBytes = sizeof(Payload->Data);
+    if (State->BytesRemaining < NumBytes) {
+      /* Clear the unused data bytes of the last packet */
+      NumBytes = State->BytesRemaining;
+      memset(Payload->Data, 0, sizeof(Payload->Data));
+    }
+
+    PSP_Status = MM_ReadMemToBuffer(State->Address, State->MemType, NumBytes,
+                                    Payload->Data);
+    if (PSP_Status == CFE_PSP_SUCCESS) {
+      State->BytesRemaining -= NumBytes;
+
+      Payload->Address = CFE_ES_MEMADDRESS_C(State->Address);
+      Payload->MemType = State->MemType;
+      Payload->Sequence = State->Sequence;
+      Payload->BytesRemaining = State->BytesRemaining;
+      Payload->NumOfBytes = NumBytes;
+      Payload->Crc = MM_CalculateCRC(Payload->Data, NumBytes, 0,
+                                     MM_INTERNAL_DUMP_FILE_CRC_TYPE);
+
+      CFE_SB_TimeStampMsg(CFE_MSG_PTR(MM_AppData.DumpTlm.TelemetryHeader));
+      CFE_SB_TransmitMsg(CFE_MSG_PTR(MM_AppData.DumpTlm.TelemetryHeader),
+                         true);
+
+      State->Address += NumBytes;
+      State->Sequence++;
+      PacketCount++;
+    } else {
+      /* The read error has been reported, end the dump */
+      CFE_EVS_SendEvent(MM_DUMP_TLM_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Dump to telemetry ended by read error: Packet = %u "
+                        "Addr = %p",
+                        (unsigned int)State->Sequence, (void *)State->Address);
+      State->BytesRemaining = 0;
+    }
+  }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Fold one memory segment into a running CRC                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_CalculateMemCRC(cpuaddr SrcAddress, MM_MemType_Enum_t MemType,
+                         size_t NumBytes, void *Buffer, uint32 *CrcPtr) {
+  int32 PSP_Status = CFE_PSP_SUCCESS;
+  const void *SegmentPtr;
+
+  if ((MemType == MM_MemType_RAM) || (MemType == MM_MemType_EEPROM)) {
+    /* Directly addressable memory is folded into the CRC in place */
+    SegmentPtr = (const void *)SrcAddress;
+  } else {
+    PSP_Status = MM_ReadMemToBuffer(SrcAddress, MemType, NumBytes, Buffer);
+    SegmentPtr = Buffer;
+  }
+
+  if (PSP_Status == CFE_PSP_SUCCESS) {
+    *CrcPtr = MM_CalculateCRC(SegmentPtr, NumBytes, *CrcPtr,
+                              MM_INTERNAL_CHECKSUM_CRC_TYPE);
+  }
+
+  return PSP_Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compute the CRC of a memory range one segment at a time         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_ChecksumMem(cpuaddr SrcAddress, MM_MemType_Enum_t MemType,
+                     uint32 NumBytes, uint32 *CrcPtr) {
+  int32 PSP_Status = CFE_PSP_SUCCESS;
+  uint32 BytesRemaining = NumBytes;
+  size_t SegmentSize = MM_INTERNAL_MAX_DUMP_DATA_SEG;
+  uint32 TempCrc = 0;
+
+  while ((BytesRemaining != 0) && (PSP_Status == CFE_PSP_SUCCESS)) {
+    if (BytesRemaining < MM_INTERNAL_MAX_DUMP_DATA_SEG) {
+      SegmentSize = BytesRemaining;
+    }
+
+    PSP_Status = MM_CalculateMemCRC(SrcAddress, MemType, SegmentSize,
+                                    MM_AppData.DumpBuffer, &TempCrc);
+    if (PSP_Status == CFE_PSP_SUCCESS) {
+      SrcAddress += SegmentSize;
+      BytesRemaining -= SegmentSize;
+
+      /* Prevent CPU hogging between checksum segments */
+      if (BytesRemaining != 0) {
+        MM_SegmentBreak();
+      }
+    }
+  }
+
+  if (PSP_Status == CFE_PSP_SUCCESS) {
+    *CrcPtr = TempCrc;
+  }
 
   return PSP_Status;
 }
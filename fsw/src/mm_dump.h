@@ -34,6 +34,26 @@
  * Exported Functions
  *************************************************************************/
 
+/**
+ * \brief Read a peek value
+ *
+ * \par Description
+ *      Support function for #MM_PeekMem and #MM_BatchPeekCmd. This
+ *      routine will read 8, 16, or 32 bits of data with the PSP
+ *      accessor of the matching width.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *      Sends no events, the caller reports read errors
+ *
+ * \param [in]   SrcAddress   The source address for the peek operation
+ * \param [in]   DataSize     Number of bits to read (8, 16, or 32)
+ * \param [out]  DataValue    The value read
+ *
+ * \return Execution status
+ * \retval #CFE_PSP_ERROR_NOT_IMPLEMENTED DataSize is not a known width
+ */
+int32 MM_PeekValue(cpuaddr SrcAddress, uint32 DataSize, uint32 *DataValue);
+
 /**
  * \brief Memory peek
  *
@@ -66,11 +86,67 @@ int32 MM_PeekMem(const MM_PeekCmd_t *CmdPtr, cpuaddr SrcAddress);
  *                             the dump file name
  *  \param [in]   FileHeader   Pointer to the dump file header structure
  * initialized
+ *  \param [out]  CrcPtr       Computed CRC of the dumped data, only
+ *                             valid on success
  *
  *  \return Execution status
  */
 int32 MM_DumpMemToFile(osal_id_t FileHandle, const char *FileName,
-                       const MM_LoadDumpFileHeader_t *FileHeader);
+                       const MM_LoadDumpFileHeader_t *FileHeader,
+                       uint32 *CrcPtr);
+
+/**
+ * \brief Memory dump to compressed file
+ *
+ *  \par Description
+ *       Support function for #MM_DumpMemToCompressedFileCmd. This routine
+ *       will read an address range and store the data run-length encoded
+ *       in a file, one dump segment at a time.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only RAM and EEPROM can be dumped to a compressed file
+ *
+ *  \param [in]   FileHandle   The open file handle of the dump file
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the dump file name
+ *  \param [in]   FileHeader   Pointer to the dump file header structure
+ *                             initialized
+ *  \param [out]  CrcPtr       Computed CRC of the uncompressed dumped data,
+ *                             only valid on success
+ *
+ *  \return Execution status
+ */
+int32 MM_DumpMemToCompressedFile(osal_id_t FileHandle, const char *FileName,
+                                 const MM_LoadDumpFileHeader_t *FileHeader,
+                                 uint32 *CrcPtr);
+
+/**
+ * \brief Memory dump to region file
+ *
+ *  \par Description
+ *       Support function for #MM_DumpRegionsToFileCmd. This routine will
+ *       write the file headers and the region directory, dump each region
+ *       in the directory in order, then rewrite the headers and directory
+ *       with the CRC of each region and the CRC of the directory.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The region directory in the MM global data must hold the verified,
+ *       fully resolved regions to dump
+ *
+ *  \param [in]   FileHandle   The open file handle of the dump file
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the dump file name
+ *  \param [in]   CFEHeader    Pointer to the initialized cFE primary file
+ *                             header
+ *  \param [in,out] MMHeader   Pointer to the MM secondary file header with
+ *                             the directory size, the directory CRC is
+ *                             stored here on success
+ *
+ *  \return Execution status
+ */
+int32 MM_DumpRegionsToFile(osal_id_t FileHandle, const char *FileName,
+                           CFE_FS_Header_t *CFEHeader,
+                           MM_LoadDumpFileHeader_t *MMHeader);
 
 /**
  * \brief Write the cFE primary and MM secondary file headers
@@ -120,4 +196,94 @@ int32 MM_FillDumpInEventBuffer(cpuaddr SrcAddress,
                                const MM_DumpInEventCmd_t *CmdPtr,
                                void *DumpBuffer);
 
+/**
+ * \brief Read memory into a buffer
+ *
+ *  \par Description
+ *       Reads an address range of any supported memory type into a byte
+ *       array, using the 8, 16, or 32 bit reads the optional memory types
+ *       require.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The source address, memory type, and size must already have been
+ *       verified
+ *
+ *  \param [in]   SrcAddress   The source address to read from
+ *  \param [in]   MemType      The memory type of the source
+ *  \param [in]   NumBytes     The number of bytes to read
+ *  \param [out]  DumpBuffer   Byte array holding the data read
+ *
+ *  \return Execution status
+ *
+ *  \sa #MM_PSP_READ_ERR_EID
+ */
+int32 MM_ReadMemToBuffer(cpuaddr SrcAddress, MM_MemType_Enum_t MemType,
+                         size_t NumBytes, void *DumpBuffer);
+
+/**
+ * \brief Send dump telemetry packets
+ *
+ *  \par Description
+ *       Support function for #MM_DumpMemToTlmCmd. Sends up to
+ *       #MM_INTERNAL_DUMP_TLM_PACKETS_PER_CYCLE dump telemetry packets of
+ *       the dump to telemetry in progress, each with its sequence number
+ *       and the CRC of its data.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called on each housekeeping request. Does nothing when no dump to
+ *       telemetry is in progress.
+ *
+ *  \sa #MM_DUMP_TLM_ERR_EID
+ */
+void MM_SendDumpTlm(void);
+
+/**
+ * \brief Fold a memory segment into a CRC
+ *
+ *  \par Description
+ *       RAM and EEPROM are folded into the CRC in place, the optional
+ *       memory types are first copied to the buffer with the access
+ *       width they require.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The source address, memory type, and size must already have been
+ *       verified. The buffer must hold at least NumBytes bytes.
+ *
+ *  \param [in]     SrcAddress   The source address to read from
+ *  \param [in]     MemType      The memory type of the source
+ *  \param [in]     NumBytes     The number of bytes to fold in
+ *  \param [out]    Buffer       Read buffer for the optional memory types
+ *  \param [in,out] CrcPtr       The running CRC, only updated on success
+ *
+ *  \return Execution status
+ *
+ *  \sa #MM_PSP_READ_ERR_EID
+ */
+int32 MM_CalculateMemCRC(cpuaddr SrcAddress, MM_MemType_Enum_t MemType,
+                         size_t NumBytes, void *Buffer, uint32 *CrcPtr);
+
+/**
+ * \brief Compute the CRC of a memory range
+ *
+ *  \par Description
+ *       Support function for #MM_ChecksumMemCmd. Folds the address range
+ *       into a CRC one dump segment at a time with #MM_CalculateMemCRC,
+ *       using the dump buffer. Calls #MM_SegmentBreak between segments.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The source address, memory type, and size must already have been
+ *       verified. Must be called from the worker task.
+ *
+ *  \param [in]   SrcAddress   The source address to checksum
+ *  \param [in]   MemType      The memory type of the source
+ *  \param [in]   NumBytes     The number of bytes to checksum
+ *  \param [out]  CrcPtr       The computed CRC, only set on success
+ *
+ *  \return Execution status
+ *
+ *  \sa #MM_PSP_READ_ERR_EID
+ */
+int32 MM_ChecksumMem(cpuaddr SrcAddress, MM_MemType_Enum_t MemType,
+                     uint32 NumBytes, uint32 *CrcPtr);
+
 #endif
@@ -26,10 +26,76 @@
 #include "mm_eventids.h"
 #include "mm_msg.h"
 #include "mm_msgids.h"
+#include "mm_worker.h"
 
 #include "mm_eds_dictionary.h"
 #include "mm_eds_dispatcher.h"
 
+/*
+ * Long running commands are handed to the worker task
+ */
+static CFE_Status_t
+MM_QueueLoadMemFromFileCmd(const MM_LoadMemFromFileCmd_t *Msg) {
+  MM_WorkerSubmit((const CFE_SB_Buffer_t *)Msg, sizeof(*Msg));
+  return CFE_SUCCESS;
+}
+
+static CFE_Status_t
+MM_QueueDumpMemToFileCmd(const MM_DumpMemToFileCmd_t *Msg) {
+  MM_WorkerSubmit((const CFE_SB_Buffer_t *)Msg, sizeof(*Msg));
+  return CFE_SUCCESS;
+}
+
+static CFE_Status_t MM_QueueDumpMemToCompressedFileCmd(
+    const MM_DumpMemToCompressedFileCmd_t *Msg) {
+  MM_WorkerSubmit((const CFE_SB_Buffer_t *)Msg, sizeof(*Msg));
+  return CFE_SUCCESS;
+}
+
+static CFE_Status_t
+MM_QueueDumpRegionsToFileCmd(const MM_DumpRegionsToFileCmd_t *Msg) {
+  MM_WorkerSubmit((const CFE_SB_Buffer_t *)Msg, sizeof(*Msg));
+  return CFE_SUCCESS;
+}
+
+static CFE_Status_t MM_QueueFillMemCmd(const MM_FillMemCmd_t *Msg) {
+  MM_WorkerSubmit((const CFE_SB_Buffer_t *)Msg, sizeof(*Msg));
+  return CFE_SUCCESS;
+}
+
+static CFE_Status_t MM_QueueLoadCommitCmd(const MM_LoadCommitCmd_t *Msg) {
+  MM_WorkerSubmit((const CFE_SB_Buffer_t *)Msg, sizeof(*Msg));
+  return CFE_SUCCESS;
+}
+
+static CFE_Status_t
+MM_QueueLoadRAMCommitCmd(const MM_LoadRAMCommitCmd_t *Msg) {
+  MM_WorkerSubmit((const CFE_SB_Buffer_t *)Msg, sizeof(*Msg));
+  return CFE_SUCCESS;
+}
+
+static CFE_Status_t MM_QueueChecksumMemCmd(const MM_ChecksumMemCmd_t *Msg) {
+  MM_WorkerSubmit((const CFE_SB_Buffer_t *)Msg, sizeof(*Msg));
+  return CFE_SUCCESS;
+}
+
+static CFE_Status_t
+MM_QueueBuildScrubIndexCmd(const MM_BuildScrubIndexCmd_t *Msg) {
+  MM_WorkerSubmit((const CFE_SB_Buffer_t *)Msg, sizeof(*Msg));
+  return CFE_SUCCESS;
+}
+
+static CFE_Status_t
+MM_QueueCompareScrubIndexCmd(const MM_CompareScrubIndexCmd_t *Msg) {
+  MM_WorkerSubmit((const CFE_SB_Buffer_t *)Msg, sizeof(*Msg));
+  return CFE_SUCCESS;
+}
+
+static CFE_Status_t MM_QueueMemTestCmd(const MM_MemTestCmd_t *Msg) {
+  MM_WorkerSubmit((const CFE_SB_Buffer_t *)Msg, sizeof(*Msg));
+  return CFE_SUCCESS;
+}
+
 /*
  * Define a lookup table for MM command codes
  */
@@ -46,11 +112,34 @@ static const EdsDispatchTable_EdsComponent_MM_Application_CFE_SB_Telecommand_t M
         .EepromWriteDisCmd_indication  = MM_EepromWriteDisCmd,
         .PokeCmd_indication            = MM_PokeCmd,
         .LoadMemWIDCmd_indication      = MM_LoadMemWIDCmd,
-        .LoadMemFromFileCmd_indication = MM_LoadMemFromFileCmd,
-        .FillMemCmd_indication         = MM_FillMemCmd,
+        .LoadMemFromFileCmd_indication = MM_QueueLoadMemFromFileCmd,
+        .FillMemCmd_indication         = MM_QueueFillMemCmd,
         .PeekCmd_indication            = MM_PeekCmd,
-        .DumpMemToFileCmd_indication   = MM_DumpMemToFileCmd,
+        .DumpMemToFileCmd_indication   = MM_QueueDumpMemToFileCmd,
         .DumpInEventCmd_indication     = MM_DumpInEventCmd,
+        .SetCpuBudgetCmd_indication    = MM_SetCpuBudgetCmd,
+        .DumpMemToCompressedFileCmd_indication = MM_QueueDumpMemToCompressedFileCmd,
+        .DumpRegionsToFileCmd_indication = MM_QueueDumpRegionsToFileCmd,
+        .DumpMemToTlmCmd_indication    = MM_DumpMemToTlmCmd,
+        .DumpInTlmCmd_indication       = MM_DumpInTlmCmd,
+        .LoadBeginCmd_indication       = MM_LoadBeginCmd,
+        .LoadDataCmd_indication        = MM_LoadDataCmd,
+        .LoadCommitCmd_indication      = MM_QueueLoadCommitCmd,
+        .LoadRAMCommitCmd_indication   = MM_QueueLoadRAMCommitCmd,
+        .ChecksumMemCmd_indication     = MM_QueueChecksumMemCmd,
+        .SetScrubRegionCmd_indication  = MM_SetScrubRegionCmd,
+        .ClearScrubRegionCmd_indication = MM_ClearScrubRegionCmd,
+        .BuildScrubIndexCmd_indication = MM_QueueBuildScrubIndexCmd,
+        .CompareScrubIndexCmd_indication = MM_QueueCompareScrubIndexCmd,
+        .SetDumpCrcTypeCmd_indication  = MM_SetDumpCrcTypeCmd,
+        .MemTestCmd_indication         = MM_QueueMemTestCmd,
+        .BatchPeekCmd_indication       = MM_BatchPeekCmd,
+        .BatchPokeCmd_indication       = MM_BatchPokeCmd,
+        .SetWatchEntryCmd_indication   = MM_SetWatchEntryCmd,
+        .ClearWatchEntryCmd_indication = MM_ClearWatchEntryCmd,
+        .SetSamplePeriodCmd_indication = MM_SetSamplePeriodCmd,
+        .MaskedPokeCmd_indication      = MM_MaskedPokeCmd,
+        .ConditionalPokeCmd_indication = MM_ConditionalPokeCmd,
     },
     .SEND_HK =
     {
@@ -71,12 +160,27 @@ void MM_TaskPipe(const CFE_SB_Buffer_t *BufPtr) {
   CFE_SB_MsgId_t MsgId;
   CFE_MSG_Size_t MsgSize;
   CFE_MSG_FcnCode_t MsgFc;
+  bool IsGroundCmd;
+
+  CFE_MSG_GetMsgId(&BufPtr->Msg, &MsgId);
+  IsGroundCmd = CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(MM_CMD_MID));
+
+  /*
+  ** Wait for the worker task to reach a segment break if it is
+  ** processing a command. Housekeeping requests don't wait.
+  */
+  if (IsGroundCmd) {
+    OS_MutSemTake(MM_AppData.CmdMutex);
+  }
 
   Status = EdsDispatch_EdsComponent_MM_Application_Telecommand(
       BufPtr, &MM_TC_DISPATCH_TABLE);
 
+  if (IsGroundCmd) {
+    OS_MutSemGive(MM_AppData.CmdMutex);
+  }
+
   if (Status != CFE_SUCCESS) {
-    CFE_MSG_GetMsgId(&BufPtr->Msg, &MsgId);
     CFE_MSG_GetSize(&BufPtr->Msg, &MsgSize);
     CFE_MSG_GetFcnCode(&BufPtr->Msg, &MsgFc);
     ++MM_AppData.HkTlm.Payload.ErrCounter;
@@ -27,12 +27,14 @@
 *************************************************************************/
 #include "mm_load.h"
 #include "mm_app.h"
+#include "mm_crc.h"
 #include "mm_eventids.h"
 #include "mm_mem16.h"
 #include "mm_mem32.h"
 #include "mm_mem8.h"
 #include "mm_mission_cfg.h"
 #include "mm_perfids.h"
+#include "mm_rle.h"
 #include "mm_utils.h"
 #include <string.h>
 
@@ -41,69 +43,86 @@
 *************************************************************************/
 extern MM_AppData_t MM_AppData;
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write 8, 16, or 32 bits of data to any given input address      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_PokeValue(cpuaddr DestAddress, MM_MemType_Enum_t MemType,
+                   uint32 DataSize, uint32 DataValue) {
+  int32 PSP_Status = CFE_PSP_ERROR_NOT_IMPLEMENTED;
+  bool Eeprom = (MemType == MM_MemType_EEPROM);
+
+  switch (DataSize) {
+  case MM_INTERNAL_BYTE_BIT_WIDTH:
+    PSP_Status = Eeprom ? CFE_PSP_EepromWrite8(DestAddress, (uint8)DataValue)
+                        : CFE_PSP_MemWrite8(DestAddress, (uint8)DataValue);
+    break;
+
+  case MM_INTERNAL_WORD_BIT_WIDTH:
+    PSP_Status = Eeprom ? CFE_PSP_EepromWrite16(DestAddress, (uint16)DataValue)
+                        : CFE_PSP_MemWrite16(DestAddress, (uint16)DataValue);
+    break;
+
+  case MM_INTERNAL_DWORD_BIT_WIDTH:
+    PSP_Status = Eeprom ? CFE_PSP_EepromWrite32(DestAddress, DataValue)
+                        : CFE_PSP_MemWrite32(DestAddress, DataValue);
+    break;
+
+  /*
+  ** We don't need a default case, a bad DataSize will get caught
+  ** in the MM_VerifyPeekPokeParams function and we won't get here
+  */
+  default:
+    break;
+  }
+
+  return PSP_Status;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Write 8, 16, or 32 bits of data to any RAM memory address       */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 CFE_Status_t MM_PokeMem(const MM_PokeCmd_t *CmdPtr, cpuaddr DestAddress) {
-  uint8 ByteValue;
-  uint16 WordValue;
-  CFE_Status_t PSP_Status = CFE_PSP_ERROR_NOT_IMPLEMENTED;
+  CFE_Status_t PSP_Status;
   uint32 DataValue = 0;
-  size_t BytesProcessed = 0;
-  size_t DataSize = 0; /* only used for giving MEM type/size in events */
+  size_t DataSize = CmdPtr->Payload.DataSize;
   uint32 EventID = 0;
 
-  /* Write input number of bits to destination address */
-  switch (CmdPtr->Payload.DataSize) {
+  /* Truncate the data to the number of bits written */
+  switch (DataSize) {
   case MM_INTERNAL_BYTE_BIT_WIDTH:
-    ByteValue = (uint8)CmdPtr->Payload.Data;
-    DataValue = (uint32)ByteValue;
-    BytesProcessed = sizeof(uint8);
-    DataSize = 8;
-    if ((PSP_Status = CFE_PSP_MemWrite8(DestAddress, ByteValue)) ==
-        CFE_PSP_SUCCESS) {
-      EventID = MM_POKE_BYTE_INF_EID;
-    }
+    DataValue = (uint8)CmdPtr->Payload.Data;
+    EventID = MM_POKE_BYTE_INF_EID;
     break;
 
   case MM_INTERNAL_WORD_BIT_WIDTH:
-    WordValue = (uint16)CmdPtr->Payload.Data;
-    DataValue = (uint32)WordValue;
-    BytesProcessed = sizeof(uint16);
-    DataSize = 16;
-    if ((PSP_Status = CFE_PSP_MemWrite16(DestAddress, WordValue)) ==
-        CFE_PSP_SUCCESS) {
-      EventID = MM_POKE_WORD_INF_EID;
-    }
+    DataValue = (uint16)CmdPtr->Payload.Data;
+    EventID = MM_POKE_WORD_INF_EID;
     break;
 
   case MM_INTERNAL_DWORD_BIT_WIDTH:
     DataValue = CmdPtr->Payload.Data;
-    BytesProcessed = sizeof(uint32);
-    DataSize = 32;
-    if ((PSP_Status = CFE_PSP_MemWrite32(DestAddress, DataValue)) ==
-        CFE_PSP_SUCCESS) {
-      EventID = MM_POKE_DWORD_INF_EID;
-    }
+    EventID = MM_POKE_DWORD_INF_EID;
     break;
 
-  /*
-  ** We don't need a default case, a bad DataSize will get caught
-  ** in the MM_VerifyPeekPokeParams function and we won't get here
-  */
   default:
     break;
   }
 
+  /* Write input number of bits to destination address */
+  PSP_Status = MM_PokeValue(DestAddress, CmdPtr->Payload.MemType, DataSize,
+                            DataValue);
+
   if (PSP_Status == CFE_PSP_SUCCESS) {
     /* Update cmd counter and last action stats */
     MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_POKE;
     MM_AppData.HkTlm.Payload.MemType = CmdPtr->Payload.MemType;
     MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(DestAddress);
     MM_AppData.HkTlm.Payload.DataValue = DataValue;
-    MM_AppData.HkTlm.Payload.BytesProcessed = BytesProcessed;
+    MM_AppData.HkTlm.Payload.BytesProcessed = DataSize / 8;
 
     CFE_EVS_SendEvent(EventID, CFE_EVS_EventType_INFORMATION,
                       "Poke Command: Addr = %p, Size = %u bits, Data = 0x%08X",
@@ -119,27 +138,98 @@ CFE_Status_t MM_PokeMem(const MM_PokeCmd_t *CmdPtr, cpuaddr DestAddress) {
   return PSP_Status;
 }
 
+#ifdef MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check whether an EEPROM address already holds the poke data     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool MM_EepromHoldsPokeData(cpuaddr DestAddress, uint32 DataSize,
+                                   uint32 DataValue) {
+  uint8 ByteValue = 0;
+  uint16 WordValue = 0;
+  uint32 DWordValue = 0;
+  bool Matches = false;
+
+  /* A failed read is treated as a mismatch so the write is attempted */
+  switch (DataSize) {
+  case MM_INTERNAL_BYTE_BIT_WIDTH:
+    Matches = (CFE_PSP_MemRead8(DestAddress, &ByteValue) == CFE_PSP_SUCCESS) &&
+              (ByteValue == (uint8)DataValue);
+    break;
+
+  case MM_INTERNAL_WORD_BIT_WIDTH:
+    Matches =
+        (CFE_PSP_MemRead16(DestAddress, &WordValue) == CFE_PSP_SUCCESS) &&
+        (WordValue == (uint16)DataValue);
+    break;
+
+  case MM_INTERNAL_DWORD_BIT_WIDTH:
+    Matches =
+        (CFE_PSP_MemRead32(DestAddress, &DWordValue) == CFE_PSP_SUCCESS) &&
+        (DWordValue == DataValue);
+    break;
+
+  default:
+    break;
+  }
+
+  return Matches;
+}
+#endif /* MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write 8, 16, or 32 bits of data to EEPROM without reporting it  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_WriteEepromValue(cpuaddr DestAddress, uint32 DataSize,
+                          uint32 DataValue) {
+  int32 PSP_Status = CFE_PSP_SUCCESS;
+  bool Unchanged = false;
+
+  CFE_ES_PerfLogEntry(MM_EEPROM_POKE_PERF_ID);
+
+#ifdef MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+  /* Skip the EEPROM write if the address already holds the data */
+  Unchanged = MM_EepromHoldsPokeData(DestAddress, DataSize, DataValue);
+#endif
+
+  if (!Unchanged) {
+    PSP_Status =
+        MM_PokeValue(DestAddress, MM_MemType_EEPROM, DataSize, DataValue);
+  }
+
+#ifdef MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+  if (PSP_Status == CFE_PSP_SUCCESS) {
+    if (Unchanged) {
+      MM_AppData.HkTlm.Payload.EepromBytesSkipped += DataSize / 8;
+    } else {
+      MM_AppData.HkTlm.Payload.EepromBytesWritten += DataSize / 8;
+    }
+  }
+#endif
+
+  CFE_ES_PerfLogExit(MM_EEPROM_POKE_PERF_ID);
+
+  return PSP_Status;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Write 8, 16, or 32 bits of data to any EEPROM memory address    */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 CFE_Status_t MM_PokeEeprom(const MM_PokeCmd_t *CmdPtr, cpuaddr DestAddress) {
-  uint8 ByteValue;
-  uint16 WordValue;
   CFE_Status_t PSP_Status = CFE_PSP_ERROR_NOT_IMPLEMENTED;
   uint32 DataValue = 0;
-  size_t BytesProcessed = 0;
-
-  CFE_ES_PerfLogEntry(MM_EEPROM_POKE_PERF_ID);
 
   /* Write input number of bits to destination address */
   switch (CmdPtr->Payload.DataSize) {
   case MM_INTERNAL_BYTE_BIT_WIDTH:
-    ByteValue = (uint8)CmdPtr->Payload.Data;
-    DataValue = (uint32)ByteValue;
-    BytesProcessed = sizeof(uint8);
-    PSP_Status = CFE_PSP_EepromWrite8(DestAddress, ByteValue);
+    DataValue = (uint8)CmdPtr->Payload.Data;
+    PSP_Status = MM_WriteEepromValue(DestAddress, MM_INTERNAL_BYTE_BIT_WIDTH,
+                                     DataValue);
     if (PSP_Status != CFE_PSP_SUCCESS) {
       CFE_EVS_SendEvent(
           MM_OS_EEPROMWRITE8_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -148,15 +238,14 @@ CFE_Status_t MM_PokeEeprom(const MM_PokeCmd_t *CmdPtr, cpuaddr DestAddress) {
     } else {
       CFE_EVS_SendEvent(MM_POKE_BYTE_INF_EID, CFE_EVS_EventType_INFORMATION,
                         "Poke Command: Addr = %p, Size = 8 bits, Data = 0x%02X",
-                        (void *)DestAddress, ByteValue);
+                        (void *)DestAddress, (unsigned int)DataValue);
     }
     break;
 
   case MM_INTERNAL_WORD_BIT_WIDTH:
-    WordValue = (uint16)CmdPtr->Payload.Data;
-    DataValue = (uint32)WordValue;
-    BytesProcessed = sizeof(uint16);
-    PSP_Status = CFE_PSP_EepromWrite16(DestAddress, WordValue);
+    DataValue = (uint16)CmdPtr->Payload.Data;
+    PSP_Status = MM_WriteEepromValue(DestAddress, MM_INTERNAL_WORD_BIT_WIDTH,
+                                     DataValue);
     if (PSP_Status != CFE_PSP_SUCCESS) {
       CFE_EVS_SendEvent(
           MM_OS_EEPROMWRITE16_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -166,14 +255,14 @@ CFE_Status_t MM_PokeEeprom(const MM_PokeCmd_t *CmdPtr, cpuaddr DestAddress) {
       CFE_EVS_SendEvent(
           MM_POKE_WORD_INF_EID, CFE_EVS_EventType_INFORMATION,
           "Poke Command: Addr = %p, Size = 16 bits, Data = 0x%04X",
-          (void *)DestAddress, WordValue);
+          (void *)DestAddress, (unsigned int)DataValue);
     }
     break;
 
   case MM_INTERNAL_DWORD_BIT_WIDTH:
     DataValue = CmdPtr->Payload.Data;
-    BytesProcessed = sizeof(uint32);
-    PSP_Status = CFE_PSP_EepromWrite32(DestAddress, CmdPtr->Payload.Data);
+    PSP_Status = MM_WriteEepromValue(DestAddress, MM_INTERNAL_DWORD_BIT_WIDTH,
+                                     DataValue);
     if (PSP_Status != CFE_PSP_SUCCESS) {
       CFE_EVS_SendEvent(
           MM_OS_EEPROMWRITE32_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -183,7 +272,7 @@ CFE_Status_t MM_PokeEeprom(const MM_PokeCmd_t *CmdPtr, cpuaddr DestAddress) {
       CFE_EVS_SendEvent(
           MM_POKE_DWORD_INF_EID, CFE_EVS_EventType_INFORMATION,
           "Poke Command: Addr = %p, Size = 32 bits, Data = 0x%08X",
-          (void *)DestAddress, (unsigned int)(CmdPtr->Payload.Data));
+          (void *)DestAddress, (unsigned int)DataValue);
     }
     break;
 
@@ -201,14 +290,60 @@ CFE_Status_t MM_PokeEeprom(const MM_PokeCmd_t *CmdPtr, cpuaddr DestAddress) {
     MM_AppData.HkTlm.Payload.MemType = CmdPtr->Payload.MemType;
     MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(DestAddress);
     MM_AppData.HkTlm.Payload.DataValue = DataValue;
-    MM_AppData.HkTlm.Payload.BytesProcessed = BytesProcessed;
+    MM_AppData.HkTlm.Payload.BytesProcessed = CmdPtr->Payload.DataSize / 8;
   }
 
-  CFE_ES_PerfLogExit(MM_EEPROM_POKE_PERF_ID);
-
   return PSP_Status;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get the number of bytes left to read in an open file            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 MM_RemainingFileSize(osal_id_t FileHandle) {
+  int32 Position;
+  int32 Remaining = -1;
+
+  /* Find the end of the file and return to the current position */
+  Position = OS_lseek(FileHandle, 0, OS_SEEK_CUR);
+  if (Position >= 0) {
+    Remaining = OS_lseek(FileHandle, 0, OS_SEEK_END);
+    if ((Remaining >= Position) &&
+        (OS_lseek(FileHandle, Position, OS_SEEK_SET) == Position)) {
+      Remaining -= Position;
+    } else {
+      Remaining = -1;
+    }
+  }
+
+  return Remaining;
+}
+
+#ifdef MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check that the rest of an open load file is the load data       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 MM_VerifyDirectLoadSize(osal_id_t FileHandle,
+                                     const char *FileName, uint32 NumBytes) {
+  int32 Remaining;
+  int32 Status = OS_SUCCESS;
+
+  Remaining = MM_RemainingFileSize(FileHandle);
+  if ((Remaining < 0) || ((uint32)Remaining != NumBytes)) {
+    Status = OS_ERR_INVALID_SIZE;
+    CFE_EVS_SendEvent(MM_LD_FILE_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Direct load file size error: Remaining = %d "
+                      "Expected = %u File = '%s'",
+                      (int)Remaining, (unsigned int)NumBytes, FileName);
+  }
+
+  return Status;
+}
+#endif /* MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Loads memory from a file                                        */
@@ -219,25 +354,61 @@ int32 MM_LoadMemFromFile(osal_id_t FileHandle, const char *FileName,
                          cpuaddr DestAddress) {
   int32 BytesRemaining = FileHeader->NumOfBytes;
   size_t BytesProcessed = 0;
-  size_t SegmentSize = MM_INTERNAL_MAX_LOAD_DATA_SEG;
+  size_t MaxSegmentSize = MM_INTERNAL_MAX_LOAD_DATA_SEG;
   uint8 *ioBuffer = (uint8 *)&MM_AppData.LoadBuffer[0];
+  bool DirectLoad = false;
+  size_t SegmentSize;
   uint8 *TargetPointer = (uint8 *)DestAddress;
   int32 Status = OS_SUCCESS;
   int32 ReadLength;
 
+#ifdef MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD
+#ifdef MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+  /* EEPROM segments are compared with the current contents before writing */
+  DirectLoad = (FileHeader->MemType != MM_MemType_EEPROM);
+#else
+  DirectLoad = true;
+#endif
+  if (DirectLoad) {
+    MaxSegmentSize = MM_INTERNAL_MAX_DIRECT_LOAD_DATA_SEG;
+
+    /*
+    ** A short file would leave the destination partly loaded, so check the
+    ** file still holds all of the load data before the first read
+    */
+    Status = MM_VerifyDirectLoadSize(FileHandle, FileName,
+                                     FileHeader->NumOfBytes);
+  }
+#endif /* MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD */
+  SegmentSize = MaxSegmentSize;
+
   if (FileHeader->MemType == MM_MemType_EEPROM) {
     CFE_ES_PerfLogEntry(MM_EEPROM_FILELOAD_PERF_ID);
   }
 
-  while (BytesRemaining != 0) {
-    if (BytesRemaining < MM_INTERNAL_MAX_LOAD_DATA_SEG) {
+  while ((Status == OS_SUCCESS) && (BytesRemaining != 0)) {
+    if (BytesRemaining < MaxSegmentSize) {
       SegmentSize = BytesRemaining;
     }
 
-    if ((ReadLength = OS_read(FileHandle, ioBuffer, SegmentSize)) ==
-        SegmentSize) {
-      memcpy(TargetPointer, ioBuffer, SegmentSize);
+    if (DirectLoad) {
+      /*
+      ** The load file CRC has already been verified, so read the data
+      ** straight into the destination
+      */
+      ReadLength = OS_read(FileHandle, TargetPointer, SegmentSize);
+    } else {
+      ReadLength = OS_read(FileHandle, ioBuffer, SegmentSize);
+      if (ReadLength == SegmentSize) {
+        if (FileHeader->MemType == MM_MemType_EEPROM) {
+          MM_WriteEeprom((cpuaddr)TargetPointer, ioBuffer, SegmentSize);
+        } else {
+          memcpy(TargetPointer, ioBuffer, SegmentSize);
+        }
+      }
+    }
 
+    if (ReadLength == SegmentSize) {
       BytesRemaining -= SegmentSize;
       BytesProcessed += SegmentSize;
       TargetPointer += SegmentSize;
@@ -253,6 +424,16 @@ int32 MM_LoadMemFromFile(osal_id_t FileHandle, const char *FileName,
           MM_OS_READ_ERR_EID, CFE_EVS_EventType_ERROR,
           "OS_read error received: RC = 0x%08X Expected = %u File = '%s'",
           (unsigned int)ReadLength, (unsigned int)SegmentSize, FileName);
+
+      /* The failed read may itself have written part of the segment */
+      if (DirectLoad) {
+        CFE_EVS_SendEvent(MM_DIRECT_LOAD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Direct load stopped, memory partly loaded: "
+                          "Loaded = %u of %u bytes Addr = %p File = '%s'",
+                          (unsigned int)BytesProcessed,
+                          (unsigned int)FileHeader->NumOfBytes,
+                          (void *)DestAddress, FileName);
+      }
     }
   }
 
@@ -275,6 +456,641 @@ int32 MM_LoadMemFromFile(osal_id_t FileHandle, const char *FileName,
   return Status;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read file data into a staging area, computing the CRC as each   */
+/* segment is read                                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 MM_StageFileData(osal_id_t FileHandle, const char *FileName,
+                              uint8 *StagePointer, uint32 NumBytes,
+                              MM_CrcType_Enum_t CrcType, uint32 *CrcPtr) {
+  uint32 BytesRemaining = NumBytes;
+  size_t SegmentSize = MM_INTERNAL_MAX_LOAD_DATA_SEG;
+  uint32 TempCrc = 0;
+  int32 Status = OS_SUCCESS;
+  int32 ReadLength;
+
+  while (BytesRemaining != 0) {
+    if (BytesRemaining < MM_INTERNAL_MAX_LOAD_DATA_SEG) {
+      SegmentSize = BytesRemaining;
+    }
+
+    if ((ReadLength = OS_read(FileHandle, StagePointer, SegmentSize)) ==
+        SegmentSize) {
+      /*
+      ** Calculate the CRC based upon the previous CRC calculation
+      */
+      TempCrc = MM_CalculateFileCRC(StagePointer, SegmentSize, TempCrc,
+                                    CrcType, MM_INTERNAL_LOAD_FILE_CRC_TYPE);
+
+      BytesRemaining -= SegmentSize;
+      StagePointer += SegmentSize;
+
+      /* Prevent CPU hogging between load segments */
+      if (BytesRemaining != 0) {
+        MM_SegmentBreak();
+      }
+    } else {
+      BytesRemaining = 0;
+      Status = OS_ERROR;
+      CFE_EVS_SendEvent(
+          MM_OS_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+          "OS_read error received: RC = 0x%08X Expected = %u File = '%s'",
+          (unsigned int)ReadLength, (unsigned int)SegmentSize, FileName);
+    }
+  }
+
+  if (Status == OS_SUCCESS) {
+    *CrcPtr = TempCrc;
+  }
+
+  return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read load file data into the staging buffer, computing the CRC  */
+/* as each segment is read                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_StageLoadFile(osal_id_t FileHandle, const char *FileName,
+                       const MM_LoadDumpFileHeader_t *FileHeader,
+                       uint32 *CrcPtr) {
+  int32 Status;
+
+  if (FileHeader->NumOfBytes > MM_INTERNAL_MAX_STAGED_LOAD_BYTES) {
+    Status = OS_ERROR;
+    CFE_EVS_SendEvent(
+        MM_STAGE_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+        "Load file too large to stage: Bytes = %u Max = %u File = '%s'",
+        (unsigned int)FileHeader->NumOfBytes,
+        (unsigned int)MM_INTERNAL_MAX_STAGED_LOAD_BYTES, FileName);
+  } else {
+    Status = MM_StageFileData(
+        FileHandle, FileName, (uint8 *)&MM_AppData.StageBuffer[0],
+        FileHeader->NumOfBytes, FileHeader->CrcType, CrcPtr);
+  }
+
+  return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Loads memory from the staging buffer                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_LoadMemFromStage(const char *FileName,
+                          const MM_LoadDumpFileHeader_t *FileHeader,
+                          cpuaddr DestAddress) {
+  CFE_Status_t PSP_Status;
+
+  if (FileHeader->MemType == MM_MemType_EEPROM) {
+    CFE_ES_PerfLogEntry(MM_EEPROM_FILELOAD_PERF_ID);
+  }
+
+  PSP_Status = MM_WriteMemFromBuffer(
+      DestAddress, FileHeader->MemType,
+      (const uint8 *)&MM_AppData.StageBuffer[0], FileHeader->NumOfBytes);
+
+  if (FileHeader->MemType == MM_MemType_EEPROM) {
+    CFE_ES_PerfLogExit(MM_EEPROM_FILELOAD_PERF_ID);
+  }
+
+  /* Update last action statistics */
+  if (PSP_Status == CFE_PSP_SUCCESS) {
+    MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_LOAD_FROM_FILE;
+    MM_AppData.HkTlm.Payload.MemType = FileHeader->MemType;
+    MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(DestAddress);
+    MM_AppData.HkTlm.Payload.BytesProcessed = FileHeader->NumOfBytes;
+    strncpy(MM_AppData.HkTlm.Payload.FileName, FileName,
+            CFE_MISSION_MAX_PATH_LEN);
+  }
+
+  return PSP_Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Checks, stages, and loads every region of a region file         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_LoadRegionsFromFile(osal_id_t FileHandle, const char *FileName,
+                             const MM_LoadDumpFileHeader_t *FileHeader) {
+  MM_LoadDumpFileHeader_t *Region = &MM_AppData.RegionDir[0];
+  MM_LoadDumpFileHeader_t SizeHeader;
+  cpuaddr DestAddress[MM_INTERNAL_MAX_FILE_REGIONS];
+  uint8 *StagePointer = (uint8 *)&MM_AppData.StageBuffer[0];
+  uint32 NumRegions = FileHeader->NumOfBytes / sizeof(MM_LoadDumpFileHeader_t);
+  uint32 TotalBytes = 0;
+  uint32 ComputedCRC = 0;
+  uint32 i;
+  int32 Status = OS_SUCCESS;
+  int32 ReadLength;
+
+  /* The directory must hold a whole number of entries */
+  if ((NumRegions == 0) || (NumRegions > MM_INTERNAL_MAX_FILE_REGIONS) ||
+      ((FileHeader->NumOfBytes % sizeof(MM_LoadDumpFileHeader_t)) != 0)) {
+    Status = OS_ERROR;
+    CFE_EVS_SendEvent(MM_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Region file directory invalid: Size = %u Max Regions = "
+                      "%u File = '%s'",
+                      (unsigned int)FileHeader->NumOfBytes,
+                      (unsigned int)MM_INTERNAL_MAX_FILE_REGIONS, FileName);
+  } else {
+    ReadLength = OS_read(FileHandle, Region, FileHeader->NumOfBytes);
+    if (ReadLength != FileHeader->NumOfBytes) {
+      Status = OS_ERROR;
+      CFE_EVS_SendEvent(
+          MM_OS_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+          "OS_read error received: RC = 0x%08X Expected = %u File = '%s'",
+          (unsigned int)ReadLength, (unsigned int)FileHeader->NumOfBytes,
+          FileName);
+    } else {
+      ComputedCRC = MM_CalculateFileCRC(Region, FileHeader->NumOfBytes, 0,
+                                        FileHeader->CrcType,
+                                        MM_INTERNAL_LOAD_FILE_CRC_TYPE);
+      if (ComputedCRC != FileHeader->Crc) {
+        Status = OS_ERROR;
+        CFE_EVS_SendEvent(MM_LOAD_FILE_CRC_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Load file CRC failure: Expected = 0x%X "
+                          "Calculated = 0x%X File = '%s'",
+                          (unsigned int)FileHeader->Crc,
+                          (unsigned int)ComputedCRC, FileName);
+      }
+    }
+  }
+
+  /*
+  ** Check every region before any region data is read, all of the region
+  ** data must fit in the staging buffer together
+  */
+  for (i = 0; (Status == OS_SUCCESS) && (i < NumRegions); i++) {
+    if (MM_ResolveSymAddr(&(Region[i].SymAddress), &DestAddress[i]) !=
+        OS_SUCCESS) {
+      Status = OS_ERROR;
+      CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Symbolic address can't be resolved: Name = '%s'",
+                        Region[i].SymAddress.SymName);
+    } else if (MM_VerifyLoadDumpParams(DestAddress[i], Region[i].MemType,
+                                       Region[i].NumOfBytes,
+                                       MM_VERIFY_LOAD) != CFE_PSP_SUCCESS) {
+      Status = OS_ERROR;
+      CFE_EVS_SendEvent(MM_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Region %u failed parameters check: File = '%s'",
+                        (unsigned int)i, FileName);
+    } else if (Region[i].NumOfBytes >
+               (MM_INTERNAL_MAX_STAGED_LOAD_BYTES - TotalBytes)) {
+      Status = OS_ERROR;
+      CFE_EVS_SendEvent(
+          MM_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+          "Region file too large to stage: Region = %u Max = %u File = '%s'",
+          (unsigned int)i, (unsigned int)MM_INTERNAL_MAX_STAGED_LOAD_BYTES,
+          FileName);
+    } else {
+      TotalBytes += Region[i].NumOfBytes;
+    }
+  }
+
+  /*
+  ** The file must hold exactly the directory and every region it lists,
+  ** a truncated file is rejected before any region data is read
+  */
+  if (Status == OS_SUCCESS) {
+    SizeHeader = *FileHeader;
+    SizeHeader.NumOfBytes = FileHeader->NumOfBytes + TotalBytes;
+    Status = MM_VerifyLoadFileSize(FileName, &SizeHeader);
+  }
+
+  /*
+  ** Stage the region data in one sequential read, checking the CRC of each
+  ** region as it is staged
+  */
+  for (i = 0; (Status == OS_SUCCESS) && (i < NumRegions); i++) {
+    Status = MM_StageFileData(FileHandle, FileName, StagePointer,
+                              Region[i].NumOfBytes, FileHeader->CrcType,
+                              &ComputedCRC);
+    if ((Status == OS_SUCCESS) && (ComputedCRC != Region[i].Crc)) {
+      Status = OS_ERROR;
+      CFE_EVS_SendEvent(MM_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Region %u CRC failure: Expected = 0x%X Calculated = "
+                        "0x%X File = '%s'",
+                        (unsigned int)i, (unsigned int)Region[i].Crc,
+                        (unsigned int)ComputedCRC, FileName);
+    }
+    StagePointer += Region[i].NumOfBytes;
+  }
+
+  /* Every region has been verified, commit the staged data to memory */
+  StagePointer = (uint8 *)&MM_AppData.StageBuffer[0];
+  for (i = 0; (Status == OS_SUCCESS) && (i < NumRegions); i++) {
+    if (Region[i].MemType == MM_MemType_EEPROM) {
+      CFE_ES_PerfLogEntry(MM_EEPROM_FILELOAD_PERF_ID);
+    }
+
+    Status = MM_WriteMemFromBuffer(DestAddress[i], Region[i].MemType,
+                                   StagePointer, Region[i].NumOfBytes);
+
+    if (Region[i].MemType == MM_MemType_EEPROM) {
+      CFE_ES_PerfLogExit(MM_EEPROM_FILELOAD_PERF_ID);
+    }
+
+    StagePointer += Region[i].NumOfBytes;
+  }
+
+  /* Update last action statistics, the address is that of the first region */
+  if (Status == OS_SUCCESS) {
+    MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_LOAD_FROM_FILE;
+    MM_AppData.HkTlm.Payload.MemType = Region[0].MemType;
+    MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(DestAddress[0]);
+    MM_AppData.HkTlm.Payload.BytesProcessed = TotalBytes;
+    strncpy(MM_AppData.HkTlm.Payload.FileName, FileName,
+            CFE_MISSION_MAX_PATH_LEN);
+  }
+
+  return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Applies the patch runs in the staging buffer                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_LoadPatchFromStage(const char *FileName,
+                            const MM_LoadDumpFileHeader_t *FileHeader,
+                            cpuaddr BaseAddress) {
+  const uint8 *StagePointer = (const uint8 *)&MM_AppData.StageBuffer[0];
+  MM_PatchRunHeader_t RunHeader;
+  uint32 RecordOffset = 0;
+  uint32 RunCount = 0;
+  size_t BytesProcessed = 0;
+  int32 Status = OS_SUCCESS;
+
+  /*
+  ** Check every run before any memory is written so a bad patch file
+  ** doesn't leave memory partially patched
+  */
+  while ((RecordOffset < FileHeader->NumOfBytes) && (Status == OS_SUCCESS)) {
+    if ((FileHeader->NumOfBytes - RecordOffset) < sizeof(RunHeader)) {
+      Status = OS_ERROR;
+    } else {
+      memcpy(&RunHeader, &StagePointer[RecordOffset], sizeof(RunHeader));
+
+      if ((RunHeader.Length == 0) ||
+          (RunHeader.Length >
+           (FileHeader->NumOfBytes - RecordOffset - sizeof(RunHeader))) ||
+          ((cpuaddr)(BaseAddress + RunHeader.Offset) < BaseAddress)) {
+        Status = OS_ERROR;
+      } else if (MM_VerifyLoadDumpParams(BaseAddress + RunHeader.Offset,
+                                         FileHeader->MemType, RunHeader.Length,
+                                         MM_VERIFY_LOAD) != CFE_PSP_SUCCESS) {
+        /* MM_VerifyLoadDumpParams has already reported the error */
+        Status = OS_ERROR;
+      } else {
+        RecordOffset += sizeof(RunHeader) + RunHeader.Length;
+        RunCount++;
+      }
+    }
+  }
+
+  if ((Status == OS_SUCCESS) && (RunCount == 0)) {
+    Status = OS_ERROR;
+  }
+
+  if (Status != OS_SUCCESS) {
+    CFE_EVS_SendEvent(MM_PATCH_RUN_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Patch file run %u invalid at byte %u: File = '%s'",
+                      (unsigned int)RunCount, (unsigned int)RecordOffset,
+                      FileName);
+  } else {
+    if (FileHeader->MemType == MM_MemType_EEPROM) {
+      CFE_ES_PerfLogEntry(MM_EEPROM_FILELOAD_PERF_ID);
+    }
+
+    RecordOffset = 0;
+    while ((RecordOffset < FileHeader->NumOfBytes) &&
+           (Status == CFE_PSP_SUCCESS)) {
+      memcpy(&RunHeader, &StagePointer[RecordOffset], sizeof(RunHeader));
+      RecordOffset += sizeof(RunHeader);
+
+      Status = MM_WriteMemFromBuffer(BaseAddress + RunHeader.Offset,
+                                     FileHeader->MemType,
+                                     &StagePointer[RecordOffset],
+                                     RunHeader.Length);
+
+      RecordOffset += RunHeader.Length;
+      BytesProcessed += RunHeader.Length;
+    }
+
+    if (FileHeader->MemType == MM_MemType_EEPROM) {
+      CFE_ES_PerfLogExit(MM_EEPROM_FILELOAD_PERF_ID);
+    }
+  }
+
+  /* Update last action statistics */
+  if (Status == CFE_PSP_SUCCESS) {
+    MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_LOAD_FROM_FILE;
+    MM_AppData.HkTlm.Payload.MemType = FileHeader->MemType;
+    MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(BaseAddress);
+    MM_AppData.HkTlm.Payload.BytesProcessed = BytesProcessed;
+    strncpy(MM_AppData.HkTlm.Payload.FileName, FileName,
+            CFE_MISSION_MAX_PATH_LEN);
+  }
+
+  return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Decompress a compressed load file one load segment at a time,   */
+/* computing the CRC and optionally writing each segment to memory */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_LoadMemFromCompressedFile(osal_id_t FileHandle, const char *FileName,
+                                   const MM_LoadDumpFileHeader_t *FileHeader,
+                                   cpuaddr DestAddress, bool WriteMem,
+                                   uint32 *CrcPtr) {
+  MM_RleDecoder_t Decoder;
+  uint8 *InBuffer = MM_AppData.CodecBuffer;
+  uint8 *OutBuffer = (uint8 *)&MM_AppData.LoadBuffer[0];
+  uint32 BytesRemaining = FileHeader->NumOfBytes;
+  size_t SegmentSize = MM_INTERNAL_MAX_LOAD_DATA_SEG;
+  size_t OutFill = 0;
+  size_t InSize = 0;
+  size_t InPos = 0;
+  size_t InUsed = 0;
+  uint32 CompressedUsed = 0;
+  int32 CompressedSize;
+  uint32 MinSize;
+  cpuaddr TargetAddress = DestAddress;
+  uint32 TempCrc = 0;
+  int32 Status = OS_SUCCESS;
+  int32 ReadLength;
+
+  MM_RleDecoderInit(&Decoder);
+
+  /*
+  ** Each record decodes to at most MM_RLE_MAX_RUN bytes from at least two
+  ** encoded bytes, and to at least one byte from at most two encoded
+  ** bytes, which bounds the compressed size before anything is decoded
+  */
+  MinSize =
+      2 * ((FileHeader->NumOfBytes + MM_RLE_MAX_RUN - 1) / MM_RLE_MAX_RUN);
+  CompressedSize = MM_RemainingFileSize(FileHandle);
+  if ((CompressedSize < 0) || ((uint32)CompressedSize < MinSize) ||
+      ((uint32)CompressedSize > (2 * FileHeader->NumOfBytes))) {
+    Status = OS_ERR_INVALID_SIZE;
+    CFE_EVS_SendEvent(MM_DECOMPRESS_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Compressed load file size error: Size = %d "
+                      "Min = %u Max = %u File = '%s'",
+                      (int)CompressedSize, (unsigned int)MinSize,
+                      (unsigned int)(2 * FileHeader->NumOfBytes), FileName);
+  }
+
+  if (WriteMem && (FileHeader->MemType == MM_MemType_EEPROM)) {
+    CFE_ES_PerfLogEntry(MM_EEPROM_FILELOAD_PERF_ID);
+  }
+
+  while ((BytesRemaining != 0) && (Status == OS_SUCCESS)) {
+    if (BytesRemaining < MM_INTERNAL_MAX_LOAD_DATA_SEG) {
+      SegmentSize = BytesRemaining;
+    }
+
+    /*
+    ** Read more compressed data once the last read has been decoded, the
+    ** rest of a repeat record needs no more input
+    */
+    if ((InPos == InSize) && (Decoder.State != MM_RLE_STATE_REPEAT)) {
+      ReadLength =
+          OS_read(FileHandle, InBuffer, sizeof(MM_AppData.CodecBuffer));
+      if (ReadLength > 0) {
+        InSize = ReadLength;
+        InPos = 0;
+      } else {
+        Status = OS_ERROR;
+        CFE_EVS_SendEvent(MM_DECOMPRESS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Compressed load file ended after %u of %u bytes: "
+                          "RC = 0x%08X File = '%s'",
+                          (unsigned int)(FileHeader->NumOfBytes -
+                                         BytesRemaining + OutFill),
+                          (unsigned int)FileHeader->NumOfBytes,
+                          (unsigned int)ReadLength, FileName);
+      }
+    }
+
+    if (Status == OS_SUCCESS) {
+      OutFill += MM_RleDecode(&Decoder, &InBuffer[InPos], InSize - InPos,
+                              &InUsed, &OutBuffer[OutFill],
+                              SegmentSize - OutFill);
+      InPos += InUsed;
+      CompressedUsed += InUsed;
+
+      if (OutFill == SegmentSize) {
+        /*
+        ** Calculate the CRC based upon the previous CRC calculation
+        */
+        TempCrc = MM_CalculateFileCRC(OutBuffer, SegmentSize, TempCrc,
+                                      FileHeader->CrcType,
+                                      MM_INTERNAL_LOAD_FILE_CRC_TYPE);
+
+        if (WriteMem) {
+          Status = MM_WriteMemFromBuffer(TargetAddress, FileHeader->MemType,
+                                         OutBuffer, SegmentSize);
+        }
+
+        BytesRemaining -= SegmentSize;
+        TargetAddress += SegmentSize;
+        OutFill = 0;
+
+        /* Prevent CPU hogging between load segments */
+        if ((BytesRemaining != 0) && (Status == OS_SUCCESS)) {
+          MM_SegmentBreak();
+        }
+      }
+    }
+  }
+
+  if (WriteMem && (FileHeader->MemType == MM_MemType_EEPROM)) {
+    CFE_ES_PerfLogExit(MM_EEPROM_FILELOAD_PERF_ID);
+  }
+
+  /*
+  ** The load data must end with the last record of the file, a record
+  ** that decodes past the load data or bytes after it are rejected
+  */
+  if ((Status == OS_SUCCESS) &&
+      ((Decoder.State != MM_RLE_STATE_HEADER) ||
+       (CompressedUsed != (uint32)CompressedSize))) {
+    Status = OS_ERROR;
+    CFE_EVS_SendEvent(MM_DECOMPRESS_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Compressed load file doesn't end with the load data: "
+                      "Used %u of %u bytes File = '%s'",
+                      (unsigned int)CompressedUsed,
+                      (unsigned int)CompressedSize, FileName);
+  }
+
+  if (Status == OS_SUCCESS) {
+    *CrcPtr = TempCrc;
+
+    /* Update last action statistics */
+    if (WriteMem) {
+      MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_LOAD_FROM_FILE;
+      MM_AppData.HkTlm.Payload.MemType = FileHeader->MemType;
+      MM_AppData.HkTlm.Payload.Address = CFE_ES_MEMADDRESS_C(DestAddress);
+      MM_AppData.HkTlm.Payload.BytesProcessed = FileHeader->NumOfBytes;
+      strncpy(MM_AppData.HkTlm.Payload.FileName, FileName,
+              CFE_MISSION_MAX_PATH_LEN);
+    }
+  }
+
+  return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write a buffer to memory using the access width required by the */
+/* memory type                                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_WriteMemFromBuffer(cpuaddr DestAddress,
+                                   MM_MemType_Enum_t MemType,
+                                   const uint8 *Buffer, size_t NumBytes) {
+  CFE_Status_t PSP_Status = CFE_PSP_SUCCESS;
+  size_t BytesRemaining = NumBytes;
+  size_t SegmentSize = MM_INTERNAL_MAX_LOAD_DATA_SEG;
+  size_t i = 0;
+  cpuaddr TargetAddress = DestAddress;
+#ifdef MM_INTERNAL_OPT_CODE_MEM32_MEMTYPE
+  uint32 Data32;
+#endif
+#ifdef MM_INTERNAL_OPT_CODE_MEM16_MEMTYPE
+  uint16 Data16;
+#endif
+
+  while ((BytesRemaining != 0) && (PSP_Status == CFE_PSP_SUCCESS)) {
+    if (BytesRemaining < MM_INTERNAL_MAX_LOAD_DATA_SEG) {
+      SegmentSize = BytesRemaining;
+    }
+
+    switch (MemType) {
+    case MM_MemType_RAM:
+      memcpy((void *)TargetAddress, Buffer, SegmentSize);
+      i = SegmentSize;
+      break;
+
+    case MM_MemType_EEPROM:
+      MM_WriteEeprom(TargetAddress, Buffer, SegmentSize);
+      i = SegmentSize;
+      break;
+
+#ifdef MM_INTERNAL_OPT_CODE_MEM32_MEMTYPE
+    case MM_MemType_MEM32:
+      for (i = 0; i < SegmentSize; i += sizeof(uint32)) {
+        memcpy(&Data32, &Buffer[i], sizeof(Data32));
+        PSP_Status = CFE_PSP_MemWrite32(TargetAddress + i, Data32);
+        if (PSP_Status != CFE_PSP_SUCCESS) {
+          break;
+        }
+      }
+      break;
+#endif /* MM_INTERNAL_OPT_CODE_MEM32_MEMTYPE */
+
+#ifdef MM_INTERNAL_OPT_CODE_MEM16_MEMTYPE
+    case MM_MemType_MEM16:
+      for (i = 0; i < SegmentSize; i += sizeof(uint16)) {
+        memcpy(&Data16, &Buffer[i], sizeof(Data16));
+        PSP_Status = CFE_PSP_MemWrite16(TargetAddress + i, Data16);
+        if (PSP_Status != CFE_PSP_SUCCESS) {
+          break;
+        }
+      }
+      break;
+#endif /* MM_INTERNAL_OPT_CODE_MEM16_MEMTYPE */
+
+#ifdef MM_INTERNAL_OPT_CODE_MEM8_MEMTYPE
+    case MM_MemType_MEM8:
+      for (i = 0; i < SegmentSize; i++) {
+        PSP_Status = CFE_PSP_MemWrite8(TargetAddress + i, Buffer[i]);
+        if (PSP_Status != CFE_PSP_SUCCESS) {
+          break;
+        }
+      }
+      break;
+#endif /* MM_INTERNAL_OPT_CODE_MEM8_MEMTYPE */
+
+    /*
+    ** The memory type has already been verified, this is not expected
+    */
+    default:
+      PSP_Status = CFE_PSP_ERROR;
+      break;
+    }
+
+    if (PSP_Status == CFE_PSP_SUCCESS) {
+      BytesRemaining -= SegmentSize;
+      Buffer += SegmentSize;
+      TargetAddress += SegmentSize;
+
+      /* Prevent CPU hogging between load segments */
+      if (BytesRemaining != 0) {
+        MM_SegmentBreak();
+      }
+    } else {
+      CFE_EVS_SendEvent(
+          MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+          "PSP write memory error: RC=0x%08X, Address=%p, MemType=%d",
+          (unsigned int)PSP_Status, (void *)(TargetAddress + i), (int)MemType);
+    }
+  }
+
+  return PSP_Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write a buffer to EEPROM, skipping the words that already hold  */
+/* the new data                                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_WriteEeprom(cpuaddr DestAddress, const uint8 *Buffer,
+                    size_t NumBytes) {
+#ifdef MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+  uint8 *TargetPointer = (uint8 *)DestAddress;
+  size_t WordSize = sizeof(uint32);
+  size_t RunStart = 0;
+  size_t Offset = 0;
+
+  while (RunStart < NumBytes) {
+    /* Extend the run while the words differ, the last word may be partial */
+    while (Offset < NumBytes) {
+      if ((NumBytes - Offset) < WordSize) {
+        WordSize = NumBytes - Offset;
+      }
+      if (memcmp(&TargetPointer[Offset], &Buffer[Offset], WordSize) == 0) {
+        break;
+      }
+      Offset += WordSize;
+    }
+
+    /* Write the run of changed words with a single copy */
+    if (Offset != RunStart) {
+      memcpy(&TargetPointer[RunStart], &Buffer[RunStart], Offset - RunStart);
+      MM_AppData.HkTlm.Payload.EepromBytesWritten += Offset - RunStart;
+    }
+
+    /* Skip the unchanged word that ended the run */
+    if (Offset < NumBytes) {
+      MM_AppData.HkTlm.Payload.EepromBytesSkipped += WordSize;
+      Offset += WordSize;
+    }
+
+    RunStart = Offset;
+  }
+#else
+  memcpy((void *)DestAddress, Buffer, NumBytes);
+#endif /* MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE */
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Verify load file size                                           */
@@ -361,6 +1177,12 @@ int32 MM_ReadFileHeaders(const char *FileName, osal_id_t FileHandle,
           (unsigned int)sizeof(MM_LoadDumpFileHeader_t), FileName);
 
       OS_Status = OS_ERR_INVALID_SIZE;
+    } else if (MMHeader->CrcType > MM_CRC_MAX_FILE_TYPE) {
+      CFE_EVS_SendEvent(MM_FILE_CRC_TYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Load file CRC type error: Type = %u File = '%s'",
+                        (unsigned int)MMHeader->CrcType, FileName);
+
+      OS_Status = OS_ERROR;
     } else {
       OS_Status = OS_SUCCESS;
     } /* end OS_read if */
@@ -375,7 +1197,6 @@ int32 MM_ReadFileHeaders(const char *FileName, osal_id_t FileHandle,
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void MM_FillMem(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr) {
-  uint16 i;
   size_t BytesProcessed = 0;
   uint32 BytesRemaining = CmdPtr->Payload.NumOfBytes;
   uint32 SegmentSize = MM_INTERNAL_MAX_FILL_DATA_SEG;
@@ -383,9 +1204,7 @@ void MM_FillMem(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr) {
   uint8 *FillBuffer = (uint8 *)&MM_AppData.FillBuffer[0];
 
   /* Create a scratch buffer with one fill segment */
-  for (i = 0; i < (MM_INTERNAL_MAX_FILL_DATA_SEG / sizeof(uint32)); i++) {
-    FillBuffer[i] = CmdPtr->Payload.FillPattern;
-  }
+  MM_BuildFillBuffer(&CmdPtr->Payload, sizeof(uint8));
 
   /* Start EEPROM performance monitor */
   if (CmdPtr->Payload.MemType == MM_MemType_EEPROM) {
@@ -399,7 +1218,11 @@ void MM_FillMem(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr) {
       SegmentSize = BytesRemaining;
     }
 
-    memcpy(TargetPointer, FillBuffer, SegmentSize);
+    if (CmdPtr->Payload.MemType == MM_MemType_EEPROM) {
+      MM_WriteEeprom((cpuaddr)TargetPointer, FillBuffer, SegmentSize);
+    } else {
+      memcpy(TargetPointer, FillBuffer, SegmentSize);
+    }
 
     TargetPointer += SegmentSize;
     BytesProcessed += SegmentSize;
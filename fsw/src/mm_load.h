@@ -35,6 +35,56 @@
  * Exported Functions
  *************************************************************************/
 
+/**
+ * \brief Write a poke value
+ *
+ *  \par Description
+ *       Support function for #MM_PokeMem and #MM_BatchPokeCmd. This
+ *       routine will write 8, 16, or 32 bits of data with the PSP
+ *       memory or EEPROM accessor of the matching width.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Sends no events, the caller reports write errors
+ *
+ *  \param [in]   DestAddress   The destination address for the poke
+ *                              operation
+ *  \param [in]   MemType       The memory type, which selects the EEPROM
+ *                              accessors for #MM_MemType_EEPROM
+ *  \param [in]   DataSize      Number of bits to write (8, 16, or 32)
+ *  \param [in]   DataValue     The value to write, truncated to DataSize
+ *
+ * \return Execution status
+ * \retval #CFE_PSP_ERROR_NOT_IMPLEMENTED DataSize is not a known width
+ */
+int32 MM_PokeValue(cpuaddr DestAddress, MM_MemType_Enum_t MemType,
+                   uint32 DataSize, uint32 DataValue);
+
+/**
+ * \brief Write a value to EEPROM without reporting it
+ *
+ *  \par Description
+ *       Support function for #MM_PokeEeprom and the batch, masked, and
+ *       conditional poke commands. This routine will write 8, 16, or 32
+ *       bits of data to a single EEPROM address. When
+ *       #MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE is defined the write
+ *       is skipped if the address already holds the data, and the bytes
+ *       written or skipped are added to the housekeeping telemetry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Sends no events and doesn't update the last action data, the
+ *       caller reports the write
+ *
+ *  \param [in]   DestAddress   The destination address for the poke
+ *                              operation
+ *  \param [in]   DataSize      Number of bits to write (8, 16, or 32)
+ *  \param [in]   DataValue     The value to write, truncated to DataSize
+ *
+ * \return Execution status
+ * \retval #CFE_PSP_ERROR_NOT_IMPLEMENTED DataSize is not a known width
+ */
+int32 MM_WriteEepromValue(cpuaddr DestAddress, uint32 DataSize,
+                          uint32 DataValue);
+
 /**
  * \brief Memory poke
  *
@@ -109,6 +159,198 @@ int32 MM_LoadMemFromFile(osal_id_t FileHandle, const char *FileName,
                          const MM_LoadDumpFileHeader_t *FileHeader,
                          cpuaddr DestAddress);
 
+/**
+ * \brief Stage load file data
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromFileCmd. This routine will
+ *       read the data section of a load file into the staging buffer
+ *       and compute the data integrity check value as each segment is
+ *       read, so the file only needs to be read once.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file pointer must be positioned at the start of the load
+ *       data. Files with more than #MM_INTERNAL_MAX_STAGED_LOAD_BYTES
+ *       load bytes are rejected.
+ *
+ *  \param [in]   FileHandle   The open file handle of the load file
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the load file name
+ *  \param [in]   FileHeader   Pointer to file header
+ *  \param [out]  CrcPtr       Computed CRC of the staged data, only
+ *                             valid on success
+ *
+ *  \return Execution status
+ *
+ *  \sa #MM_STAGE_SIZE_ERR_EID
+ */
+int32 MM_StageLoadFile(osal_id_t FileHandle, const char *FileName,
+                       const MM_LoadDumpFileHeader_t *FileHeader,
+                       uint32 *CrcPtr);
+
+/**
+ * \brief Memory load from staged data
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromFileCmd. This routine will
+ *       write the load data previously read by #MM_StageLoadFile to
+ *       memory and update the "last action" housekeeping data.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The staged data must already have passed the CRC check
+ *
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the load file name
+ *  \param [in]   FileHeader   Pointer to file header
+ *  \param [in]   DestAddress  The destination address for the requested
+ *                             load operation
+ *
+ *  \return Execution status
+ */
+int32 MM_LoadMemFromStage(const char *FileName,
+                          const MM_LoadDumpFileHeader_t *FileHeader,
+                          cpuaddr DestAddress);
+
+/**
+ * \brief Memory load from a staged patch file
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromFileCmd. This routine will
+ *       apply the runs of a patch load file previously read by
+ *       #MM_StageLoadFile. Every run is checked before any memory is
+ *       written, then each run is written at its offset from the base
+ *       address and the "last action" housekeeping data is updated.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The staged data must already have passed the CRC check
+ *
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the load file name
+ *  \param [in]   FileHeader   Pointer to file header
+ *  \param [in]   BaseAddress  The resolved address the run offsets are
+ *                             relative to
+ *
+ *  \return Execution status
+ *
+ *  \sa #MM_PatchRunHeader_t, #MM_PATCH_RUN_ERR_EID
+ */
+int32 MM_LoadPatchFromStage(const char *FileName,
+                            const MM_LoadDumpFileHeader_t *FileHeader,
+                            cpuaddr BaseAddress);
+
+/**
+ * \brief Memory load from a region file
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromFileCmd. This routine will
+ *       read the region directory of a region load file, check the
+ *       directory CRC and the address, memory type, and size of every
+ *       region, then read all of the region data into the staging buffer
+ *       in one sequential pass, checking the CRC of each region as it is
+ *       read. Memory is only written once every region has been verified,
+ *       then the "last action" housekeeping data is updated.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file pointer must be positioned at the start of the region
+ *       directory. The data of all regions together can't exceed
+ *       #MM_INTERNAL_MAX_STAGED_LOAD_BYTES. The file size must match the
+ *       headers, the directory, and the sum of the region sizes.
+ *
+ *  \param [in]   FileHandle   The open file handle of the load file
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the load file name
+ *  \param [in]   FileHeader   Pointer to file header
+ *
+ *  \return Execution status
+ *
+ *  \sa #MM_REGION_ERR_EID, #MM_LD_FILE_SIZE_ERR_EID
+ */
+int32 MM_LoadRegionsFromFile(osal_id_t FileHandle, const char *FileName,
+                             const MM_LoadDumpFileHeader_t *FileHeader);
+
+/**
+ * \brief Memory load from a compressed file
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromFileCmd. This routine will
+ *       decompress the data section of a compressed load file one load
+ *       segment at a time through the load buffer and compute the data
+ *       integrity check value of the decompressed data. When WriteMem is
+ *       true each segment is also written to memory and the "last action"
+ *       housekeeping data is updated.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file pointer must be positioned at the start of the load
+ *       data. The file header byte count and CRC describe the
+ *       decompressed data.
+ *
+ *  \param [in]   FileHandle   The open file handle of the load file
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the load file name
+ *  \param [in]   FileHeader   Pointer to file header
+ *  \param [in]   DestAddress  The destination address for the requested
+ *                             load operation
+ *  \param [in]   WriteMem     Write the decompressed data to memory
+ *  \param [out]  CrcPtr       Computed CRC of the decompressed data, only
+ *                             valid on success
+ *
+ *  \return Execution status
+ *
+ *  \sa #MM_DECOMPRESS_ERR_EID
+ */
+int32 MM_LoadMemFromCompressedFile(osal_id_t FileHandle, const char *FileName,
+                                   const MM_LoadDumpFileHeader_t *FileHeader,
+                                   cpuaddr DestAddress, bool WriteMem,
+                                   uint32 *CrcPtr);
+
+/**
+ * \brief Write a buffer to memory
+ *
+ *  \par Description
+ *       Writes a buffer to memory of any supported memory type, using
+ *       the access width the memory type requires. The write is
+ *       segmented by #MM_INTERNAL_MAX_LOAD_DATA_SEG to prevent CPU
+ *       hogging.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The destination address, memory type, and size must already
+ *       have been verified for a load operation
+ *
+ *  \param [in]   DestAddress  The destination address
+ *  \param [in]   MemType      The memory type of the destination
+ *  \param [in]   Buffer       Pointer to the data to write
+ *  \param [in]   NumBytes     The number of bytes to write
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_PSP_SUCCESS \copybrief CFE_PSP_SUCCESS
+ *
+ *  \sa #MM_PSP_WRITE_ERR_EID
+ */
+CFE_Status_t MM_WriteMemFromBuffer(cpuaddr DestAddress,
+                                   MM_MemType_Enum_t MemType,
+                                   const uint8 *Buffer, size_t NumBytes);
+
+/**
+ * \brief Write a buffer to EEPROM
+ *
+ *  \par Description
+ *       Copies a buffer to memory mapped EEPROM. When
+ *       #MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE is defined the current
+ *       contents are compared one 32 bit word at a time, each run of
+ *       changed words is written with a single copy, and the unchanged
+ *       words are skipped. The bytes written and skipped are added to the
+ *       housekeeping telemetry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The destination address and size must already have been verified
+ *       and the EEPROM bank must be write-enabled
+ *
+ *  \param [in]   DestAddress  The destination address
+ *  \param [in]   Buffer       Pointer to the data to write
+ *  \param [in]   NumBytes     The number of bytes to write
+ */
+void MM_WriteEeprom(cpuaddr DestAddress, const uint8 *Buffer, size_t NumBytes);
+
 /**
  * \brief Verify load file size
  *
@@ -139,7 +381,7 @@ int32 MM_VerifyLoadFileSize(const char *FileName,
  *       file specified by the FileHandle.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       A secondary header with an unknown CRC type is rejected
  *
  *  \param [in]   FileName     A pointer to a character string holding
  *                             the file name (used only for error event
@@ -27,6 +27,7 @@
 *************************************************************************/
 #include "mm_mem16.h"
 #include "mm_app.h"
+#include "mm_crc.h"
 #include "mm_eventids.h"
 #include "mm_interface_cfg.h"
 #include "mm_utils.h"
@@ -127,7 +128,8 @@ int32 MM_LoadMem16FromFile(osal_id_t FileHandle, const char *FileName,
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 int32 MM_DumpMem16ToFile(osal_id_t FileHandle, const char *FileName,
-                         const MM_LoadDumpFileHeader_t *FileHeader) {
+                         const MM_LoadDumpFileHeader_t *FileHeader,
+                         uint32 *CrcPtr) {
   int32 OS_Status;
   CFE_Status_t PSP_Status = CFE_PSP_SUCCESS;
   uint32 i;
@@ -137,6 +139,7 @@ int32 MM_DumpMem16ToFile(osal_id_t FileHandle, const char *FileName,
       CFE_ES_MEMADDRESS_TO_PTR(FileHeader->SymAddress.Offset);
   uint16 *ioBuffer16 = (uint16 *)&MM_AppData.DumpBuffer[0];
   size_t SegmentSize = MM_INTERNAL_MAX_DUMP_DATA_SEG;
+  uint32 TempCrc = 0;
 
   while (BytesRemaining != 0) {
     if (BytesRemaining < MM_INTERNAL_MAX_DUMP_DATA_SEG) {
@@ -166,6 +169,11 @@ int32 MM_DumpMem16ToFile(osal_id_t FileHandle, const char *FileName,
       /* Write i/o buffer contents to file */
       if ((OS_Status = OS_write(FileHandle, ioBuffer16, SegmentSize)) ==
           SegmentSize) {
+        /* Fold the segment into the running CRC */
+        TempCrc = MM_CalculateFileCRC(ioBuffer16, SegmentSize, TempCrc,
+                                      FileHeader->CrcType,
+                                      MM_INTERNAL_DUMP_FILE_CRC_TYPE);
+
         /* Update process counters */
         BytesRemaining -= SegmentSize;
         BytesProcessed += SegmentSize;
@@ -187,6 +195,8 @@ int32 MM_DumpMem16ToFile(osal_id_t FileHandle, const char *FileName,
   }
 
   if (PSP_Status == CFE_PSP_SUCCESS) {
+    *CrcPtr = TempCrc;
+
     /* Update last action statistics */
     MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_DUMP_TO_FILE;
     MM_AppData.HkTlm.Payload.MemType = MM_MemType_MEM16;
@@ -213,6 +223,7 @@ int32 MM_FillMem16(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr) {
   uint32 NewBytesRemaining;
   uint16 FillPattern16 = (uint16)CmdPtr->Payload.FillPattern;
   uint16 *DataPointer16 = (uint16 *)DestAddress;
+  const uint16 *FillBuffer16 = (const uint16 *)&MM_AppData.FillBuffer[0];
   size_t SegmentSize = MM_INTERNAL_MAX_FILL_DATA_SEG;
 
   /* Check fill size and warn if not a multiple of 2 */
@@ -225,6 +236,9 @@ int32 MM_FillMem16(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr) {
     BytesRemaining = NewBytesRemaining;
   }
 
+  /* Repeat the fill pattern across one fill segment */
+  MM_BuildFillBuffer(&CmdPtr->Payload, sizeof(uint16));
+
   while (BytesRemaining != 0) {
     /* Set size of next segment */
     if (BytesRemaining < MM_INTERNAL_MAX_FILL_DATA_SEG) {
@@ -233,7 +247,7 @@ int32 MM_FillMem16(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr) {
 
     /* Fill next segment */
     for (i = 0; i < (SegmentSize / sizeof(uint16)); i++) {
-      PSP_Status = CFE_PSP_MemWrite16((cpuaddr)DataPointer16, FillPattern16);
+      PSP_Status = CFE_PSP_MemWrite16((cpuaddr)DataPointer16, FillBuffer16[i]);
       if (PSP_Status == CFE_PSP_SUCCESS) {
         DataPointer16++;
       } else {
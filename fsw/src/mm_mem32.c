@@ -27,6 +27,7 @@
 *************************************************************************/
 #include "mm_mem32.h"
 #include "mm_app.h"
+#include "mm_crc.h"
 #include "mm_eventids.h"
 #include "mm_interface_cfg.h"
 #include "mm_utils.h"
@@ -126,7 +127,8 @@ int32 MM_LoadMem32FromFile(osal_id_t FileHandle, const char *FileName,
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 int32 MM_DumpMem32ToFile(osal_id_t FileHandle, const char *FileName,
-                         const MM_LoadDumpFileHeader_t *FileHeader) {
+                         const MM_LoadDumpFileHeader_t *FileHeader,
+                         uint32 *CrcPtr) {
   int32 OS_Status;
   CFE_Status_t PSP_Status = CFE_PSP_SUCCESS;
   uint32 i;
@@ -136,6 +138,7 @@ int32 MM_DumpMem32ToFile(osal_id_t FileHandle, const char *FileName,
       CFE_ES_MEMADDRESS_TO_PTR(FileHeader->SymAddress.Offset);
   uint32 *ioBuffer32 = (uint32 *)&MM_AppData.DumpBuffer[0];
   size_t SegmentSize = MM_INTERNAL_MAX_DUMP_DATA_SEG;
+  uint32 TempCrc = 0;
 
   while (BytesRemaining != 0) {
     if (BytesRemaining < MM_INTERNAL_MAX_DUMP_DATA_SEG) {
@@ -165,6 +168,11 @@ int32 MM_DumpMem32ToFile(osal_id_t FileHandle, const char *FileName,
       /* Write i/o buffer contents to file */
       if ((OS_Status = OS_write(FileHandle, ioBuffer32, SegmentSize)) ==
           SegmentSize) {
+        /* Fold the segment into the running CRC */
+        TempCrc = MM_CalculateFileCRC(ioBuffer32, SegmentSize, TempCrc,
+                                      FileHeader->CrcType,
+                                      MM_INTERNAL_DUMP_FILE_CRC_TYPE);
+
         /* Update process counters */
         BytesRemaining -= SegmentSize;
         BytesProcessed += SegmentSize;
@@ -186,6 +194,8 @@ int32 MM_DumpMem32ToFile(osal_id_t FileHandle, const char *FileName,
   }
 
   if (PSP_Status == CFE_PSP_SUCCESS) {
+    *CrcPtr = TempCrc;
+
     /* Update last action statistics */
     MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_DUMP_TO_FILE;
     MM_AppData.HkTlm.Payload.MemType = MM_MemType_MEM32;
@@ -212,6 +222,7 @@ int32 MM_FillMem32(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr) {
   uint32 NewBytesRemaining;
   uint32 FillPattern32 = CmdPtr->Payload.FillPattern;
   uint32 *DataPointer32 = (uint32 *)(DestAddress);
+  const uint32 *FillBuffer32 = (const uint32 *)&MM_AppData.FillBuffer[0];
   size_t SegmentSize = MM_INTERNAL_MAX_FILL_DATA_SEG;
 
   /* Check fill size and warn if not a multiple of 4 */
@@ -224,6 +235,9 @@ int32 MM_FillMem32(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr) {
     BytesRemaining = NewBytesRemaining;
   }
 
+  /* Repeat the fill pattern across one fill segment */
+  MM_BuildFillBuffer(&CmdPtr->Payload, sizeof(uint32));
+
   while (BytesRemaining != 0) {
     /* Set size of next segment */
     if (BytesRemaining < MM_INTERNAL_MAX_FILL_DATA_SEG) {
@@ -232,7 +246,7 @@ int32 MM_FillMem32(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr) {
 
     /* Fill next segment */
     for (i = 0; i < (SegmentSize / sizeof(uint32)); i++) {
-      PSP_Status = CFE_PSP_MemWrite32((cpuaddr)DataPointer32, FillPattern32);
+      PSP_Status = CFE_PSP_MemWrite32((cpuaddr)DataPointer32, FillBuffer32[i]);
       if (PSP_Status == CFE_PSP_SUCCESS) {
         DataPointer32++;
       } else {
@@ -27,6 +27,7 @@
 *************************************************************************/
 #include "mm_mem8.h"
 #include "mm_app.h"
+#include "mm_crc.h"
 #include "mm_eventids.h"
 #include "mm_interface_cfg.h"
 #include "mm_utils.h"
@@ -126,7 +127,8 @@ int32 MM_LoadMem8FromFile(osal_id_t FileHandle, const char *FileName,
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 int32 MM_DumpMem8ToFile(osal_id_t FileHandle, const char *FileName,
-                        const MM_LoadDumpFileHeader_t *FileHeader) {
+                        const MM_LoadDumpFileHeader_t *FileHeader,
+                        uint32 *CrcPtr) {
   int32 OS_Status;
   CFE_Status_t PSP_Status = CFE_PSP_SUCCESS;
   uint32 i;
@@ -135,6 +137,7 @@ int32 MM_DumpMem8ToFile(osal_id_t FileHandle, const char *FileName,
   uint8 *DataPointer8 = CFE_ES_MEMADDRESS_TO_PTR(FileHeader->SymAddress.Offset);
   uint8 *ioBuffer8 = (uint8 *)&MM_AppData.DumpBuffer[0];
   size_t SegmentSize = MM_INTERNAL_MAX_DUMP_DATA_SEG;
+  uint32 TempCrc = 0;
 
   while (BytesRemaining != 0) {
     if (BytesRemaining < MM_INTERNAL_MAX_DUMP_DATA_SEG) {
@@ -164,6 +167,11 @@ int32 MM_DumpMem8ToFile(osal_id_t FileHandle, const char *FileName,
       /* Write i/o buffer contents to file */
       if ((OS_Status = OS_write(FileHandle, ioBuffer8, SegmentSize)) ==
           SegmentSize) {
+        /* Fold the segment into the running CRC */
+        TempCrc = MM_CalculateFileCRC(ioBuffer8, SegmentSize, TempCrc,
+                                      FileHeader->CrcType,
+                                      MM_INTERNAL_DUMP_FILE_CRC_TYPE);
+
         /* Update process counters */
         BytesRemaining -= SegmentSize;
         BytesProcessed += SegmentSize;
@@ -185,6 +193,8 @@ int32 MM_DumpMem8ToFile(osal_id_t FileHandle, const char *FileName,
   }
 
   if (PSP_Status == CFE_PSP_SUCCESS) {
+    *CrcPtr = TempCrc;
+
     /* Update last action statistics */
     MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_DUMP_TO_FILE;
     MM_AppData.HkTlm.Payload.MemType = MM_MemType_MEM8;
@@ -210,8 +220,12 @@ int32 MM_FillMem8(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr) {
   uint32 BytesRemaining = CmdPtr->Payload.NumOfBytes;
   uint8 FillPattern8 = (uint8)CmdPtr->Payload.FillPattern;
   uint8 *DataPointer8 = (uint8 *)DestAddress;
+  const uint8 *FillBuffer8 = (const uint8 *)&MM_AppData.FillBuffer[0];
   size_t SegmentSize = MM_INTERNAL_MAX_FILL_DATA_SEG;
 
+  /* Repeat the fill pattern across one fill segment */
+  MM_BuildFillBuffer(&CmdPtr->Payload, sizeof(uint8));
+
   while (BytesRemaining != 0) {
     /* Set size of next segment */
     if (BytesRemaining < MM_INTERNAL_MAX_FILL_DATA_SEG) {
@@ -220,7 +234,7 @@ int32 MM_FillMem8(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr) {
 
     /* Fill next segment */
     for (i = 0; i < SegmentSize; i++) {
-      PSP_Status = CFE_PSP_MemWrite8((cpuaddr)DataPointer8, FillPattern8);
+      PSP_Status = CFE_PSP_MemWrite8((cpuaddr)DataPointer8, FillBuffer8[i]);
       if (PSP_Status == CFE_PSP_SUCCESS) {
         DataPointer8++;
       } else {
@@ -76,11 +76,14 @@ int32 MM_LoadMem8FromFile(osal_id_t FileHandle, const char *FileName,
  *  \param [in]   FileName     A pointer to a character string holding
  *                             the dump file name
  *  \param [in]   FileHeader   Pointer to file header
+ *  \param [out]  CrcPtr       Computed CRC of the dumped data, only
+ *                             valid on success
  *
  *  \return Execution status
  */
 int32 MM_DumpMem8ToFile(osal_id_t FileHandle, const char *FileName,
-                        const MM_LoadDumpFileHeader_t *FileHeader);
+                        const MM_LoadDumpFileHeader_t *FileHeader,
+                        uint32 *CrcPtr);
 
 /**
  * \brief Fill memory8
@@ -0,0 +1,343 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Memory test for the CFS Memory Manager. Test patterns are written to
+ *   and read back from a region of memory one word at a time, and the
+ *   failing reads are recorded in the memory test packet.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_memtest.h"
+#include "mm_app.h"
+#include "mm_eventids.h"
+#include "mm_internal_cfg.h"
+#include "mm_perfids.h"
+#include "mm_utils.h"
+#include <string.h>
+
+/*************************************************************************
+** Macro Definitions
+*************************************************************************/
+
+/**
+ * \name March element operations
+ * \{
+ */
+#define MM_MEM_TEST_READ 0x01  /**< \brief Read and check each word */
+#define MM_MEM_TEST_WRITE 0x02 /**< \brief Write each word */
+/**\}*/
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Count an access and give up the CPU after each segment          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void MM_MemTestStep(MM_MemTest_t *Test) {
+  Test->SegmentBytes += Test->WordSize;
+
+  if (Test->SegmentBytes >= MM_INTERNAL_MAX_FILL_DATA_SEG) {
+    Test->SegmentBytes = 0;
+    MM_SegmentBreak();
+  }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write one word of the region under test                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 MM_MemTestWrite(MM_MemTest_t *Test, uint32 Word, uint32 Value) {
+  cpuaddr Address = Test->Address + (Word * Test->WordSize);
+  int32 PSP_Status;
+
+  switch (Test->WordSize) {
+  case sizeof(uint32):
+    PSP_Status = CFE_PSP_MemWrite32(Address, Value);
+    break;
+
+  case sizeof(uint16):
+    PSP_Status = CFE_PSP_MemWrite16(Address, (uint16)Value);
+    break;
+
+  default:
+    PSP_Status = CFE_PSP_MemWrite8(Address, (uint8)Value);
+    break;
+  }
+
+  if (PSP_Status != CFE_PSP_SUCCESS) {
+    CFE_EVS_SendEvent(
+        MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+        "PSP write memory error: RC=%d, Address=%p, MemType=MEM%u",
+        (int)PSP_Status, (void *)Address, (unsigned int)(Test->WordSize * 8));
+  }
+
+  MM_MemTestStep(Test);
+
+  return PSP_Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read one word of the region under test and check its value      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 MM_MemTestRead(MM_MemTest_t *Test, uint32 Word, uint32 Expected) {
+  MM_MemTestTlm_Payload_t *Payload = Test->Payload;
+  cpuaddr Address = Test->Address + (Word * Test->WordSize);
+  uint32 Value32 = 0;
+  uint16 Value16 = 0;
+  uint8 Value8 = 0;
+  int32 PSP_Status;
+
+  switch (Test->WordSize) {
+  case sizeof(uint32):
+    PSP_Status = CFE_PSP_MemRead32(Address, &Value32);
+    break;
+
+  case sizeof(uint16):
+    PSP_Status = CFE_PSP_MemRead16(Address, &Value16);
+    Value32 = Value16;
+    break;
+
+  default:
+    PSP_Status = CFE_PSP_MemRead8(Address, &Value8);
+    Value32 = Value8;
+    break;
+  }
+
+  if (PSP_Status != CFE_PSP_SUCCESS) {
+    CFE_EVS_SendEvent(MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "PSP read memory error: RC=%d, Address=%p, MemType=MEM%u",
+                      (int)PSP_Status, (void *)Address,
+                      (unsigned int)(Test->WordSize * 8));
+  } else if (Value32 != Expected) {
+    if (Payload->NumReported < MM_INTERFACE_MAX_MEM_TEST_FAILURES) {
+      Payload->Failures[Payload->NumReported].Address =
+          CFE_ES_MEMADDRESS_C(Address);
+      Payload->Failures[Payload->NumReported].Expected = Expected;
+      Payload->Failures[Payload->NumReported].Actual = Value32;
+      Payload->NumReported++;
+    }
+    Payload->NumFailures++;
+    Payload->FailedPatterns |= Test->Pattern;
+  }
+
+  MM_MemTestStep(Test);
+
+  return PSP_Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Run one march element over every word of the region            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 MM_MemTestMarchElement(MM_MemTest_t *Test, bool Up, uint8 Ops,
+                                    uint32 ReadValue, uint32 WriteValue) {
+  uint32 i;
+  uint32 Word;
+  int32 PSP_Status = CFE_PSP_SUCCESS;
+
+  for (i = 0; (i < Test->NumWords) && (PSP_Status == CFE_PSP_SUCCESS); i++) {
+    if (Up) {
+      Word = i;
+    } else {
+      Word = Test->NumWords - 1 - i;
+    }
+
+    if ((Ops & MM_MEM_TEST_READ) != 0) {
+      PSP_Status = MM_MemTestRead(Test, Word, ReadValue);
+    }
+
+    if ((PSP_Status == CFE_PSP_SUCCESS) && ((Ops & MM_MEM_TEST_WRITE) != 0)) {
+      PSP_Status = MM_MemTestWrite(Test, Word, WriteValue);
+    }
+  }
+
+  return PSP_Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* March C-: {w0} up(r0,w1) up(r1,w0) down(r0,w1) down(r1,w0) {r0} */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 MM_MemTestMarchC(MM_MemTest_t *Test) {
+  uint32 Ones = Test->Ones;
+  int32 PSP_Status;
+
+  PSP_Status = MM_MemTestMarchElement(Test, true, MM_MEM_TEST_WRITE, 0, 0);
+
+  if (PSP_Status == CFE_PSP_SUCCESS) {
+    PSP_Status = MM_MemTestMarchElement(
+        Test, true, MM_MEM_TEST_READ | MM_MEM_TEST_WRITE, 0, Ones);
+  }
+
+  if (PSP_Status == CFE_PSP_SUCCESS) {
+    PSP_Status = MM_MemTestMarchElement(
+        Test, true, MM_MEM_TEST_READ | MM_MEM_TEST_WRITE, Ones, 0);
+  }
+
+  if (PSP_Status == CFE_PSP_SUCCESS) {
+    PSP_Status = MM_MemTestMarchElement(
+        Test, false, MM_MEM_TEST_READ | MM_MEM_TEST_WRITE, 0, Ones);
+  }
+
+  if (PSP_Status == CFE_PSP_SUCCESS) {
+    PSP_Status = MM_MemTestMarchElement(
+        Test, false, MM_MEM_TEST_READ | MM_MEM_TEST_WRITE, Ones, 0);
+  }
+
+  if (PSP_Status == CFE_PSP_SUCCESS) {
+    PSP_Status = MM_MemTestMarchElement(Test, true, MM_MEM_TEST_READ, 0, 0);
+  }
+
+  return PSP_Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Walk a single one bit through each word of the region           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 MM_MemTestWalkingOnes(MM_MemTest_t *Test) {
+  uint32 Word;
+  uint32 Bit;
+  int32 PSP_Status = CFE_PSP_SUCCESS;
+
+  for (Word = 0;
+       (Word < Test->NumWords) && (PSP_Status == CFE_PSP_SUCCESS); Word++) {
+    for (Bit = 0;
+         (Bit < (Test->WordSize * 8)) && (PSP_Status == CFE_PSP_SUCCESS);
+         Bit++) {
+      PSP_Status = MM_MemTestWrite(Test, Word, (uint32)1 << Bit);
+
+      if (PSP_Status == CFE_PSP_SUCCESS) {
+        PSP_Status = MM_MemTestRead(Test, Word, (uint32)1 << Bit);
+      }
+    }
+  }
+
+  return PSP_Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write the address of each word, or its complement, to the whole */
+/* region before checking it, so a word aliased by an address      */
+/* fault is overwritten before it is read                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 MM_MemTestAddressPass(MM_MemTest_t *Test, uint32 Invert) {
+  uint32 Word;
+  uint32 Value;
+  int32 PSP_Status = CFE_PSP_SUCCESS;
+
+  for (Word = 0;
+       (Word < Test->NumWords) && (PSP_Status == CFE_PSP_SUCCESS); Word++) {
+    Value = (uint32)(Test->Address + (Word * Test->WordSize));
+    PSP_Status = MM_MemTestWrite(Test, Word, (Value ^ Invert) & Test->Ones);
+  }
+
+  for (Word = 0;
+       (Word < Test->NumWords) && (PSP_Status == CFE_PSP_SUCCESS); Word++) {
+    Value = (uint32)(Test->Address + (Word * Test->WordSize));
+    PSP_Status = MM_MemTestRead(Test, Word, (Value ^ Invert) & Test->Ones);
+  }
+
+  return PSP_Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Test a region of memory                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_MemTest(cpuaddr Address, MM_MemType_Enum_t MemType,
+                 uint32 NumOfBytes, uint8 Patterns,
+                 MM_MemTestTlm_Payload_t *Payload) {
+  MM_MemTest_t Test;
+  int32 PSP_Status = CFE_PSP_SUCCESS;
+
+  memset(Payload, 0, sizeof(*Payload));
+  memset(&Test, 0, sizeof(Test));
+
+  switch (MemType) {
+  case MM_MemType_MEM32:
+    Test.WordSize = sizeof(uint32);
+    break;
+
+  case MM_MemType_MEM16:
+    Test.WordSize = sizeof(uint16);
+    break;
+
+  case MM_MemType_MEM8:
+    Test.WordSize = sizeof(uint8);
+    break;
+
+  default:
+    /* Use the widest access the RAM region allows */
+    if (MM_Verify32Aligned(Address, NumOfBytes)) {
+      Test.WordSize = sizeof(uint32);
+    } else {
+      Test.WordSize = sizeof(uint8);
+    }
+    break;
+  }
+
+  Test.Address = Address;
+  Test.NumWords = NumOfBytes / Test.WordSize;
+  Test.Ones = (uint32)(0xFFFFFFFFu >> (32 - (Test.WordSize * 8)));
+  Test.Payload = Payload;
+
+  CFE_ES_PerfLogEntry(MM_MEM_TEST_PERF_ID);
+
+  if ((Patterns & MM_MemTestPattern_MARCH_C) != 0) {
+    Test.Pattern = MM_MemTestPattern_MARCH_C;
+    PSP_Status = MM_MemTestMarchC(&Test);
+  }
+
+  if ((PSP_Status == CFE_PSP_SUCCESS) &&
+      ((Patterns & MM_MemTestPattern_WALKING_ONES) != 0)) {
+    Test.Pattern = MM_MemTestPattern_WALKING_ONES;
+    PSP_Status = MM_MemTestWalkingOnes(&Test);
+  }
+
+  if ((PSP_Status == CFE_PSP_SUCCESS) &&
+      ((Patterns & MM_MemTestPattern_ADDRESS) != 0)) {
+    Test.Pattern = MM_MemTestPattern_ADDRESS;
+    PSP_Status = MM_MemTestAddressPass(&Test, 0);
+
+    if (PSP_Status == CFE_PSP_SUCCESS) {
+      PSP_Status = MM_MemTestAddressPass(&Test, 0xFFFFFFFFu);
+    }
+  }
+
+  CFE_ES_PerfLogExit(MM_MEM_TEST_PERF_ID);
+
+  Payload->Address = CFE_ES_MEMADDRESS_C(Address);
+  Payload->MemType = MemType;
+  Payload->NumOfBytes = Test.NumWords * Test.WordSize;
+  Payload->Patterns = Patterns;
+
+  return PSP_Status;
+}
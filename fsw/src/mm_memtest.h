@@ -0,0 +1,98 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Manager memory test. The memory test
+ *   runs March C-, walking ones, and address as data patterns over a
+ *   region of memory, giving up the CPU between segments.
+ */
+#ifndef MM_MEMTEST_H
+#define MM_MEMTEST_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+#include "mm_msg.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/**
+ * \brief All the memory test patterns
+ */
+#define MM_MEM_TEST_ALL_PATTERNS                                               \
+  (MM_MemTestPattern_MARCH_C | MM_MemTestPattern_WALKING_ONES |                \
+   MM_MemTestPattern_ADDRESS)
+
+/*************************************************************************
+ * Type Definitions
+ *************************************************************************/
+
+/**
+ *  \brief Memory test progress
+ */
+typedef struct {
+  cpuaddr Address;       /**< \brief Address of the first word tested */
+  uint32 WordSize;       /**< \brief Bytes read or written by each access */
+  uint32 NumWords;       /**< \brief Number of words tested */
+  uint32 Ones;           /**< \brief Word with every bit set */
+  uint32 SegmentBytes;   /**< \brief Bytes accessed since the last segment
+                              break */
+  uint8 Pattern;         /**< \brief Pattern being run */
+  MM_MemTestTlm_Payload_t *Payload; /**< \brief Test results */
+} MM_MemTest_t;
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Test a region of memory
+ *
+ *  \par Description
+ *       Runs each pattern selected in Patterns over the region and records
+ *       the failing reads in the memory test packet payload. MEM8, MEM16,
+ *       and MEM32 memory is accessed with the matching PSP accessors. RAM
+ *       is accessed 32 bits at a time when the address and size are 32-bit
+ *       aligned, and a byte at a time otherwise. Gives up the CPU after
+ *       each #MM_INTERNAL_MAX_FILL_DATA_SEG bytes of accesses.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The region must already have passed the fill parameter checks,
+ *       and the memory type must not be EEPROM. The contents of the region
+ *       are destroyed. Stops at the first PSP read or write error.
+ *
+ *  \param [in]  Address     Fully resolved address of the region
+ *  \param [in]  MemType     Memory type of the region
+ *  \param [in]  NumOfBytes  Size of the region in bytes
+ *  \param [in]  Patterns    Mask of #MM_MemTestPattern_Enum_t values
+ *  \param [out] Payload     Memory test packet payload to fill in
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_PSP_SUCCESS \copybrief CFE_PSP_SUCCESS
+ *
+ *  \sa #MM_PSP_READ_ERR_EID, #MM_PSP_WRITE_ERR_EID
+ */
+int32 MM_MemTest(cpuaddr Address, MM_MemType_Enum_t MemType,
+                 uint32 NumOfBytes, uint8 Patterns,
+                 MM_MemTestTlm_Payload_t *Payload);
+
+#endif
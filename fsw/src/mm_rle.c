@@ -0,0 +1,158 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Run-length codec for CFS Memory Manager compressed load and dump
+ *   files
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_rle.h"
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Run-length encode a buffer                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t MM_RleEncode(const uint8 *InBuffer, size_t InSize, uint8 *OutBuffer) {
+  size_t InPos = 0;
+  size_t OutPos = 0;
+  size_t RunLength;
+
+  while (InPos < InSize) {
+    /* Measure the repeat run starting here */
+    RunLength = 1;
+    while ((InPos + RunLength < InSize) && (RunLength < MM_RLE_MAX_RUN) &&
+           (InBuffer[InPos + RunLength] == InBuffer[InPos])) {
+      RunLength++;
+    }
+
+    if (RunLength > 1) {
+      OutBuffer[OutPos++] = (uint8)(1 - (int32)RunLength);
+      OutBuffer[OutPos++] = InBuffer[InPos];
+      InPos += RunLength;
+    } else {
+      /*
+      ** Gather literal bytes until a run of three or more starts, a run
+      ** of two costs as much as two literal bytes
+      */
+      RunLength = 1;
+      while ((InPos + RunLength < InSize) && (RunLength < MM_RLE_MAX_RUN) &&
+             !((InPos + RunLength + 2 < InSize) &&
+               (InBuffer[InPos + RunLength] ==
+                InBuffer[InPos + RunLength + 1]) &&
+               (InBuffer[InPos + RunLength] ==
+                InBuffer[InPos + RunLength + 2]))) {
+        RunLength++;
+      }
+
+      OutBuffer[OutPos++] = (uint8)(RunLength - 1);
+      memcpy(&OutBuffer[OutPos], &InBuffer[InPos], RunLength);
+      OutPos += RunLength;
+      InPos += RunLength;
+    }
+  }
+
+  return OutPos;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Initialize a run-length decoder                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_RleDecoderInit(MM_RleDecoder_t *Decoder) {
+  Decoder->State = MM_RLE_STATE_HEADER;
+  Decoder->Value = 0;
+  Decoder->Count = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Run-length decode a piece of encoded data                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t MM_RleDecode(MM_RleDecoder_t *Decoder, const uint8 *InBuffer,
+                    size_t InSize, size_t *InUsed, uint8 *OutBuffer,
+                    size_t OutSize) {
+  size_t InPos = 0;
+  size_t OutPos = 0;
+  size_t Length;
+  int8 Header;
+
+  while ((OutPos < OutSize) &&
+         ((InPos < InSize) || (Decoder->State == MM_RLE_STATE_REPEAT))) {
+    switch (Decoder->State) {
+    case MM_RLE_STATE_HEADER:
+      Header = (int8)InBuffer[InPos++];
+      if (Header >= 0) {
+        Decoder->Count = (uint8)(Header + 1);
+        Decoder->State = MM_RLE_STATE_LITERAL;
+      } else if (Header != -128) {
+        Decoder->Count = (uint8)(1 - Header);
+        Decoder->State = MM_RLE_STATE_REPEAT_VALUE;
+      }
+      break;
+
+    case MM_RLE_STATE_LITERAL:
+      Length = Decoder->Count;
+      if (Length > (OutSize - OutPos)) {
+        Length = OutSize - OutPos;
+      }
+      if (Length > (InSize - InPos)) {
+        Length = InSize - InPos;
+      }
+
+      memcpy(&OutBuffer[OutPos], &InBuffer[InPos], Length);
+      InPos += Length;
+      OutPos += Length;
+      Decoder->Count -= Length;
+      if (Decoder->Count == 0) {
+        Decoder->State = MM_RLE_STATE_HEADER;
+      }
+      break;
+
+    case MM_RLE_STATE_REPEAT_VALUE:
+      Decoder->Value = InBuffer[InPos++];
+      Decoder->State = MM_RLE_STATE_REPEAT;
+      break;
+
+    default: /* MM_RLE_STATE_REPEAT */
+      Length = Decoder->Count;
+      if (Length > (OutSize - OutPos)) {
+        Length = OutSize - OutPos;
+      }
+
+      memset(&OutBuffer[OutPos], Decoder->Value, Length);
+      OutPos += Length;
+      Decoder->Count -= Length;
+      if (Decoder->Count == 0) {
+        Decoder->State = MM_RLE_STATE_HEADER;
+      }
+      break;
+    }
+  }
+
+  *InUsed = InPos;
+
+  return OutPos;
+}
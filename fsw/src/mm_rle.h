@@ -0,0 +1,140 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Manager run-length codec used by
+ *   compressed load and dump files. The codec is PackBits: each record
+ *   starts with a signed header byte N. For N from 0 to 127 the next N + 1
+ *   bytes are copied as is. For N from -1 to -127 the next byte is
+ *   repeated 1 - N times. N = -128 is skipped.
+ */
+#ifndef MM_RLE_H
+#define MM_RLE_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "common_types.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/**
+ * \brief Maximum number of bytes in one run-length record
+ */
+#define MM_RLE_MAX_RUN 128
+
+/**
+ * \brief Worst case encoded size of NumBytes of data
+ *
+ * Data with no repeats costs one header byte per #MM_RLE_MAX_RUN bytes
+ */
+#define MM_RLE_MAX_ENCODED_SIZE(NumBytes)                                      \
+  ((NumBytes) + (((NumBytes) + MM_RLE_MAX_RUN - 1) / MM_RLE_MAX_RUN))
+
+/**
+ * \name Run-length decoder states
+ * \{
+ */
+#define MM_RLE_STATE_HEADER 0       /**< \brief Expecting a header byte */
+#define MM_RLE_STATE_LITERAL 1      /**< \brief Copying literal bytes */
+#define MM_RLE_STATE_REPEAT_VALUE 2 /**< \brief Expecting the repeat value */
+#define MM_RLE_STATE_REPEAT 3       /**< \brief Writing repeated bytes */
+/**\}*/
+
+/*************************************************************************
+ * Type Definitions
+ *************************************************************************/
+
+/**
+ *  \brief Run-length decoder state
+ *
+ *  Holds the record being decoded so encoded data can be decoded in
+ *  pieces of any size
+ */
+typedef struct {
+  uint8 State; /**< \brief Decoder state, see #MM_RLE_STATE_HEADER */
+  uint8 Value; /**< \brief Value of the current repeat record */
+  uint8 Count; /**< \brief Bytes left in the current record */
+} MM_RleDecoder_t;
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Run-length encode a buffer
+ *
+ *  \par Description
+ *       Encodes a complete buffer. Records never span calls, so a large
+ *       data set can be encoded one segment at a time and the encoded
+ *       segments concatenated.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The output buffer must hold at least
+ *       #MM_RLE_MAX_ENCODED_SIZE(InSize) bytes
+ *
+ *  \param [in]   InBuffer   Pointer to the data to encode
+ *  \param [in]   InSize     Number of bytes to encode
+ *  \param [out]  OutBuffer  Pointer to the encoded data
+ *
+ *  \return Number of encoded bytes written to OutBuffer
+ */
+size_t MM_RleEncode(const uint8 *InBuffer, size_t InSize, uint8 *OutBuffer);
+
+/**
+ * \brief Initialize a run-length decoder
+ *
+ *  \par Description
+ *       Prepares a decoder to decode a new encoded data set
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [out]  Decoder   Pointer to the decoder state
+ */
+void MM_RleDecoderInit(MM_RleDecoder_t *Decoder);
+
+/**
+ * \brief Run-length decode a piece of encoded data
+ *
+ *  \par Description
+ *       Decodes until either the encoded input is used up or the output
+ *       buffer is full. A record may be split across calls, the decoder
+ *       state carries the rest of it to the next call.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       At least one input byte is used or one output byte produced when
+ *       both InSize and OutSize are non-zero
+ *
+ *  \param [in,out] Decoder    Pointer to the decoder state
+ *  \param [in]     InBuffer   Pointer to the encoded data
+ *  \param [in]     InSize     Number of encoded bytes available
+ *  \param [out]    InUsed     Number of encoded bytes used
+ *  \param [out]    OutBuffer  Pointer to the decoded data
+ *  \param [in]     OutSize    Room in the output buffer in bytes
+ *
+ *  \return Number of decoded bytes written to OutBuffer
+ */
+size_t MM_RleDecode(MM_RleDecoder_t *Decoder, const uint8 *InBuffer,
+                    size_t InSize, size_t *InUsed, uint8 *OutBuffer,
+                    size_t OutSize);
+
+#endif
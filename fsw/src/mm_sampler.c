@@ -0,0 +1,79 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Peek sampler for the CFS Memory Manager. The watch list is read every
+ *   few housekeeping requests and streamed to the ground in a watch
+ *   packet.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_sampler.h"
+#include "mm_app.h"
+#include "mm_dump.h"
+#include "mm_perfids.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Sample the watch list when it is due                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SamplerStep(void) {
+  MM_SamplerState_t *State = &MM_AppData.Sampler;
+  MM_WatchTlm_Payload_t *Payload = &MM_AppData.WatchTlm.Payload;
+  const MM_WatchEntry_t *Entry;
+  uint32 i;
+
+  if (State->Period != 0) {
+    State->Count++;
+  }
+
+  if ((State->Period != 0) && (State->Count >= State->Period)) {
+    State->Count = 0;
+
+    OS_MutSemTake(MM_AppData.CmdMutex);
+    CFE_ES_PerfLogEntry(MM_SAMPLER_PERF_ID);
+
+    Payload->ValidMask = 0;
+    for (i = 0; i < MM_INTERFACE_MAX_WATCH_ENTRIES; i++) {
+      Entry = &State->Entries[i];
+
+      /* Undefined entries and failed reads are sent as zero */
+      if ((Entry->DataSize != 0) &&
+          (MM_PeekValue(Entry->Address, Entry->DataSize,
+                        &Payload->Values[i]) == CFE_PSP_SUCCESS)) {
+        Payload->ValidMask |= (uint32)1 << i;
+      } else {
+        Payload->Values[i] = 0;
+      }
+    }
+
+    CFE_ES_PerfLogExit(MM_SAMPLER_PERF_ID);
+    OS_MutSemGive(MM_AppData.CmdMutex);
+
+    Payload->Sequence = State->Sequence;
+    State->Sequence++;
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(MM_AppData.WatchTlm.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(MM_AppData.WatchTlm.TelemetryHeader),
+                       true);
+  }
+}
@@ -0,0 +1,56 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Manager peek sampler. The sampler
+ *   reads the watch list every few housekeeping requests and sends the
+ *   values in a watch telemetry packet.
+ */
+#ifndef MM_SAMPLER_H
+#define MM_SAMPLER_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Sample the watch list when it is due
+ *
+ *  \par Description
+ *       Counts housekeeping requests and, once every sample period,
+ *       reads each defined watch entry with the PSP accessor of its data
+ *       size and sends the values in a watch packet (#MM_WatchTlm_t).
+ *       Nothing is sent while the sample period is zero.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the MM main task for each housekeeping request. The
+ *       watch entries were resolved and checked when they were set, so
+ *       no events are sent for a sample. An entry that can't be read
+ *       has its bit cleared in the valid mask of the packet. Takes the
+ *       command mutex, so it never samples while a command is modifying
+ *       memory.
+ */
+void MM_SamplerStep(void);
+
+#endif
@@ -0,0 +1,170 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Background scrubber for the CFS Memory Manager. Scrub regions are
+ *   checked against their golden CRCs a few segments each time the MM main
+ *   task wakes up.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_scrub.h"
+#include "mm_app.h"
+#include "mm_dump.h"
+#include "mm_eventids.h"
+#include "mm_internal_cfg.h"
+#include "mm_perfids.h"
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Restart a scrub region after it has been set or cleared         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_ScrubRestartRegion(uint32 RegionNum) {
+  MM_ScrubState_t *State = &MM_AppData.Scrub;
+
+  if (State->Regions[RegionNum].NumOfBytes != 0) {
+    MM_AppData.HkTlm.Payload.ScrubStatus[RegionNum] = MM_ScrubStatus_PENDING;
+  } else {
+    MM_AppData.HkTlm.Payload.ScrubStatus[RegionNum] = MM_ScrubStatus_UNUSED;
+  }
+
+  /* The block index describes the old region */
+  memset(&State->Index[RegionNum], 0, sizeof(State->Index[RegionNum]));
+
+  /* Lets index commands paused at a segment break see the restart */
+  State->Generation[RegionNum]++;
+
+  /* A partial pass over the old region contents is meaningless */
+  if (State->Region == RegionNum) {
+    State->Offset = 0;
+    State->Crc = 0;
+  }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Move on to the next scrub region                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool MM_ScrubNextRegion(void) {
+  MM_ScrubState_t *State = &MM_AppData.Scrub;
+
+  State->Region = (State->Region + 1) % MM_INTERFACE_MAX_SCRUB_REGIONS;
+  State->Offset = 0;
+  State->Crc = 0;
+
+  /* Tell the caller when a pass over the region table has completed */
+  return (State->Region == 0);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record the result of a completed pass over a scrub region       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void MM_ScrubFinishRegion(MM_ScrubStatus_Enum_t NewStatus) {
+  const MM_ScrubState_t *State = &MM_AppData.Scrub;
+  const MM_ScrubRegion_t *Region = &State->Regions[State->Region];
+  MM_ScrubStatus_Enum_t *Status =
+      &MM_AppData.HkTlm.Payload.ScrubStatus[State->Region];
+
+  if (NewStatus == MM_ScrubStatus_BAD) {
+    MM_AppData.HkTlm.Payload.ScrubMismatches++;
+
+    /* Only report the change, not every pass over a corrupted region */
+    if (*Status != MM_ScrubStatus_BAD) {
+      CFE_EVS_SendEvent(MM_SCRUB_MISMATCH_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Scrub region %u CRC mismatch: Expected = 0x%08X "
+                        "Calculated = 0x%08X Addr = %p Bytes = %u",
+                        (unsigned int)State->Region,
+                        (unsigned int)Region->GoldenCrc,
+                        (unsigned int)State->Crc, (void *)Region->Address,
+                        (unsigned int)Region->NumOfBytes);
+    }
+  } else if ((NewStatus == MM_ScrubStatus_GOOD) &&
+             ((*Status == MM_ScrubStatus_BAD) ||
+              (*Status == MM_ScrubStatus_READ_ERROR))) {
+    CFE_EVS_SendEvent(MM_SCRUB_MATCH_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Scrub region %u CRC matches again",
+                      (unsigned int)State->Region);
+  }
+
+  *Status = NewStatus;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Scrub the next part of the scrub regions                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_ScrubStep(void) {
+  MM_ScrubState_t *State = &MM_AppData.Scrub;
+  const MM_ScrubRegion_t *Region;
+  uint32 BytesScrubbed = 0;
+  bool TableDone = false;
+  size_t SegmentSize;
+  int32 PSP_Status;
+
+  OS_MutSemTake(MM_AppData.CmdMutex);
+  CFE_ES_PerfLogEntry(MM_SCRUB_PERF_ID);
+
+  /* Small regions are not scrubbed more than once per call */
+  while (!TableDone && (BytesScrubbed < MM_INTERNAL_SCRUB_BYTES_PER_CYCLE)) {
+    Region = &State->Regions[State->Region];
+
+    if (Region->NumOfBytes == 0) {
+      /* Skip undefined regions */
+      TableDone = MM_ScrubNextRegion();
+    } else {
+      SegmentSize = Region->NumOfBytes - State->Offset;
+      if (SegmentSize > MM_INTERNAL_MAX_DUMP_DATA_SEG) {
+        SegmentSize = MM_INTERNAL_MAX_DUMP_DATA_SEG;
+      }
+
+      PSP_Status = MM_CalculateMemCRC(Region->Address + State->Offset,
+                                      Region->MemType, SegmentSize,
+                                      MM_AppData.ScrubBuffer, &State->Crc);
+      BytesScrubbed += SegmentSize;
+
+      if (PSP_Status != CFE_PSP_SUCCESS) {
+        /* The read error has been reported, try again on the next pass */
+        MM_ScrubFinishRegion(MM_ScrubStatus_READ_ERROR);
+        TableDone = MM_ScrubNextRegion();
+      } else {
+        State->Offset += SegmentSize;
+
+        if (State->Offset == Region->NumOfBytes) {
+          if (State->Crc == Region->GoldenCrc) {
+            MM_ScrubFinishRegion(MM_ScrubStatus_GOOD);
+          } else {
+            MM_ScrubFinishRegion(MM_ScrubStatus_BAD);
+          }
+          TableDone = MM_ScrubNextRegion();
+        }
+      }
+    }
+  }
+
+  CFE_ES_PerfLogExit(MM_SCRUB_PERF_ID);
+  OS_MutSemGive(MM_AppData.CmdMutex);
+}
@@ -0,0 +1,77 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Manager background scrubber. Each
+ *   time the MM main task wakes up the scrubber folds a few more
+ *   segments of the scrub regions into their CRCs, and compares the CRC
+ *   of each region to its golden CRC when a pass over it completes.
+ */
+#ifndef MM_SCRUB_H
+#define MM_SCRUB_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Restart a scrub region
+ *
+ *  \par Description
+ *       Sets the status of the region to #MM_ScrubStatus_PENDING, or to
+ *       #MM_ScrubStatus_UNUSED when the region is not defined, and drops
+ *       the block index of the region and any partial pass over it.
+ *       Bumps the generation of the region so an index build or compare
+ *       paused at a segment break can tell that its work is stale.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called after a scrub region has been set or cleared. The caller
+ *       must hold the command mutex.
+ *
+ *  \param [in]  RegionNum   Number of the region that changed
+ */
+void MM_ScrubRestartRegion(uint32 RegionNum);
+
+/**
+ * \brief Scrub the next part of the scrub regions
+ *
+ *  \par Description
+ *       Folds up to #MM_INTERNAL_SCRUB_BYTES_PER_CYCLE bytes of the scrub
+ *       regions into their running CRCs, one segment at a time. When a
+ *       pass over a region completes its CRC is compared to the golden
+ *       CRC, the region status is updated, and the scrubber moves on to
+ *       the next defined region. Stops early at the end of the region
+ *       table, so no region is checked more than once per call.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the MM main task when the pipe read times out and
+ *       after each housekeeping request, but not after ground commands.
+ *       Takes the command mutex, so it never runs while a command is
+ *       modifying memory.
+ *
+ *  \sa #MM_SCRUB_MISMATCH_ERR_EID, #MM_SCRUB_MATCH_INF_EID
+ */
+void MM_ScrubStep(void);
+
+#endif
@@ -26,6 +26,7 @@
 *************************************************************************/
 #include "mm_utils.h"
 #include "mm_app.h"
+#include "mm_crc.h"
 #include "mm_dump.h"
 #include "mm_eventids.h"
 #include "mm_interface_cfg.h"
@@ -33,13 +34,6 @@
 #include "mm_perfids.h"
 #include <string.h>
 
-/*************************************************************************
-** Macro Definitions
-*************************************************************************/
-
-#define FILE_CRC_BUFFER_SIZE                                                   \
-  200 /**< \brief Number of bytes per read when computing file CRC */
-
 /*************************************************************************
 ** External Data
 *************************************************************************/
@@ -65,20 +59,41 @@ void MM_ResetHk(void) {
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void MM_SegmentBreak(void) {
-  /*
-  ** Performance Log entry stamp
-  */
-  CFE_ES_PerfLogEntry(MM_SEGBREAK_PERF_ID);
+  OS_time_t CurrentTime;
+  int64 ElapsedTime;
 
   /*
-  ** Give something else the chance to run
+  ** Keep processing segments until the CPU time budget is spent
   */
-  OS_TaskDelay(MM_INTERNAL_PROCESSOR_CYCLE);
+  OS_GetLocalTime(&CurrentTime);
+  ElapsedTime = OS_TimeGetTotalMicroseconds(
+      OS_TimeSubtract(CurrentTime, MM_AppData.SegmentStartTime));
 
-  /*
-  ** Performance Log exit stamp
-  */
-  CFE_ES_PerfLogExit(MM_SEGBREAK_PERF_ID);
+  if ((ElapsedTime < 0) ||
+      (ElapsedTime >= MM_AppData.HkTlm.Payload.CpuBudget)) {
+    /*
+    ** Performance Log entry stamp
+    */
+    CFE_ES_PerfLogEntry(MM_SEGBREAK_PERF_ID);
+
+    /*
+    ** Give something else the chance to run, including the MM main
+    ** task if it is waiting to process a command
+    */
+    OS_MutSemGive(MM_AppData.CmdMutex);
+    OS_TaskDelay(MM_INTERNAL_PROCESSOR_CYCLE);
+    OS_MutSemTake(MM_AppData.CmdMutex);
+
+    /*
+    ** Start a new budget
+    */
+    OS_GetLocalTime(&MM_AppData.SegmentStartTime);
+
+    /*
+    ** Performance Log exit stamp
+    */
+    CFE_ES_PerfLogExit(MM_SEGBREAK_PERF_ID);
+  }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -256,15 +271,18 @@ int32 MM_VerifyLoadDumpParams(cpuaddr Address, MM_MemType_Enum_t MemType,
 
   if ((VerifyType != MM_VERIFY_LOAD) && (VerifyType != MM_VERIFY_DUMP) &&
       (VerifyType != MM_VERIFY_EVENT) && (VerifyType != MM_VERIFY_FILL) &&
-      (VerifyType != MM_VERIFY_WID)) {
+      (VerifyType != MM_VERIFY_WID) && (VerifyType != MM_VERIFY_INTLM)) {
     PSP_Status = CFE_PSP_ERROR;
   }
 
-  /* The DumpInEvent and LoadMemWID commands use the same max size for all
-   * memory types. Therefore if one of these is the command being verified,
-   * the max size can be set here rather than in the switch statement */
+  /* The DumpInEvent, DumpInTlm, and LoadMemWID commands use the same max
+   * size for all memory types. Therefore if one of these is the command being
+   * verified, the max size can be set here rather than in the switch
+   * statement */
   if (VerifyType == MM_VERIFY_EVENT) {
     MaxSize = MM_INTERNAL_MAX_DUMP_INEVENT_BYTES;
+  } else if (VerifyType == MM_VERIFY_INTLM) {
+    MaxSize = MM_INTERFACE_MAX_DUMP_TLM_DATA;
   } else if (VerifyType == MM_VERIFY_WID) {
     MaxSize = MM_INTERFACE_MAX_UNINTERRUPTIBLE_DATA;
   }
@@ -461,11 +479,13 @@ int32 MM_ResolveSymAddr(MM_SymAddr_t *SymAddr, cpuaddr *ResolvedAddr) {
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 int32 MM_ComputeCRCFromFile(osal_id_t FileHandle, uint32 *CrcPtr,
-                            uint32 TypeCRC) {
+                            MM_CrcType_Enum_t CrcType) {
   int32 ByteCntr;
   int32 OS_Status = OS_SUCCESS;
   uint32 TempCrc = 0;
-  static uint8 DataArray[FILE_CRC_BUFFER_SIZE];
+  static uint8 DataArray[MM_INTERNAL_FILE_CRC_BUFFER_SIZE];
+
+  CFE_ES_PerfLogEntry(MM_FILE_CRC_PERF_ID);
 
   do {
     /*
@@ -480,11 +500,14 @@ int32 MM_ComputeCRCFromFile(osal_id_t FileHandle, uint32 *CrcPtr,
       /*
       ** Calculate the CRC based upon the previous CRC calculation
       */
-      TempCrc = CFE_ES_CalculateCRC(DataArray, ByteCntr, TempCrc, TypeCRC);
+      TempCrc = MM_CalculateFileCRC(DataArray, ByteCntr, TempCrc, CrcType,
+                                    MM_INTERNAL_LOAD_FILE_CRC_TYPE);
     }
 
   } while (ByteCntr > 0);
 
+  CFE_ES_PerfLogExit(MM_FILE_CRC_PERF_ID);
+
   /*
   ** Check if we broke out of the loop because of an error return
   ** from the OS_read call
@@ -497,3 +520,91 @@ int32 MM_ComputeCRCFromFile(osal_id_t FileHandle, uint32 *CrcPtr,
 
   return OS_Status;
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Format bytes as hex text                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t MM_FormatHexBytes(char *Dest, size_t DestSize, const uint8 *Src,
+                         size_t NumBytes) {
+  static const char HexDigits[] = "0123456789ABCDEF";
+  size_t Length = 0;
+  size_t i;
+
+  /* Each byte is written as "0xNN ", stop while there is room for the NUL */
+  for (i = 0; (i < NumBytes) && (Length + MM_HEX_CHARS_PER_BYTE < DestSize);
+       i++) {
+    Dest[Length++] = '0';
+    Dest[Length++] = 'x';
+    Dest[Length++] = HexDigits[Src[i] >> 4];
+    Dest[Length++] = HexDigits[Src[i] & 0x0F];
+    Dest[Length++] = ' ';
+  }
+
+  if (DestSize > 0) {
+    Dest[Length] = '\0';
+  }
+
+  return Length;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify fill pattern size                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_VerifyFillPattern(const MM_FillMemCmd_Payload_t *Payload) {
+  int32 Status = OS_SUCCESS;
+
+  if ((Payload->PatternSize > MM_FILL_MAX_PATTERN_SIZE) ||
+      ((Payload->PatternSize != 0) &&
+       ((MM_FILL_MAX_PATTERN_SIZE % Payload->PatternSize) != 0))) {
+    Status = OS_ERROR;
+    CFE_EVS_SendEvent(MM_FILL_PATTERN_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Fill pattern size error: Size = %u",
+                      (unsigned int)Payload->PatternSize);
+  }
+
+  return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Repeat the fill pattern across the fill buffer                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_BuildFillBuffer(const MM_FillMemCmd_Payload_t *Payload,
+                        size_t AccessSize) {
+  uint8 *FillBuffer = (uint8 *)&MM_AppData.FillBuffer[0];
+  uint64 Pattern = ((uint64)Payload->FillPatternHigh << 32) |
+                   Payload->FillPattern;
+  const uint16 ByteOrder = 1;
+  size_t PatternSize = Payload->PatternSize;
+  size_t Filled;
+  size_t CopySize;
+
+  if (PatternSize == 0) {
+    PatternSize = AccessSize;
+  }
+
+  /* The low bytes of the pattern are at the end on big endian targets */
+  if (*(const uint8 *)&ByteOrder == 1) {
+    memcpy(FillBuffer, &Pattern, PatternSize);
+  } else {
+    memcpy(FillBuffer, (const uint8 *)&Pattern + sizeof(Pattern) - PatternSize,
+           PatternSize);
+  }
+
+  /* Double the filled part of the buffer until the buffer is full */
+  Filled = PatternSize;
+  while (Filled < MM_INTERNAL_MAX_FILL_DATA_SEG) {
+    CopySize = Filled;
+    if (CopySize > (MM_INTERNAL_MAX_FILL_DATA_SEG - Filled)) {
+      CopySize = MM_INTERNAL_MAX_FILL_DATA_SEG - Filled;
+    }
+
+    memcpy(&FillBuffer[Filled], FillBuffer, CopySize);
+    Filled += CopySize;
+  }
+}
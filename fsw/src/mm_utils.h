@@ -31,6 +31,16 @@
 #include "mm_extern_typedefs.h"
 #include "mm_msg.h"
 
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+#define MM_HEX_CHARS_PER_BYTE                                                  \
+  5 /**< \brief Characters #MM_FormatHexBytes writes per byte */
+
+#define MM_FILL_MAX_PATTERN_SIZE                                               \
+  8 /**< \brief Largest fill pattern in bytes, every pattern size divides it */
+
 /*************************************************************************
  * Exported Functions
  *************************************************************************/
@@ -55,10 +65,16 @@ void MM_ResetHk(void);
  *  \par Description
  *       This routine gets called during each segment break in a load,
  *       dump, or memory fill operation and handles any processing
- *       that needs to be done during those breaks
+ *       that needs to be done during those breaks. The CPU is only given
+ *       up once the operation has used up the CPU time budget
+ *       (#MM_HkTlm_Payload_t.CpuBudget) since the last time it was given
+ *       up, so the number of bytes processed between delays grows or
+ *       shrinks with the time each segment takes.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       The caller must hold the command mutex. It is released for the
+ *       duration of the break so the MM main task can process commands.
+ *       The budget is restarted by the worker task before each job.
  */
 void MM_SegmentBreak(void);
 
@@ -188,16 +204,81 @@ int32 MM_ResolveSymAddr(MM_SymAddr_t *SymAddr, cpuaddr *ResolvedAddr);
  *       file pointer to the end of file
  *
  *  \param [in]   FileHandle   The open file handle of the file to scan
- *  \param [in]   TypeCRC      CRC type to compute
+ *  \param [in]   CrcType      CRC type from the load file header,
+ *                             #MM_CrcType_DEFAULT computes
+ *                             #MM_INTERNAL_LOAD_FILE_CRC_TYPE
  *  \param [out]  CrcPtr       The computed CRC. Only updated if the return
  *                             value is #OS_SUCCESS
  *
  *  \return Execution status, see \ref OSReturnCodes
  *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
  *
- *  \sa #CFE_ES_CalculateCRC, #OS_read
+ *  \sa #MM_CalculateFileCRC, #OS_read
  */
 int32 MM_ComputeCRCFromFile(osal_id_t FileHandle, uint32 *CrcPtr,
-                            uint32 TypeCRC);
+                            MM_CrcType_Enum_t CrcType);
+
+/**
+ * \brief Format bytes as hex text
+ *
+ *  \par Description
+ *       Writes each byte as "0xNN " using a digit lookup table and
+ *       NUL terminates the result. Bytes that don't fit in the
+ *       destination are left out.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [out]  Dest       Destination string
+ *  \param [in]   DestSize   Size of the destination string in bytes
+ *  \param [in]   Src        Bytes to format
+ *  \param [in]   NumBytes   Number of bytes to format
+ *
+ *  \return Number of characters written, not counting the NUL
+ */
+size_t MM_FormatHexBytes(char *Dest, size_t DestSize, const uint8 *Src,
+                         size_t NumBytes);
+
+/**
+ * \brief Verify fill pattern size
+ *
+ *  \par Description
+ *       Checks that the fill command pattern size is zero or a size that
+ *       divides #MM_FILL_MAX_PATTERN_SIZE, so every fill segment starts
+ *       at the beginning of the pattern
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]  Payload   Fill command payload
+ *
+ *  \return Execution status
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ *  \retval #OS_ERROR   \copybrief OS_ERROR
+ *
+ *  \sa #MM_FILL_PATTERN_ERR_EID
+ */
+int32 MM_VerifyFillPattern(const MM_FillMemCmd_Payload_t *Payload);
+
+/**
+ * \brief Build the fill buffer
+ *
+ *  \par Description
+ *       Repeats the fill command pattern across the whole fill buffer so
+ *       fill segments can be written with block copies or read back one
+ *       access width at a time
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The pattern size must already have been verified with
+ *       #MM_VerifyFillPattern. The pattern is the low pattern size bytes
+ *       of the 64-bit pattern stored in the target byte order, so a
+ *       pattern that matches the access width is written as that value.
+ *
+ *  \param [in]  Payload      Fill command payload
+ *  \param [in]  AccessSize   Access width of the memory type in bytes,
+ *                            used when the payload pattern size is zero
+ */
+void MM_BuildFillBuffer(const MM_FillMemCmd_Payload_t *Payload,
+                        size_t AccessSize);
 
 #endif
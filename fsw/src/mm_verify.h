@@ -135,8 +135,8 @@
 /*
  * Minimum size for max fill data segment
  */
-#if MM_INTERNAL_MAX_FILL_DATA_SEG < 4
-#error MM_INTERNAL_MAX_FILL_DATA_SEG cannot be less than 4
+#if MM_INTERNAL_MAX_FILL_DATA_SEG < 8
+#error MM_INTERNAL_MAX_FILL_DATA_SEG cannot be less than 8
 #endif
 
 /*
@@ -150,10 +150,174 @@
 #error MM_MAX_DUMP_DATA_SEG should be longword aligned
 #endif
 
-#if (MM_INTERNAL_MAX_FILL_DATA_SEG % 4) != 0
-#error MM_INTERNAL_MAX_FILL_DATA_SEG should be longword aligned
+#if (MM_INTERNAL_MAX_FILL_DATA_SEG % 8) != 0
+#error MM_INTERNAL_MAX_FILL_DATA_SEG should be a multiple of 8
 #endif
 
+/*
+ * Load file sub-types
+ */
+#if MM_INTERNAL_CFE_HDR_PATCH_SUBTYPE == MM_INTERNAL_CFE_HDR_SUBTYPE
+#error MM_INTERNAL_CFE_HDR_PATCH_SUBTYPE must be different from MM_INTERNAL_CFE_HDR_SUBTYPE
+#endif
+
+#if MM_INTERNAL_CFE_HDR_COMPRESSED_SUBTYPE == MM_INTERNAL_CFE_HDR_SUBTYPE
+#error MM_INTERNAL_CFE_HDR_COMPRESSED_SUBTYPE must be different from MM_INTERNAL_CFE_HDR_SUBTYPE
+#elif MM_INTERNAL_CFE_HDR_COMPRESSED_SUBTYPE == MM_INTERNAL_CFE_HDR_PATCH_SUBTYPE
+#error MM_INTERNAL_CFE_HDR_COMPRESSED_SUBTYPE must be different from MM_INTERNAL_CFE_HDR_PATCH_SUBTYPE
+#endif
+
+#if MM_INTERNAL_CFE_HDR_REGION_SUBTYPE == MM_INTERNAL_CFE_HDR_SUBTYPE
+#error MM_INTERNAL_CFE_HDR_REGION_SUBTYPE must be different from MM_INTERNAL_CFE_HDR_SUBTYPE
+#elif MM_INTERNAL_CFE_HDR_REGION_SUBTYPE == MM_INTERNAL_CFE_HDR_PATCH_SUBTYPE
+#error MM_INTERNAL_CFE_HDR_REGION_SUBTYPE must be different from MM_INTERNAL_CFE_HDR_PATCH_SUBTYPE
+#elif MM_INTERNAL_CFE_HDR_REGION_SUBTYPE == MM_INTERNAL_CFE_HDR_COMPRESSED_SUBTYPE
+#error MM_INTERNAL_CFE_HDR_REGION_SUBTYPE must be different from MM_INTERNAL_CFE_HDR_COMPRESSED_SUBTYPE
+#endif
+
+/*
+ * Load, dump, and fill CPU time budget
+ */
+#if MM_INTERNAL_DEFAULT_CPU_BUDGET > MM_INTERNAL_MAX_CPU_BUDGET
+#error MM_INTERNAL_DEFAULT_CPU_BUDGET cannot be greater than MM_INTERNAL_MAX_CPU_BUDGET
+#endif
+
+/*
+ * Staged load buffer size
+ */
+#if MM_INTERNAL_MAX_STAGED_LOAD_BYTES < 4
+#error MM_INTERNAL_MAX_STAGED_LOAD_BYTES cannot be less than 4
+#endif
+
+#if (MM_INTERNAL_MAX_STAGED_LOAD_BYTES % 4) != 0
+#error MM_INTERNAL_MAX_STAGED_LOAD_BYTES should be longword aligned
+#endif
+
+/*
+ * Region file directory size
+ */
+#if MM_INTERNAL_MAX_FILE_REGIONS < 1
+#error MM_INTERNAL_MAX_FILE_REGIONS cannot be less than 1
+#endif
+
+#if MM_INTERFACE_MAX_DUMP_REGIONS < 1
+#error MM_INTERFACE_MAX_DUMP_REGIONS cannot be less than 1
+#elif MM_INTERFACE_MAX_DUMP_REGIONS > MM_INTERNAL_MAX_FILE_REGIONS
+#error MM_INTERFACE_MAX_DUMP_REGIONS cannot be greater than MM_INTERNAL_MAX_FILE_REGIONS
+#endif
+
+/*
+ * Dump to telemetry
+ */
+#if MM_INTERFACE_MAX_DUMP_TLM_DATA < 1
+#error MM_INTERFACE_MAX_DUMP_TLM_DATA cannot be less than 1
+#endif
+
+#if (MM_INTERFACE_MAX_DUMP_TLM_DATA % 4) != 0
+#error MM_INTERFACE_MAX_DUMP_TLM_DATA should be longword aligned
+#endif
+
+#if MM_INTERNAL_DUMP_TLM_PACKETS_PER_CYCLE < 1
+#error MM_INTERNAL_DUMP_TLM_PACKETS_PER_CYCLE cannot be less than 1
+#endif
+
+/*
+ * Chunked load
+ */
+#if MM_INTERFACE_MAX_LOAD_CHUNK_DATA < 1
+#error MM_INTERFACE_MAX_LOAD_CHUNK_DATA cannot be less than 1
+#endif
+
+#if MM_INTERNAL_MAX_CHUNK_LOAD_BYTES < 4
+#error MM_INTERNAL_MAX_CHUNK_LOAD_BYTES cannot be less than 4
+#endif
+
+#if (MM_INTERNAL_MAX_CHUNK_LOAD_BYTES % 4) != 0
+#error MM_INTERNAL_MAX_CHUNK_LOAD_BYTES should be longword aligned
+#endif
+
+#if MM_INTERNAL_MAX_RAM_COMMIT_BYTES < 1
+#error MM_INTERNAL_MAX_RAM_COMMIT_BYTES cannot be less than 1
+#elif MM_INTERNAL_MAX_RAM_COMMIT_BYTES > MM_INTERNAL_MAX_CHUNK_LOAD_BYTES
+#error MM_INTERNAL_MAX_RAM_COMMIT_BYTES cannot be greater than MM_INTERNAL_MAX_CHUNK_LOAD_BYTES
+#endif
+
+/*
+ * Background scrubber
+ */
+#if MM_INTERFACE_MAX_SCRUB_REGIONS < 1
+#error MM_INTERFACE_MAX_SCRUB_REGIONS cannot be less than 1
+#elif MM_INTERFACE_MAX_SCRUB_REGIONS > 255
+#error MM_INTERFACE_MAX_SCRUB_REGIONS cannot be greater than 255
+#endif
+
+#if (MM_INTERFACE_MAX_SCRUB_REGIONS % 4) != 0
+#error MM_INTERFACE_MAX_SCRUB_REGIONS should be longword aligned
+#endif
+
+#if MM_INTERNAL_SCRUB_BYTES_PER_CYCLE < 1
+#error MM_INTERNAL_SCRUB_BYTES_PER_CYCLE cannot be less than 1
+#endif
+
+#if MM_INTERNAL_MAX_SCRUB_BLOCKS < 1
+#error MM_INTERNAL_MAX_SCRUB_BLOCKS cannot be less than 1
+#elif MM_INTERNAL_MAX_SCRUB_BLOCKS > 65536
+#error MM_INTERNAL_MAX_SCRUB_BLOCKS cannot be greater than 65536
+#endif
+
+#if MM_INTERNAL_SCRUB_BLOCK_SIZE < 4
+#error MM_INTERNAL_SCRUB_BLOCK_SIZE cannot be less than 4
+#endif
+
+#if (MM_INTERNAL_SCRUB_BLOCK_SIZE % 4) != 0
+#error MM_INTERNAL_SCRUB_BLOCK_SIZE should be longword aligned
+#endif
+
+#if MM_INTERFACE_MAX_SCRUB_MISMATCH_BLOCKS < 1
+#error MM_INTERFACE_MAX_SCRUB_MISMATCH_BLOCKS cannot be less than 1
+#endif
+
+#if (MM_INTERFACE_MAX_SCRUB_MISMATCH_BLOCKS % 2) != 0
+#error MM_INTERFACE_MAX_SCRUB_MISMATCH_BLOCKS should be a multiple of 2
+#endif
+
+#if MM_INTERFACE_MAX_MEM_TEST_FAILURES < 1
+#error MM_INTERFACE_MAX_MEM_TEST_FAILURES cannot be less than 1
+#endif
+
+#if MM_INTERFACE_MAX_MEM_TEST_FAILURES > 65535
+#error MM_INTERFACE_MAX_MEM_TEST_FAILURES cannot be greater than 65535
+#endif
+
+#if MM_INTERFACE_MAX_BATCH_PEEK_ENTRIES < 1
+#error MM_INTERFACE_MAX_BATCH_PEEK_ENTRIES cannot be less than 1
+#endif
+
+#if MM_INTERFACE_MAX_BATCH_POKE_ENTRIES < 1
+#error MM_INTERFACE_MAX_BATCH_POKE_ENTRIES cannot be less than 1
+#endif
+
+#if MM_INTERFACE_MAX_WATCH_ENTRIES < 1
+#error MM_INTERFACE_MAX_WATCH_ENTRIES cannot be less than 1
+#elif MM_INTERFACE_MAX_WATCH_ENTRIES > 32
+#error MM_INTERFACE_MAX_WATCH_ENTRIES cannot be greater than 32
+#endif
+
+/*
+ * Optional direct file load Configurable Parameters
+ */
+#ifdef MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD
+
+#if MM_INTERNAL_MAX_DIRECT_LOAD_DATA_SEG < MM_INTERNAL_MAX_LOAD_DATA_SEG
+#error MM_INTERNAL_MAX_DIRECT_LOAD_DATA_SEG cannot be less than MM_INTERNAL_MAX_LOAD_DATA_SEG
+#endif
+
+#if (MM_INTERNAL_MAX_DIRECT_LOAD_DATA_SEG % 4) != 0
+#error MM_INTERNAL_MAX_DIRECT_LOAD_DATA_SEG should be longword aligned
+#endif
+
+#endif /* MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD */
+
 /*
  * Optional MEM32 Configurable Parameters
  */
@@ -244,6 +408,10 @@
 
 #endif /* MM_INTERNAL_OPT_CODE_MEM8_MEMTYPE */
 
+#if MM_INTERNAL_FILE_CRC_BUFFER_SIZE < 1
+#error MM_INTERNAL_FILE_CRC_BUFFER_SIZE cannot be less than 1
+#endif
+
 #if MM_INTERNAL_LOAD_WID_CRC_TYPE != CFE_MISSION_ES_DEFAULT_CRC
 #error MM_INTERNAL_LOAD_WID_CRC_TYPE must be a type supported by CFE_ES_CalculateCRC
 #endif
@@ -253,5 +421,8 @@
 #if MM_INTERNAL_DUMP_FILE_CRC_TYPE != CFE_MISSION_ES_DEFAULT_CRC
 #error MM_INTERNAL_DUMP_FILE_CRC_TYPE must be a type supported by CFE_ES_CalculateCRC
 #endif
+#if MM_INTERNAL_CHECKSUM_CRC_TYPE != CFE_MISSION_ES_DEFAULT_CRC
+#error MM_INTERNAL_CHECKSUM_CRC_TYPE must be a type supported by CFE_ES_CalculateCRC
+#endif
 
 #endif
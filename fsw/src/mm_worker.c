@@ -0,0 +1,227 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Worker child task for the CFS Memory Manager. Load, dump, and fill
+ *   commands are queued here by the MM main task and executed in the
+ *   background.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_worker.h"
+#include "mm_app.h"
+#include "mm_cmds.h"
+#include "mm_eventids.h"
+#include "mm_fcncodes.h"
+#include "mm_internal_cfg.h"
+#include "mm_perfids.h"
+#include "mm_utils.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create the command mutex, job queue, and worker child task      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_WorkerInit(void) {
+  int32 OS_Status;
+  CFE_Status_t Status;
+
+  OS_Status =
+      OS_MutSemCreate(&MM_AppData.CmdMutex, MM_INTERNAL_CMD_MUTEX_NAME, 0);
+  if (OS_Status != OS_SUCCESS) {
+    CFE_EVS_SendEvent(MM_WORKER_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Error Creating Command Mutex, RC = %d", (int)OS_Status);
+    return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+  }
+
+  OS_Status = OS_QueueCreate(&MM_AppData.WorkerQueue,
+                             MM_INTERNAL_WORKER_QUEUE_NAME,
+                             MM_INTERNAL_WORKER_QUEUE_DEPTH,
+                             sizeof(MM_WorkerJob_t), 0);
+  if (OS_Status != OS_SUCCESS) {
+    CFE_EVS_SendEvent(MM_WORKER_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Error Creating Worker Queue, RC = %d", (int)OS_Status);
+    return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+  }
+
+  Status = CFE_ES_CreateChildTask(
+      &MM_AppData.WorkerTaskId, MM_INTERNAL_WORKER_TASK_NAME, MM_WorkerTask,
+      CFE_ES_TASK_STACK_ALLOCATE, MM_INTERNAL_WORKER_STACK_SIZE,
+      MM_INTERNAL_WORKER_PRIORITY, 0);
+  if (Status != CFE_SUCCESS) {
+    CFE_EVS_SendEvent(MM_WORKER_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Error Creating Worker Task, RC = 0x%08X",
+                      (unsigned int)Status);
+  }
+
+  return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Worker child task main loop                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_WorkerTask(void) {
+  int32 OS_Status = OS_SUCCESS;
+  size_t JobSize = 0;
+  MM_WorkerJob_t Job;
+
+  while (OS_Status == OS_SUCCESS) {
+    /*
+    ** Pend until the main task hands over a job
+    */
+    OS_Status = OS_QueueGet(MM_AppData.WorkerQueue, &Job, sizeof(Job),
+                            &JobSize, OS_PEND);
+
+    if (OS_Status == OS_SUCCESS) {
+      /*
+      ** Only one task may be processing a command at a time. The lock
+      ** is released by MM_SegmentBreak while the job is delayed.
+      */
+      OS_MutSemTake(MM_AppData.CmdMutex);
+      CFE_ES_PerfLogEntry(MM_WORKER_PERF_ID);
+
+      MM_WorkerProcessJob(&Job);
+
+      CFE_ES_PerfLogExit(MM_WORKER_PERF_ID);
+      OS_MutSemGive(MM_AppData.CmdMutex);
+    }
+  }
+
+  CFE_EVS_SendEvent(MM_WORKER_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "Worker Queue Read Error, Worker will exit. RC = %d",
+                    (int)OS_Status);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Queue a command for the worker task                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_WorkerSubmit(const CFE_SB_Buffer_t *BufPtr, size_t MsgSize) {
+  int32 OS_Status;
+  CFE_MSG_FcnCode_t CommandCode = 0;
+
+  CFE_MSG_GetFcnCode(&BufPtr->Msg, &CommandCode);
+
+  OS_Status = OS_QueuePut(MM_AppData.WorkerQueue, BufPtr, MsgSize, 0);
+
+  if (OS_Status == OS_SUCCESS) {
+    /*
+    ** The worker reads the chunked load buffer once it gets to the commit,
+    ** so the buffer is held until then. The caller holds the command mutex
+    ** so the worker can't have run the commit yet.
+    */
+    if ((CommandCode == MM_LOAD_COMMIT_CC) ||
+        (CommandCode == MM_LOAD_RAM_COMMIT_CC)) {
+      MM_AppData.ChunkLoad.CommitsQueued++;
+    }
+  } else {
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_WORKER_QUEUE_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Worker queue error, command rejected: CC = %u, RC = %d",
+                      (unsigned int)CommandCode, (int)OS_Status);
+  }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Release the chunked load buffer held for a queued commit        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void MM_WorkerCommitDone(void) {
+  if (MM_AppData.ChunkLoad.CommitsQueued > 0) {
+    MM_AppData.ChunkLoad.CommitsQueued--;
+  }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Execute a queued command                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_WorkerProcessJob(const MM_WorkerJob_t *Job) {
+  CFE_MSG_FcnCode_t CommandCode = 0;
+
+  MM_ResetHk(); /* Clear all "Last Action" data */
+
+  /* Each job starts with a full CPU time budget */
+  OS_GetLocalTime(&MM_AppData.SegmentStartTime);
+
+  CFE_MSG_GetFcnCode(&Job->SBBuf.Msg, &CommandCode);
+  switch (CommandCode) {
+  case MM_LOAD_MEM_FROM_FILE_CC:
+    MM_LoadMemFromFileCmd(&Job->LoadMemFromFileCmd);
+    break;
+
+  case MM_DUMP_MEM_TO_FILE_CC:
+    MM_DumpMemToFileCmd(&Job->DumpMemToFileCmd);
+    break;
+
+  case MM_DUMP_MEM_TO_COMPRESSED_FILE_CC:
+    MM_DumpMemToCompressedFileCmd(&Job->DumpMemToCompressedFileCmd);
+    break;
+
+  case MM_DUMP_REGIONS_TO_FILE_CC:
+    MM_DumpRegionsToFileCmd(&Job->DumpRegionsToFileCmd);
+    break;
+
+  case MM_FILL_MEM_CC:
+    MM_FillMemCmd(&Job->FillMemCmd);
+    break;
+
+  case MM_LOAD_COMMIT_CC:
+    MM_LoadCommitCmd(&Job->LoadCommitCmd);
+    MM_WorkerCommitDone();
+    break;
+
+  case MM_LOAD_RAM_COMMIT_CC:
+    MM_LoadRAMCommitCmd(&Job->LoadRAMCommitCmd);
+    MM_WorkerCommitDone();
+    break;
+
+  case MM_CHECKSUM_MEM_CC:
+    MM_ChecksumMemCmd(&Job->ChecksumMemCmd);
+    break;
+
+  case MM_BUILD_SCRUB_INDEX_CC:
+    MM_BuildScrubIndexCmd(&Job->BuildScrubIndexCmd);
+    break;
+
+  case MM_COMPARE_SCRUB_INDEX_CC:
+    MM_CompareScrubIndexCmd(&Job->CompareScrubIndexCmd);
+    break;
+
+  case MM_MEM_TEST_CC:
+    MM_MemTestCmd(&Job->MemTestCmd);
+    break;
+
+  default:
+    /*
+    ** Only the commands above are ever queued, so this is not expected
+    */
+    MM_AppData.HkTlm.Payload.ErrCounter++;
+    CFE_EVS_SendEvent(MM_CC_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "Invalid worker command code %d", CommandCode);
+    break;
+  }
+}
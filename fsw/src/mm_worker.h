@@ -0,0 +1,136 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Manager worker child task. The worker
+ *   executes long running memory operations (file loads, file dumps,
+ *   fills, checksums, scrub indexes, and memory tests) so the MM main task
+ *   stays responsive to housekeeping requests.
+ */
+#ifndef MM_WORKER_H
+#define MM_WORKER_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+
+#include "cfe.h"
+#include "mm_msg.h"
+
+/*************************************************************************
+ * Type Definitions
+ *************************************************************************/
+
+/**
+ *  \brief Worker job queue entry
+ *
+ *  A job is a copy of the command message that requested the operation,
+ *  sized to hold the largest command the worker executes.
+ */
+typedef union {
+  CFE_SB_Buffer_t SBBuf;                      /**< \brief Generic SB buffer */
+  MM_LoadMemFromFileCmd_t LoadMemFromFileCmd; /**< \brief Load from file */
+  MM_DumpMemToFileCmd_t DumpMemToFileCmd;     /**< \brief Dump to file */
+  MM_DumpMemToCompressedFileCmd_t
+      DumpMemToCompressedFileCmd; /**< \brief Dump to compressed file */
+  MM_DumpRegionsToFileCmd_t
+      DumpRegionsToFileCmd; /**< \brief Dump regions to file */
+  MM_FillMemCmd_t FillMemCmd;                 /**< \brief Fill memory */
+  MM_LoadCommitCmd_t LoadCommitCmd;           /**< \brief Chunked load commit */
+  MM_LoadRAMCommitCmd_t LoadRAMCommitCmd;     /**< \brief Chunked RAM commit */
+  MM_ChecksumMemCmd_t ChecksumMemCmd;         /**< \brief Checksum memory */
+  MM_BuildScrubIndexCmd_t
+      BuildScrubIndexCmd; /**< \brief Build scrub index */
+  MM_CompareScrubIndexCmd_t
+      CompareScrubIndexCmd; /**< \brief Compare scrub index */
+  MM_MemTestCmd_t MemTestCmd;                 /**< \brief Memory test */
+} MM_WorkerJob_t;
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Initialize the worker task
+ *
+ *  \par Description
+ *       Creates the command mutex, the worker job queue, and the worker
+ *       child task
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called from the MM main task during application
+ *       initialization
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ *
+ *  \sa #MM_WORKER_ERR_EID
+ */
+CFE_Status_t MM_WorkerInit(void);
+
+/**
+ * \brief Worker child task entry point
+ *
+ *  \par Description
+ *       Pends on the worker job queue and executes each job while
+ *       holding the command mutex
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Returns (ending the child task) when the job queue can no
+ *       longer be read
+ */
+void MM_WorkerTask(void);
+
+/**
+ * \brief Submit a command to the worker task
+ *
+ *  \par Description
+ *       Copies the command message onto the worker job queue. The
+ *       command counters are updated by the command handler when the
+ *       worker executes the job, or here if the job can't be queued.
+ *       A queued load commit holds the chunked load buffer until the
+ *       worker has run it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The command length must already have been verified and must
+ *       not exceed the size of #MM_WorkerJob_t. The caller must hold
+ *       the command mutex.
+ *
+ *  \param [in]  BufPtr    Pointer to the command message
+ *  \param [in]  MsgSize   Size of the command message in bytes
+ *
+ *  \sa #MM_WORKER_QUEUE_ERR_EID
+ */
+void MM_WorkerSubmit(const CFE_SB_Buffer_t *BufPtr, size_t MsgSize);
+
+/**
+ * \brief Execute a worker job
+ *
+ *  \par Description
+ *       Clears the "last action" housekeeping data and calls the command
+ *       handler that matches the command code of the job
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller must hold the command mutex
+ *
+ *  \param [in]  Job   Pointer to the job to execute
+ */
+void MM_WorkerProcessJob(const MM_WorkerJob_t *Job);
+
+#endif
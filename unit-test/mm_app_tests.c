@@ -28,6 +28,8 @@
 #include "mm_eventids.h"
 #include "mm_fcncodes.h"
 #include "mm_msgids.h"
+#include "mm_scrub.h"
+#include "mm_worker.h"
 
 #include "mm_test_utils.h"
 
@@ -65,10 +67,34 @@ void MM_AppMain_Test_Nominal(void) {
   UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
+  UtAssert_STUB_COUNT(MM_ScrubStep, 0);
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
   UtAssert_STUB_COUNT(CFE_ES_ExitApp, 1);
 }
 
+void MM_AppMain_Test_SendHk(void) {
+  CFE_SB_Buffer_t Buf;
+  CFE_SB_Buffer_t *BufPtr = &Buf;
+  CFE_SB_MsgId_t MsgId = CFE_SB_ValueToMsgId(MM_SEND_HK_MID);
+
+  /* Set to exit loop after first run */
+  UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+
+  /* Causes check for non-null buffer pointer to succeed */
+  UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &BufPtr, sizeof(BufPtr),
+                   false);
+
+  /* Set to satisfy the housekeeping request check */
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+
+  /* Execute the function being tested */
+  MM_AppMain();
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(MM_ScrubStep, 1);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
 void MM_AppMain_Test_AppInitError(void) {
   /* Set to exit loop after first run */
   UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
@@ -101,6 +127,7 @@ void MM_AppMain_Test_SBError(void) {
   UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
+  UtAssert_STUB_COUNT(MM_ScrubStep, 0);
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
   MM_Test_Verify_Event(1, MM_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
                        "SB Pipe Read Error, App will exit. RC = 0x%08X");
@@ -117,6 +144,8 @@ void MM_AppMain_Test_SBTimeout(void) {
   MM_AppMain();
 
   /* Verify results */
+  UtAssert_STUB_COUNT(MM_ScrubStep, 1);
+
   /* Generates 1 event message we don't care about in this test */
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
@@ -138,7 +167,10 @@ void MM_AppInit_Test_Nominal(void) {
   UtAssert_INT32_EQ(MM_AppData.RunStatus, CFE_ES_RunStatus_APP_RUN);
   UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.CpuBudget,
+                     MM_INTERNAL_DEFAULT_CPU_BUDGET);
 
+  UtAssert_STUB_COUNT(MM_WorkerInit, 1);
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
   MM_Test_Verify_Event(0, MM_INIT_INF_EID, CFE_EVS_EventType_INFORMATION,
                        "MM Initialized. Version %d.%d.%d.%d");
@@ -263,11 +295,32 @@ void MM_AppInit_Test_SBSubscribeMMError(void) {
                    context_CFE_EVS_SendEvent[0].Spec);
 }
 
+void MM_AppInit_Test_WorkerInitError(void) {
+  CFE_Status_t Result;
+
+  /* Set to fail creation of the worker task */
+  UT_SetDefaultReturnValue(UT_KEY(MM_WorkerInit),
+                           CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+  /* Execute the function being tested */
+  Result = MM_AppInit();
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+  UtAssert_INT32_EQ(MM_AppData.RunStatus, CFE_ES_RunStatus_APP_RUN);
+  UtAssert_STUB_COUNT(MM_WorkerInit, 1);
+
+  /* The worker reports its own error, so no init event is sent */
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
 void UtTest_Setup(void) {
   ADD_TEST(MM_AppMain_Test_Nominal);
+  ADD_TEST(MM_AppMain_Test_SendHk);
   ADD_TEST(MM_AppMain_Test_AppInitError);
   ADD_TEST(MM_AppMain_Test_SBError);
   ADD_TEST(MM_AppMain_Test_SBTimeout);
@@ -276,4 +329,5 @@ void UtTest_Setup(void) {
   ADD_TEST(MM_AppInit_Test_SBCreatePipeError);
   ADD_TEST(MM_AppInit_Test_SBSubscribeHKError);
   ADD_TEST(MM_AppInit_Test_SBSubscribeMMError);
+  ADD_TEST(MM_AppInit_Test_WorkerInitError);
 }
@@ -26,6 +26,7 @@
 /* ======== */
 
 #include "mm_cmds.h"
+#include "mm_crc.h"
 #include "mm_dispatch.h"
 #include "mm_dump.h"
 #include "mm_eventids.h"
@@ -35,7 +36,10 @@
 #include "mm_mem16.h"
 #include "mm_mem32.h"
 #include "mm_mem8.h"
+#include "mm_memtest.h"
 #include "mm_msgids.h"
+#include "mm_sampler.h"
+#include "mm_scrub.h"
 #include "mm_test_utils.h"
 #include "mm_utils.h"
 
@@ -68,6 +72,8 @@ void Test_MM_SendHkCmd_Nominal(void) {
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
   UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
   UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+  UtAssert_STUB_COUNT(MM_SendDumpTlm, 1);
+  UtAssert_STUB_COUNT(MM_SamplerStep, 1);
 }
 
 void Test_MM_NoopCmd_Nominal(void) {
@@ -104,6 +110,9 @@ void Test_MM_ResetCountersCmd_Nominal(void) {
   MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_NOACTION;
   MM_AppData.HkTlm.Payload.CmdCounter = 1;
   MM_AppData.HkTlm.Payload.ErrCounter = 1;
+  MM_AppData.HkTlm.Payload.EepromBytesWritten = 1;
+  MM_AppData.HkTlm.Payload.EepromBytesSkipped = 1;
+  MM_AppData.HkTlm.Payload.ScrubMismatches = 1;
 
   /* Run function under test */
   Status = MM_ResetCountersCmd(&ResetCountersCmd);
@@ -114,6 +123,9 @@ void Test_MM_ResetCountersCmd_Nominal(void) {
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.LastAction, MM_LastAction_RESET);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.EepromBytesWritten, 0);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.EepromBytesSkipped, 0);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.ScrubMismatches, 0);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
   MM_Test_Verify_Event(0, MM_RESET_INF_EID, CFE_EVS_EventType_INFORMATION,
@@ -490,7 +502,7 @@ void Test_MM_LoadMemWIDCmd_Nominal(void) {
 
   UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), ComputedCRC);
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), ComputedCRC);
 
   UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
                         &SymAddr);
@@ -530,7 +542,7 @@ void Test_MM_LoadMemWIDCmd_CRCError(void) {
 
   UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), ComputedCRC);
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), ComputedCRC);
 
   /* Execute the function being tested */
   Result = MM_LoadMemWIDCmd(&LoadMemWIDCmd);
@@ -593,6 +605,7 @@ void Test_MM_LoadMemFromFileCmd_RAM(void) {
 
   ComputedCrc = 99;
   Hdr.Crc = ComputedCrc;
+  Hdr.NumOfBytes = MM_INTERNAL_MAX_STAGED_LOAD_BYTES + 4;
   Hdr.MemType = MM_MemType_RAM;
 
   UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
@@ -636,6 +649,7 @@ void Test_MM_LoadMemFromFileCmd_BadType(void) {
 
   ComputedCrc = 99;
   Hdr.Crc = ComputedCrc;
+  Hdr.NumOfBytes = MM_INTERNAL_MAX_STAGED_LOAD_BYTES + 4;
   Hdr.MemType = 42;
 
   UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
@@ -675,6 +689,7 @@ void Test_MM_LoadMemFromFileCmd_EEPROM(void) {
 
   ComputedCrc = 99;
   Hdr.Crc = ComputedCrc;
+  Hdr.NumOfBytes = MM_INTERNAL_MAX_STAGED_LOAD_BYTES + 4;
   Hdr.MemType = MM_MemType_EEPROM;
 
   UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
@@ -718,6 +733,7 @@ void Test_MM_LoadMemFromFileCmd_MEM32(void) {
 
   ComputedCrc = 99;
   Hdr.Crc = ComputedCrc;
+  Hdr.NumOfBytes = MM_INTERNAL_MAX_STAGED_LOAD_BYTES + 4;
   Hdr.MemType = MM_MemType_MEM32;
 
   UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
@@ -763,6 +779,7 @@ void Test_MM_LoadMemFromFileCmd_MEM32Invalid(void) {
 
   ComputedCrc = 99;
   Hdr.Crc = ComputedCrc;
+  Hdr.NumOfBytes = MM_INTERNAL_MAX_STAGED_LOAD_BYTES + 4;
   Hdr.MemType = MM_MemType_MEM32;
 
   UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
@@ -805,6 +822,7 @@ void Test_MM_LoadMemFromFileCmd_MEM16(void) {
 
   ComputedCrc = 99;
   Hdr.Crc = ComputedCrc;
+  Hdr.NumOfBytes = MM_INTERNAL_MAX_STAGED_LOAD_BYTES + 4;
   Hdr.MemType = MM_MemType_MEM16;
 
   UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
@@ -850,6 +868,7 @@ void Test_MM_LoadMemFromFileCmd_MEM8(void) {
 
   ComputedCrc = 99;
   Hdr.Crc = ComputedCrc;
+  Hdr.NumOfBytes = MM_INTERNAL_MAX_STAGED_LOAD_BYTES + 4;
   Hdr.MemType = MM_MemType_MEM8;
 
   UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
@@ -928,8 +947,11 @@ void Test_MM_LoadMemFromFileCmd_lseekError(void) {
   uint32 ComputedCrc;
   MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
+  memset(&Hdr, 0, sizeof(MM_LoadDumpFileHeader_t));
+
   ComputedCrc = 99;
   Hdr.Crc = ComputedCrc;
+  Hdr.NumOfBytes = MM_INTERNAL_MAX_STAGED_LOAD_BYTES + 4;
 
   UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_SUCCESS);
@@ -963,8 +985,11 @@ void Test_MM_LoadMemFromFileCmd_LoadParamsError(void) {
   uint32 ComputedCrc;
   MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
+  memset(&Hdr, 0, sizeof(MM_LoadDumpFileHeader_t));
+
   ComputedCrc = 99;
   Hdr.Crc = ComputedCrc;
+  Hdr.NumOfBytes = MM_INTERNAL_MAX_STAGED_LOAD_BYTES + 4;
 
   UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_SUCCESS);
@@ -1002,8 +1027,11 @@ void Test_MM_LoadMemFromFileCmd_SymNameError(void) {
   uint32 ComputedCrc;
   MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
+  memset(&Hdr, 0, sizeof(MM_LoadDumpFileHeader_t));
+
   ComputedCrc = 99;
   Hdr.Crc = ComputedCrc;
+  Hdr.NumOfBytes = MM_INTERNAL_MAX_STAGED_LOAD_BYTES + 4;
 
   UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_SUCCESS);
@@ -1039,8 +1067,11 @@ void Test_MM_LoadMemFromFileCmd_LoadFileCRCError(void) {
   uint32 ComputedCrc;
   MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
+  memset(&Hdr, 0, sizeof(MM_LoadDumpFileHeader_t));
+
   ComputedCrc = 99;
   Hdr.Crc = ComputedCrc + 1;
+  Hdr.NumOfBytes = MM_INTERNAL_MAX_STAGED_LOAD_BYTES + 4;
 
   UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_SUCCESS);
@@ -1072,14 +1103,22 @@ void Test_MM_LoadMemFromFileCmd_LoadFileCRCError(void) {
 
 void Test_MM_LoadMemFromFileCmd_ComputeCRCError(void) {
   CFE_Status_t Result;
+  MM_LoadDumpFileHeader_t Hdr;
   MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
+  memset(&Hdr, 0, sizeof(MM_LoadDumpFileHeader_t));
+
+  Hdr.NumOfBytes = MM_INTERNAL_MAX_STAGED_LOAD_BYTES + 4;
+
   UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadFileSize), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_ComputeCRCFromFile), OS_ERROR);
   UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_SUCCESS);
 
+  UT_SetHandlerFunction(UT_KEY(MM_ReadFileHeaders),
+                        UT_Handler_MM_ReadFileHeaders, &Hdr);
+
   /* Execute the function being tested */
   Result = MM_LoadMemFromFileCmd(&LoadMemFromFileCmd);
 
@@ -1094,35 +1133,80 @@ void Test_MM_LoadMemFromFileCmd_ComputeCRCError(void) {
       "MM_ComputeCRCFromFile error received: RC = 0x%08X File = '%s'");
 }
 
-void Test_MM_LoadMemFromFileCmd_CloseError(void) {
+void Test_MM_LoadMemFromFileCmd_Staged(void) {
   CFE_Status_t Result;
+  MM_LoadDumpFileHeader_t Hdr;
+  uint32 ComputedCrc;
   MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
-  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  memset(&Hdr, 0, sizeof(MM_LoadDumpFileHeader_t));
 
-  /* Skip most of the function since it's tested elsewhere */
-  UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_ERROR);
+  ComputedCrc = 99;
+  Hdr.Crc = ComputedCrc;
+  Hdr.NumOfBytes = MM_INTERNAL_MAX_STAGED_LOAD_BYTES;
+  Hdr.MemType = MM_MemType_RAM;
 
-  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_ERROR);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadFileSize), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_StageLoadFile), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_LoadMemFromStage), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_StageLoadFile),
+                        UT_Handler_MM_ComputeCRCFromFile, &ComputedCrc);
+  UT_SetHandlerFunction(UT_KEY(MM_ReadFileHeaders),
+                        UT_Handler_MM_ReadFileHeaders, &Hdr);
 
   /* Execute the function being tested */
   Result = MM_LoadMemFromFileCmd(&LoadMemFromFileCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 2);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  /* The load file is only read once */
+  UtAssert_STUB_COUNT(MM_StageLoadFile, 1);
+  UtAssert_STUB_COUNT(MM_LoadMemFromStage, 1);
+  UtAssert_STUB_COUNT(MM_ComputeCRCFromFile, 0);
+  UtAssert_STUB_COUNT(OS_lseek, 0);
+  UtAssert_STUB_COUNT(MM_LoadMemFromFile, 0);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_OS_CLOSE_ERR_EID, CFE_EVS_EventType_ERROR,
-                       "OS_close error received: RC = 0x%08X File = '%s'");
+  MM_Test_Verify_Event(0, MM_LD_MEM_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                       "Load Memory From File Command: Loaded %d bytes to "
+                       "address %p from file '%s'");
 }
 
-void Test_MM_LoadMemFromFileCmd_OpenError(void) {
+void Test_MM_LoadMemFromFileCmd_StagedCommitError(void) {
   CFE_Status_t Result;
+  MM_LoadDumpFileHeader_t Hdr;
+  uint32 ComputedCrc;
   MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
-  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+  memset(&Hdr, 0, sizeof(MM_LoadDumpFileHeader_t));
+
+  ComputedCrc = 99;
+  Hdr.Crc = ComputedCrc;
+  Hdr.NumOfBytes = 4;
+  Hdr.MemType = MM_MemType_MEM32;
+
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadFileSize), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_StageLoadFile), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_LoadMemFromStage), CFE_PSP_ERROR);
+  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_StageLoadFile),
+                        UT_Handler_MM_ComputeCRCFromFile, &ComputedCrc);
+  UT_SetHandlerFunction(UT_KEY(MM_ReadFileHeaders),
+                        UT_Handler_MM_ReadFileHeaders, &Hdr);
 
   /* Execute the function being tested */
   Result = MM_LoadMemFromFileCmd(&LoadMemFromFileCmd);
@@ -1132,450 +1216,736 @@ void Test_MM_LoadMemFromFileCmd_OpenError(void) {
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_OS_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
-                       "OS_OpenCreate error received: RC = %d File = '%s'");
+  UtAssert_STUB_COUNT(MM_LoadMemFromStage, 1);
+  UtAssert_STUB_COUNT(MM_LoadMem32FromFile, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_MM_FillMemCmd_RAM(void) {
+/*
+ * Reads the headers of a patch load file
+ */
+void UT_Handler_MM_ReadPatchFileHeaders(void *UserObj, UT_EntryKey_t FuncKey,
+                                        const UT_StubContext_t *Context) {
+  CFE_FS_Header_t *CFEFileHeaderPtr;
+
+  CFEFileHeaderPtr =
+      UT_Hook_GetArgValueByName(Context, "CFEHeader", CFE_FS_Header_t *);
+  CFEFileHeaderPtr->SubType = MM_INTERNAL_CFE_HDR_PATCH_SUBTYPE;
+
+  UT_Handler_MM_ReadFileHeaders(UserObj, FuncKey, Context);
+}
+
+void Test_MM_LoadMemFromFileCmd_Patch(void) {
   CFE_Status_t Result;
-  MM_FillMemCmd_t FillMemCmd;
+  MM_LoadDumpFileHeader_t Hdr;
+  uint32 ComputedCrc;
+  MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
-  memset(&(FillMemCmd.Payload), 0, sizeof(MM_FillMemCmd_Payload_t));
+  memset(&Hdr, 0, sizeof(MM_LoadDumpFileHeader_t));
 
-  FillMemCmd.Payload.MemType = MM_MemType_RAM;
-  MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_FILL;
+  ComputedCrc = 99;
+  Hdr.Crc = ComputedCrc;
+  Hdr.NumOfBytes = 12;
+  Hdr.MemType = MM_MemType_RAM;
 
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadFileSize), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_StageLoadFile), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_FillMem), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_LoadPatchFromStage), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_StageLoadFile),
+                        UT_Handler_MM_ComputeCRCFromFile, &ComputedCrc);
+  UT_SetHandlerFunction(UT_KEY(MM_ReadFileHeaders),
+                        UT_Handler_MM_ReadPatchFileHeaders, &Hdr);
 
   /* Execute the function being tested */
-  Result = MM_FillMemCmd(&FillMemCmd);
+  Result = MM_LoadMemFromFileCmd(&LoadMemFromFileCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
+  /* The runs are checked when they are applied, not as one image */
+  UtAssert_STUB_COUNT(MM_StageLoadFile, 1);
+  UtAssert_STUB_COUNT(MM_VerifyLoadDumpParams, 0);
+  UtAssert_STUB_COUNT(MM_LoadPatchFromStage, 1);
+  UtAssert_STUB_COUNT(MM_LoadMemFromStage, 0);
+  UtAssert_STUB_COUNT(MM_LoadMemFromFile, 0);
+
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_FILL_INF_EID, CFE_EVS_EventType_INFORMATION,
-                       "Fill Memory Command: Filled %d bytes at address: %p "
-                       "with pattern: 0x%08X");
+  MM_Test_Verify_Event(0, MM_LD_MEM_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                       "Load Memory From File Command: Loaded %d bytes to "
+                       "address %p from file '%s'");
 }
 
-void Test_MM_FillMemCmd_EEPROM(void) {
+void Test_MM_LoadMemFromFileCmd_PatchLarge(void) {
   CFE_Status_t Result;
-  MM_FillMemCmd_t FillMemCmd;
+  MM_LoadDumpFileHeader_t Hdr;
+  MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
-  memset(&(FillMemCmd.Payload), 0, sizeof(MM_FillMemCmd_Payload_t));
+  memset(&Hdr, 0, sizeof(MM_LoadDumpFileHeader_t));
 
-  FillMemCmd.Payload.MemType = MM_MemType_EEPROM;
-  MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_FILL;
+  Hdr.NumOfBytes = MM_INTERNAL_MAX_STAGED_LOAD_BYTES + 4;
+  Hdr.MemType = MM_MemType_RAM;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_FillMem), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadFileSize), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_StageLoadFile), OS_ERROR);
+  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_ReadFileHeaders),
+                        UT_Handler_MM_ReadPatchFileHeaders, &Hdr);
 
   /* Execute the function being tested */
-  Result = MM_FillMemCmd(&FillMemCmd);
+  Result = MM_LoadMemFromFileCmd(&LoadMemFromFileCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_FILL_INF_EID, CFE_EVS_EventType_INFORMATION,
-                       "Fill Memory Command: Filled %d bytes at address: %p "
-                       "with pattern: 0x%08X");
+  /* Patch files are always staged, MM_StageLoadFile rejects large ones */
+  UtAssert_STUB_COUNT(MM_StageLoadFile, 1);
+  UtAssert_STUB_COUNT(MM_ComputeCRCFromFile, 0);
+  UtAssert_STUB_COUNT(MM_LoadPatchFromStage, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_MM_FillMemCmd_MEM32(void) {
+/*
+ * Reads the headers of a compressed load file
+ */
+void UT_Handler_MM_ReadCompressedFileHeaders(void *UserObj,
+                                             UT_EntryKey_t FuncKey,
+                                             const UT_StubContext_t *Context) {
+  CFE_FS_Header_t *CFEFileHeaderPtr;
+
+  CFEFileHeaderPtr =
+      UT_Hook_GetArgValueByName(Context, "CFEHeader", CFE_FS_Header_t *);
+  CFEFileHeaderPtr->SubType = MM_INTERNAL_CFE_HDR_COMPRESSED_SUBTYPE;
+
+  UT_Handler_MM_ReadFileHeaders(UserObj, FuncKey, Context);
+}
+
+void Test_MM_LoadMemFromFileCmd_Compressed(void) {
   CFE_Status_t Result;
-  MM_FillMemCmd_t FillMemCmd;
+  MM_LoadDumpFileHeader_t Hdr;
+  uint32 ComputedCrc;
+  MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
-  memset(&(FillMemCmd.Payload), 0, sizeof(MM_FillMemCmd_Payload_t));
+  memset(&Hdr, 0, sizeof(MM_LoadDumpFileHeader_t));
 
-  FillMemCmd.Payload.MemType = MM_MemType_MEM32;
-  MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_FILL;
+  ComputedCrc = 99;
+  Hdr.Crc = ComputedCrc;
+  Hdr.NumOfBytes = 4;
+  Hdr.MemType = MM_MemType_RAM;
 
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_LoadMemFromCompressedFile), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_lseek),
+                           sizeof(CFE_FS_Header_t) +
+                               sizeof(MM_LoadDumpFileHeader_t));
   UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_FillMem32), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_LoadMemFromCompressedFile),
+                        UT_Handler_MM_ComputeCRCFromFile, &ComputedCrc);
+  UT_SetHandlerFunction(UT_KEY(MM_ReadFileHeaders),
+                        UT_Handler_MM_ReadCompressedFileHeaders, &Hdr);
 
   /* Execute the function being tested */
-  Result = MM_FillMemCmd(&FillMemCmd);
+  Result = MM_LoadMemFromFileCmd(&LoadMemFromFileCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(MM_FillMem32, 1);
+  /*
+  ** Small compressed files are not staged, they are decompressed once to
+  ** check the CRC and again to load memory
+  */
+  UtAssert_STUB_COUNT(MM_VerifyLoadFileSize, 0);
+  UtAssert_STUB_COUNT(MM_StageLoadFile, 0);
+  UtAssert_STUB_COUNT(MM_ComputeCRCFromFile, 0);
+  UtAssert_STUB_COUNT(MM_LoadMemFromCompressedFile, 2);
+  UtAssert_STUB_COUNT(OS_lseek, 1);
+  UtAssert_STUB_COUNT(MM_LoadMemFromFile, 0);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_FILL_INF_EID, CFE_EVS_EventType_INFORMATION,
-                       "Fill Memory Command: Filled %d bytes at address: %p "
-                       "with pattern: 0x%08X");
+  MM_Test_Verify_Event(0, MM_LD_MEM_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                       "Load Memory From File Command: Loaded %d bytes to "
+                       "address %p from file '%s'");
 }
 
-void Test_MM_FillMemCmd_MEM16(void) {
+void Test_MM_LoadMemFromFileCmd_CompressedError(void) {
   CFE_Status_t Result;
-  MM_FillMemCmd_t FillMemCmd;
+  MM_LoadDumpFileHeader_t Hdr;
+  MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
-  memset(&(FillMemCmd.Payload), 0, sizeof(MM_FillMemCmd_Payload_t));
+  memset(&Hdr, 0, sizeof(MM_LoadDumpFileHeader_t));
 
-  FillMemCmd.Payload.MemType = MM_MemType_MEM16;
-  MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_FILL;
+  Hdr.NumOfBytes = 4;
+  Hdr.MemType = MM_MemType_RAM;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_FillMem16), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_LoadMemFromCompressedFile), OS_ERROR);
+  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_ReadFileHeaders),
+                        UT_Handler_MM_ReadCompressedFileHeaders, &Hdr);
 
   /* Execute the function being tested */
-  Result = MM_FillMemCmd(&FillMemCmd);
+  Result = MM_LoadMemFromFileCmd(&LoadMemFromFileCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
-  UtAssert_STUB_COUNT(MM_FillMem16, 1);
+  UtAssert_STUB_COUNT(MM_LoadMemFromCompressedFile, 1);
+  UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_FILL_INF_EID, CFE_EVS_EventType_INFORMATION,
-                       "Fill Memory Command: Filled %d bytes at address: %p "
-                       "with pattern: 0x%08X");
+  /* The read error event is sent by MM_LoadMemFromCompressedFile */
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_MM_FillMemCmd_MEM8(void) {
+void UT_Handler_MM_ReadRegionFileHeaders(void *UserObj, UT_EntryKey_t FuncKey,
+                                         const UT_StubContext_t *Context) {
+  CFE_FS_Header_t *CFEFileHeaderPtr;
+
+  CFEFileHeaderPtr =
+      UT_Hook_GetArgValueByName(Context, "CFEHeader", CFE_FS_Header_t *);
+  CFEFileHeaderPtr->SubType = MM_INTERNAL_CFE_HDR_REGION_SUBTYPE;
+
+  UT_Handler_MM_ReadFileHeaders(UserObj, FuncKey, Context);
+}
+
+void Test_MM_LoadMemFromFileCmd_Region(void) {
   CFE_Status_t Result;
-  MM_FillMemCmd_t FillMemCmd;
+  MM_LoadDumpFileHeader_t Hdr;
+  MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
-  memset(&(FillMemCmd.Payload), 0, sizeof(MM_FillMemCmd_Payload_t));
+  memset(&Hdr, 0, sizeof(MM_LoadDumpFileHeader_t));
 
-  FillMemCmd.Payload.MemType = MM_MemType_MEM8;
-  MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_FILL;
+  Hdr.NumOfBytes = 2 * sizeof(MM_LoadDumpFileHeader_t);
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_FillMem8), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_LoadRegionsFromFile), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_ReadFileHeaders),
+                        UT_Handler_MM_ReadRegionFileHeaders, &Hdr);
 
   /* Execute the function being tested */
-  Result = MM_FillMemCmd(&FillMemCmd);
+  Result = MM_LoadMemFromFileCmd(&LoadMemFromFileCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(MM_FillMem8, 1);
+  /* Region files are checked and loaded in a single pass */
+  UtAssert_STUB_COUNT(MM_LoadRegionsFromFile, 1);
+  UtAssert_STUB_COUNT(MM_VerifyLoadFileSize, 0);
+  UtAssert_STUB_COUNT(MM_StageLoadFile, 0);
+  UtAssert_STUB_COUNT(MM_ComputeCRCFromFile, 0);
+  UtAssert_STUB_COUNT(OS_lseek, 0);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_FILL_INF_EID, CFE_EVS_EventType_INFORMATION,
-                       "Fill Memory Command: Filled %d bytes at address: %p "
-                       "with pattern: 0x%08X");
+  MM_Test_Verify_Event(0, MM_LD_MEM_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                       "Load Memory From File Command: Loaded %d bytes in %u "
+                       "regions from file '%s'");
 }
 
-void Test_MM_FillMemCmd_SymNameError(void) {
+void Test_MM_LoadMemFromFileCmd_RegionError(void) {
   CFE_Status_t Result;
-  MM_FillMemCmd_t FillMemCmd;
+  MM_LoadDumpFileHeader_t Hdr;
+  MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR);
+  memset(&Hdr, 0, sizeof(MM_LoadDumpFileHeader_t));
+
+  Hdr.NumOfBytes = sizeof(MM_LoadDumpFileHeader_t);
+
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_LoadRegionsFromFile), OS_ERROR);
+  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_ReadFileHeaders),
+                        UT_Handler_MM_ReadRegionFileHeaders, &Hdr);
 
   /* Execute the function being tested */
-  Result = MM_FillMemCmd(&FillMemCmd);
+  Result = MM_LoadMemFromFileCmd(&LoadMemFromFileCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
-                       "Symbolic address can't be resolved: Name = '%s'");
+  /* The error event is sent by MM_LoadRegionsFromFile */
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_MM_FillMemCmd_NoLastActionFill(void) {
+void Test_MM_LoadMemFromFileCmd_StagedCRCError(void) {
   CFE_Status_t Result;
-  MM_FillMemCmd_t FillMemCmd;
+  MM_LoadDumpFileHeader_t Hdr;
+  uint32 ComputedCrc;
+  MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
-  memset(&(FillMemCmd.Payload), 0, sizeof(MM_FillMemCmd_Payload_t));
+  memset(&Hdr, 0, sizeof(MM_LoadDumpFileHeader_t));
 
-  FillMemCmd.Payload.MemType = MM_MemType_RAM;
-  MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_NOACTION;
+  ComputedCrc = 99;
+  Hdr.Crc = ComputedCrc + 1;
+  Hdr.NumOfBytes = 4;
+  Hdr.MemType = MM_MemType_RAM;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadFileSize), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_StageLoadFile), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_StageLoadFile),
+                        UT_Handler_MM_ComputeCRCFromFile, &ComputedCrc);
+  UT_SetHandlerFunction(UT_KEY(MM_ReadFileHeaders),
+                        UT_Handler_MM_ReadFileHeaders, &Hdr);
 
   /* Execute the function being tested */
-  Result = MM_FillMemCmd(&FillMemCmd);
+  Result = MM_LoadMemFromFileCmd(&LoadMemFromFileCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+  /* Nothing is written to memory when the CRC doesn't match */
+  UtAssert_STUB_COUNT(MM_LoadMemFromStage, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_LOAD_FILE_CRC_ERR_EID, CFE_EVS_EventType_ERROR,
+      "Load file CRC failure: Expected = 0x%X Calculated = 0x%X File = '%s'");
 }
 
-void Test_MM_FillMemCmd_NoVerifyLoadDump(void) {
+void Test_MM_LoadMemFromFileCmd_StageError(void) {
   CFE_Status_t Result;
-  MM_FillMemCmd_t FillMemCmd;
+  MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_ERROR);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadFileSize), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_StageLoadFile), OS_ERROR);
+  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_SUCCESS);
 
   /* Execute the function being tested */
-  Result = MM_FillMemCmd(&FillMemCmd);
+  Result = MM_LoadMemFromFileCmd(&LoadMemFromFileCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
+  UtAssert_STUB_COUNT(MM_LoadMemFromStage, 0);
+
+  /* The read error event is sent by MM_StageLoadFile */
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_MM_FillMemCmd_BadType(void) {
+void Test_MM_LoadMemFromFileCmd_CloseError(void) {
   CFE_Status_t Result;
-  MM_FillMemCmd_t FillMemCmd;
+  MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
-  memset(&(FillMemCmd.Payload), 0, sizeof(MM_FillMemCmd_Payload_t));
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
 
-  FillMemCmd.Payload.MemType = 99;
-  FillMemCmd.Payload.NumOfBytes = 1;
+  /* Skip most of the function since it's tested elsewhere */
+  UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), OS_ERROR);
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_ERROR);
 
   /* Execute the function being tested */
-  Result = MM_FillMemCmd(&FillMemCmd);
+  Result = MM_LoadMemFromFileCmd(&LoadMemFromFileCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 2);
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_OS_CLOSE_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "OS_close error received: RC = 0x%08X File = '%s'");
 }
 
-void Test_MM_PeekCmd_Nominal(void) {
+void Test_MM_LoadMemFromFileCmd_OpenError(void) {
   CFE_Status_t Result;
-  MM_PeekCmd_t PeekCmd;
+  MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyPeekPokeParams), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_PeekMem), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
 
   /* Execute the function being tested */
-  Result = MM_PeekCmd(&PeekCmd);
+  Result = MM_LoadMemFromFileCmd(&LoadMemFromFileCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_OS_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "OS_OpenCreate error received: RC = %d File = '%s'");
 }
 
-void Test_MM_PeekCmd_SymNameError(void) {
+void Test_MM_FillMemCmd_RAM(void) {
   CFE_Status_t Result;
-  MM_PeekCmd_t PeekCmd;
+  MM_FillMemCmd_t FillMemCmd;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR_NAME_LENGTH);
+  memset(&(FillMemCmd.Payload), 0, sizeof(MM_FillMemCmd_Payload_t));
+
+  FillMemCmd.Payload.MemType = MM_MemType_RAM;
+  MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_FILL;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_FillMem), CFE_PSP_SUCCESS);
 
   /* Execute the function being tested */
-  Result = MM_PeekCmd(&PeekCmd);
+  Result = MM_FillMemCmd(&FillMemCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
-                       "Symbolic address can't be resolved: Name = '%s'");
+  MM_Test_Verify_Event(0, MM_FILL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                       "Fill Memory Command: Filled %d bytes at address: %p "
+                       "with pattern: 0x%08X");
 }
 
-void Test_MM_PeekCmd_NoVerifyPeekPokeParams(void) {
+void Test_MM_FillMemCmd_EEPROM(void) {
   CFE_Status_t Result;
-  MM_PeekCmd_t PeekCmd;
+  MM_FillMemCmd_t FillMemCmd;
+
+  memset(&(FillMemCmd.Payload), 0, sizeof(MM_FillMemCmd_Payload_t));
+
+  FillMemCmd.Payload.MemType = MM_MemType_EEPROM;
+  MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_FILL;
 
   UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyPeekPokeParams), OS_ERROR);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_FillMem), CFE_PSP_SUCCESS);
 
   /* Execute the function being tested */
-  Result = MM_PeekCmd(&PeekCmd);
+  Result = MM_FillMemCmd(&FillMemCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_FILL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                       "Fill Memory Command: Filled %d bytes at address: %p "
+                       "with pattern: 0x%08X");
 }
 
-void Test_MM_PeekCmd_PeekErr(void) {
+void Test_MM_FillMemCmd_MEM32(void) {
   CFE_Status_t Result;
-  MM_PeekCmd_t PeekCmd;
+  MM_FillMemCmd_t FillMemCmd;
+
+  memset(&(FillMemCmd.Payload), 0, sizeof(MM_FillMemCmd_Payload_t));
+
+  FillMemCmd.Payload.MemType = MM_MemType_MEM32;
+  MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_FILL;
 
   UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyPeekPokeParams), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_PeekMem), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_FillMem32), CFE_PSP_SUCCESS);
 
   /* Execute the function being tested */
-  Result = MM_PeekCmd(&PeekCmd);
+  Result = MM_FillMemCmd(&FillMemCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+  UtAssert_STUB_COUNT(MM_FillMem32, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_FILL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                       "Fill Memory Command: Filled %d bytes at address: %p "
+                       "with pattern: 0x%08X");
 }
 
-void Test_MM_DumpMemToFileCmd_RAM(void) {
+void Test_MM_FillMemCmd_MEM16(void) {
   CFE_Status_t Result;
-  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
-  cpuaddr SymAddr;
+  MM_FillMemCmd_t FillMemCmd;
 
-  memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
+  memset(&(FillMemCmd.Payload), 0, sizeof(MM_FillMemCmd_Payload_t));
 
-  SymAddr = 0x42;
-  DumpMemToFileCmd.Payload.MemType = MM_MemType_RAM;
-  DumpMemToFileCmd.Payload.NumOfBytes = 50;
-  strncpy(DumpMemToFileCmd.Payload.FileName, "filename_RAM",
-          sizeof(DumpMemToFileCmd.Payload.FileName) - 1);
+  FillMemCmd.Payload.MemType = MM_MemType_MEM16;
+  MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_FILL;
 
   UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMemToFile), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_lseek),
-                           sizeof(CFE_FS_Header_t) +
-                               sizeof(MM_LoadDumpFileHeader_t));
-  UT_SetDefaultReturnValue(UT_KEY(MM_ComputeCRCFromFile), OS_SUCCESS);
-  /* Second call to MM_WriteFileHeaders will also return OS_SUCCESS as set above
-   */
-
-  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
-                        &SymAddr);
+  UT_SetDefaultReturnValue(UT_KEY(MM_FillMem16), CFE_PSP_SUCCESS);
 
   /* Execute the function being tested */
-  Result = MM_DumpMemToFileCmd(&(DumpMemToFileCmd));
-
-  /* Verify the results */
-  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
-                    MM_LastAction_DUMP_TO_FILE);
-  UtAssert_EQ(MM_MemType_Enum_t, MM_AppData.HkTlm.Payload.MemType,
-              DumpMemToFileCmd.Payload.MemType);
-  UtAssert_ADDRESS_EQ(
-      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), SymAddr);
-  UtAssert_EQ(size_t, MM_AppData.HkTlm.Payload.BytesProcessed,
-              DumpMemToFileCmd.Payload.NumOfBytes);
-  UtAssert_StrCmp(MM_AppData.HkTlm.Payload.FileName,
-                  DumpMemToFileCmd.Payload.FileName, "Expected '%s' == '%s",
-                  MM_AppData.HkTlm.Payload.FileName,
-                  DumpMemToFileCmd.Payload.FileName);
+  Result = MM_FillMemCmd(&FillMemCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(MM_DumpMemToFile, 1);
+  UtAssert_STUB_COUNT(MM_FillMem16, 1);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_DMP_MEM_FILE_INF_EID,
-                       CFE_EVS_EventType_INFORMATION,
-                       "Dump Memory To File Command: Dumped %d bytes from "
-                       "address %p to file '%s'");
+  MM_Test_Verify_Event(0, MM_FILL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                       "Fill Memory Command: Filled %d bytes at address: %p "
+                       "with pattern: 0x%08X");
 }
 
-void Test_MM_DumpMemToFileCmd_EEPROM(void) {
+void Test_MM_FillMemCmd_MEM8(void) {
   CFE_Status_t Result;
-  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
-  cpuaddr SymAddr;
+  MM_FillMemCmd_t FillMemCmd;
 
-  memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
+  memset(&(FillMemCmd.Payload), 0, sizeof(MM_FillMemCmd_Payload_t));
 
-  SymAddr = 0x42;
-  DumpMemToFileCmd.Payload.MemType = MM_MemType_EEPROM;
-  DumpMemToFileCmd.Payload.NumOfBytes = 40;
-  strncpy(DumpMemToFileCmd.Payload.FileName, "filename_EEPROM",
-          sizeof(DumpMemToFileCmd.Payload.FileName) - 1);
+  FillMemCmd.Payload.MemType = MM_MemType_MEM8;
+  MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_FILL;
 
   UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMemToFile), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_lseek),
-                           sizeof(CFE_FS_Header_t) +
-                               sizeof(MM_LoadDumpFileHeader_t));
-  UT_SetDefaultReturnValue(UT_KEY(MM_ComputeCRCFromFile), OS_SUCCESS);
-  /* Second call to MM_WriteFileHeaders will also return OS_SUCCESS as set above
-   */
-
-  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
-                        &SymAddr);
+  UT_SetDefaultReturnValue(UT_KEY(MM_FillMem8), CFE_PSP_SUCCESS);
 
   /* Execute the function being tested */
-  Result = MM_DumpMemToFileCmd(&(DumpMemToFileCmd));
-
-  /* Verify the results */
-  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
-                    MM_LastAction_DUMP_TO_FILE);
-  UtAssert_EQ(MM_MemType_Enum_t, MM_AppData.HkTlm.Payload.MemType,
-              DumpMemToFileCmd.Payload.MemType);
-  UtAssert_ADDRESS_EQ(
-      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), SymAddr);
-  UtAssert_EQ(size_t, MM_AppData.HkTlm.Payload.BytesProcessed,
-              DumpMemToFileCmd.Payload.NumOfBytes);
-  UtAssert_StrCmp(MM_AppData.HkTlm.Payload.FileName,
-                  DumpMemToFileCmd.Payload.FileName, "Expected '%s' == '%s",
-                  MM_AppData.HkTlm.Payload.FileName,
-                  DumpMemToFileCmd.Payload.FileName);
+  Result = MM_FillMemCmd(&FillMemCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(MM_DumpMemToFile, 1);
+  UtAssert_STUB_COUNT(MM_FillMem8, 1);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_DMP_MEM_FILE_INF_EID,
-                       CFE_EVS_EventType_INFORMATION,
-                       "Dump Memory To File Command: Dumped %d bytes from "
-                       "address %p to file '%s'");
+  MM_Test_Verify_Event(0, MM_FILL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                       "Fill Memory Command: Filled %d bytes at address: %p "
+                       "with pattern: 0x%08X");
 }
 
-void Test_MM_DumpMemToFileCmd_MEM32(void) {
+void Test_MM_FillMemCmd_SymNameError(void) {
   CFE_Status_t Result;
-  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
+  MM_FillMemCmd_t FillMemCmd;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_FillMemCmd(&FillMemCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Symbolic address can't be resolved: Name = '%s'");
+}
+
+void Test_MM_FillMemCmd_NoLastActionFill(void) {
+  CFE_Status_t Result;
+  MM_FillMemCmd_t FillMemCmd;
+
+  memset(&(FillMemCmd.Payload), 0, sizeof(MM_FillMemCmd_Payload_t));
+
+  FillMemCmd.Payload.MemType = MM_MemType_RAM;
+  MM_AppData.HkTlm.Payload.LastAction = MM_LastAction_NOACTION;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+
+  /* Execute the function being tested */
+  Result = MM_FillMemCmd(&FillMemCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_FillMemCmd_NoVerifyLoadDump(void) {
+  CFE_Status_t Result;
+  MM_FillMemCmd_t FillMemCmd;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_FillMemCmd(&FillMemCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_FillMemCmd_PatternError(void) {
+  CFE_Status_t Result;
+  MM_FillMemCmd_t FillMemCmd;
+
+  memset(&(FillMemCmd.Payload), 0, sizeof(MM_FillMemCmd_Payload_t));
+
+  FillMemCmd.Payload.MemType = MM_MemType_RAM;
+  FillMemCmd.Payload.PatternSize = 3;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyFillPattern), OS_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_FillMemCmd(&FillMemCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_FillMem, 0);
+}
+
+void Test_MM_FillMemCmd_BadType(void) {
+  CFE_Status_t Result;
+  MM_FillMemCmd_t FillMemCmd;
+
+  memset(&(FillMemCmd.Payload), 0, sizeof(MM_FillMemCmd_Payload_t));
+
+  FillMemCmd.Payload.MemType = 99;
+  FillMemCmd.Payload.NumOfBytes = 1;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+
+  /* Execute the function being tested */
+  Result = MM_FillMemCmd(&FillMemCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_PeekCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_PeekCmd_t PeekCmd;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyPeekPokeParams), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_PeekMem), CFE_PSP_SUCCESS);
+
+  /* Execute the function being tested */
+  Result = MM_PeekCmd(&PeekCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_PeekCmd_SymNameError(void) {
+  CFE_Status_t Result;
+  MM_PeekCmd_t PeekCmd;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR_NAME_LENGTH);
+
+  /* Execute the function being tested */
+  Result = MM_PeekCmd(&PeekCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Symbolic address can't be resolved: Name = '%s'");
+}
+
+void Test_MM_PeekCmd_NoVerifyPeekPokeParams(void) {
+  CFE_Status_t Result;
+  MM_PeekCmd_t PeekCmd;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyPeekPokeParams), OS_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_PeekCmd(&PeekCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_PeekCmd_PeekErr(void) {
+  CFE_Status_t Result;
+  MM_PeekCmd_t PeekCmd;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyPeekPokeParams), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_PeekMem), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+
+  /* Execute the function being tested */
+  Result = MM_PeekCmd(&PeekCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_DumpMemToFileCmd_RAM(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
   cpuaddr SymAddr;
 
   memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
 
   SymAddr = 0x42;
-  DumpMemToFileCmd.Payload.MemType = MM_MemType_MEM32;
-  DumpMemToFileCmd.Payload.NumOfBytes = 32;
-  strncpy(DumpMemToFileCmd.Payload.FileName, "filename_32",
+  DumpMemToFileCmd.Payload.MemType = MM_MemType_RAM;
+  DumpMemToFileCmd.Payload.NumOfBytes = 50;
+  strncpy(DumpMemToFileCmd.Payload.FileName, "filename_RAM",
           sizeof(DumpMemToFileCmd.Payload.FileName) - 1);
 
   UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMem32ToFile), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_lseek),
-                           sizeof(CFE_FS_Header_t) +
-                               sizeof(MM_LoadDumpFileHeader_t));
-  UT_SetDefaultReturnValue(UT_KEY(MM_ComputeCRCFromFile), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMemToFile), CFE_PSP_SUCCESS);
   /* Second call to MM_WriteFileHeaders will also return OS_SUCCESS as set above
    */
 
@@ -1604,7 +1974,12 @@ void Test_MM_DumpMemToFileCmd_MEM32(void) {
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(MM_DumpMem32ToFile, 1);
+  UtAssert_STUB_COUNT(MM_DumpMemToFile, 1);
+
+  /* The CRC comes from the dump itself, the file is never read back */
+  UtAssert_STUB_COUNT(MM_ComputeCRCFromFile, 0);
+  UtAssert_STUB_COUNT(OS_lseek, 0);
+  UtAssert_STUB_COUNT(MM_WriteFileHeaders, 2);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
   MM_Test_Verify_Event(0, MM_DMP_MEM_FILE_INF_EID,
@@ -1613,7 +1988,7 @@ void Test_MM_DumpMemToFileCmd_MEM32(void) {
                        "address %p to file '%s'");
 }
 
-void Test_MM_DumpMemToFileCmd_MEM16(void) {
+void Test_MM_DumpMemToFileCmd_EEPROM(void) {
   CFE_Status_t Result;
   MM_DumpMemToFileCmd_t DumpMemToFileCmd;
   cpuaddr SymAddr;
@@ -1621,20 +1996,16 @@ void Test_MM_DumpMemToFileCmd_MEM16(void) {
   memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
 
   SymAddr = 0x42;
-  DumpMemToFileCmd.Payload.MemType = MM_MemType_MEM16;
-  DumpMemToFileCmd.Payload.NumOfBytes = 16;
-  strncpy(DumpMemToFileCmd.Payload.FileName, "filename_16",
+  DumpMemToFileCmd.Payload.MemType = MM_MemType_EEPROM;
+  DumpMemToFileCmd.Payload.NumOfBytes = 40;
+  strncpy(DumpMemToFileCmd.Payload.FileName, "filename_EEPROM",
           sizeof(DumpMemToFileCmd.Payload.FileName) - 1);
 
   UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMem16ToFile), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_lseek),
-                           sizeof(CFE_FS_Header_t) +
-                               sizeof(MM_LoadDumpFileHeader_t));
-  UT_SetDefaultReturnValue(UT_KEY(MM_ComputeCRCFromFile), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMemToFile), CFE_PSP_SUCCESS);
   /* Second call to MM_WriteFileHeaders will also return OS_SUCCESS as set above
    */
 
@@ -1663,7 +2034,7 @@ void Test_MM_DumpMemToFileCmd_MEM16(void) {
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(MM_DumpMem16ToFile, 1);
+  UtAssert_STUB_COUNT(MM_DumpMemToFile, 1);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
   MM_Test_Verify_Event(0, MM_DMP_MEM_FILE_INF_EID,
@@ -1672,7 +2043,7 @@ void Test_MM_DumpMemToFileCmd_MEM16(void) {
                        "address %p to file '%s'");
 }
 
-void Test_MM_DumpMemToFileCmd_MEM8(void) {
+void Test_MM_DumpMemToFileCmd_MEM32(void) {
   CFE_Status_t Result;
   MM_DumpMemToFileCmd_t DumpMemToFileCmd;
   cpuaddr SymAddr;
@@ -1680,20 +2051,16 @@ void Test_MM_DumpMemToFileCmd_MEM8(void) {
   memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
 
   SymAddr = 0x42;
-  DumpMemToFileCmd.Payload.MemType = MM_MemType_MEM8;
-  DumpMemToFileCmd.Payload.NumOfBytes = 8;
-  strncpy(DumpMemToFileCmd.Payload.FileName, "filename_8",
+  DumpMemToFileCmd.Payload.MemType = MM_MemType_MEM32;
+  DumpMemToFileCmd.Payload.NumOfBytes = 32;
+  strncpy(DumpMemToFileCmd.Payload.FileName, "filename_32",
           sizeof(DumpMemToFileCmd.Payload.FileName) - 1);
 
   UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
   UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMem8ToFile), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_lseek),
-                           sizeof(CFE_FS_Header_t) +
-                               sizeof(MM_LoadDumpFileHeader_t));
-  UT_SetDefaultReturnValue(UT_KEY(MM_ComputeCRCFromFile), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMem32ToFile), CFE_PSP_SUCCESS);
   /* Second call to MM_WriteFileHeaders will also return OS_SUCCESS as set above
    */
 
@@ -1722,98 +2089,3016 @@ void Test_MM_DumpMemToFileCmd_MEM8(void) {
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(MM_DumpMem8ToFile, 1);
+  UtAssert_STUB_COUNT(MM_DumpMem32ToFile, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_DMP_MEM_FILE_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Dump Memory To File Command: Dumped %d bytes from "
+                       "address %p to file '%s'");
+}
+
+void Test_MM_DumpMemToFileCmd_MEM16(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
+  cpuaddr SymAddr;
+
+  memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
+
+  SymAddr = 0x42;
+  DumpMemToFileCmd.Payload.MemType = MM_MemType_MEM16;
+  DumpMemToFileCmd.Payload.NumOfBytes = 16;
+  strncpy(DumpMemToFileCmd.Payload.FileName, "filename_16",
+          sizeof(DumpMemToFileCmd.Payload.FileName) - 1);
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMem16ToFile), CFE_PSP_SUCCESS);
+  /* Second call to MM_WriteFileHeaders will also return OS_SUCCESS as set above
+   */
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToFileCmd(&(DumpMemToFileCmd));
+
+  /* Verify the results */
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_DUMP_TO_FILE);
+  UtAssert_EQ(MM_MemType_Enum_t, MM_AppData.HkTlm.Payload.MemType,
+              DumpMemToFileCmd.Payload.MemType);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), SymAddr);
+  UtAssert_EQ(size_t, MM_AppData.HkTlm.Payload.BytesProcessed,
+              DumpMemToFileCmd.Payload.NumOfBytes);
+  UtAssert_StrCmp(MM_AppData.HkTlm.Payload.FileName,
+                  DumpMemToFileCmd.Payload.FileName, "Expected '%s' == '%s",
+                  MM_AppData.HkTlm.Payload.FileName,
+                  DumpMemToFileCmd.Payload.FileName);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_DumpMem16ToFile, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_DMP_MEM_FILE_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Dump Memory To File Command: Dumped %d bytes from "
+                       "address %p to file '%s'");
+}
+
+void Test_MM_DumpMemToFileCmd_MEM8(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
+  cpuaddr SymAddr;
+
+  memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
+
+  SymAddr = 0x42;
+  DumpMemToFileCmd.Payload.MemType = MM_MemType_MEM8;
+  DumpMemToFileCmd.Payload.NumOfBytes = 8;
+  strncpy(DumpMemToFileCmd.Payload.FileName, "filename_8",
+          sizeof(DumpMemToFileCmd.Payload.FileName) - 1);
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMem8ToFile), CFE_PSP_SUCCESS);
+  /* Second call to MM_WriteFileHeaders will also return OS_SUCCESS as set above
+   */
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToFileCmd(&(DumpMemToFileCmd));
+
+  /* Verify the results */
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_DUMP_TO_FILE);
+  UtAssert_EQ(MM_MemType_Enum_t, MM_AppData.HkTlm.Payload.MemType,
+              DumpMemToFileCmd.Payload.MemType);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), SymAddr);
+  UtAssert_EQ(size_t, MM_AppData.HkTlm.Payload.BytesProcessed,
+              DumpMemToFileCmd.Payload.NumOfBytes);
+  UtAssert_StrCmp(MM_AppData.HkTlm.Payload.FileName,
+                  DumpMemToFileCmd.Payload.FileName, "Expected '%s' == '%s",
+                  MM_AppData.HkTlm.Payload.FileName,
+                  DumpMemToFileCmd.Payload.FileName);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_DumpMem8ToFile, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_DMP_MEM_FILE_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Dump Memory To File Command: Dumped %d bytes from "
+                       "address %p to file '%s'");
+}
+
+void Test_MM_DumpMemToCompressedFileCmd_RAM(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToCompressedFileCmd_t DumpCmd;
+  cpuaddr SymAddr;
+
+  memset(&(DumpCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
+
+  SymAddr = 0x42;
+  DumpCmd.Payload.MemType = MM_MemType_RAM;
+  DumpCmd.Payload.NumOfBytes = 50;
+  strncpy(DumpCmd.Payload.FileName, "filename_RLE",
+          sizeof(DumpCmd.Payload.FileName) - 1);
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMemToCompressedFile), OS_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToCompressedFileCmd(&DumpCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_EQ(size_t, MM_AppData.HkTlm.Payload.BytesProcessed,
+              DumpCmd.Payload.NumOfBytes);
+
+  UtAssert_STUB_COUNT(MM_DumpMemToCompressedFile, 1);
+  UtAssert_STUB_COUNT(MM_DumpMemToFile, 0);
+  UtAssert_STUB_COUNT(MM_WriteFileHeaders, 2);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_DMP_MEM_FILE_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Dump Memory To File Command: Dumped %d bytes from "
+                       "address %p to file '%s'");
+}
+
+void Test_MM_DumpMemToCompressedFileCmd_BadType(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToCompressedFileCmd_t DumpCmd;
+
+  memset(&(DumpCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
+
+  DumpCmd.Payload.MemType = MM_MemType_MEM32;
+  DumpCmd.Payload.NumOfBytes = 8;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToCompressedFileCmd(&DumpCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  /* The dump file is not created */
+  UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_COMPRESS_MEMTYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Compressed dump not supported for MemType = %d");
+}
+
+void Test_MM_DumpRegionsToFileCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_DumpRegionsToFileCmd_t DumpCmd;
+  cpuaddr SymAddr;
+
+  memset(&(DumpCmd.Payload), 0, sizeof(DumpCmd.Payload));
+
+  SymAddr = 0x42;
+  DumpCmd.Payload.NumRegions = 2;
+  DumpCmd.Payload.Regions[0].MemType = MM_MemType_RAM;
+  DumpCmd.Payload.Regions[0].NumOfBytes = 50;
+  DumpCmd.Payload.Regions[1].MemType = MM_MemType_MEM32;
+  DumpCmd.Payload.Regions[1].NumOfBytes = 8;
+  strncpy(DumpCmd.Payload.FileName, "filename_regions",
+          sizeof(DumpCmd.Payload.FileName) - 1);
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_DumpRegionsToFile), OS_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+
+  /* Execute the function being tested */
+  Result = MM_DumpRegionsToFileCmd(&DumpCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_EQ(size_t, MM_AppData.HkTlm.Payload.BytesProcessed, 58);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.MemType, MM_MemType_RAM);
+
+  /* The directory holds the resolved regions */
+  UtAssert_UINT32_EQ(MM_AppData.RegionDir[1].MemType, MM_MemType_MEM32);
+  UtAssert_UINT32_EQ(MM_AppData.RegionDir[1].NumOfBytes, 8);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.RegionDir[1].SymAddress.Offset),
+      SymAddr);
+
+  /* One file holds every region */
+  UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+  UtAssert_STUB_COUNT(MM_DumpRegionsToFile, 1);
+  UtAssert_STUB_COUNT(OS_close, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_DMP_MEM_FILE_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Dump Memory To File Command: Dumped %d bytes in %u "
+                       "regions to file '%s'");
+}
+
+void Test_MM_DumpRegionsToFileCmd_BadCount(void) {
+  CFE_Status_t Result;
+  MM_DumpRegionsToFileCmd_t DumpCmd;
+
+  memset(&(DumpCmd.Payload), 0, sizeof(DumpCmd.Payload));
+
+  DumpCmd.Payload.NumRegions = MM_INTERFACE_MAX_DUMP_REGIONS + 1;
+
+  /* Execute the function being tested */
+  Result = MM_DumpRegionsToFileCmd(&DumpCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+  UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Region dump count invalid: Regions = %u Max = %u");
+}
+
+void Test_MM_DumpRegionsToFileCmd_VerifyParamsError(void) {
+  CFE_Status_t Result;
+  MM_DumpRegionsToFileCmd_t DumpCmd;
+
+  memset(&(DumpCmd.Payload), 0, sizeof(DumpCmd.Payload));
+
+  DumpCmd.Payload.NumRegions = 2;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDeferredRetcode(UT_KEY(MM_VerifyLoadDumpParams), 2, CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_DumpRegionsToFileCmd(&DumpCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  /* The dump file is not created when any region is invalid */
+  UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Region %u failed parameters check: File = '%s'");
+}
+
+void Test_MM_DumpRegionsToFileCmd_DumpError(void) {
+  CFE_Status_t Result;
+  MM_DumpRegionsToFileCmd_t DumpCmd;
+
+  memset(&(DumpCmd.Payload), 0, sizeof(DumpCmd.Payload));
+
+  DumpCmd.Payload.NumRegions = 1;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_DumpRegionsToFile), OS_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_DumpRegionsToFileCmd(&DumpCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  /* The file is closed and the write error was reported by the engine */
+  UtAssert_STUB_COUNT(OS_close, 1);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_DumpMemToFileCmd_CloseError(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
+
+  memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
+
+  DumpMemToFileCmd.Payload.MemType = MM_MemType_MEM8;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_MemValidateRange), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMem8ToFile), CFE_PSP_SUCCESS);
+
+  /* Set to generate error message MM_OS_CLOSE_ERR_EID */
+  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+
+  MM_Test_Verify_Event(0, MM_DMP_MEM_FILE_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Dump Memory To File Command: Dumped %d bytes from "
+                       "address %p to file '%s'");
+
+  MM_Test_Verify_Event(1, MM_OS_CLOSE_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "OS_close error received: RC = 0x%08X File = '%s'");
+}
+
+void Test_MM_DumpMemToFileCmd_CreatError(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_OS_CREAT_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "OS_OpenCreate error received: RC = %d File = '%s'");
+}
+
+void Test_MM_DumpMemToFileCmd_InvalidDumpResult(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
+
+  memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
+
+  DumpMemToFileCmd.Payload.MemType = MM_MemType_MEM8;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMem8ToFile),
+                           CFE_PSP_ERROR_NOT_IMPLEMENTED);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_DumpMemToFileCmd_SymNameError(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Symbolic address can't be resolved: Name = '%s'");
+}
+
+void Test_MM_DumpMemToFileCmd_NoVerifyDumpParams(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_DumpMemToFileCmd_NoWriteHeaders(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_ERR_INVALID_SIZE);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+}
+
+void Test_MM_DumpMemToFileCmd_BadType(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
+
+  memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
+
+  DumpMemToFileCmd.Payload.MemType = 99;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_SUCCESS);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_DumpMemToFileCmd_ReWriteHeadersErr(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
+  cpuaddr SymAddr;
+
+  memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
+
+  SymAddr = 0x42;
+  DumpMemToFileCmd.Payload.MemType = MM_MemType_RAM;
+  DumpMemToFileCmd.Payload.NumOfBytes = 50;
+  strncpy(DumpMemToFileCmd.Payload.FileName, "filename_RAM",
+          sizeof(DumpMemToFileCmd.Payload.FileName) - 1);
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
+  UT_SetDeferredRetcode(UT_KEY(MM_WriteFileHeaders), 2, OS_ERR_INVALID_SIZE);
+  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMemToFile), CFE_PSP_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToFileCmd(&(DumpMemToFileCmd));
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_DumpInEventCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_DumpInEventCmd_t DumpInEventCmd;
+  cpuaddr SymAddr;
+
+  memset(&(DumpInEventCmd.Payload), 0, sizeof(MM_DumpInEventCmd_Payload_t));
+
+  SymAddr = 0x42;
+  DumpInEventCmd.Payload.NumOfBytes = 1;
+  DumpInEventCmd.Payload.MemType = MM_MemType_EEPROM;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_FillDumpInEventBuffer), CFE_PSP_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+
+  /* Execute the function being tested */
+  Result = MM_DumpInEventCmd(&DumpInEventCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_DUMP_INEVENT);
+  UtAssert_EQ(MM_MemType_Enum_t, MM_AppData.HkTlm.Payload.MemType,
+              DumpInEventCmd.Payload.MemType);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), SymAddr);
+  UtAssert_EQ(size_t, MM_AppData.HkTlm.Payload.BytesProcessed,
+              DumpInEventCmd.Payload.NumOfBytes);
+
+  UtAssert_STUB_COUNT(MM_FormatHexBytes, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_DUMP_INEVENT_INF_EID,
+                       CFE_EVS_EventType_INFORMATION, "%s");
+}
+
+void Test_MM_DumpInEventCmd_SymNameError(void) {
+  CFE_Status_t Result;
+  MM_DumpInEventCmd_t DumpInEventCmd;
+
+  /* Set to generate error message MM_SYMNAME_ERR_EID */
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR_NAME_LENGTH);
+
+  /* Execute the function being tested */
+  Result = MM_DumpInEventCmd(&DumpInEventCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Symbolic address can't be resolved: Name = '%s'");
+}
+
+void Test_MM_DumpInEventCmd_NoVerifyDumpParams(void) {
+  CFE_Status_t Result;
+  MM_DumpInEventCmd_t DumpInEventCmd;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_DumpInEventCmd(&DumpInEventCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_DumpInEventCmd_FillDumpInvalid(void) {
+  CFE_Status_t Result;
+  MM_DumpInEventCmd_t DumpInEventCmd;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_FillDumpInEventBuffer),
+                           CFE_PSP_ERROR_NOT_IMPLEMENTED);
+
+  /* Execute the function being tested */
+  Result = MM_DumpInEventCmd(&DumpInEventCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  /* Error event is issued in MM_FillDumpInEventBuffer and thus not visible here
+   */
+}
+
+void Test_MM_DumpMemToTlmCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToTlmCmd_t DumpMemToTlmCmd;
+  cpuaddr SymAddr;
+
+  memset(&DumpMemToTlmCmd, 0, sizeof(DumpMemToTlmCmd));
+
+  SymAddr = 0x42;
+  DumpMemToTlmCmd.Payload.NumOfBytes = (2 * MM_INTERFACE_MAX_DUMP_TLM_DATA) + 4;
+  DumpMemToTlmCmd.Payload.MemType = MM_MemType_RAM;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), OS_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToTlmCmd(&DumpMemToTlmCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_DUMP_TO_TLM);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), SymAddr);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed,
+                     DumpMemToTlmCmd.Payload.NumOfBytes);
+
+  /* The packets are only sent on the following housekeeping requests */
+  UtAssert_ADDRESS_EQ(MM_AppData.DumpTlmState.Address, SymAddr);
+  UtAssert_UINT32_EQ(MM_AppData.DumpTlmState.BytesRemaining,
+                     DumpMemToTlmCmd.Payload.NumOfBytes);
+  UtAssert_UINT32_EQ(MM_AppData.DumpTlmState.Sequence, 0);
+  UtAssert_STUB_COUNT(MM_SendDumpTlm, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_DUMP_TLM_INF_EID, CFE_EVS_EventType_INFORMATION,
+                       "Dump Memory To Telemetry Command: Dumping %u bytes "
+                       "from address %p in %u packets");
+}
+
+void Test_MM_DumpMemToTlmCmd_InProgress(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToTlmCmd_t DumpMemToTlmCmd;
+
+  memset(&DumpMemToTlmCmd, 0, sizeof(DumpMemToTlmCmd));
+
+  /* Another dump to telemetry still has bytes to send */
+  MM_AppData.DumpTlmState.BytesRemaining = 8;
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToTlmCmd(&DumpMemToTlmCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_UINT32_EQ(MM_AppData.DumpTlmState.BytesRemaining, 8);
+  UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_DUMP_TLM_ERR_EID, CFE_EVS_EventType_ERROR,
+      "Dump to telemetry already in progress: Bytes remaining = %u");
+}
+
+void Test_MM_DumpMemToTlmCmd_SymNameError(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToTlmCmd_t DumpMemToTlmCmd;
+
+  memset(&DumpMemToTlmCmd, 0, sizeof(DumpMemToTlmCmd));
+
+  /* Set to generate error message MM_SYMNAME_ERR_EID */
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR_NAME_LENGTH);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToTlmCmd(&DumpMemToTlmCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_UINT32_EQ(MM_AppData.DumpTlmState.BytesRemaining, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Symbolic address can't be resolved: Name = '%s'");
+}
+
+void Test_MM_DumpMemToTlmCmd_NoVerifyDumpParams(void) {
+  CFE_Status_t Result;
+  MM_DumpMemToTlmCmd_t DumpMemToTlmCmd;
+
+  memset(&DumpMemToTlmCmd, 0, sizeof(DumpMemToTlmCmd));
+  DumpMemToTlmCmd.Payload.NumOfBytes = 4;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToTlmCmd(&DumpMemToTlmCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_UINT32_EQ(MM_AppData.DumpTlmState.BytesRemaining, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_DumpInTlmCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_DumpInTlmCmd_t DumpInTlmCmd;
+  cpuaddr SymAddr;
+
+  memset(&DumpInTlmCmd, 0, sizeof(DumpInTlmCmd));
+
+  SymAddr = 0x42;
+  DumpInTlmCmd.Payload.NumOfBytes = 12;
+  DumpInTlmCmd.Payload.MemType = MM_MemType_RAM;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_ReadMemToBuffer), CFE_PSP_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+
+  /* Execute the function being tested */
+  Result = MM_DumpInTlmCmd(&DumpInTlmCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_DUMP_INTLM);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), SymAddr);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed, 12);
+
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.DumpInTlm.Payload.Address), SymAddr);
+  UtAssert_UINT8_EQ(MM_AppData.DumpInTlm.Payload.MemType, MM_MemType_RAM);
+  UtAssert_UINT32_EQ(MM_AppData.DumpInTlm.Payload.NumOfBytes, 12);
+  UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_DUMP_INTLM_DBG_EID, CFE_EVS_EventType_DEBUG,
+                       "Dump In Telemetry Command: Sent %u bytes from "
+                       "address %p");
+}
+
+void Test_MM_DumpInTlmCmd_SymNameError(void) {
+  CFE_Status_t Result;
+  MM_DumpInTlmCmd_t DumpInTlmCmd;
+
+  memset(&DumpInTlmCmd, 0, sizeof(DumpInTlmCmd));
+
+  /* Set to generate error message MM_SYMNAME_ERR_EID */
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR_NAME_LENGTH);
+
+  /* Execute the function being tested */
+  Result = MM_DumpInTlmCmd(&DumpInTlmCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Symbolic address can't be resolved: Name = '%s'");
+}
+
+void Test_MM_DumpInTlmCmd_NoVerifyDumpParams(void) {
+  CFE_Status_t Result;
+  MM_DumpInTlmCmd_t DumpInTlmCmd;
+
+  memset(&DumpInTlmCmd, 0, sizeof(DumpInTlmCmd));
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_DumpInTlmCmd(&DumpInTlmCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ReadMemToBuffer, 0);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_DumpInTlmCmd_ReadError(void) {
+  CFE_Status_t Result;
+  MM_DumpInTlmCmd_t DumpInTlmCmd;
+
+  memset(&DumpInTlmCmd, 0, sizeof(DumpInTlmCmd));
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_ReadMemToBuffer), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_DumpInTlmCmd(&DumpInTlmCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+  /* Error event is issued in MM_ReadMemToBuffer and thus not visible here */
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_LoadBeginCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_LoadBeginCmd_t LoadBeginCmd;
+  cpuaddr SymAddr;
+
+  memset(&LoadBeginCmd, 0, sizeof(LoadBeginCmd));
+
+  SymAddr = 0x42;
+  LoadBeginCmd.Payload.MemType = MM_MemType_RAM;
+  LoadBeginCmd.Payload.NumOfBytes = 1000;
+  LoadBeginCmd.Payload.Crc = 0x1234;
+
+  /* Left over data from an earlier chunked load must be cleared */
+  MM_AppData.ChunkLoad.InProgress = true;
+  MM_AppData.ChunkLoad.BytesReceived = 8;
+  memset(MM_AppData.ChunkLoadBuffer, 0xFF, sizeof(MM_AppData.ChunkLoadBuffer));
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+
+  /* Execute the function being tested */
+  Result = MM_LoadBeginCmd(&LoadBeginCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_BOOL_TRUE(MM_AppData.ChunkLoad.InProgress);
+  UtAssert_ADDRESS_EQ(MM_AppData.ChunkLoad.DestAddress, SymAddr);
+  UtAssert_UINT8_EQ(MM_AppData.ChunkLoad.MemType, MM_MemType_RAM);
+  UtAssert_UINT32_EQ(MM_AppData.ChunkLoad.NumOfBytes, 1000);
+  UtAssert_UINT32_EQ(MM_AppData.ChunkLoad.Crc, 0x1234);
+  UtAssert_UINT32_EQ(MM_AppData.ChunkLoad.BytesReceived, 0);
+  UtAssert_UINT32_EQ(MM_AppData.ChunkLoadBuffer[0], 0);
+  UtAssert_UINT32_EQ(MM_AppData.ChunkLoadBuffer[(1000 / 4) - 1], 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_LOAD_BEGIN_INF_EID, CFE_EVS_EventType_INFORMATION,
+                       "Load Begin Command: Expecting %u bytes for address %p");
+}
+
+void Test_MM_LoadBeginCmd_SymNameError(void) {
+  CFE_Status_t Result;
+  MM_LoadBeginCmd_t LoadBeginCmd;
+
+  memset(&LoadBeginCmd, 0, sizeof(LoadBeginCmd));
+
+  /* Set to generate error message MM_SYMNAME_ERR_EID */
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR_NAME_LENGTH);
+
+  /* Execute the function being tested */
+  Result = MM_LoadBeginCmd(&LoadBeginCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_BOOL_FALSE(MM_AppData.ChunkLoad.InProgress);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Symbolic address can't be resolved: Name = '%s'");
+}
+
+void Test_MM_LoadBeginCmd_NoVerifyLoadParams(void) {
+  CFE_Status_t Result;
+  MM_LoadBeginCmd_t LoadBeginCmd;
+
+  memset(&LoadBeginCmd, 0, sizeof(LoadBeginCmd));
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_LoadBeginCmd(&LoadBeginCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_BOOL_FALSE(MM_AppData.ChunkLoad.InProgress);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_LoadBeginCmd_TooLarge(void) {
+  CFE_Status_t Result;
+  MM_LoadBeginCmd_t LoadBeginCmd;
+
+  memset(&LoadBeginCmd, 0, sizeof(LoadBeginCmd));
+  LoadBeginCmd.Payload.NumOfBytes = MM_INTERNAL_MAX_CHUNK_LOAD_BYTES + 4;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+
+  /* Execute the function being tested */
+  Result = MM_LoadBeginCmd(&LoadBeginCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_BOOL_FALSE(MM_AppData.ChunkLoad.InProgress);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_LOAD_CHUNK_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Chunked load too large: Bytes = %u Max = %u");
+}
+
+void Test_MM_LoadBeginCmd_CommitPending(void) {
+  CFE_Status_t Result;
+  MM_LoadBeginCmd_t LoadBeginCmd;
+
+  memset(&LoadBeginCmd, 0, sizeof(LoadBeginCmd));
+  LoadBeginCmd.Payload.NumOfBytes = 100;
+
+  /* A queued commit still needs the load buffer */
+  MM_AppData.ChunkLoad.InProgress = true;
+  MM_AppData.ChunkLoad.CommitsQueued = 1;
+  MM_AppData.ChunkLoad.NumOfBytes = 8;
+  memset(MM_AppData.ChunkLoadBuffer, 0xFF, sizeof(MM_AppData.ChunkLoadBuffer));
+
+  /* Execute the function being tested */
+  Result = MM_LoadBeginCmd(&LoadBeginCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_UINT32_EQ(MM_AppData.ChunkLoad.NumOfBytes, 8);
+  UtAssert_UINT32_EQ(MM_AppData.ChunkLoadBuffer[0], 0xFFFFFFFF);
+  UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_LOAD_CHUNK_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Load begin rejected: Load commit pending");
+}
+
+void Test_MM_LoadDataCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_LoadDataCmd_t LoadDataCmd;
+  uint8 *LoadBytes = (uint8 *)MM_AppData.ChunkLoadBuffer;
+
+  memset(&LoadDataCmd, 0, sizeof(LoadDataCmd));
+  memset(LoadDataCmd.Payload.DataArray, 0xA5,
+         sizeof(LoadDataCmd.Payload.DataArray));
+
+  MM_AppData.ChunkLoad.InProgress = true;
+  MM_AppData.ChunkLoad.NumOfBytes = 100;
+
+  /* The last chunk of the load */
+  LoadDataCmd.Payload.Offset = 90;
+  LoadDataCmd.Payload.NumOfBytes = 10;
+
+  /* Execute the function being tested */
+  Result = MM_LoadDataCmd(&LoadDataCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_UINT8_EQ(LoadBytes[89], 0);
+  UtAssert_UINT8_EQ(LoadBytes[90], 0xA5);
+  UtAssert_UINT8_EQ(LoadBytes[99], 0xA5);
+  UtAssert_UINT8_EQ(LoadBytes[100], 0);
+  UtAssert_UINT32_EQ(MM_AppData.ChunkLoad.BytesReceived, 10);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_LOAD_DATA_DBG_EID, CFE_EVS_EventType_DEBUG,
+                       "Load Data Command: Stored %u bytes at offset %u");
+}
+
+void Test_MM_LoadDataCmd_NotInProgress(void) {
+  CFE_Status_t Result;
+  MM_LoadDataCmd_t LoadDataCmd;
+
+  memset(&LoadDataCmd, 0, sizeof(LoadDataCmd));
+  LoadDataCmd.Payload.NumOfBytes = 1;
+
+  /* Execute the function being tested */
+  Result = MM_LoadDataCmd(&LoadDataCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_LOAD_CHUNK_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Load data rejected: No chunked load in progress");
+}
+
+void Test_MM_LoadDataCmd_CommitPending(void) {
+  CFE_Status_t Result;
+  MM_LoadDataCmd_t LoadDataCmd;
+  uint8 *LoadBytes = (uint8 *)MM_AppData.ChunkLoadBuffer;
+
+  memset(&LoadDataCmd, 0, sizeof(LoadDataCmd));
+  memset(LoadDataCmd.Payload.DataArray, 0xA5,
+         sizeof(LoadDataCmd.Payload.DataArray));
+  LoadDataCmd.Payload.NumOfBytes = 10;
+
+  /* A queued commit still needs the load buffer */
+  MM_AppData.ChunkLoad.InProgress = true;
+  MM_AppData.ChunkLoad.CommitsQueued = 1;
+  MM_AppData.ChunkLoad.NumOfBytes = 100;
+
+  /* Execute the function being tested */
+  Result = MM_LoadDataCmd(&LoadDataCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_UINT8_EQ(LoadBytes[0], 0);
+  UtAssert_UINT32_EQ(MM_AppData.ChunkLoad.BytesReceived, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_LOAD_CHUNK_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Load data rejected: Load commit pending");
+}
+
+void Test_MM_LoadDataCmd_BadChunk(void) {
+  MM_LoadDataCmd_t LoadDataCmd;
+
+  memset(&LoadDataCmd, 0, sizeof(LoadDataCmd));
+
+  MM_AppData.ChunkLoad.InProgress = true;
+  MM_AppData.ChunkLoad.NumOfBytes = 1000;
+
+  /* Empty chunk */
+  LoadDataCmd.Payload.Offset = 0;
+  LoadDataCmd.Payload.NumOfBytes = 0;
+  UtAssert_INT32_EQ(MM_LoadDataCmd(&LoadDataCmd), CFE_SUCCESS);
+
+  /* Chunk larger than the command data array */
+  LoadDataCmd.Payload.NumOfBytes = MM_INTERFACE_MAX_LOAD_CHUNK_DATA + 1;
+  UtAssert_INT32_EQ(MM_LoadDataCmd(&LoadDataCmd), CFE_SUCCESS);
+
+  /* Chunk that runs past the end of the load */
+  LoadDataCmd.Payload.Offset = 999;
+  LoadDataCmd.Payload.NumOfBytes = 2;
+  UtAssert_INT32_EQ(MM_LoadDataCmd(&LoadDataCmd), CFE_SUCCESS);
+
+  /* Chunk that starts past the end of the load */
+  LoadDataCmd.Payload.Offset = 0xFFFFFFFF;
+  LoadDataCmd.Payload.NumOfBytes = 2;
+  UtAssert_INT32_EQ(MM_LoadDataCmd(&LoadDataCmd), CFE_SUCCESS);
+
+  /* Verify results */
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 4);
+  UtAssert_UINT32_EQ(MM_AppData.ChunkLoad.BytesReceived, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
+  MM_Test_Verify_Event(
+      3, MM_LOAD_CHUNK_ERR_EID, CFE_EVS_EventType_ERROR,
+      "Load data rejected: Offset = %u Bytes = %u Load size = %u");
+}
+
+void Test_MM_LoadCommitCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_LoadCommitCmd_t LoadCommitCmd;
+
+  memset(&LoadCommitCmd, 0, sizeof(LoadCommitCmd));
+
+  MM_AppData.ChunkLoad.InProgress = true;
+  MM_AppData.ChunkLoad.MemType = MM_MemType_EEPROM;
+  MM_AppData.ChunkLoad.DestAddress = 0x42;
+  MM_AppData.ChunkLoad.NumOfBytes = 1000;
+  MM_AppData.ChunkLoad.Crc = 0x1234;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x1234);
+  UT_SetDefaultReturnValue(UT_KEY(MM_WriteMemFromBuffer), CFE_PSP_SUCCESS);
+
+  /* Execute the function being tested */
+  Result = MM_LoadCommitCmd(&LoadCommitCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_BOOL_FALSE(MM_AppData.ChunkLoad.InProgress);
+  UtAssert_STUB_COUNT(MM_WriteMemFromBuffer, 1);
+
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_LOAD_CHUNKS);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.MemType, MM_MemType_EEPROM);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), 0x42);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed, 1000);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_LOAD_COMMIT_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Load Commit Command: Wrote %u bytes to address %p");
+}
+
+void Test_MM_LoadCommitCmd_NotInProgress(void) {
+  CFE_Status_t Result;
+  MM_LoadCommitCmd_t LoadCommitCmd;
+
+  memset(&LoadCommitCmd, 0, sizeof(LoadCommitCmd));
+
+  /* Execute the function being tested */
+  Result = MM_LoadCommitCmd(&LoadCommitCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_WriteMemFromBuffer, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_LOAD_CHUNK_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Load commit rejected: No chunked load in progress");
+}
+
+void Test_MM_LoadCommitCmd_CRCError(void) {
+  CFE_Status_t Result;
+  MM_LoadCommitCmd_t LoadCommitCmd;
+
+  memset(&LoadCommitCmd, 0, sizeof(LoadCommitCmd));
+
+  MM_AppData.ChunkLoad.InProgress = true;
+  MM_AppData.ChunkLoad.NumOfBytes = 1000;
+  MM_AppData.ChunkLoad.Crc = 0x1234;
+
+  /* Set to generate error message MM_LOAD_COMMIT_CRC_ERR_EID */
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x4321);
+
+  /* Execute the function being tested */
+  Result = MM_LoadCommitCmd(&LoadCommitCmd);
+
+  /* Verify results, the load stays open for missing chunks */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_BOOL_TRUE(MM_AppData.ChunkLoad.InProgress);
+  UtAssert_STUB_COUNT(MM_WriteMemFromBuffer, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_LOAD_COMMIT_CRC_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Chunked load CRC failure: Expected = 0x%X "
+                       "Calculated = 0x%X Bytes received = %u");
+}
+
+void Test_MM_LoadCommitCmd_WriteError(void) {
+  CFE_Status_t Result;
+  MM_LoadCommitCmd_t LoadCommitCmd;
+
+  memset(&LoadCommitCmd, 0, sizeof(LoadCommitCmd));
+
+  MM_AppData.ChunkLoad.InProgress = true;
+  MM_AppData.ChunkLoad.NumOfBytes = 1000;
+  MM_AppData.ChunkLoad.Crc = 0x1234;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x1234);
+  UT_SetDefaultReturnValue(UT_KEY(MM_WriteMemFromBuffer), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_LoadCommitCmd(&LoadCommitCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_BOOL_FALSE(MM_AppData.ChunkLoad.InProgress);
+
+  /* Error event is issued in MM_WriteMemFromBuffer and thus not visible here
+   */
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_LoadRAMCommitCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_LoadRAMCommitCmd_t LoadRAMCommitCmd;
+  uint8 DestBuffer[1000];
+
+  memset(&LoadRAMCommitCmd, 0, sizeof(LoadRAMCommitCmd));
+  memset(DestBuffer, 0, sizeof(DestBuffer));
+  memset(MM_AppData.ChunkLoadBuffer, 0x5A, sizeof(DestBuffer));
+
+  MM_AppData.ChunkLoad.InProgress = true;
+  MM_AppData.ChunkLoad.MemType = MM_MemType_RAM;
+  MM_AppData.ChunkLoad.DestAddress = (cpuaddr)DestBuffer;
+  MM_AppData.ChunkLoad.NumOfBytes = sizeof(DestBuffer);
+  MM_AppData.ChunkLoad.Crc = 0x1234;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x1234);
+
+  /* Execute the function being tested */
+  Result = MM_LoadRAMCommitCmd(&LoadRAMCommitCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_BOOL_FALSE(MM_AppData.ChunkLoad.InProgress);
+  UtAssert_MemCmp(DestBuffer, MM_AppData.ChunkLoadBuffer, sizeof(DestBuffer),
+                  "DestBuffer holds the chunked load data");
+  UtAssert_STUB_COUNT(OS_GetLocalTime, 2);
+
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_LOAD_CHUNKS);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.MemType, MM_MemType_RAM);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), DestBuffer);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed,
+                     sizeof(DestBuffer));
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_LOAD_RAM_COMMIT_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Load RAM Commit Command: Wrote %u bytes to address %p "
+                       "in %u usec");
+}
+
+void Test_MM_LoadRAMCommitCmd_NotInProgress(void) {
+  CFE_Status_t Result;
+  MM_LoadRAMCommitCmd_t LoadRAMCommitCmd;
+
+  memset(&LoadRAMCommitCmd, 0, sizeof(LoadRAMCommitCmd));
+
+  /* Execute the function being tested */
+  Result = MM_LoadRAMCommitCmd(&LoadRAMCommitCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_LOAD_CHUNK_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Load commit rejected: No chunked load in progress");
+}
+
+void Test_MM_LoadRAMCommitCmd_NotRAM(void) {
+  CFE_Status_t Result;
+  MM_LoadRAMCommitCmd_t LoadRAMCommitCmd;
+
+  memset(&LoadRAMCommitCmd, 0, sizeof(LoadRAMCommitCmd));
+
+  MM_AppData.ChunkLoad.InProgress = true;
+  MM_AppData.ChunkLoad.MemType = MM_MemType_EEPROM;
+  MM_AppData.ChunkLoad.NumOfBytes = 4;
+
+  /* Execute the function being tested */
+  Result = MM_LoadRAMCommitCmd(&LoadRAMCommitCmd);
+
+  /* Verify results, the chunked load can still be committed normally */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_BOOL_TRUE(MM_AppData.ChunkLoad.InProgress);
+  UtAssert_STUB_COUNT(MM_CalculateCRC, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_LOAD_RAM_COMMIT_ERR_EID, CFE_EVS_EventType_ERROR,
+      "Load RAM commit rejected: MemType = %d Bytes = %u Max = %u");
+}
+
+void Test_MM_LoadRAMCommitCmd_TooLarge(void) {
+  CFE_Status_t Result;
+  MM_LoadRAMCommitCmd_t LoadRAMCommitCmd;
+
+  memset(&LoadRAMCommitCmd, 0, sizeof(LoadRAMCommitCmd));
+
+  MM_AppData.ChunkLoad.InProgress = true;
+  MM_AppData.ChunkLoad.MemType = MM_MemType_RAM;
+  MM_AppData.ChunkLoad.NumOfBytes = MM_INTERNAL_MAX_RAM_COMMIT_BYTES + 1;
+
+  /* Execute the function being tested */
+  Result = MM_LoadRAMCommitCmd(&LoadRAMCommitCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_BOOL_TRUE(MM_AppData.ChunkLoad.InProgress);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_LOAD_RAM_COMMIT_ERR_EID, CFE_EVS_EventType_ERROR,
+      "Load RAM commit rejected: MemType = %d Bytes = %u Max = %u");
+}
+
+void Test_MM_LoadRAMCommitCmd_CRCError(void) {
+  CFE_Status_t Result;
+  MM_LoadRAMCommitCmd_t LoadRAMCommitCmd;
+
+  memset(&LoadRAMCommitCmd, 0, sizeof(LoadRAMCommitCmd));
+
+  MM_AppData.ChunkLoad.InProgress = true;
+  MM_AppData.ChunkLoad.MemType = MM_MemType_RAM;
+  MM_AppData.ChunkLoad.NumOfBytes = 100;
+  MM_AppData.ChunkLoad.Crc = 0x1234;
+
+  /* Set to generate error message MM_LOAD_COMMIT_CRC_ERR_EID */
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x4321);
+
+  /* Execute the function being tested */
+  Result = MM_LoadRAMCommitCmd(&LoadRAMCommitCmd);
+
+  /* Verify results, no memory is touched */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_BOOL_TRUE(MM_AppData.ChunkLoad.InProgress);
+  UtAssert_STUB_COUNT(OS_GetLocalTime, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_LOAD_COMMIT_CRC_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Chunked load CRC failure: Expected = 0x%X "
+                       "Calculated = 0x%X Bytes received = %u");
+}
+
+/*
+ * Returns the CRC passed in UserObj from MM_ChecksumMem
+ */
+void UT_Handler_MM_ChecksumMem(void *UserObj, UT_EntryKey_t FuncKey,
+                               const UT_StubContext_t *Context) {
+  uint32 *CrcPtr = UT_Hook_GetArgValueByName(Context, "CrcPtr", uint32 *);
+
+  *CrcPtr = *((uint32 *)UserObj);
+}
+
+void Test_MM_ChecksumMemCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_ChecksumMemCmd_t ChecksumMemCmd;
+  cpuaddr SymAddr;
+  uint32 Crc = 0xCAFEF00D;
+
+  memset(&ChecksumMemCmd, 0, sizeof(ChecksumMemCmd));
+
+  SymAddr = 0x42;
+  ChecksumMemCmd.Payload.MemType = MM_MemType_EEPROM;
+  ChecksumMemCmd.Payload.NumOfBytes = 3 * 1024 * 1024;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+  UT_SetHandlerFunction(UT_KEY(MM_ChecksumMem), UT_Handler_MM_ChecksumMem,
+                        &Crc);
+
+  /* Execute the function being tested */
+  Result = MM_ChecksumMemCmd(&ChecksumMemCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_STUB_COUNT(MM_ChecksumMem, 1);
+
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_CHECKSUM);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.MemType, MM_MemType_EEPROM);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), SymAddr);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.DataValue, 0xCAFEF00D);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed,
+                     3 * 1024 * 1024);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_CHECKSUM_MEM_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Checksum Memory Command: CRC = 0x%08X for %u bytes "
+                       "at address %p");
+}
+
+void Test_MM_ChecksumMemCmd_SymNameError(void) {
+  CFE_Status_t Result;
+  MM_ChecksumMemCmd_t ChecksumMemCmd;
+
+  memset(&ChecksumMemCmd, 0, sizeof(ChecksumMemCmd));
+
+  /* Set to generate error message MM_SYMNAME_ERR_EID */
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR_NAME_LENGTH);
+
+  /* Execute the function being tested */
+  Result = MM_ChecksumMemCmd(&ChecksumMemCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ChecksumMem, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Symbolic address can't be resolved: Name = '%s'");
+}
+
+void Test_MM_ChecksumMemCmd_NoVerifyDumpParams(void) {
+  CFE_Status_t Result;
+  MM_ChecksumMemCmd_t ChecksumMemCmd;
+
+  memset(&ChecksumMemCmd, 0, sizeof(ChecksumMemCmd));
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_ChecksumMemCmd(&ChecksumMemCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ChecksumMem, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_ChecksumMemCmd_ReadError(void) {
+  CFE_Status_t Result;
+  MM_ChecksumMemCmd_t ChecksumMemCmd;
+
+  memset(&ChecksumMemCmd, 0, sizeof(ChecksumMemCmd));
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_ChecksumMem), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_ChecksumMemCmd(&ChecksumMemCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  /* Error event is issued in MM_ChecksumMem and thus not visible here */
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_SetScrubRegionCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_SetScrubRegionCmd_t SetScrubRegionCmd;
+  cpuaddr SymAddr;
+
+  memset(&SetScrubRegionCmd, 0, sizeof(SetScrubRegionCmd));
+
+  SymAddr = 0x42;
+  SetScrubRegionCmd.Payload.RegionNum = MM_INTERFACE_MAX_SCRUB_REGIONS - 1;
+  SetScrubRegionCmd.Payload.MemType = MM_MemType_RAM;
+  SetScrubRegionCmd.Payload.NumOfBytes = 1024;
+  SetScrubRegionCmd.Payload.GoldenCrc = 0xCAFEF00D;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+
+  /* Execute the function being tested */
+  Result = MM_SetScrubRegionCmd(&SetScrubRegionCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_UINT8_EQ(
+      MM_AppData.Scrub.Regions[MM_INTERFACE_MAX_SCRUB_REGIONS - 1].MemType,
+      MM_MemType_RAM);
+  UtAssert_ADDRESS_EQ(
+      MM_AppData.Scrub.Regions[MM_INTERFACE_MAX_SCRUB_REGIONS - 1].Address,
+      SymAddr);
+  UtAssert_UINT32_EQ(
+      MM_AppData.Scrub.Regions[MM_INTERFACE_MAX_SCRUB_REGIONS - 1].NumOfBytes,
+      1024);
+  UtAssert_UINT32_EQ(
+      MM_AppData.Scrub.Regions[MM_INTERFACE_MAX_SCRUB_REGIONS - 1].GoldenCrc,
+      0xCAFEF00D);
+  UtAssert_STUB_COUNT(MM_ScrubRestartRegion, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SCRUB_REGION_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Set Scrub Region Command: Region = %u Addr = %p "
+                       "Bytes = %u Golden CRC = 0x%08X");
+}
+
+void Test_MM_SetScrubRegionCmd_RegionNumError(void) {
+  CFE_Status_t Result;
+  MM_SetScrubRegionCmd_t SetScrubRegionCmd;
+
+  memset(&SetScrubRegionCmd, 0, sizeof(SetScrubRegionCmd));
+
+  /* Set to generate error message MM_SCRUB_REGION_ERR_EID */
+  SetScrubRegionCmd.Payload.RegionNum = MM_INTERFACE_MAX_SCRUB_REGIONS;
+
+  /* Execute the function being tested */
+  Result = MM_SetScrubRegionCmd(&SetScrubRegionCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+  UtAssert_STUB_COUNT(MM_ScrubRestartRegion, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SCRUB_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Scrub region number invalid: Region = %u Max = %u");
+}
+
+void Test_MM_SetScrubRegionCmd_SymNameError(void) {
+  CFE_Status_t Result;
+  MM_SetScrubRegionCmd_t SetScrubRegionCmd;
+
+  memset(&SetScrubRegionCmd, 0, sizeof(SetScrubRegionCmd));
+
+  /* Set to generate error message MM_SYMNAME_ERR_EID */
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR_NAME_LENGTH);
+
+  /* Execute the function being tested */
+  Result = MM_SetScrubRegionCmd(&SetScrubRegionCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ScrubRestartRegion, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Symbolic address can't be resolved: Name = '%s'");
+}
+
+void Test_MM_SetScrubRegionCmd_NoVerifyDumpParams(void) {
+  CFE_Status_t Result;
+  MM_SetScrubRegionCmd_t SetScrubRegionCmd;
+
+  memset(&SetScrubRegionCmd, 0, sizeof(SetScrubRegionCmd));
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_SetScrubRegionCmd(&SetScrubRegionCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Regions[0].NumOfBytes, 0);
+  UtAssert_STUB_COUNT(MM_ScrubRestartRegion, 0);
+
+  /* Error event is issued in MM_VerifyLoadDumpParams */
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_ClearScrubRegionCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_ClearScrubRegionCmd_t ClearScrubRegionCmd;
+
+  memset(&ClearScrubRegionCmd, 0, sizeof(ClearScrubRegionCmd));
+
+  ClearScrubRegionCmd.Payload.RegionNum = 1;
+  MM_AppData.Scrub.Regions[1].NumOfBytes = 1024;
+  MM_AppData.Scrub.Regions[1].GoldenCrc = 0xCAFEF00D;
+
+  /* Execute the function being tested */
+  Result = MM_ClearScrubRegionCmd(&ClearScrubRegionCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Regions[1].NumOfBytes, 0);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Regions[1].GoldenCrc, 0);
+  UtAssert_STUB_COUNT(MM_ScrubRestartRegion, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SCRUB_REGION_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Clear Scrub Region Command: Region = %u");
+}
+
+void Test_MM_ClearScrubRegionCmd_RegionNumError(void) {
+  CFE_Status_t Result;
+  MM_ClearScrubRegionCmd_t ClearScrubRegionCmd;
+
+  memset(&ClearScrubRegionCmd, 0, sizeof(ClearScrubRegionCmd));
+
+  /* Set to generate error message MM_SCRUB_REGION_ERR_EID */
+  ClearScrubRegionCmd.Payload.RegionNum = MM_INTERFACE_MAX_SCRUB_REGIONS;
+
+  /* Execute the function being tested */
+  Result = MM_ClearScrubRegionCmd(&ClearScrubRegionCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ScrubRestartRegion, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SCRUB_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Scrub region number invalid: Region = %u Max = %u");
+}
+
+void Test_MM_BuildScrubIndexCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_BuildScrubIndexCmd_t BuildScrubIndexCmd;
+  uint32 Crc = 0xCAFEF00D;
+
+  memset(&BuildScrubIndexCmd, 0, sizeof(BuildScrubIndexCmd));
+
+  BuildScrubIndexCmd.Payload.RegionNum = 1;
+  MM_AppData.Scrub.Regions[1].MemType = MM_MemType_RAM;
+  MM_AppData.Scrub.Regions[1].Address = 0x1000;
+  MM_AppData.Scrub.Regions[1].NumOfBytes =
+      (2 * MM_INTERNAL_SCRUB_BLOCK_SIZE) + 4;
+
+  UT_SetHandlerFunction(UT_KEY(MM_ChecksumMem), UT_Handler_MM_ChecksumMem,
+                        &Crc);
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x5A5A);
+
+  /* Execute the function being tested */
+  Result = MM_BuildScrubIndexCmd(&BuildScrubIndexCmd);
+
+  /* Verify results, two full blocks and one short block */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_STUB_COUNT(MM_ChecksumMem, 3);
+  UtAssert_STUB_COUNT(MM_SegmentBreak, 2);
+
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Index[1].BlockSize,
+                     MM_INTERNAL_SCRUB_BLOCK_SIZE);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Index[1].NumBlocks, 3);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Index[1].RootCrc, 0x5A5A);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Index[1].BlockCrc[2], 0xCAFEF00D);
+
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_SCRUB_INDEX);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.MemType, MM_MemType_RAM);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.DataValue, 0x5A5A);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed,
+                     (2 * MM_INTERNAL_SCRUB_BLOCK_SIZE) + 4);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SCRUB_INDEX_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Build Scrub Index Command: Region = %u Blocks = %u "
+                       "Block size = %u Root = 0x%08X");
+}
+
+void Test_MM_BuildScrubIndexCmd_LargeRegion(void) {
+  CFE_Status_t Result;
+  MM_BuildScrubIndexCmd_t BuildScrubIndexCmd;
+
+  memset(&BuildScrubIndexCmd, 0, sizeof(BuildScrubIndexCmd));
+
+  /* Region needs more than the maximum number of minimum size blocks */
+  MM_AppData.Scrub.Regions[0].MemType = MM_MemType_RAM;
+  MM_AppData.Scrub.Regions[0].NumOfBytes =
+      (2 * MM_INTERNAL_MAX_SCRUB_BLOCKS * MM_INTERNAL_SCRUB_BLOCK_SIZE) + 4;
+
+  /* Execute the function being tested */
+  Result = MM_BuildScrubIndexCmd(&BuildScrubIndexCmd);
+
+  /* Verify results, larger blocks keep the index within its size */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_UINT32_GT(MM_AppData.Scrub.Index[0].BlockSize,
+                     2 * MM_INTERNAL_SCRUB_BLOCK_SIZE);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Index[0].BlockSize % 4, 0);
+  UtAssert_UINT32_LTEQ(MM_AppData.Scrub.Index[0].NumBlocks,
+                       MM_INTERNAL_MAX_SCRUB_BLOCKS);
+  UtAssert_UINT32_GTEQ(MM_AppData.Scrub.Index[0].BlockSize *
+                           MM_AppData.Scrub.Index[0].NumBlocks,
+                       MM_AppData.Scrub.Regions[0].NumOfBytes);
+  UtAssert_STUB_COUNT(MM_ChecksumMem, MM_AppData.Scrub.Index[0].NumBlocks);
+}
+
+void Test_MM_BuildScrubIndexCmd_RegionNumError(void) {
+  CFE_Status_t Result;
+  MM_BuildScrubIndexCmd_t BuildScrubIndexCmd;
+
+  memset(&BuildScrubIndexCmd, 0, sizeof(BuildScrubIndexCmd));
+
+  /* Set to generate error message MM_SCRUB_REGION_ERR_EID */
+  BuildScrubIndexCmd.Payload.RegionNum = MM_INTERFACE_MAX_SCRUB_REGIONS;
+
+  /* Execute the function being tested */
+  Result = MM_BuildScrubIndexCmd(&BuildScrubIndexCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ChecksumMem, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SCRUB_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Scrub region number invalid: Region = %u Max = %u");
+}
+
+void Test_MM_BuildScrubIndexCmd_NotDefined(void) {
+  CFE_Status_t Result;
+  MM_BuildScrubIndexCmd_t BuildScrubIndexCmd;
+
+  memset(&BuildScrubIndexCmd, 0, sizeof(BuildScrubIndexCmd));
+
+  /* Execute the function being tested */
+  Result = MM_BuildScrubIndexCmd(&BuildScrubIndexCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ChecksumMem, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SCRUB_INDEX_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Build scrub index error: Region %u is not defined");
+}
+
+void Test_MM_BuildScrubIndexCmd_ReadError(void) {
+  CFE_Status_t Result;
+  MM_BuildScrubIndexCmd_t BuildScrubIndexCmd;
+
+  memset(&BuildScrubIndexCmd, 0, sizeof(BuildScrubIndexCmd));
+
+  MM_AppData.Scrub.Regions[0].MemType = MM_MemType_MEM8;
+  MM_AppData.Scrub.Regions[0].NumOfBytes = 3 * MM_INTERNAL_SCRUB_BLOCK_SIZE;
+  MM_AppData.Scrub.Index[0].NumBlocks = 3;
+  MM_AppData.Scrub.Index[0].BlockCrc[0] = 0x1234;
+
+  UT_SetDeferredRetcode(UT_KEY(MM_ChecksumMem), 2, CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_BuildScrubIndexCmd(&BuildScrubIndexCmd);
+
+  /* Verify results, the old index is kept */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ChecksumMem, 2);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Index[0].NumBlocks, 3);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Index[0].BlockCrc[0], 0x1234);
+
+  /* Error event is issued in MM_ChecksumMem and thus not visible here */
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void UT_Handler_MM_SegmentBreak_ChangeRegion(void *UserObj,
+                                             UT_EntryKey_t FuncKey,
+                                             const UT_StubContext_t *Context) {
+  /*
+  ** A set scrub region command with the same parameters runs during the
+  ** segment break, so only the restart shows the change
+  */
+  memset(&MM_AppData.Scrub.Index[0], 0, sizeof(MM_AppData.Scrub.Index[0]));
+  MM_AppData.Scrub.Generation[0]++;
+}
+
+void Test_MM_BuildScrubIndexCmd_RegionChanged(void) {
+  CFE_Status_t Result;
+  MM_BuildScrubIndexCmd_t BuildScrubIndexCmd;
+
+  memset(&BuildScrubIndexCmd, 0, sizeof(BuildScrubIndexCmd));
+
+  MM_AppData.Scrub.Regions[0].MemType = MM_MemType_RAM;
+  MM_AppData.Scrub.Regions[0].NumOfBytes = 2 * MM_INTERNAL_SCRUB_BLOCK_SIZE;
+
+  UT_SetHandlerFunction(UT_KEY(MM_SegmentBreak),
+                        UT_Handler_MM_SegmentBreak_ChangeRegion, NULL);
+
+  /* Execute the function being tested */
+  Result = MM_BuildScrubIndexCmd(&BuildScrubIndexCmd);
+
+  /* Verify results, the index is not stored */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ChecksumMem, 2);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Index[0].NumBlocks, 0);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Index[0].RootCrc, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SCRUB_INDEX_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Build scrub index error: Region %u changed during "
+                       "the build");
+}
+
+void Test_MM_CompareScrubIndexCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_CompareScrubIndexCmd_t CompareScrubIndexCmd;
+  uint32 Crc = 0x1111;
+
+  memset(&CompareScrubIndexCmd, 0, sizeof(CompareScrubIndexCmd));
+
+  CompareScrubIndexCmd.Payload.RegionNum = 2;
+  MM_AppData.Scrub.Regions[2].MemType = MM_MemType_EEPROM;
+  MM_AppData.Scrub.Regions[2].Address = 0x1000;
+  MM_AppData.Scrub.Regions[2].NumOfBytes = 3 * MM_INTERNAL_SCRUB_BLOCK_SIZE;
+  MM_AppData.Scrub.Index[2].BlockSize = MM_INTERNAL_SCRUB_BLOCK_SIZE;
+  MM_AppData.Scrub.Index[2].NumBlocks = 3;
+  MM_AppData.Scrub.Index[2].BlockCrc[0] = 0x1111;
+  MM_AppData.Scrub.Index[2].BlockCrc[1] = 0x2222;
+  MM_AppData.Scrub.Index[2].BlockCrc[2] = 0x1111;
+
+  /* The stubbed CRC of the index matches its zero root */
+  UT_SetHandlerFunction(UT_KEY(MM_ChecksumMem), UT_Handler_MM_ChecksumMem,
+                        &Crc);
+
+  /* Execute the function being tested */
+  Result = MM_CompareScrubIndexCmd(&CompareScrubIndexCmd);
+
+  /* Verify results, only block 1 doesn't match */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_STUB_COUNT(MM_ChecksumMem, 3);
+  UtAssert_STUB_COUNT(MM_SegmentBreak, 2);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+  UtAssert_UINT8_EQ(MM_AppData.ScrubIndexTlm.Payload.RegionNum, 2);
+  UtAssert_UINT8_EQ(MM_AppData.ScrubIndexTlm.Payload.MemType,
+                    MM_MemType_EEPROM);
+  UtAssert_UINT32_EQ(MM_AppData.ScrubIndexTlm.Payload.BlockSize,
+                     MM_INTERNAL_SCRUB_BLOCK_SIZE);
+  UtAssert_UINT32_EQ(MM_AppData.ScrubIndexTlm.Payload.NumBlocks, 3);
+  UtAssert_UINT32_EQ(MM_AppData.ScrubIndexTlm.Payload.NumMismatches, 1);
+  UtAssert_UINT32_EQ(MM_AppData.ScrubIndexTlm.Payload.NumReported, 1);
+  UtAssert_UINT32_EQ(MM_AppData.ScrubIndexTlm.Payload.BlockIndex[0], 1);
+
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_SCRUB_COMPARE);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.DataValue, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SCRUB_COMPARE_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Compare Scrub Index Command: Region = %u "
+                       "Mismatched blocks = %u of %u");
+}
+
+void Test_MM_CompareScrubIndexCmd_ReportLimit(void) {
+  CFE_Status_t Result;
+  MM_CompareScrubIndexCmd_t CompareScrubIndexCmd;
+  uint32 Crc = 0x1111;
+  uint32 NumBlocks = MM_INTERFACE_MAX_SCRUB_MISMATCH_BLOCKS + 2;
+
+  memset(&CompareScrubIndexCmd, 0, sizeof(CompareScrubIndexCmd));
+
+  MM_AppData.Scrub.Regions[0].MemType = MM_MemType_RAM;
+  MM_AppData.Scrub.Regions[0].NumOfBytes =
+      NumBlocks * MM_INTERNAL_SCRUB_BLOCK_SIZE;
+  MM_AppData.Scrub.Index[0].BlockSize = MM_INTERNAL_SCRUB_BLOCK_SIZE;
+  MM_AppData.Scrub.Index[0].NumBlocks = NumBlocks;
+
+  UT_SetHandlerFunction(UT_KEY(MM_ChecksumMem), UT_Handler_MM_ChecksumMem,
+                        &Crc);
+
+  /* Execute the function being tested */
+  Result = MM_CompareScrubIndexCmd(&CompareScrubIndexCmd);
+
+  /* Verify results, every block is counted but not every one reported */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_UINT32_EQ(MM_AppData.ScrubIndexTlm.Payload.NumMismatches,
+                     NumBlocks);
+  UtAssert_UINT32_EQ(MM_AppData.ScrubIndexTlm.Payload.NumReported,
+                     MM_INTERFACE_MAX_SCRUB_MISMATCH_BLOCKS);
+  UtAssert_UINT32_EQ(
+      MM_AppData.ScrubIndexTlm.Payload
+          .BlockIndex[MM_INTERFACE_MAX_SCRUB_MISMATCH_BLOCKS - 1],
+      MM_INTERFACE_MAX_SCRUB_MISMATCH_BLOCKS - 1);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+void Test_MM_CompareScrubIndexCmd_RegionNumError(void) {
+  CFE_Status_t Result;
+  MM_CompareScrubIndexCmd_t CompareScrubIndexCmd;
+
+  memset(&CompareScrubIndexCmd, 0, sizeof(CompareScrubIndexCmd));
+
+  /* Set to generate error message MM_SCRUB_REGION_ERR_EID */
+  CompareScrubIndexCmd.Payload.RegionNum = MM_INTERFACE_MAX_SCRUB_REGIONS;
+
+  /* Execute the function being tested */
+  Result = MM_CompareScrubIndexCmd(&CompareScrubIndexCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SCRUB_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Scrub region number invalid: Region = %u Max = %u");
+}
+
+void Test_MM_CompareScrubIndexCmd_NoIndex(void) {
+  CFE_Status_t Result;
+  MM_CompareScrubIndexCmd_t CompareScrubIndexCmd;
+
+  memset(&CompareScrubIndexCmd, 0, sizeof(CompareScrubIndexCmd));
+
+  MM_AppData.Scrub.Regions[0].NumOfBytes = MM_INTERNAL_SCRUB_BLOCK_SIZE;
+
+  /* Execute the function being tested */
+  Result = MM_CompareScrubIndexCmd(&CompareScrubIndexCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ChecksumMem, 0);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SCRUB_INDEX_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Compare scrub index error: Region %u has no index");
+}
+
+void Test_MM_CompareScrubIndexCmd_RootError(void) {
+  CFE_Status_t Result;
+  MM_CompareScrubIndexCmd_t CompareScrubIndexCmd;
+
+  memset(&CompareScrubIndexCmd, 0, sizeof(CompareScrubIndexCmd));
+
+  MM_AppData.Scrub.Regions[0].NumOfBytes = MM_INTERNAL_SCRUB_BLOCK_SIZE;
+  MM_AppData.Scrub.Index[0].BlockSize = MM_INTERNAL_SCRUB_BLOCK_SIZE;
+  MM_AppData.Scrub.Index[0].NumBlocks = 1;
+  MM_AppData.Scrub.Index[0].RootCrc = 0x1234;
+
+  /* Set to generate error message MM_SCRUB_INDEX_ERR_EID */
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x5A5A);
+
+  /* Execute the function being tested */
+  Result = MM_CompareScrubIndexCmd(&CompareScrubIndexCmd);
+
+  /* Verify results, memory is not checked against a corrupted index */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ChecksumMem, 0);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SCRUB_INDEX_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Compare scrub index error: Region %u index doesn't "
+                       "match its root CRC");
+}
+
+void Test_MM_CompareScrubIndexCmd_ReadError(void) {
+  CFE_Status_t Result;
+  MM_CompareScrubIndexCmd_t CompareScrubIndexCmd;
+
+  memset(&CompareScrubIndexCmd, 0, sizeof(CompareScrubIndexCmd));
+
+  MM_AppData.Scrub.Regions[0].MemType = MM_MemType_MEM8;
+  MM_AppData.Scrub.Regions[0].NumOfBytes = 2 * MM_INTERNAL_SCRUB_BLOCK_SIZE;
+  MM_AppData.Scrub.Index[0].BlockSize = MM_INTERNAL_SCRUB_BLOCK_SIZE;
+  MM_AppData.Scrub.Index[0].NumBlocks = 2;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_ChecksumMem), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_CompareScrubIndexCmd(&CompareScrubIndexCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ChecksumMem, 1);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+  /* Error event is issued in MM_ChecksumMem and thus not visible here */
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_CompareScrubIndexCmd_RegionChanged(void) {
+  CFE_Status_t Result;
+  MM_CompareScrubIndexCmd_t CompareScrubIndexCmd;
+
+  memset(&CompareScrubIndexCmd, 0, sizeof(CompareScrubIndexCmd));
+
+  MM_AppData.Scrub.Regions[0].MemType = MM_MemType_RAM;
+  MM_AppData.Scrub.Regions[0].NumOfBytes = 2 * MM_INTERNAL_SCRUB_BLOCK_SIZE;
+  MM_AppData.Scrub.Index[0].BlockSize = MM_INTERNAL_SCRUB_BLOCK_SIZE;
+  MM_AppData.Scrub.Index[0].NumBlocks = 2;
+
+  UT_SetHandlerFunction(UT_KEY(MM_SegmentBreak),
+                        UT_Handler_MM_SegmentBreak_ChangeRegion, NULL);
+
+  /* Execute the function being tested */
+  Result = MM_CompareScrubIndexCmd(&CompareScrubIndexCmd);
+
+  /* Verify results, every block of the copy is compared but not sent */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ChecksumMem, 2);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SCRUB_INDEX_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Compare scrub index error: Region %u changed "
+                       "during the compare");
+}
+
+void Test_MM_SetCpuBudgetCmd_Nominal(void) {
+  MM_SetCpuBudgetCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  CmdPacket.Payload.CpuBudget = MM_INTERNAL_MAX_CPU_BUDGET;
+
+  /* Execute the function being tested */
+  Result = MM_SetCpuBudgetCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.CpuBudget,
+                     MM_INTERNAL_MAX_CPU_BUDGET);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_CPU_BUDGET_INF_EID, CFE_EVS_EventType_INFORMATION,
+                       "CPU budget set to %u usec");
+}
+
+void Test_MM_SetCpuBudgetCmd_TooLarge(void) {
+  MM_SetCpuBudgetCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  MM_AppData.HkTlm.Payload.CpuBudget = 10;
+  CmdPacket.Payload.CpuBudget = MM_INTERNAL_MAX_CPU_BUDGET + 1;
+
+  /* Execute the function being tested */
+  Result = MM_SetCpuBudgetCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.CpuBudget, 10);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_CPU_BUDGET_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "CPU budget %u usec exceeds maximum %u usec");
+}
+
+void Test_MM_SetDumpCrcTypeCmd_Nominal(void) {
+  MM_SetDumpCrcTypeCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  CmdPacket.Payload.CrcType = MM_CRC_MAX_FILE_TYPE;
+
+  /* Execute the function being tested */
+  Result = MM_SetDumpCrcTypeCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.DumpCrcType,
+                    MM_CRC_MAX_FILE_TYPE);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_DUMP_CRC_TYPE_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Dump CRC type set to %u");
+}
+
+void Test_MM_SetDumpCrcTypeCmd_TooLarge(void) {
+  MM_SetDumpCrcTypeCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  MM_AppData.HkTlm.Payload.DumpCrcType = MM_CrcType_CRC32;
+  CmdPacket.Payload.CrcType = MM_CRC_MAX_FILE_TYPE + 1;
+
+  /* Execute the function being tested */
+  Result = MM_SetDumpCrcTypeCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.DumpCrcType, MM_CrcType_CRC32);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_DUMP_CRC_TYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Dump CRC type %u exceeds maximum %u");
+}
+
+/*
+ * Records one failure in the payload passed to MM_MemTest
+ */
+void UT_Handler_MM_MemTest(void *UserObj, UT_EntryKey_t FuncKey,
+                           const UT_StubContext_t *Context) {
+  MM_MemTestTlm_Payload_t *Payload =
+      UT_Hook_GetArgValueByName(Context, "Payload", MM_MemTestTlm_Payload_t *);
+
+  Payload->NumOfBytes =
+      UT_Hook_GetArgValueByName(Context, "NumOfBytes", uint32);
+  Payload->NumFailures = 1;
+  Payload->NumReported = 1;
+}
+
+void Test_MM_MemTestCmd_Nominal(void) {
+  MM_MemTestCmd_t CmdPacket;
+  CFE_Status_t Result;
+  cpuaddr SymAddr = 0x40;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.MemType = MM_MemType_MEM32;
+  CmdPacket.Payload.NumOfBytes = 64;
+  CmdPacket.Payload.Patterns = MM_MEM_TEST_ALL_PATTERNS;
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+  UT_SetHandlerFunction(UT_KEY(MM_MemTest), UT_Handler_MM_MemTest, NULL);
+
+  /* Execute the function being tested */
+  Result = MM_MemTestCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_STUB_COUNT(MM_MemTest, 1);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_MEM_TEST);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.MemType, MM_MemType_MEM32);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), SymAddr);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.DataValue, 1);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed, 64);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_MEM_TEST_INF_EID, CFE_EVS_EventType_INFORMATION,
+                       "Memory Test Command: %u failures in %u bytes at "
+                       "address %p");
+}
+
+void Test_MM_MemTestCmd_SymNameError(void) {
+  MM_MemTestCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.Patterns = MM_MemTestPattern_MARCH_C;
+
+  /* Set to generate error message MM_SYMNAME_ERR_EID */
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR_NAME_LENGTH);
+
+  /* Execute the function being tested */
+  Result = MM_MemTestCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_MemTest, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Symbolic address can't be resolved: Name = '%s'");
+}
+
+void Test_MM_MemTestCmd_NoPatterns(void) {
+  MM_MemTestCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.MemType = MM_MemType_RAM;
+
+  /* Execute the function being tested */
+  Result = MM_MemTestCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_MemTest, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_MEM_TEST_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Memory test error: Patterns = 0x%02X invalid");
+}
+
+void Test_MM_MemTestCmd_UnknownPattern(void) {
+  MM_MemTestCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.MemType = MM_MemType_RAM;
+  CmdPacket.Payload.Patterns =
+      MM_MemTestPattern_MARCH_C | (MM_MEM_TEST_ALL_PATTERNS + 1);
+
+  /* Execute the function being tested */
+  Result = MM_MemTestCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_MemTest, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_MEM_TEST_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Memory test error: Patterns = 0x%02X invalid");
+}
+
+void Test_MM_MemTestCmd_Eeprom(void) {
+  MM_MemTestCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.MemType = MM_MemType_EEPROM;
+  CmdPacket.Payload.NumOfBytes = 64;
+  CmdPacket.Payload.Patterns = MM_MemTestPattern_MARCH_C;
+
+  /* Execute the function being tested */
+  Result = MM_MemTestCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_MemTest, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_MEM_TEST_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Memory test error: EEPROM can't be tested");
+}
+
+void Test_MM_MemTestCmd_NoVerifyFillParams(void) {
+  MM_MemTestCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.MemType = MM_MemType_RAM;
+  CmdPacket.Payload.Patterns = MM_MemTestPattern_MARCH_C;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_MemTestCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_MemTest, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_MemTestCmd_TestError(void) {
+  MM_MemTestCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.MemType = MM_MemType_RAM;
+  CmdPacket.Payload.Patterns = MM_MemTestPattern_WALKING_ONES;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_MemTest), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_MemTestCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+  /* Error event is issued in MM_MemTest and thus not visible here */
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+/*
+ * Returns the address as the value read by MM_PeekValue
+ */
+void UT_Handler_MM_PeekValue(void *UserObj, UT_EntryKey_t FuncKey,
+                             const UT_StubContext_t *Context) {
+  uint32 *DataValue =
+      UT_Hook_GetArgValueByName(Context, "DataValue", uint32 *);
+
+  *DataValue = UT_Hook_GetArgValueByName(Context, "SrcAddress", cpuaddr);
+}
+
+void Test_MM_BatchPeekCmd_Nominal(void) {
+  MM_BatchPeekCmd_t CmdPacket;
+  CFE_Status_t Result;
+  cpuaddr SymAddr = 0x40;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.NumEntries = 2;
+  CmdPacket.Payload.Entries[0].MemType = MM_MemType_MEM16;
+  CmdPacket.Payload.Entries[0].DataSize = MM_INTERNAL_WORD_BIT_WIDTH;
+  CmdPacket.Payload.Entries[1].MemType = MM_MemType_RAM;
+  CmdPacket.Payload.Entries[1].DataSize = MM_INTERNAL_DWORD_BIT_WIDTH;
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+  UT_SetHandlerFunction(UT_KEY(MM_PeekValue), UT_Handler_MM_PeekValue, NULL);
+
+  /* Execute the function being tested */
+  Result = MM_BatchPeekCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_STUB_COUNT(MM_VerifyPeekPokeParams, 2);
+  UtAssert_STUB_COUNT(MM_PeekValue, 2);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+  UtAssert_UINT32_EQ(MM_AppData.BatchPeekTlm.Payload.NumEntries, 2);
+  UtAssert_UINT32_EQ(MM_AppData.BatchPeekTlm.Payload.Results[0].DataSize,
+                     MM_INTERNAL_WORD_BIT_WIDTH);
+  UtAssert_UINT32_EQ(MM_AppData.BatchPeekTlm.Payload.Results[1].DataValue,
+                     SymAddr);
+
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_BATCH_PEEK);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.MemType, MM_MemType_MEM16);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), SymAddr);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.DataValue, 2);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed, 6);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_BATCH_PEEK_INF_EID, CFE_EVS_EventType_INFORMATION,
+                       "Batch Peek Command: %u entries, %u bytes read");
+}
+
+void Test_MM_BatchPeekCmd_NoEntries(void) {
+  MM_BatchPeekCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+
+  /* Execute the function being tested */
+  Result = MM_BatchPeekCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_BATCH_PEEK_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Batch peek error: NumEntries = %u, max = %u");
+}
+
+void Test_MM_BatchPeekCmd_TooManyEntries(void) {
+  MM_BatchPeekCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.NumEntries = MM_INTERFACE_MAX_BATCH_PEEK_ENTRIES + 1;
+
+  /* Execute the function being tested */
+  Result = MM_BatchPeekCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_BATCH_PEEK_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Batch peek error: NumEntries = %u, max = %u");
+}
+
+void Test_MM_BatchPeekCmd_SymNameError(void) {
+  MM_BatchPeekCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.NumEntries = 3;
+
+  /* Fail to resolve the second entry */
+  UT_SetDeferredRetcode(UT_KEY(MM_ResolveSymAddr), 2, OS_ERROR_NAME_LENGTH);
+
+  /* Execute the function being tested */
+  Result = MM_BatchPeekCmd(&CmdPacket);
+
+  /* Verify results, no entry is read */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ResolveSymAddr, 2);
+  UtAssert_STUB_COUNT(MM_PeekValue, 0);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Symbolic address can't be resolved: Name = '%s'");
+  MM_Test_Verify_Event(1, MM_BATCH_PEEK_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Batch peek error: Entry %u of %u rejected");
+}
+
+void Test_MM_BatchPeekCmd_NoVerifyPeekPokeParams(void) {
+  MM_BatchPeekCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.NumEntries = 3;
+
+  /* Fail the checks on the last entry */
+  UT_SetDeferredRetcode(UT_KEY(MM_VerifyPeekPokeParams), 3, OS_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_BatchPeekCmd(&CmdPacket);
+
+  /* Verify results, no entry is read */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_VerifyPeekPokeParams, 3);
+  UtAssert_STUB_COUNT(MM_PeekValue, 0);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_BATCH_PEEK_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Batch peek error: Entry %u of %u rejected");
+}
+
+void Test_MM_BatchPeekCmd_PeekErr(void) {
+  MM_BatchPeekCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.NumEntries = 3;
+
+  /* Fail the read of the second entry */
+  UT_SetDeferredRetcode(UT_KEY(MM_PeekValue), 2, CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_BatchPeekCmd(&CmdPacket);
+
+  /* Verify results, the remaining entry is not read */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_PeekValue, 2);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "PSP read memory error: RC=%d, Address=%p, "
+                       "MemType=MEM%u");
+}
+
+/*
+ * Returns the number of MM_PeekValue calls so far as the value read
+ */
+void UT_Handler_MM_PeekValue_Count(void *UserObj, UT_EntryKey_t FuncKey,
+                                   const UT_StubContext_t *Context) {
+  uint32 *Count = UserObj;
+  uint32 *DataValue =
+      UT_Hook_GetArgValueByName(Context, "DataValue", uint32 *);
+
+  (*Count)++;
+  *DataValue = *Count;
+}
+
+/*
+ * Records the values written by MM_PokeValue or MM_WriteEepromValue and
+ * returns a status per call
+ */
+typedef struct {
+  uint32 NumCalls;
+  int32 Status[8];
+  uint32 DataValue[8];
+} UT_PokeValueLog_t;
+
+void UT_Handler_MM_PokeValue(void *UserObj, UT_EntryKey_t FuncKey,
+                             const UT_StubContext_t *Context) {
+  UT_PokeValueLog_t *Log = UserObj;
+
+  if (Log->NumCalls < 8) {
+    Log->DataValue[Log->NumCalls] =
+        UT_Hook_GetArgValueByName(Context, "DataValue", uint32);
+    UT_Stub_SetReturnValue(FuncKey, Log->Status[Log->NumCalls]);
+  }
+  Log->NumCalls++;
+}
+
+void Test_MM_BatchPokeCmd_Nominal(void) {
+  MM_BatchPokeCmd_t CmdPacket;
+  CFE_Status_t Result;
+  cpuaddr SymAddr = 0x40;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.NumEntries = 2;
+  CmdPacket.Payload.Entries[0].MemType = MM_MemType_EEPROM;
+  CmdPacket.Payload.Entries[0].DataSize = MM_INTERNAL_BYTE_BIT_WIDTH;
+  CmdPacket.Payload.Entries[1].MemType = MM_MemType_RAM;
+  CmdPacket.Payload.Entries[1].DataSize = MM_INTERNAL_DWORD_BIT_WIDTH;
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+
+  /* Execute the function being tested */
+  Result = MM_BatchPokeCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_STUB_COUNT(MM_VerifyPeekPokeParams, 2);
+  UtAssert_STUB_COUNT(MM_PeekValue, 2);
+  UtAssert_STUB_COUNT(MM_WriteEepromValue, 1);
+  UtAssert_STUB_COUNT(MM_PokeValue, 1);
+  UtAssert_STUB_COUNT(MM_PokeEeprom, 0);
+
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_BATCH_POKE);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.MemType, MM_MemType_EEPROM);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), SymAddr);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.DataValue, 2);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed, 5);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_BATCH_POKE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                       "Batch Poke Command: %u entries, %u bytes written");
+}
+
+void Test_MM_BatchPokeCmd_NoEntries(void) {
+  MM_BatchPokeCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+
+  /* Execute the function being tested */
+  Result = MM_BatchPokeCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+  UtAssert_STUB_COUNT(MM_PokeValue, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_BATCH_POKE_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Batch poke error: NumEntries = %u, max = %u");
+}
+
+void Test_MM_BatchPokeCmd_TooManyEntries(void) {
+  MM_BatchPokeCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.NumEntries = MM_INTERFACE_MAX_BATCH_POKE_ENTRIES + 1;
+
+  /* Execute the function being tested */
+  Result = MM_BatchPokeCmd(&CmdPacket);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+  UtAssert_STUB_COUNT(MM_PokeValue, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_BATCH_POKE_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Batch poke error: NumEntries = %u, max = %u");
+}
+
+void Test_MM_BatchPokeCmd_SymNameError(void) {
+  MM_BatchPokeCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.NumEntries = 3;
+
+  /* Fail to resolve the last entry */
+  UT_SetDeferredRetcode(UT_KEY(MM_ResolveSymAddr), 3, OS_ERROR_NAME_LENGTH);
+
+  /* Execute the function being tested */
+  Result = MM_BatchPokeCmd(&CmdPacket);
+
+  /* Verify results, nothing is read or written */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_PeekValue, 0);
+  UtAssert_STUB_COUNT(MM_PokeValue, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Symbolic address can't be resolved: Name = '%s'");
+  MM_Test_Verify_Event(1, MM_BATCH_POKE_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Batch poke error: Entry %u of %u rejected");
+}
+
+void Test_MM_BatchPokeCmd_NoVerifyPeekPokeParams(void) {
+  MM_BatchPokeCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.NumEntries = 3;
+
+  /* Fail the checks on the second entry */
+  UT_SetDeferredRetcode(UT_KEY(MM_VerifyPeekPokeParams), 2, OS_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_BatchPokeCmd(&CmdPacket);
+
+  /* Verify results, nothing is read or written */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_VerifyPeekPokeParams, 2);
+  UtAssert_STUB_COUNT(MM_PeekValue, 0);
+  UtAssert_STUB_COUNT(MM_PokeValue, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_BATCH_POKE_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Batch poke error: Entry %u of %u rejected");
+}
+
+void Test_MM_BatchPokeCmd_PeekErr(void) {
+  MM_BatchPokeCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.NumEntries = 3;
+
+  /* Fail to save the current value of the second entry */
+  UT_SetDeferredRetcode(UT_KEY(MM_PeekValue), 2, CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_BatchPokeCmd(&CmdPacket);
+
+  /* Verify results, nothing is written */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_PeekValue, 2);
+  UtAssert_STUB_COUNT(MM_PokeValue, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "PSP read memory error: RC=%d, Address=%p, "
+                       "MemType=MEM%u");
+}
+
+void Test_MM_BatchPokeCmd_FirstPokeErr(void) {
+  MM_BatchPokeCmd_t CmdPacket;
+  CFE_Status_t Result;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.NumEntries = 3;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_PokeValue), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_BatchPokeCmd(&CmdPacket);
+
+  /* Verify results, there is nothing to restore */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_PokeValue, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "PSP write memory error: RC=0x%08X, Address=%p, MemType=MEM%u");
+}
+
+void Test_MM_BatchPokeCmd_Rollback(void) {
+  MM_BatchPokeCmd_t CmdPacket;
+  CFE_Status_t Result;
+  uint32 PeekCount = 0;
+  UT_PokeValueLog_t PokeLog;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.NumEntries = 4;
+  CmdPacket.Payload.Entries[0].Data = 0x10;
+  CmdPacket.Payload.Entries[1].Data = 0x20;
+  CmdPacket.Payload.Entries[2].Data = 0x30;
+  CmdPacket.Payload.Entries[3].Data = 0x40;
+
+  /* Fail the write of the third entry */
+  memset(&PokeLog, 0, sizeof(PokeLog));
+  PokeLog.Status[2] = CFE_PSP_ERROR;
+
+  UT_SetHandlerFunction(UT_KEY(MM_PeekValue), UT_Handler_MM_PeekValue_Count,
+                        &PeekCount);
+  UT_SetHandlerFunction(UT_KEY(MM_PokeValue), UT_Handler_MM_PokeValue,
+                        &PokeLog);
+
+  /* Execute the function being tested */
+  Result = MM_BatchPokeCmd(&CmdPacket);
+
+  /* Verify results, the two entries written are restored newest first */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_PeekValue, 4);
+  UtAssert_UINT32_EQ(PokeLog.NumCalls, 5);
+  UtAssert_UINT32_EQ(PokeLog.DataValue[0], 0x10);
+  UtAssert_UINT32_EQ(PokeLog.DataValue[1], 0x20);
+  UtAssert_UINT32_EQ(PokeLog.DataValue[2], 0x30);
+  UtAssert_UINT32_EQ(PokeLog.DataValue[3], 2);
+  UtAssert_UINT32_EQ(PokeLog.DataValue[4], 1);
+  UtAssert_STUB_COUNT(MM_ResetHk, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+  MM_Test_Verify_Event(
+      0, MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "PSP write memory error: RC=0x%08X, Address=%p, MemType=MEM%u");
+  MM_Test_Verify_Event(1, MM_BATCH_POKE_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Batch poke error: Entry %u write failed, %u of %u "
+                       "written entries restored");
+}
+
+void Test_MM_BatchPokeCmd_RollbackErr(void) {
+  MM_BatchPokeCmd_t CmdPacket;
+  CFE_Status_t Result;
+  UT_PokeValueLog_t PokeLog;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.NumEntries = 3;
+
+  /* Fail the write of the third entry and the restore of the second */
+  memset(&PokeLog, 0, sizeof(PokeLog));
+  PokeLog.Status[2] = CFE_PSP_ERROR;
+  PokeLog.Status[3] = CFE_PSP_ERROR;
+
+  UT_SetHandlerFunction(UT_KEY(MM_PokeValue), UT_Handler_MM_PokeValue,
+                        &PokeLog);
+
+  /* Execute the function being tested */
+  Result = MM_BatchPokeCmd(&CmdPacket);
+
+  /* Verify results, the first entry is still restored */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_UINT32_EQ(PokeLog.NumCalls, 5);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+  MM_Test_Verify_Event(
+      1, MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "PSP write memory error: RC=0x%08X, Address=%p, MemType=MEM%u");
+  MM_Test_Verify_Event(2, MM_BATCH_POKE_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Batch poke error: Entry %u write failed, %u of %u "
+                       "written entries restored");
+}
+
+void Test_MM_BatchPokeCmd_RollbackEeprom(void) {
+  MM_BatchPokeCmd_t CmdPacket;
+  CFE_Status_t Result;
+  uint32 PeekCount = 0;
+  UT_PokeValueLog_t EepromLog;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.NumEntries = 2;
+  CmdPacket.Payload.Entries[0].MemType = MM_MemType_EEPROM;
+  CmdPacket.Payload.Entries[0].DataSize = MM_INTERNAL_WORD_BIT_WIDTH;
+  CmdPacket.Payload.Entries[0].Data = 0x1234;
+  CmdPacket.Payload.Entries[1].MemType = MM_MemType_RAM;
+  CmdPacket.Payload.Entries[1].DataSize = MM_INTERNAL_BYTE_BIT_WIDTH;
+
+  /* The RAM entry fails so the EEPROM entry is restored */
+  memset(&EepromLog, 0, sizeof(EepromLog));
+  UT_SetHandlerFunction(UT_KEY(MM_PeekValue), UT_Handler_MM_PeekValue_Count,
+                        &PeekCount);
+  UT_SetHandlerFunction(UT_KEY(MM_WriteEepromValue), UT_Handler_MM_PokeValue,
+                        &EepromLog);
+  UT_SetDefaultReturnValue(UT_KEY(MM_PokeValue), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_BatchPokeCmd(&CmdPacket);
+
+  /* Verify results, neither EEPROM write is reported as a poke */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_PokeValue, 1);
+  UtAssert_STUB_COUNT(MM_PokeEeprom, 0);
+  UtAssert_STUB_COUNT(MM_ResetHk, 1);
+  UtAssert_UINT32_EQ(EepromLog.NumCalls, 2);
+  UtAssert_UINT32_EQ(EepromLog.DataValue[0], 0x1234);
+  UtAssert_UINT32_EQ(EepromLog.DataValue[1], 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+  MM_Test_Verify_Event(
+      0, MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "PSP write memory error: RC=0x%08X, Address=%p, MemType=MEM%u");
+  MM_Test_Verify_Event(1, MM_BATCH_POKE_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Batch poke error: Entry %u write failed, %u of %u "
+                       "written entries restored");
+}
+
+void Test_MM_SetWatchEntryCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_SetWatchEntryCmd_t SetWatchEntryCmd;
+  cpuaddr SymAddr = 0x42;
+
+  memset(&SetWatchEntryCmd, 0, sizeof(SetWatchEntryCmd));
+
+  SetWatchEntryCmd.Payload.EntryNum = MM_INTERFACE_MAX_WATCH_ENTRIES - 1;
+  SetWatchEntryCmd.Payload.MemType = MM_MemType_MEM16;
+  SetWatchEntryCmd.Payload.DataSize = MM_INTERNAL_WORD_BIT_WIDTH;
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+
+  /* Execute the function being tested */
+  Result = MM_SetWatchEntryCmd(&SetWatchEntryCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_STUB_COUNT(MM_VerifyPeekPokeParams, 1);
+
+  UtAssert_UINT8_EQ(
+      MM_AppData.Sampler.Entries[MM_INTERFACE_MAX_WATCH_ENTRIES - 1].MemType,
+      MM_MemType_MEM16);
+  UtAssert_ADDRESS_EQ(
+      MM_AppData.Sampler.Entries[MM_INTERFACE_MAX_WATCH_ENTRIES - 1].Address,
+      SymAddr);
+  UtAssert_UINT32_EQ(
+      MM_AppData.Sampler.Entries[MM_INTERFACE_MAX_WATCH_ENTRIES - 1].DataSize,
+      MM_INTERNAL_WORD_BIT_WIDTH);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_WATCH_ENTRY_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Set Watch Entry Command: Entry = %u Addr = %p "
+                       "Size = %u bits");
+}
+
+void Test_MM_SetWatchEntryCmd_EntryNumError(void) {
+  CFE_Status_t Result;
+  MM_SetWatchEntryCmd_t SetWatchEntryCmd;
+
+  memset(&SetWatchEntryCmd, 0, sizeof(SetWatchEntryCmd));
+
+  /* Set to generate error message MM_WATCH_ENTRY_ERR_EID */
+  SetWatchEntryCmd.Payload.EntryNum = MM_INTERFACE_MAX_WATCH_ENTRIES;
+
+  /* Execute the function being tested */
+  Result = MM_SetWatchEntryCmd(&SetWatchEntryCmd);
+
+  /* Verify results */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_DMP_MEM_FILE_INF_EID,
-                       CFE_EVS_EventType_INFORMATION,
-                       "Dump Memory To File Command: Dumped %d bytes from "
-                       "address %p to file '%s'");
+  MM_Test_Verify_Event(0, MM_WATCH_ENTRY_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Watch entry number invalid: Entry = %u Max = %u");
 }
 
-void Test_MM_DumpMemToFileCmd_ComputeCRCError(void) {
+void Test_MM_SetWatchEntryCmd_SymNameError(void) {
   CFE_Status_t Result;
-  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
-  MM_LoadDumpFileHeader_t MMFileHeader;
-
-  memset(&MMFileHeader, 0, sizeof(MM_LoadDumpFileHeader_t));
-
-  MMFileHeader.MemType = MM_MemType_RAM;
-
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMemToFile), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_lseek),
-                           sizeof(CFE_FS_Header_t) +
-                               sizeof(MM_LoadDumpFileHeader_t));
+  MM_SetWatchEntryCmd_t SetWatchEntryCmd;
 
-  UT_SetHandlerFunction(UT_KEY(MM_WriteFileHeaders),
-                        UT_Handler_MM_WriteFileHeaders, &MMFileHeader);
+  memset(&SetWatchEntryCmd, 0, sizeof(SetWatchEntryCmd));
 
-  /* Set to generate error message MM_COMPUTECRCFROMFILE_ERR_EID */
-  UT_SetDefaultReturnValue(UT_KEY(MM_ComputeCRCFromFile), OS_ERROR);
+  /* Set to generate error message MM_SYMNAME_ERR_EID */
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR_NAME_LENGTH);
 
   /* Execute the function being tested */
-  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+  Result = MM_SetWatchEntryCmd(&SetWatchEntryCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_VerifyPeekPokeParams, 0);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(
-      0, MM_COMPUTECRCFROMFILE_ERR_EID, CFE_EVS_EventType_ERROR,
-      "MM_ComputeCRCFromFile error received: RC = 0x%08X File = '%s'");
+  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Symbolic address can't be resolved: Name = '%s'");
 }
 
-void Test_MM_DumpMemToFileCmd_CloseError(void) {
+void Test_MM_SetWatchEntryCmd_NoVerifyPeekPokeParams(void) {
   CFE_Status_t Result;
-  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
+  MM_SetWatchEntryCmd_t SetWatchEntryCmd;
 
-  memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
+  memset(&SetWatchEntryCmd, 0, sizeof(SetWatchEntryCmd));
+  SetWatchEntryCmd.Payload.DataSize = MM_INTERNAL_DWORD_BIT_WIDTH;
 
-  DumpMemToFileCmd.Payload.MemType = MM_MemType_MEM8;
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyPeekPokeParams), OS_ERROR);
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_MemValidateRange), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMem8ToFile), CFE_PSP_SUCCESS);
+  /* Execute the function being tested */
+  Result = MM_SetWatchEntryCmd(&SetWatchEntryCmd);
 
-  /* Set to generate error message MM_OS_CLOSE_ERR_EID */
-  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_ERROR);
+  /* Verify results, the entry is not defined */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_UINT32_EQ(MM_AppData.Sampler.Entries[0].DataSize, 0);
+
+  /* Error event is issued in MM_VerifyPeekPokeParams */
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_ClearWatchEntryCmd_Nominal(void) {
+  CFE_Status_t Result;
+  MM_ClearWatchEntryCmd_t ClearWatchEntryCmd;
+
+  memset(&ClearWatchEntryCmd, 0, sizeof(ClearWatchEntryCmd));
+
+  ClearWatchEntryCmd.Payload.EntryNum = 1;
+  MM_AppData.Sampler.Entries[1].Address = 0x1000;
+  MM_AppData.Sampler.Entries[1].DataSize = MM_INTERNAL_BYTE_BIT_WIDTH;
 
   /* Execute the function being tested */
-  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+  Result = MM_ClearWatchEntryCmd(&ClearWatchEntryCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
-
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_ADDRESS_EQ(MM_AppData.Sampler.Entries[1].Address, 0);
+  UtAssert_UINT32_EQ(MM_AppData.Sampler.Entries[1].DataSize, 0);
 
-  MM_Test_Verify_Event(0, MM_DMP_MEM_FILE_INF_EID,
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_WATCH_ENTRY_INF_EID,
                        CFE_EVS_EventType_INFORMATION,
-                       "Dump Memory To File Command: Dumped %d bytes from "
-                       "address %p to file '%s'");
-
-  MM_Test_Verify_Event(1, MM_OS_CLOSE_ERR_EID, CFE_EVS_EventType_ERROR,
-                       "OS_close error received: RC = 0x%08X File = '%s'");
+                       "Clear Watch Entry Command: Entry = %u");
 }
 
-void Test_MM_DumpMemToFileCmd_CreatError(void) {
+void Test_MM_ClearWatchEntryCmd_EntryNumError(void) {
   CFE_Status_t Result;
-  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
+  MM_ClearWatchEntryCmd_t ClearWatchEntryCmd;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+  memset(&ClearWatchEntryCmd, 0, sizeof(ClearWatchEntryCmd));
+
+  /* Set to generate error message MM_WATCH_ENTRY_ERR_EID */
+  ClearWatchEntryCmd.Payload.EntryNum = MM_INTERFACE_MAX_WATCH_ENTRIES;
 
   /* Execute the function being tested */
-  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+  Result = MM_ClearWatchEntryCmd(&ClearWatchEntryCmd);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
@@ -1821,277 +5106,400 @@ void Test_MM_DumpMemToFileCmd_CreatError(void) {
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_OS_CREAT_ERR_EID, CFE_EVS_EventType_ERROR,
-                       "OS_OpenCreate error received: RC = %d File = '%s'");
+  MM_Test_Verify_Event(0, MM_WATCH_ENTRY_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Watch entry number invalid: Entry = %u Max = %u");
 }
 
-void Test_MM_DumpMemToFileCmd_InvalidDumpResult(void) {
+void Test_MM_SetSamplePeriodCmd_Nominal(void) {
   CFE_Status_t Result;
-  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
-
-  memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
+  MM_SetSamplePeriodCmd_t SetSamplePeriodCmd;
 
-  DumpMemToFileCmd.Payload.MemType = MM_MemType_MEM8;
+  memset(&SetSamplePeriodCmd, 0, sizeof(SetSamplePeriodCmd));
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMem8ToFile),
-                           CFE_PSP_ERROR_NOT_IMPLEMENTED);
+  SetSamplePeriodCmd.Payload.Period = 4;
+  MM_AppData.Sampler.Count = 3;
 
   /* Execute the function being tested */
-  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+  Result = MM_SetSamplePeriodCmd(&SetSamplePeriodCmd);
 
-  /* Verify results */
+  /* Verify results, a full period starts now */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_UINT32_EQ(MM_AppData.Sampler.Period, 4);
+  UtAssert_UINT32_EQ(MM_AppData.Sampler.Count, 0);
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SAMPLE_PERIOD_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Set Sample Period Command: Period = %u");
 }
 
-void Test_MM_DumpMemToFileCmd_lseekError(void) {
+void Test_MM_MaskedPokeCmd_Nominal(void) {
+  MM_MaskedPokeCmd_t CmdPacket;
+  UT_PokeValueLog_t PokeLog;
   CFE_Status_t Result;
-  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
-
-  memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
+  cpuaddr SymAddr = 0xA5A4;
 
-  DumpMemToFileCmd.Payload.MemType = MM_MemType_MEM8;
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  memset(&PokeLog, 0, sizeof(PokeLog));
+  CmdPacket.Payload.MemType = MM_MemType_MEM16;
+  CmdPacket.Payload.DataSize = MM_INTERNAL_WORD_BIT_WIDTH;
+  CmdPacket.Payload.Data = 0xFFFF00FF;
+  CmdPacket.Payload.Mask = 0xFFFF0F0F;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMem8ToFile), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_lseek), OS_ERROR);
+  /* The current value read is the address */
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+  UT_SetHandlerFunction(UT_KEY(MM_PeekValue), UT_Handler_MM_PeekValue, NULL);
+  UT_SetHandlerFunction(UT_KEY(MM_PokeValue), UT_Handler_MM_PokeValue,
+                        &PokeLog);
 
   /* Execute the function being tested */
-  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+  Result = MM_MaskedPokeCmd(&CmdPacket);
 
-  /* Verify results */
+  /* Verify results, only the masked bits change */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_STUB_COUNT(MM_VerifyPeekPokeParams, 1);
+  UtAssert_STUB_COUNT(MM_PeekValue, 1);
+  UtAssert_UINT32_EQ(PokeLog.NumCalls, 1);
+  UtAssert_UINT32_EQ(PokeLog.DataValue[0], 0xA0AF);
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_MASKED_POKE);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.MemType, MM_MemType_MEM16);
+  UtAssert_ADDRESS_EQ(MM_AppData.HkTlm.Payload.Address, SymAddr);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.DataValue, 0xA0AF);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed, 2);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_MASKED_POKE_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Masked Poke Command: Addr = %p Size = %u bits "
+                       "Old = 0x%08X New = 0x%08X");
 }
 
-void Test_MM_DumpMemToFileCmd_SymNameError(void) {
+void Test_MM_MaskedPokeCmd_SymNameError(void) {
+  MM_MaskedPokeCmd_t CmdPacket;
   CFE_Status_t Result;
-  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR);
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+
+  /* Set to generate error message MM_SYMNAME_ERR_EID */
+  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR_NAME_LENGTH);
 
   /* Execute the function being tested */
-  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+  Result = MM_MaskedPokeCmd(&CmdPacket);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_VerifyPeekPokeParams, 0);
+  UtAssert_STUB_COUNT(MM_PeekValue, 0);
+  UtAssert_STUB_COUNT(MM_PokeValue, 0);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
   MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
                        "Symbolic address can't be resolved: Name = '%s'");
 }
 
-void Test_MM_DumpMemToFileCmd_NoVerifyDumpParams(void) {
+void Test_MM_MaskedPokeCmd_NoVerifyPeekPokeParams(void) {
+  MM_MaskedPokeCmd_t CmdPacket;
   CFE_Status_t Result;
-  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_ERROR);
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyPeekPokeParams), OS_ERROR);
 
   /* Execute the function being tested */
-  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+  Result = MM_MaskedPokeCmd(&CmdPacket);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_PeekValue, 0);
+  UtAssert_STUB_COUNT(MM_PokeValue, 0);
 
+  /* Error event is issued in MM_VerifyPeekPokeParams */
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_MM_DumpMemToFileCmd_NoWriteHeaders(void) {
+void Test_MM_MaskedPokeCmd_ReadError(void) {
+  MM_MaskedPokeCmd_t CmdPacket;
   CFE_Status_t Result;
-  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_ERR_INVALID_SIZE);
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.DataSize = MM_INTERNAL_BYTE_BIT_WIDTH;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_PeekValue), CFE_PSP_ERROR);
 
   /* Execute the function being tested */
-  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+  Result = MM_MaskedPokeCmd(&CmdPacket);
 
-  /* Verify results */
+  /* Verify results, nothing is written */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_PokeValue, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "PSP read memory error: RC=%d, Address=%p, "
+                       "MemType=MEM%u");
 }
 
-void Test_MM_DumpMemToFileCmd_BadType(void) {
+void Test_MM_MaskedPokeCmd_WriteError(void) {
+  MM_MaskedPokeCmd_t CmdPacket;
   CFE_Status_t Result;
-  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
-
-  memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
 
-  DumpMemToFileCmd.Payload.MemType = 99;
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.MemType = MM_MemType_EEPROM;
+  CmdPacket.Payload.DataSize = MM_INTERNAL_DWORD_BIT_WIDTH;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_close), OS_SUCCESS);
+  UT_SetDefaultReturnValue(UT_KEY(MM_PokeValue), CFE_PSP_ERROR);
 
   /* Execute the function being tested */
-  Result = MM_DumpMemToFileCmd(&DumpMemToFileCmd);
+  Result = MM_MaskedPokeCmd(&CmdPacket);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_NOACTION);
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "PSP write memory error: RC=0x%08X, Address=%p, MemType=MEM%u");
 }
 
-void Test_MM_DumpMemToFileCmd_ReWriteHeadersErr(void) {
+void Test_MM_MaskedPokeCmd_Eeprom(void) {
+  MM_MaskedPokeCmd_t CmdPacket;
+  UT_PokeValueLog_t EepromLog;
   CFE_Status_t Result;
-  MM_DumpMemToFileCmd_t DumpMemToFileCmd;
-  cpuaddr SymAddr;
-
-  memset(&(DumpMemToFileCmd.Payload), 0, sizeof(MM_DumpMemToFileCmd_Payload_t));
-
-  SymAddr = 0x42;
-  DumpMemToFileCmd.Payload.MemType = MM_MemType_RAM;
-  DumpMemToFileCmd.Payload.NumOfBytes = 50;
-  strncpy(DumpMemToFileCmd.Payload.FileName, "filename_RAM",
-          sizeof(DumpMemToFileCmd.Payload.FileName) - 1);
+  cpuaddr SymAddr = 0x12;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_WriteFileHeaders), OS_SUCCESS);
-  UT_SetDeferredRetcode(UT_KEY(MM_WriteFileHeaders), 2, OS_ERR_INVALID_SIZE);
-  UT_SetDefaultReturnValue(UT_KEY(MM_DumpMemToFile), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(OS_lseek),
-                           sizeof(CFE_FS_Header_t) +
-                               sizeof(MM_LoadDumpFileHeader_t));
-  UT_SetDefaultReturnValue(UT_KEY(MM_ComputeCRCFromFile), OS_SUCCESS);
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  memset(&EepromLog, 0, sizeof(EepromLog));
+  CmdPacket.Payload.MemType = MM_MemType_EEPROM;
+  CmdPacket.Payload.DataSize = MM_INTERNAL_BYTE_BIT_WIDTH;
+  CmdPacket.Payload.Data = 0xF0;
+  CmdPacket.Payload.Mask = 0xF0;
 
+  /* The current value read is the address */
   UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
                         &SymAddr);
+  UT_SetHandlerFunction(UT_KEY(MM_PeekValue), UT_Handler_MM_PeekValue, NULL);
+  UT_SetHandlerFunction(UT_KEY(MM_WriteEepromValue), UT_Handler_MM_PokeValue,
+                        &EepromLog);
 
   /* Execute the function being tested */
-  Result = MM_DumpMemToFileCmd(&(DumpMemToFileCmd));
+  Result = MM_MaskedPokeCmd(&CmdPacket);
 
-  /* Verify results */
+  /*
+  ** Verify results, EEPROM is written through the EEPROM write helper,
+  ** which sends no events, so the masked poke event is the only one
+  */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
-  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_STUB_COUNT(MM_PokeValue, 0);
+  UtAssert_STUB_COUNT(MM_PokeEeprom, 0);
+  UtAssert_UINT32_EQ(EepromLog.NumCalls, 1);
+  UtAssert_UINT32_EQ(EepromLog.DataValue[0], 0xF2);
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_MASKED_POKE);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.MemType, MM_MemType_EEPROM);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_MASKED_POKE_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Masked Poke Command: Addr = %p Size = %u bits "
+                       "Old = 0x%08X New = 0x%08X");
 }
 
-void Test_MM_DumpInEventCmd_Nominal(void) {
+void Test_MM_ConditionalPokeCmd_Nominal(void) {
+  MM_ConditionalPokeCmd_t CmdPacket;
+  UT_PokeValueLog_t PokeLog;
   CFE_Status_t Result;
-  MM_DumpInEventCmd_t DumpInEventCmd;
-  cpuaddr SymAddr;
+  cpuaddr SymAddr = 0x34;
 
-  memset(&(DumpInEventCmd.Payload), 0, sizeof(MM_DumpInEventCmd_Payload_t));
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  memset(&PokeLog, 0, sizeof(PokeLog));
+  CmdPacket.Payload.MemType = MM_MemType_RAM;
+  CmdPacket.Payload.DataSize = MM_INTERNAL_BYTE_BIT_WIDTH;
+  CmdPacket.Payload.Expected = 0x0034;
+  CmdPacket.Payload.Data = 0x0156;
 
-  SymAddr = 0x42;
-  DumpInEventCmd.Payload.NumOfBytes = 1;
-  DumpInEventCmd.Payload.MemType = MM_MemType_EEPROM;
+  /* The current value read is the address */
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+  UT_SetHandlerFunction(UT_KEY(MM_PeekValue), UT_Handler_MM_PeekValue, NULL);
+  UT_SetHandlerFunction(UT_KEY(MM_PokeValue), UT_Handler_MM_PokeValue,
+                        &PokeLog);
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_FillDumpInEventBuffer), CFE_PSP_SUCCESS);
+  /* Execute the function being tested */
+  Result = MM_ConditionalPokeCmd(&CmdPacket);
+
+  /* Verify results, the data is truncated to the data size */
+  UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
+  UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_UINT32_EQ(PokeLog.NumCalls, 1);
+  UtAssert_UINT32_EQ(PokeLog.DataValue[0], 0x56);
+
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_COND_POKE);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.MemType, MM_MemType_RAM);
+  UtAssert_ADDRESS_EQ(MM_AppData.HkTlm.Payload.Address, SymAddr);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.DataValue, 0x56);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_COND_POKE_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Conditional Poke Command: Addr = %p Size = %u bits "
+                       "Old = 0x%08X New = 0x%08X");
+}
+
+void Test_MM_ConditionalPokeCmd_Eeprom(void) {
+  MM_ConditionalPokeCmd_t CmdPacket;
+  UT_PokeValueLog_t EepromLog;
+  CFE_Status_t Result;
+  cpuaddr SymAddr = 0x1234;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  memset(&EepromLog, 0, sizeof(EepromLog));
+  CmdPacket.Payload.MemType = MM_MemType_EEPROM;
+  CmdPacket.Payload.DataSize = MM_INTERNAL_WORD_BIT_WIDTH;
+  CmdPacket.Payload.Expected = 0x1234;
+  CmdPacket.Payload.Data = 0x5678;
 
+  /* The current value read is the address */
   UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
                         &SymAddr);
+  UT_SetHandlerFunction(UT_KEY(MM_PeekValue), UT_Handler_MM_PeekValue, NULL);
+  UT_SetHandlerFunction(UT_KEY(MM_WriteEepromValue), UT_Handler_MM_PokeValue,
+                        &EepromLog);
 
   /* Execute the function being tested */
-  Result = MM_DumpInEventCmd(&DumpInEventCmd);
+  Result = MM_ConditionalPokeCmd(&CmdPacket);
 
-  /* Verify results */
+  /* Verify results, the EEPROM write is not reported as a poke */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 1);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_STUB_COUNT(MM_PokeEeprom, 0);
+  UtAssert_STUB_COUNT(MM_PokeValue, 0);
+  UtAssert_UINT32_EQ(EepromLog.NumCalls, 1);
+  UtAssert_UINT32_EQ(EepromLog.DataValue[0], 0x5678);
 
   UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction,
-                    MM_LastAction_DUMP_INEVENT);
-  UtAssert_EQ(MM_MemType_Enum_t, MM_AppData.HkTlm.Payload.MemType,
-              DumpInEventCmd.Payload.MemType);
-  UtAssert_ADDRESS_EQ(
-      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), SymAddr);
-  UtAssert_EQ(size_t, MM_AppData.HkTlm.Payload.BytesProcessed,
-              DumpInEventCmd.Payload.NumOfBytes);
+                    MM_LastAction_COND_POKE);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.MemType, MM_MemType_EEPROM);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_DUMP_INEVENT_INF_EID,
-                       CFE_EVS_EventType_INFORMATION, "%s");
+  MM_Test_Verify_Event(0, MM_COND_POKE_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Conditional Poke Command: Addr = %p Size = %u bits "
+                       "Old = 0x%08X New = 0x%08X");
 }
 
-void Test_MM_DumpInEventCmd_SymNameError(void) {
+void Test_MM_ConditionalPokeCmd_Mismatch(void) {
+  MM_ConditionalPokeCmd_t CmdPacket;
   CFE_Status_t Result;
-  MM_DumpInEventCmd_t DumpInEventCmd;
+  cpuaddr SymAddr = 0x12345678;
 
-  /* Set to generate error message MM_SYMNAME_ERR_EID */
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_ERROR_NAME_LENGTH);
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.MemType = MM_MemType_MEM32;
+  CmdPacket.Payload.DataSize = MM_INTERNAL_DWORD_BIT_WIDTH;
+  CmdPacket.Payload.Expected = 0x12345679;
+  CmdPacket.Payload.Data = 0xCAFEF00D;
+
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+  UT_SetHandlerFunction(UT_KEY(MM_PeekValue), UT_Handler_MM_PeekValue, NULL);
 
   /* Execute the function being tested */
-  Result = MM_DumpInEventCmd(&DumpInEventCmd);
+  Result = MM_ConditionalPokeCmd(&CmdPacket);
 
-  /* Verify results */
+  /* Verify results, nothing is written */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_PeekValue, 1);
+  UtAssert_STUB_COUNT(MM_PokeValue, 0);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
-                       "Symbolic address can't be resolved: Name = '%s'");
+  MM_Test_Verify_Event(0, MM_COND_POKE_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Conditional Poke not written: Addr = %p "
+                       "Expected = 0x%08X Actual = 0x%08X");
 }
 
-void Test_MM_DumpInEventCmd_NoVerifyDumpParams(void) {
+void Test_MM_ConditionalPokeCmd_WriteError(void) {
+  MM_ConditionalPokeCmd_t CmdPacket;
   CFE_Status_t Result;
-  MM_DumpInEventCmd_t DumpInEventCmd;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_ERROR);
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.MemType = MM_MemType_EEPROM;
+  CmdPacket.Payload.DataSize = MM_INTERNAL_WORD_BIT_WIDTH;
+
+  /* The current value read is zero, which is the expected value */
+  UT_SetDefaultReturnValue(UT_KEY(MM_PokeValue), CFE_PSP_ERROR);
 
   /* Execute the function being tested */
-  Result = MM_DumpInEventCmd(&DumpInEventCmd);
+  Result = MM_ConditionalPokeCmd(&CmdPacket);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_PokeValue, 1);
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "PSP write memory error: RC=0x%08X, Address=%p, MemType=MEM%u");
 }
 
-void Test_MM_DumpInEventCmd_FillDumpInvalid(void) {
+void Test_MM_ConditionalPokeCmd_EepromError(void) {
+  MM_ConditionalPokeCmd_t CmdPacket;
   CFE_Status_t Result;
-  MM_DumpInEventCmd_t DumpInEventCmd;
+  cpuaddr SymAddr = 0x34;
 
-  UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), OS_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), CFE_PSP_SUCCESS);
-  UT_SetDefaultReturnValue(UT_KEY(MM_FillDumpInEventBuffer),
-                           CFE_PSP_ERROR_NOT_IMPLEMENTED);
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  CmdPacket.Payload.MemType = MM_MemType_EEPROM;
+  CmdPacket.Payload.DataSize = MM_INTERNAL_BYTE_BIT_WIDTH;
+  CmdPacket.Payload.Expected = 0x34;
+
+  /* Set to generate error message MM_PSP_WRITE_ERR_EID */
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr), UT_Handler_MM_ResolveSymAddr,
+                        &SymAddr);
+  UT_SetHandlerFunction(UT_KEY(MM_PeekValue), UT_Handler_MM_PeekValue, NULL);
+  UT_SetDefaultReturnValue(UT_KEY(MM_WriteEepromValue), CFE_PSP_ERROR);
 
   /* Execute the function being tested */
-  Result = MM_DumpInEventCmd(&DumpInEventCmd);
+  Result = MM_ConditionalPokeCmd(&CmdPacket);
 
   /* Verify results */
   UtAssert_EQ(CFE_Status_t, Result, CFE_SUCCESS);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+  UtAssert_STUB_COUNT(MM_WriteEepromValue, 1);
+  UtAssert_STUB_COUNT(MM_PokeEeprom, 0);
+  UtAssert_STUB_COUNT(MM_PokeValue, 0);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.LastAction, 0);
 
-  /* Error event is issued in MM_FillDumpInEventBuffer and thus not visible here
-   */
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "PSP write memory error: RC=0x%08X, Address=%p, MemType=MEM%u");
 }
 
 /*
@@ -2134,6 +5542,16 @@ void UtTest_Setup(void) {
   ADD_TEST(Test_MM_LoadMemFromFileCmd_SymNameError);
   ADD_TEST(Test_MM_LoadMemFromFileCmd_LoadFileCRCError);
   ADD_TEST(Test_MM_LoadMemFromFileCmd_ComputeCRCError);
+  ADD_TEST(Test_MM_LoadMemFromFileCmd_Staged);
+  ADD_TEST(Test_MM_LoadMemFromFileCmd_StagedCommitError);
+  ADD_TEST(Test_MM_LoadMemFromFileCmd_StagedCRCError);
+  ADD_TEST(Test_MM_LoadMemFromFileCmd_StageError);
+  ADD_TEST(Test_MM_LoadMemFromFileCmd_Patch);
+  ADD_TEST(Test_MM_LoadMemFromFileCmd_PatchLarge);
+  ADD_TEST(Test_MM_LoadMemFromFileCmd_Compressed);
+  ADD_TEST(Test_MM_LoadMemFromFileCmd_CompressedError);
+  ADD_TEST(Test_MM_LoadMemFromFileCmd_Region);
+  ADD_TEST(Test_MM_LoadMemFromFileCmd_RegionError);
   ADD_TEST(Test_MM_LoadMemFromFileCmd_CloseError);
   ADD_TEST(Test_MM_LoadMemFromFileCmd_OpenError);
   ADD_TEST(Test_MM_FillMemCmd_RAM);
@@ -2144,6 +5562,7 @@ void UtTest_Setup(void) {
   ADD_TEST(Test_MM_FillMemCmd_SymNameError);
   ADD_TEST(Test_MM_FillMemCmd_NoLastActionFill);
   ADD_TEST(Test_MM_FillMemCmd_NoVerifyLoadDump);
+  ADD_TEST(Test_MM_FillMemCmd_PatternError);
   ADD_TEST(Test_MM_FillMemCmd_BadType);
   ADD_TEST(Test_MM_PeekCmd_Nominal);
   ADD_TEST(Test_MM_PeekCmd_SymNameError);
@@ -2154,18 +5573,116 @@ void UtTest_Setup(void) {
   ADD_TEST(Test_MM_DumpMemToFileCmd_MEM32);
   ADD_TEST(Test_MM_DumpMemToFileCmd_MEM16);
   ADD_TEST(Test_MM_DumpMemToFileCmd_MEM8);
-  ADD_TEST(Test_MM_DumpMemToFileCmd_ComputeCRCError);
   ADD_TEST(Test_MM_DumpMemToFileCmd_CloseError);
   ADD_TEST(Test_MM_DumpMemToFileCmd_CreatError);
   ADD_TEST(Test_MM_DumpMemToFileCmd_InvalidDumpResult);
-  ADD_TEST(Test_MM_DumpMemToFileCmd_lseekError);
   ADD_TEST(Test_MM_DumpMemToFileCmd_SymNameError);
   ADD_TEST(Test_MM_DumpMemToFileCmd_NoVerifyDumpParams);
   ADD_TEST(Test_MM_DumpMemToFileCmd_NoWriteHeaders);
   ADD_TEST(Test_MM_DumpMemToFileCmd_BadType);
   ADD_TEST(Test_MM_DumpMemToFileCmd_ReWriteHeadersErr);
+  ADD_TEST(Test_MM_DumpMemToCompressedFileCmd_RAM);
+  ADD_TEST(Test_MM_DumpMemToCompressedFileCmd_BadType);
+  ADD_TEST(Test_MM_DumpRegionsToFileCmd_Nominal);
+  ADD_TEST(Test_MM_DumpRegionsToFileCmd_BadCount);
+  ADD_TEST(Test_MM_DumpRegionsToFileCmd_VerifyParamsError);
+  ADD_TEST(Test_MM_DumpRegionsToFileCmd_DumpError);
   ADD_TEST(Test_MM_DumpInEventCmd_Nominal);
   ADD_TEST(Test_MM_DumpInEventCmd_SymNameError);
   ADD_TEST(Test_MM_DumpInEventCmd_NoVerifyDumpParams);
   ADD_TEST(Test_MM_DumpInEventCmd_FillDumpInvalid);
+  ADD_TEST(Test_MM_DumpMemToTlmCmd_Nominal);
+  ADD_TEST(Test_MM_DumpMemToTlmCmd_InProgress);
+  ADD_TEST(Test_MM_DumpMemToTlmCmd_SymNameError);
+  ADD_TEST(Test_MM_DumpMemToTlmCmd_NoVerifyDumpParams);
+  ADD_TEST(Test_MM_DumpInTlmCmd_Nominal);
+  ADD_TEST(Test_MM_DumpInTlmCmd_SymNameError);
+  ADD_TEST(Test_MM_DumpInTlmCmd_NoVerifyDumpParams);
+  ADD_TEST(Test_MM_DumpInTlmCmd_ReadError);
+  ADD_TEST(Test_MM_LoadBeginCmd_Nominal);
+  ADD_TEST(Test_MM_LoadBeginCmd_SymNameError);
+  ADD_TEST(Test_MM_LoadBeginCmd_NoVerifyLoadParams);
+  ADD_TEST(Test_MM_LoadBeginCmd_TooLarge);
+  ADD_TEST(Test_MM_LoadBeginCmd_CommitPending);
+  ADD_TEST(Test_MM_LoadDataCmd_Nominal);
+  ADD_TEST(Test_MM_LoadDataCmd_NotInProgress);
+  ADD_TEST(Test_MM_LoadDataCmd_CommitPending);
+  ADD_TEST(Test_MM_LoadDataCmd_BadChunk);
+  ADD_TEST(Test_MM_LoadCommitCmd_Nominal);
+  ADD_TEST(Test_MM_LoadCommitCmd_NotInProgress);
+  ADD_TEST(Test_MM_LoadCommitCmd_CRCError);
+  ADD_TEST(Test_MM_LoadCommitCmd_WriteError);
+  ADD_TEST(Test_MM_LoadRAMCommitCmd_Nominal);
+  ADD_TEST(Test_MM_LoadRAMCommitCmd_NotInProgress);
+  ADD_TEST(Test_MM_LoadRAMCommitCmd_NotRAM);
+  ADD_TEST(Test_MM_LoadRAMCommitCmd_TooLarge);
+  ADD_TEST(Test_MM_LoadRAMCommitCmd_CRCError);
+  ADD_TEST(Test_MM_ChecksumMemCmd_Nominal);
+  ADD_TEST(Test_MM_ChecksumMemCmd_SymNameError);
+  ADD_TEST(Test_MM_ChecksumMemCmd_NoVerifyDumpParams);
+  ADD_TEST(Test_MM_ChecksumMemCmd_ReadError);
+  ADD_TEST(Test_MM_SetScrubRegionCmd_Nominal);
+  ADD_TEST(Test_MM_SetScrubRegionCmd_RegionNumError);
+  ADD_TEST(Test_MM_SetScrubRegionCmd_SymNameError);
+  ADD_TEST(Test_MM_SetScrubRegionCmd_NoVerifyDumpParams);
+  ADD_TEST(Test_MM_ClearScrubRegionCmd_Nominal);
+  ADD_TEST(Test_MM_ClearScrubRegionCmd_RegionNumError);
+  ADD_TEST(Test_MM_BuildScrubIndexCmd_Nominal);
+  ADD_TEST(Test_MM_BuildScrubIndexCmd_LargeRegion);
+  ADD_TEST(Test_MM_BuildScrubIndexCmd_RegionNumError);
+  ADD_TEST(Test_MM_BuildScrubIndexCmd_NotDefined);
+  ADD_TEST(Test_MM_BuildScrubIndexCmd_ReadError);
+  ADD_TEST(Test_MM_BuildScrubIndexCmd_RegionChanged);
+  ADD_TEST(Test_MM_CompareScrubIndexCmd_Nominal);
+  ADD_TEST(Test_MM_CompareScrubIndexCmd_ReportLimit);
+  ADD_TEST(Test_MM_CompareScrubIndexCmd_RegionNumError);
+  ADD_TEST(Test_MM_CompareScrubIndexCmd_NoIndex);
+  ADD_TEST(Test_MM_CompareScrubIndexCmd_RootError);
+  ADD_TEST(Test_MM_CompareScrubIndexCmd_ReadError);
+  ADD_TEST(Test_MM_CompareScrubIndexCmd_RegionChanged);
+  ADD_TEST(Test_MM_SetCpuBudgetCmd_Nominal);
+  ADD_TEST(Test_MM_SetCpuBudgetCmd_TooLarge);
+  ADD_TEST(Test_MM_SetDumpCrcTypeCmd_Nominal);
+  ADD_TEST(Test_MM_SetDumpCrcTypeCmd_TooLarge);
+  ADD_TEST(Test_MM_MemTestCmd_Nominal);
+  ADD_TEST(Test_MM_MemTestCmd_SymNameError);
+  ADD_TEST(Test_MM_MemTestCmd_NoPatterns);
+  ADD_TEST(Test_MM_MemTestCmd_UnknownPattern);
+  ADD_TEST(Test_MM_MemTestCmd_Eeprom);
+  ADD_TEST(Test_MM_MemTestCmd_NoVerifyFillParams);
+  ADD_TEST(Test_MM_MemTestCmd_TestError);
+  ADD_TEST(Test_MM_BatchPeekCmd_Nominal);
+  ADD_TEST(Test_MM_BatchPeekCmd_NoEntries);
+  ADD_TEST(Test_MM_BatchPeekCmd_TooManyEntries);
+  ADD_TEST(Test_MM_BatchPeekCmd_SymNameError);
+  ADD_TEST(Test_MM_BatchPeekCmd_NoVerifyPeekPokeParams);
+  ADD_TEST(Test_MM_BatchPeekCmd_PeekErr);
+  ADD_TEST(Test_MM_BatchPokeCmd_Nominal);
+  ADD_TEST(Test_MM_BatchPokeCmd_NoEntries);
+  ADD_TEST(Test_MM_BatchPokeCmd_TooManyEntries);
+  ADD_TEST(Test_MM_BatchPokeCmd_SymNameError);
+  ADD_TEST(Test_MM_BatchPokeCmd_NoVerifyPeekPokeParams);
+  ADD_TEST(Test_MM_BatchPokeCmd_PeekErr);
+  ADD_TEST(Test_MM_BatchPokeCmd_FirstPokeErr);
+  ADD_TEST(Test_MM_BatchPokeCmd_Rollback);
+  ADD_TEST(Test_MM_BatchPokeCmd_RollbackErr);
+  ADD_TEST(Test_MM_BatchPokeCmd_RollbackEeprom);
+  ADD_TEST(Test_MM_SetWatchEntryCmd_Nominal);
+  ADD_TEST(Test_MM_SetWatchEntryCmd_EntryNumError);
+  ADD_TEST(Test_MM_SetWatchEntryCmd_SymNameError);
+  ADD_TEST(Test_MM_SetWatchEntryCmd_NoVerifyPeekPokeParams);
+  ADD_TEST(Test_MM_ClearWatchEntryCmd_Nominal);
+  ADD_TEST(Test_MM_ClearWatchEntryCmd_EntryNumError);
+  ADD_TEST(Test_MM_SetSamplePeriodCmd_Nominal);
+  ADD_TEST(Test_MM_MaskedPokeCmd_Nominal);
+  ADD_TEST(Test_MM_MaskedPokeCmd_SymNameError);
+  ADD_TEST(Test_MM_MaskedPokeCmd_NoVerifyPeekPokeParams);
+  ADD_TEST(Test_MM_MaskedPokeCmd_ReadError);
+  ADD_TEST(Test_MM_MaskedPokeCmd_WriteError);
+  ADD_TEST(Test_MM_MaskedPokeCmd_Eeprom);
+  ADD_TEST(Test_MM_ConditionalPokeCmd_Nominal);
+  ADD_TEST(Test_MM_ConditionalPokeCmd_Eeprom);
+  ADD_TEST(Test_MM_ConditionalPokeCmd_Mismatch);
+  ADD_TEST(Test_MM_ConditionalPokeCmd_WriteError);
+  ADD_TEST(Test_MM_ConditionalPokeCmd_EepromError);
 }
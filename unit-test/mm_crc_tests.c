@@ -0,0 +1,228 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit tests for mm_crc.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_crc.h"
+#include "mm_test_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "utassert.h"
+#include "utstubs.h"
+#include "uttest.h"
+
+#include "cfe.h"
+#include <string.h>
+
+/*
+ * Bit at a time CRC-16/ARC, the definition the table kernel must match
+ */
+static uint32 UT_Crc16ArcReference(const uint8 *Data, size_t DataLength,
+                                   uint32 InputCRC) {
+  uint16 Crc = (uint16)(InputCRC & 0xFFFF);
+  size_t i;
+  uint32 Bit;
+
+  for (i = 0; i < DataLength; i++) {
+    Crc ^= Data[i];
+    for (Bit = 0; Bit < 8; Bit++) {
+      if ((Crc & 1) != 0) {
+        Crc = (Crc >> 1) ^ 0xA001;
+      } else {
+        Crc = Crc >> 1;
+      }
+    }
+  }
+
+  return Crc;
+}
+
+/*
+ * Function Definitions
+ */
+
+void Test_MM_CalculateCRC_CheckValue(void) {
+  const char Data[] = "123456789";
+  uint32 Result;
+
+  /* Execute the function being tested */
+  Result = MM_CalculateCRC(Data, strlen(Data), 0, CFE_ES_CrcType_16_ARC);
+
+  /* Verify results, the published CRC-16/ARC check value */
+  UtAssert_UINT32_EQ(Result, 0xBB3D);
+  UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 0);
+}
+
+void Test_MM_CalculateCRC_Lengths(void) {
+  uint8 Data[64];
+  size_t Offset;
+  size_t Length;
+  uint32 Mismatches = 0;
+
+  for (Offset = 0; Offset < sizeof(Data); Offset++) {
+    Data[Offset] = (uint8)((Offset * 131) + 7);
+  }
+
+  /*
+  ** Cover every remainder after the eight byte steps and data that
+  ** doesn't start on an aligned address
+  */
+  for (Offset = 0; Offset < 8; Offset++) {
+    for (Length = 0; Length <= sizeof(Data) - Offset; Length++) {
+      if (MM_CalculateCRC(&Data[Offset], Length, 0x1234 + Length,
+                          CFE_ES_CrcType_16_ARC) !=
+          UT_Crc16ArcReference(&Data[Offset], Length, 0x1234 + Length)) {
+        Mismatches++;
+      }
+    }
+  }
+
+  /* Verify results */
+  UtAssert_UINT32_EQ(Mismatches, 0);
+}
+
+void Test_MM_CalculateCRC_Pieces(void) {
+  uint8 Data[100];
+  uint32 Whole;
+  uint32 Pieces;
+
+  memset(Data, 0xA5, sizeof(Data));
+  Data[50] = 0x3C;
+
+  Whole = MM_CalculateCRC(Data, sizeof(Data), 0, CFE_ES_CrcType_16_ARC);
+
+  /* Execute the function being tested, continuing a CRC */
+  Pieces = MM_CalculateCRC(Data, 13, 0, CFE_ES_CrcType_16_ARC);
+  Pieces = MM_CalculateCRC(&Data[13], sizeof(Data) - 13, Pieces,
+                           CFE_ES_CrcType_16_ARC);
+
+  /* Verify results */
+  UtAssert_UINT32_EQ(Pieces, Whole);
+}
+
+void Test_MM_CalculateCRC_OtherType(void) {
+  uint8 Data[4] = {0};
+  uint32 Result;
+
+  UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x5A5A);
+
+  /* Execute the function being tested */
+  Result = MM_CalculateCRC(Data, sizeof(Data), 0, CFE_ES_CrcType_NONE);
+
+  /* Verify results, types without a table kernel are passed on */
+  UtAssert_UINT32_EQ(Result, 0x5A5A);
+  UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+}
+
+void Test_MM_CalculateFileCRC_Crc16(void) {
+  const char Data[] = "123456789";
+  uint32 Result;
+
+  /* Execute the function being tested */
+  Result = MM_CalculateFileCRC(Data, strlen(Data), 0, MM_CrcType_CRC16_ARC,
+                               CFE_ES_CrcType_NONE);
+
+  /* Verify results, the file type wins over the default type */
+  UtAssert_UINT32_EQ(Result, 0xBB3D);
+  UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 0);
+}
+
+void Test_MM_CalculateFileCRC_Crc32(void) {
+  const char Data[] = "123456789";
+  uint32 Result;
+
+  /* Execute the function being tested */
+  Result = MM_CalculateFileCRC(Data, strlen(Data), 0, MM_CrcType_CRC32,
+                               CFE_ES_CrcType_16_ARC);
+
+  /* Verify results, the published CRC-32 check value */
+  UtAssert_UINT32_EQ(Result, 0xCBF43926);
+}
+
+void Test_MM_CalculateFileCRC_Crc32c(void) {
+  const char Data[] = "123456789";
+  uint32 Result;
+
+  /* Execute the function being tested */
+  Result = MM_CalculateFileCRC(Data, strlen(Data), 0, MM_CrcType_CRC32C,
+                               CFE_ES_CrcType_16_ARC);
+
+  /* Verify results, the published CRC-32C check value */
+  UtAssert_UINT32_EQ(Result, 0xE3069283);
+}
+
+void Test_MM_CalculateFileCRC_Pieces(void) {
+  uint8 Data[100];
+  uint32 Whole;
+  uint32 Pieces;
+  size_t i;
+
+  for (i = 0; i < sizeof(Data); i++) {
+    Data[i] = (uint8)((i * 37) + 11);
+  }
+
+  Whole = MM_CalculateFileCRC(Data, sizeof(Data), 0, MM_CrcType_CRC32C,
+                              CFE_ES_CrcType_16_ARC);
+
+  /* Execute the function being tested, continuing a CRC */
+  Pieces = MM_CalculateFileCRC(Data, 21, 0, MM_CrcType_CRC32C,
+                               CFE_ES_CrcType_16_ARC);
+  Pieces = MM_CalculateFileCRC(&Data[21], sizeof(Data) - 21, Pieces,
+                               MM_CrcType_CRC32C, CFE_ES_CrcType_16_ARC);
+
+  /* Verify results */
+  UtAssert_UINT32_EQ(Pieces, Whole);
+}
+
+void Test_MM_CalculateFileCRC_Default(void) {
+  uint8 Data[4] = {0};
+  uint32 Result;
+
+  UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x5A5A);
+
+  /* Execute the function being tested */
+  Result = MM_CalculateFileCRC(Data, sizeof(Data), 0, MM_CrcType_DEFAULT,
+                               CFE_ES_CrcType_NONE);
+
+  /* Verify results, the default type is used for older files */
+  UtAssert_UINT32_EQ(Result, 0x5A5A);
+  UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void) {
+  ADD_TEST(Test_MM_CalculateCRC_CheckValue);
+  ADD_TEST(Test_MM_CalculateCRC_Lengths);
+  ADD_TEST(Test_MM_CalculateCRC_Pieces);
+  ADD_TEST(Test_MM_CalculateCRC_OtherType);
+  ADD_TEST(Test_MM_CalculateFileCRC_Crc16);
+  ADD_TEST(Test_MM_CalculateFileCRC_Crc32);
+  ADD_TEST(Test_MM_CalculateFileCRC_Crc32c);
+  ADD_TEST(Test_MM_CalculateFileCRC_Pieces);
+  ADD_TEST(Test_MM_CalculateFileCRC_Default);
+}
@@ -33,6 +33,7 @@
 #include "mm_msgids.h"
 #include "mm_test_utils.h"
 #include "mm_topicids.h"
+#include "mm_worker.h"
 
 #include "cfe.h"
 #include "utassert.h"
@@ -407,7 +408,8 @@ void Test_MM_ProcessGroundCommand_LoadMemFromFileCmd(void) {
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(MM_LoadMemFromFileCmd, 1);
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 1);
+  UtAssert_STUB_COUNT(MM_LoadMemFromFileCmd, 0);
 }
 
 void Test_MM_ProcessGroundCommand_LoadMemFromFileCmdErr(void) {
@@ -439,6 +441,7 @@ void Test_MM_ProcessGroundCommand_LoadMemFromFileCmdErr(void) {
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 0);
   UtAssert_STUB_COUNT(MM_LoadMemFromFileCmd, 0);
 }
 
@@ -463,7 +466,8 @@ void Test_MM_ProcessGroundCommand_DumpMemToFileCmd(void) {
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(MM_DumpMemToFileCmd, 1);
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 1);
+  UtAssert_STUB_COUNT(MM_DumpMemToFileCmd, 0);
 }
 
 void Test_MM_ProcessGroundCommand_DumpMemToFileCmdErr(void) {
@@ -495,6 +499,7 @@ void Test_MM_ProcessGroundCommand_DumpMemToFileCmdErr(void) {
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 0);
   UtAssert_STUB_COUNT(MM_DumpMemToFileCmd, 0);
 }
 
@@ -554,17 +559,17 @@ void Test_MM_ProcessGroundCommand_DumpInEventCmdErr(void) {
   UtAssert_STUB_COUNT(MM_DumpInEventCmd, 0);
 }
 
-void Test_MM_ProcessGroundCommand_FillMemCmd(void) {
+void Test_MM_ProcessGroundCommand_DumpMemToTlmCmd(void) {
   CFE_MSG_FcnCode_t CommandCode;
   size_t ExpectedLen;
 
-  /* Set up to run MM_FillMemCmd() */
-  CommandCode = MM_FILL_MEM_CC;
+  /* Set up to run MM_DumpMemToTlmCmd() */
+  CommandCode = MM_DUMP_MEM_TO_TLM_CC;
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
                    sizeof(CFE_MSG_FcnCode_t), false);
 
   /* Set up to pass command length verification */
-  ExpectedLen = sizeof(MM_FillMemCmd_t);
+  ExpectedLen = sizeof(MM_DumpMemToTlmCmd_t);
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
                    false);
 
@@ -575,10 +580,10 @@ void Test_MM_ProcessGroundCommand_FillMemCmd(void) {
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(MM_FillMemCmd, 1);
+  UtAssert_STUB_COUNT(MM_DumpMemToTlmCmd, 1);
 }
 
-void Test_MM_ProcessGroundCommand_FillMemCmdErr(void) {
+void Test_MM_ProcessGroundCommand_DumpMemToTlmCmdErr(void) {
   CFE_MSG_FcnCode_t CommandCode;
   size_t ExpectedLen;
   CFE_SB_MsgId_t MsgId;
@@ -588,8 +593,8 @@ void Test_MM_ProcessGroundCommand_FillMemCmdErr(void) {
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
                    false);
 
-  /* Set up to run MM_FillMemCmd() */
-  CommandCode = MM_FILL_MEM_CC;
+  /* Set up to run MM_DumpMemToTlmCmd() */
+  CommandCode = MM_DUMP_MEM_TO_TLM_CC;
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
                    sizeof(CFE_MSG_FcnCode_t), false);
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
@@ -607,20 +612,20 @@ void Test_MM_ProcessGroundCommand_FillMemCmdErr(void) {
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
-  UtAssert_STUB_COUNT(MM_FillMemCmd, 0);
+  UtAssert_STUB_COUNT(MM_DumpMemToTlmCmd, 0);
 }
 
-void Test_MM_ProcessGroundCommand_LookupSymCmd(void) {
+void Test_MM_ProcessGroundCommand_DumpInTlmCmd(void) {
   CFE_MSG_FcnCode_t CommandCode;
   size_t ExpectedLen;
 
-  /* Set up to run MM_LookupSymCmd() */
-  CommandCode = MM_LOOKUP_SYM_CC;
+  /* Set up to run MM_DumpInTlmCmd() */
+  CommandCode = MM_DUMP_IN_TLM_CC;
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
                    sizeof(CFE_MSG_FcnCode_t), false);
 
   /* Set up to pass command length verification */
-  ExpectedLen = sizeof(MM_LookupSymCmd_t);
+  ExpectedLen = sizeof(MM_DumpInTlmCmd_t);
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
                    false);
 
@@ -631,10 +636,10 @@ void Test_MM_ProcessGroundCommand_LookupSymCmd(void) {
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(MM_LookupSymCmd, 1);
+  UtAssert_STUB_COUNT(MM_DumpInTlmCmd, 1);
 }
 
-void Test_MM_ProcessGroundCommand_LookupSymCmdErr(void) {
+void Test_MM_ProcessGroundCommand_DumpInTlmCmdErr(void) {
   CFE_MSG_FcnCode_t CommandCode;
   size_t ExpectedLen;
   CFE_SB_MsgId_t MsgId;
@@ -644,8 +649,8 @@ void Test_MM_ProcessGroundCommand_LookupSymCmdErr(void) {
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
                    false);
 
-  /* Set up to run MM_LookupSymCmd() */
-  CommandCode = MM_LOOKUP_SYM_CC;
+  /* Set up to run MM_DumpInTlmCmd() */
+  CommandCode = MM_DUMP_IN_TLM_CC;
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
                    sizeof(CFE_MSG_FcnCode_t), false);
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
@@ -663,20 +668,20 @@ void Test_MM_ProcessGroundCommand_LookupSymCmdErr(void) {
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
-  UtAssert_STUB_COUNT(MM_LookupSymCmd, 0);
+  UtAssert_STUB_COUNT(MM_DumpInTlmCmd, 0);
 }
 
-void Test_MM_ProcessGroundCommand_SymTblToFileCmd(void) {
+void Test_MM_ProcessGroundCommand_LoadBeginCmd(void) {
   CFE_MSG_FcnCode_t CommandCode;
   size_t ExpectedLen;
 
-  /* Set up to run MM_SymTblToFileCmd() */
-  CommandCode = MM_SYM_TBL_TO_FILE_CC;
+  /* Set up to run MM_LoadBeginCmd() */
+  CommandCode = MM_LOAD_BEGIN_CC;
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
                    sizeof(CFE_MSG_FcnCode_t), false);
 
   /* Set up to pass command length verification */
-  ExpectedLen = sizeof(MM_SymTblToFileCmd_t);
+  ExpectedLen = sizeof(MM_LoadBeginCmd_t);
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
                    false);
 
@@ -687,10 +692,10 @@ void Test_MM_ProcessGroundCommand_SymTblToFileCmd(void) {
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(MM_SymTblToFileCmd, 1);
+  UtAssert_STUB_COUNT(MM_LoadBeginCmd, 1);
 }
 
-void Test_MM_ProcessGroundCommand_SymTblToFileCmdErr(void) {
+void Test_MM_ProcessGroundCommand_LoadBeginCmdErr(void) {
   CFE_MSG_FcnCode_t CommandCode;
   size_t ExpectedLen;
   CFE_SB_MsgId_t MsgId;
@@ -700,8 +705,8 @@ void Test_MM_ProcessGroundCommand_SymTblToFileCmdErr(void) {
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
                    false);
 
-  /* Set up to run MM_SymTblToFileCmd() */
-  CommandCode = MM_SYM_TBL_TO_FILE_CC;
+  /* Set up to run MM_LoadBeginCmd() */
+  CommandCode = MM_LOAD_BEGIN_CC;
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
                    sizeof(CFE_MSG_FcnCode_t), false);
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
@@ -719,20 +724,20 @@ void Test_MM_ProcessGroundCommand_SymTblToFileCmdErr(void) {
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
-  UtAssert_STUB_COUNT(MM_SymTblToFileCmd, 0);
+  UtAssert_STUB_COUNT(MM_LoadBeginCmd, 0);
 }
 
-void Test_MM_ProcessGroundCommand_EepromWriteEnaCmd(void) {
+void Test_MM_ProcessGroundCommand_LoadDataCmd(void) {
   CFE_MSG_FcnCode_t CommandCode;
   size_t ExpectedLen;
 
-  /* Set up to run MM_EepromWriteEnaCmd() */
-  CommandCode = MM_EEPROM_WRITE_ENA_CC;
+  /* Set up to run MM_LoadDataCmd() */
+  CommandCode = MM_LOAD_DATA_CC;
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
                    sizeof(CFE_MSG_FcnCode_t), false);
 
   /* Set up to pass command length verification */
-  ExpectedLen = sizeof(MM_EepromWriteEnaCmd_t);
+  ExpectedLen = sizeof(MM_LoadDataCmd_t);
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
                    false);
 
@@ -743,10 +748,10 @@ void Test_MM_ProcessGroundCommand_EepromWriteEnaCmd(void) {
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(MM_EepromWriteEnaCmd, 1);
+  UtAssert_STUB_COUNT(MM_LoadDataCmd, 1);
 }
 
-void Test_MM_ProcessGroundCommand_EepromWriteEnaCmdErr(void) {
+void Test_MM_ProcessGroundCommand_LoadDataCmdErr(void) {
   CFE_MSG_FcnCode_t CommandCode;
   size_t ExpectedLen;
   CFE_SB_MsgId_t MsgId;
@@ -756,8 +761,8 @@ void Test_MM_ProcessGroundCommand_EepromWriteEnaCmdErr(void) {
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
                    false);
 
-  /* Set up to run MM_EepromWriteEnaCmd() */
-  CommandCode = MM_EEPROM_WRITE_ENA_CC;
+  /* Set up to run MM_LoadDataCmd() */
+  CommandCode = MM_LOAD_DATA_CC;
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
                    sizeof(CFE_MSG_FcnCode_t), false);
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
@@ -775,20 +780,20 @@ void Test_MM_ProcessGroundCommand_EepromWriteEnaCmdErr(void) {
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
-  UtAssert_STUB_COUNT(MM_EepromWriteEnaCmd, 0);
+  UtAssert_STUB_COUNT(MM_LoadDataCmd, 0);
 }
 
-void Test_MM_ProcessGroundCommand_EepromWriteDisCmd(void) {
+void Test_MM_ProcessGroundCommand_LoadCommitCmd(void) {
   CFE_MSG_FcnCode_t CommandCode;
   size_t ExpectedLen;
 
-  /* Set up to run MM_EepromWriteDisCmd() */
-  CommandCode = MM_EEPROM_WRITE_DIS_CC;
+  /* Set up to run MM_LoadCommitCmd() */
+  CommandCode = MM_LOAD_COMMIT_CC;
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
                    sizeof(CFE_MSG_FcnCode_t), false);
 
   /* Set up to pass command length verification */
-  ExpectedLen = sizeof(MM_EepromWriteDisCmd_t);
+  ExpectedLen = sizeof(MM_LoadCommitCmd_t);
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
                    false);
 
@@ -799,10 +804,11 @@ void Test_MM_ProcessGroundCommand_EepromWriteDisCmd(void) {
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
-  UtAssert_STUB_COUNT(MM_EepromWriteDisCmd, 1);
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 1);
+  UtAssert_STUB_COUNT(MM_LoadCommitCmd, 0);
 }
 
-void Test_MM_ProcessGroundCommand_EepromWriteDisCmdErr(void) {
+void Test_MM_ProcessGroundCommand_LoadCommitCmdErr(void) {
   CFE_MSG_FcnCode_t CommandCode;
   size_t ExpectedLen;
   CFE_SB_MsgId_t MsgId;
@@ -812,8 +818,8 @@ void Test_MM_ProcessGroundCommand_EepromWriteDisCmdErr(void) {
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
                    false);
 
-  /* Set up to run MM_EepromWriteDisCmd() */
-  CommandCode = MM_EEPROM_WRITE_DIS_CC;
+  /* Set up to run MM_LoadCommitCmd() */
+  CommandCode = MM_LOAD_COMMIT_CC;
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
                    sizeof(CFE_MSG_FcnCode_t), false);
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
@@ -831,17 +837,57 @@ void Test_MM_ProcessGroundCommand_EepromWriteDisCmdErr(void) {
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
-  UtAssert_STUB_COUNT(MM_EepromWriteDisCmd, 0);
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 0);
+  UtAssert_STUB_COUNT(MM_LoadCommitCmd, 0);
 }
 
-void Test_MM_ProcessGroundCommand_UnknownCC(void) {
+void Test_MM_ProcessGroundCommand_LoadRAMCommitCmd(void) {
   CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
 
-  /* Set up for a failed command code check */
-  CommandCode = 200;
+  /* Set up to run MM_LoadRAMCommitCmd() */
+  CommandCode = MM_LOAD_RAM_COMMIT_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_LoadRAMCommitCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 1);
+  UtAssert_STUB_COUNT(MM_LoadRAMCommitCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_LoadRAMCommitCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_LoadRAMCommitCmd() */
+  CommandCode = MM_LOAD_RAM_COMMIT_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
   UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
                    sizeof(CFE_MSG_FcnCode_t), false);
 
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
   /* Run function under test */
   MM_ProcessGroundCommand(NULL);
 
@@ -849,16 +895,1271 @@ void Test_MM_ProcessGroundCommand_UnknownCC(void) {
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
 
-  UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CC_ERR_EID);
-  UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType,
-                    CFE_EVS_EventType_ERROR);
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 0);
+  UtAssert_STUB_COUNT(MM_LoadRAMCommitCmd, 0);
+}
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  UtAssert_StrnCmp("Invalid ground command code %d",
-                   context_CFE_EVS_SendEvent[0].Spec,
-                   CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-                   "Event string matched expected result, '%s'",
-                   context_CFE_EVS_SendEvent[0].Spec);
+void Test_MM_ProcessGroundCommand_ChecksumMemCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_ChecksumMemCmd() */
+  CommandCode = MM_CHECKSUM_MEM_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_ChecksumMemCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 1);
+  UtAssert_STUB_COUNT(MM_ChecksumMemCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_ChecksumMemCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_ChecksumMemCmd() */
+  CommandCode = MM_CHECKSUM_MEM_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 0);
+  UtAssert_STUB_COUNT(MM_ChecksumMemCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_SetScrubRegionCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_SetScrubRegionCmd() */
+  CommandCode = MM_SET_SCRUB_REGION_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_SetScrubRegionCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_SetScrubRegionCmd, 1);
+}
+
+void Test_MM_ProcessGroundCommand_SetScrubRegionCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_SetScrubRegionCmd() */
+  CommandCode = MM_SET_SCRUB_REGION_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_SetScrubRegionCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_ClearScrubRegionCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_ClearScrubRegionCmd() */
+  CommandCode = MM_CLEAR_SCRUB_REGION_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_ClearScrubRegionCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_ClearScrubRegionCmd, 1);
+}
+
+void Test_MM_ProcessGroundCommand_ClearScrubRegionCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_ClearScrubRegionCmd() */
+  CommandCode = MM_CLEAR_SCRUB_REGION_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_ClearScrubRegionCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_BuildScrubIndexCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_BuildScrubIndexCmd() */
+  CommandCode = MM_BUILD_SCRUB_INDEX_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_BuildScrubIndexCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 1);
+  UtAssert_STUB_COUNT(MM_BuildScrubIndexCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_BuildScrubIndexCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_BuildScrubIndexCmd() */
+  CommandCode = MM_BUILD_SCRUB_INDEX_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 0);
+  UtAssert_STUB_COUNT(MM_BuildScrubIndexCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_CompareScrubIndexCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_CompareScrubIndexCmd() */
+  CommandCode = MM_COMPARE_SCRUB_INDEX_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_CompareScrubIndexCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 1);
+  UtAssert_STUB_COUNT(MM_CompareScrubIndexCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_CompareScrubIndexCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_CompareScrubIndexCmd() */
+  CommandCode = MM_COMPARE_SCRUB_INDEX_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 0);
+  UtAssert_STUB_COUNT(MM_CompareScrubIndexCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_FillMemCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_FillMemCmd() */
+  CommandCode = MM_FILL_MEM_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_FillMemCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 1);
+  UtAssert_STUB_COUNT(MM_FillMemCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_FillMemCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_FillMemCmd() */
+  CommandCode = MM_FILL_MEM_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 0);
+  UtAssert_STUB_COUNT(MM_FillMemCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_LookupSymCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_LookupSymCmd() */
+  CommandCode = MM_LOOKUP_SYM_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_LookupSymCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_LookupSymCmd, 1);
+}
+
+void Test_MM_ProcessGroundCommand_LookupSymCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_LookupSymCmd() */
+  CommandCode = MM_LOOKUP_SYM_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_LookupSymCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_SymTblToFileCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_SymTblToFileCmd() */
+  CommandCode = MM_SYM_TBL_TO_FILE_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_SymTblToFileCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_SymTblToFileCmd, 1);
+}
+
+void Test_MM_ProcessGroundCommand_SymTblToFileCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_SymTblToFileCmd() */
+  CommandCode = MM_SYM_TBL_TO_FILE_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_SymTblToFileCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_EepromWriteEnaCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_EepromWriteEnaCmd() */
+  CommandCode = MM_EEPROM_WRITE_ENA_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_EepromWriteEnaCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_EepromWriteEnaCmd, 1);
+}
+
+void Test_MM_ProcessGroundCommand_EepromWriteEnaCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_EepromWriteEnaCmd() */
+  CommandCode = MM_EEPROM_WRITE_ENA_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_EepromWriteEnaCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_EepromWriteDisCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_EepromWriteDisCmd() */
+  CommandCode = MM_EEPROM_WRITE_DIS_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_EepromWriteDisCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_EepromWriteDisCmd, 1);
+}
+
+void Test_MM_ProcessGroundCommand_EepromWriteDisCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_EepromWriteDisCmd() */
+  CommandCode = MM_EEPROM_WRITE_DIS_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_EepromWriteDisCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_SetCpuBudgetCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_SetCpuBudgetCmd() */
+  CommandCode = MM_SET_CPU_BUDGET_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_SetCpuBudgetCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_SetCpuBudgetCmd, 1);
+}
+
+void Test_MM_ProcessGroundCommand_SetCpuBudgetCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_SetCpuBudgetCmd() */
+  CommandCode = MM_SET_CPU_BUDGET_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_SetCpuBudgetCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_DumpMemToCompressedFileCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_DumpMemToCompressedFileCmd() */
+  CommandCode = MM_DUMP_MEM_TO_COMPRESSED_FILE_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_DumpMemToCompressedFileCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 1);
+  UtAssert_STUB_COUNT(MM_DumpMemToCompressedFileCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_DumpMemToCompressedFileCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_DumpMemToCompressedFileCmd() */
+  CommandCode = MM_DUMP_MEM_TO_COMPRESSED_FILE_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 0);
+}
+
+void Test_MM_ProcessGroundCommand_DumpRegionsToFileCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_DumpRegionsToFileCmd() */
+  CommandCode = MM_DUMP_REGIONS_TO_FILE_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_DumpRegionsToFileCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 1);
+  UtAssert_STUB_COUNT(MM_DumpRegionsToFileCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_DumpRegionsToFileCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_DumpRegionsToFileCmd() */
+  CommandCode = MM_DUMP_REGIONS_TO_FILE_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 0);
+}
+
+void Test_MM_ProcessGroundCommand_UnknownCC(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+
+  /* Set up for a failed command code check */
+  CommandCode = 200;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CC_ERR_EID);
+  UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType,
+                    CFE_EVS_EventType_ERROR);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  UtAssert_StrnCmp("Invalid ground command code %d",
+                   context_CFE_EVS_SendEvent[0].Spec,
+                   CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+                   "Event string matched expected result, '%s'",
+                   context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void Test_MM_ProcessGroundCommand_SetDumpCrcTypeCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_SetDumpCrcTypeCmd() */
+  CommandCode = MM_SET_DUMP_CRC_TYPE_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_SetDumpCrcTypeCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_SetDumpCrcTypeCmd, 1);
+}
+
+void Test_MM_ProcessGroundCommand_SetDumpCrcTypeCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_SetDumpCrcTypeCmd() */
+  CommandCode = MM_SET_DUMP_CRC_TYPE_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_SetDumpCrcTypeCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_MemTestCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_MemTestCmd() */
+  CommandCode = MM_MEM_TEST_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_MemTestCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 1);
+  UtAssert_STUB_COUNT(MM_MemTestCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_MemTestCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_MemTestCmd() */
+  CommandCode = MM_MEM_TEST_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_WorkerSubmit, 0);
+  UtAssert_STUB_COUNT(MM_MemTestCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_BatchPeekCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_BatchPeekCmd() */
+  CommandCode = MM_BATCH_PEEK_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_BatchPeekCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_BatchPeekCmd, 1);
+}
+
+void Test_MM_ProcessGroundCommand_BatchPeekCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_BatchPeekCmd() */
+  CommandCode = MM_BATCH_PEEK_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_BatchPeekCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_BatchPokeCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_BatchPokeCmd() */
+  CommandCode = MM_BATCH_POKE_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_BatchPokeCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_BatchPokeCmd, 1);
+}
+
+void Test_MM_ProcessGroundCommand_BatchPokeCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_BatchPokeCmd() */
+  CommandCode = MM_BATCH_POKE_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_BatchPokeCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_SetWatchEntryCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_SetWatchEntryCmd() */
+  CommandCode = MM_SET_WATCH_ENTRY_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_SetWatchEntryCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_SetWatchEntryCmd, 1);
+}
+
+void Test_MM_ProcessGroundCommand_SetWatchEntryCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_SetWatchEntryCmd() */
+  CommandCode = MM_SET_WATCH_ENTRY_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_SetWatchEntryCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_ClearWatchEntryCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_ClearWatchEntryCmd() */
+  CommandCode = MM_CLEAR_WATCH_ENTRY_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_ClearWatchEntryCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_ClearWatchEntryCmd, 1);
+}
+
+void Test_MM_ProcessGroundCommand_ClearWatchEntryCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_ClearWatchEntryCmd() */
+  CommandCode = MM_CLEAR_WATCH_ENTRY_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_ClearWatchEntryCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_SetSamplePeriodCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_SetSamplePeriodCmd() */
+  CommandCode = MM_SET_SAMPLE_PERIOD_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_SetSamplePeriodCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_SetSamplePeriodCmd, 1);
+}
+
+void Test_MM_ProcessGroundCommand_SetSamplePeriodCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_SetSamplePeriodCmd() */
+  CommandCode = MM_SET_SAMPLE_PERIOD_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_SetSamplePeriodCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_MaskedPokeCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_MaskedPokeCmd() */
+  CommandCode = MM_MASKED_POKE_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_MaskedPokeCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_MaskedPokeCmd, 1);
+}
+
+void Test_MM_ProcessGroundCommand_MaskedPokeCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_MaskedPokeCmd() */
+  CommandCode = MM_MASKED_POKE_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_MaskedPokeCmd, 0);
+}
+
+void Test_MM_ProcessGroundCommand_ConditionalPokeCmd(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+
+  /* Set up to run MM_ConditionalPokeCmd() */
+  CommandCode = MM_CONDITIONAL_POKE_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to pass command length verification */
+  ExpectedLen = sizeof(MM_ConditionalPokeCmd_t);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(MM_ConditionalPokeCmd, 1);
+}
+
+void Test_MM_ProcessGroundCommand_ConditionalPokeCmdErr(void) {
+  CFE_MSG_FcnCode_t CommandCode;
+  size_t ExpectedLen;
+  CFE_SB_MsgId_t MsgId;
+
+  /* Provide a message ID for test */
+  MsgId = CFE_SB_MSGID_C(MM_MISSION_CMD_TOPICID);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(CFE_SB_MsgId_t),
+                   false);
+
+  /* Set up to run MM_ConditionalPokeCmd() */
+  CommandCode = MM_CONDITIONAL_POKE_CC;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CFE_MSG_FcnCode_t), false);
+
+  /* Set up to fail command length verification */
+  ExpectedLen = 0;
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &ExpectedLen, sizeof(size_t),
+                   false);
+
+  /* Run function under test */
+  MM_ProcessGroundCommand(NULL);
+
+  /* Evaluate run */
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(MM_ConditionalPokeCmd, 0);
 }
 
 void Test_MM_TaskPipe_SendHk(void) {
@@ -874,6 +2175,7 @@ void Test_MM_TaskPipe_SendHk(void) {
 
   /* Evaluate run */
   UtAssert_STUB_COUNT(MM_SendHkCmd, 1);
+  UtAssert_STUB_COUNT(OS_MutSemTake, 0);
 
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
@@ -904,6 +2206,8 @@ void Test_MM_TaskPipe_Cmd(void) {
 
   /* Evaluate run */
   UtAssert_STUB_COUNT(MM_NoopCmd, 1);
+  UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+  UtAssert_STUB_COUNT(OS_MutSemGive, 1);
 
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_EQ(uint8_t, MM_AppData.HkTlm.Payload.ErrCounter, 0);
@@ -951,6 +2255,28 @@ void UtTest_Setup(void) {
   ADD_TEST(Test_MM_ProcessGroundCommand_DumpMemToFileCmdErr);
   ADD_TEST(Test_MM_ProcessGroundCommand_DumpInEventCmd);
   ADD_TEST(Test_MM_ProcessGroundCommand_DumpInEventCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_DumpMemToTlmCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_DumpMemToTlmCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_DumpInTlmCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_DumpInTlmCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_LoadBeginCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_LoadBeginCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_LoadDataCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_LoadDataCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_LoadCommitCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_LoadCommitCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_LoadRAMCommitCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_LoadRAMCommitCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_ChecksumMemCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_ChecksumMemCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_SetScrubRegionCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_SetScrubRegionCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_ClearScrubRegionCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_ClearScrubRegionCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_BuildScrubIndexCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_BuildScrubIndexCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_CompareScrubIndexCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_CompareScrubIndexCmdErr);
   ADD_TEST(Test_MM_ProcessGroundCommand_FillMemCmd);
   ADD_TEST(Test_MM_ProcessGroundCommand_FillMemCmdErr);
   ADD_TEST(Test_MM_ProcessGroundCommand_LookupSymCmd);
@@ -961,6 +2287,30 @@ void UtTest_Setup(void) {
   ADD_TEST(Test_MM_ProcessGroundCommand_EepromWriteEnaCmdErr);
   ADD_TEST(Test_MM_ProcessGroundCommand_EepromWriteDisCmd);
   ADD_TEST(Test_MM_ProcessGroundCommand_EepromWriteDisCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_SetCpuBudgetCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_SetCpuBudgetCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_DumpMemToCompressedFileCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_DumpMemToCompressedFileCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_DumpRegionsToFileCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_DumpRegionsToFileCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_SetDumpCrcTypeCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_SetDumpCrcTypeCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_MemTestCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_MemTestCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_BatchPeekCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_BatchPeekCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_BatchPokeCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_BatchPokeCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_SetWatchEntryCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_SetWatchEntryCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_ClearWatchEntryCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_ClearWatchEntryCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_SetSamplePeriodCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_SetSamplePeriodCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_MaskedPokeCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_MaskedPokeCmdErr);
+  ADD_TEST(Test_MM_ProcessGroundCommand_ConditionalPokeCmd);
+  ADD_TEST(Test_MM_ProcessGroundCommand_ConditionalPokeCmdErr);
   ADD_TEST(Test_MM_ProcessGroundCommand_UnknownCC);
   ADD_TEST(Test_MM_TaskPipe_SendHk);
   ADD_TEST(Test_MM_TaskPipe_Cmd);
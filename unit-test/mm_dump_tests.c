@@ -24,6 +24,7 @@
 /************************************************************************
 ** Includes
 *************************************************************************/
+#include "mm_crc.h"
 #include "mm_dump.h"
 #include "mm_eventids.h"
 #include "mm_filedefs.h"
@@ -33,6 +34,7 @@
 #include "mm_msg.h"
 #include "mm_msgdefs.h"
 #include "mm_msgids.h"
+#include "mm_rle.h"
 #include "mm_test_utils.h"
 #include "mm_utils.h"
 #include "mm_version.h"
@@ -269,11 +271,45 @@ void Test_MM_PeekMem_DefaultSwitch(void) {
       "PSP read memory error: RC=%d, Address=%p, MemType=MEM%u");
 }
 
+void Test_MM_PeekValue_Word(void) {
+  uint32 DataValue = 0xFFFFFFFF;
+  int32 Result;
+
+  UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_MemRead16), CFE_PSP_SUCCESS);
+
+  /* Execute the function being tested */
+  Result = MM_PeekValue(1, MM_INTERNAL_WORD_BIT_WIDTH, &DataValue);
+
+  /* Verify results, the upper bits are cleared */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_STUB_COUNT(CFE_PSP_MemRead16, 1);
+  UtAssert_True(DataValue <= 0xFFFF, "DataValue <= 0xFFFF");
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_PeekValue_DefaultSwitch(void) {
+  uint32 DataValue = 0;
+  int32 Result;
+
+  /* Execute the function being tested */
+  Result = MM_PeekValue(1, 99, &DataValue);
+
+  /* Verify results, nothing is read and no event is sent */
+  UtAssert_INT32_EQ(Result, CFE_PSP_ERROR_NOT_IMPLEMENTED);
+  UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 0);
+  UtAssert_STUB_COUNT(CFE_PSP_MemRead16, 0);
+  UtAssert_STUB_COUNT(CFE_PSP_MemRead32, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void Test_MM_DumpMemToFile_Nominal(void) {
   osal_id_t FileHandle = MM_UT_OBJID_1;
   char FileName[CFE_MISSION_MAX_PATH_LEN];
   MM_LoadDumpFileHeader_t FileHeader;
   int32 Result;
+  uint32 Crc = 0;
 
   strncpy(FileName, "filename", sizeof(FileName) - 1);
   FileName[sizeof(FileName) - 1] = '\0';
@@ -283,11 +319,14 @@ void Test_MM_DumpMemToFile_Nominal(void) {
   FileHeader.SymAddress.Offset = CFE_ES_MEMADDRESS_C(&MM_AppData.LoadBuffer[0]);
   FileHeader.MemType = MM_MemType_RAM;
 
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateFileCRC), 0x5A5A);
+
   /* Execute the function being tested */
-  Result = MM_DumpMemToFile(FileHandle, FileName, &FileHeader);
+  Result = MM_DumpMemToFile(FileHandle, FileName, &FileHeader, &Crc);
 
   /* Verify results */
   UtAssert_True(Result == OS_SUCCESS, "Result == OS_SUCCESS");
+  UtAssert_UINT32_EQ(Crc, 0x5A5A);
   UtAssert_True(
       MM_AppData.HkTlm.Payload.LastAction == MM_LastAction_DUMP_TO_FILE,
       "MM_AppData.HkTlm.Payload.LastAction == MM_LastAction_DUMP_TO_FILE");
@@ -314,6 +353,7 @@ void Test_MM_DumpMemToFile_CPUHogging(void) {
   char FileName[CFE_MISSION_MAX_PATH_LEN];
   MM_LoadDumpFileHeader_t FileHeader;
   int32 Result;
+  uint32 Crc = 0;
   char Data[2 * MM_INTERNAL_MAX_DUMP_DATA_SEG] = {0};
 
   strncpy(FileName, "filename", sizeof(FileName) - 1);
@@ -324,11 +364,17 @@ void Test_MM_DumpMemToFile_CPUHogging(void) {
   FileHeader.SymAddress.Offset = CFE_ES_MEMADDRESS_C(Data);
   FileHeader.MemType = MM_MemType_RAM;
 
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateFileCRC), 0x5A5A);
+
   /* Execute the function being tested */
-  Result = MM_DumpMemToFile(FileHandle, FileName, &FileHeader);
+  Result = MM_DumpMemToFile(FileHandle, FileName, &FileHeader, &Crc);
 
   /* Verify results */
   UtAssert_True(Result == OS_SUCCESS, "Result == OS_SUCCESS");
+  UtAssert_UINT32_EQ(Crc, 0x5A5A);
+
+  /* The CRC is folded in as each segment is dumped */
+  UtAssert_STUB_COUNT(MM_CalculateFileCRC, 2);
   UtAssert_True(
       MM_AppData.HkTlm.Payload.LastAction == MM_LastAction_DUMP_TO_FILE,
       "MM_AppData.HkTlm.Payload.LastAction == MM_LastAction_DUMP_TO_FILE");
@@ -357,6 +403,7 @@ void Test_MM_DumpMemToFile_WriteError(void) {
   char FileName[CFE_MISSION_MAX_PATH_LEN];
   MM_LoadDumpFileHeader_t FileHeader;
   int32 Result;
+  uint32 Crc = 0;
 
   strncpy(FileName, "filename", sizeof(FileName) - 1);
   FileName[sizeof(FileName) - 1] = '\0';
@@ -370,7 +417,7 @@ void Test_MM_DumpMemToFile_WriteError(void) {
   UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_ERROR);
 
   /* Execute the function being tested */
-  Result = MM_DumpMemToFile(FileHandle, FileName, &FileHeader);
+  Result = MM_DumpMemToFile(FileHandle, FileName, &FileHeader, &Crc);
 
   /* Verify results */
   UtAssert_True(Result == OS_ERROR, "Result == OS_ERROR");
@@ -386,6 +433,161 @@ void Test_MM_DumpMemToFile_WriteError(void) {
       "OS_write error received: RC = %d, Expected = %u, File = '%s'");
 }
 
+void Test_MM_DumpMemToCompressedFile_Nominal(void) {
+  osal_id_t FileHandle = MM_UT_OBJID_1;
+  char FileName[CFE_MISSION_MAX_PATH_LEN];
+  MM_LoadDumpFileHeader_t FileHeader;
+  int32 Result;
+  uint32 Crc = 0;
+  char Data[2 * MM_INTERNAL_MAX_DUMP_DATA_SEG] = {0};
+
+  strncpy(FileName, "filename", sizeof(FileName) - 1);
+  FileName[sizeof(FileName) - 1] = '\0';
+
+  FileHeader.NumOfBytes = sizeof(Data);
+  /* a valid source address is required input to memcpy */
+  FileHeader.SymAddress.Offset = CFE_ES_MEMADDRESS_C(Data);
+  FileHeader.MemType = MM_MemType_RAM;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_RleEncode), 4);
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateFileCRC), 0x5A5A);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToCompressedFile(FileHandle, FileName, &FileHeader, &Crc);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_SUCCESS);
+  UtAssert_UINT32_EQ(Crc, 0x5A5A);
+
+  /* Each segment is encoded and written, the CRC covers the raw data */
+  UtAssert_STUB_COUNT(MM_RleEncode, 2);
+  UtAssert_STUB_COUNT(OS_write, 2);
+  UtAssert_STUB_COUNT(MM_CalculateFileCRC, 2);
+  UtAssert_STUB_COUNT(MM_SegmentBreak, 1);
+
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_DUMP_TO_FILE);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed, sizeof(Data));
+  UtAssert_STRINGBUF_EQ(MM_AppData.HkTlm.Payload.FileName,
+                        sizeof(MM_AppData.HkTlm.Payload.FileName), FileName,
+                        sizeof(FileName));
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_DumpMemToCompressedFile_WriteError(void) {
+  osal_id_t FileHandle = MM_UT_OBJID_1;
+  char FileName[CFE_MISSION_MAX_PATH_LEN];
+  MM_LoadDumpFileHeader_t FileHeader;
+  int32 Result;
+  uint32 Crc = 0;
+
+  strncpy(FileName, "filename", sizeof(FileName) - 1);
+  FileName[sizeof(FileName) - 1] = '\0';
+
+  FileHeader.NumOfBytes = 1;
+  /* a valid source address is required input to memcpy */
+  FileHeader.SymAddress.Offset = CFE_ES_MEMADDRESS_C(&MM_AppData.LoadBuffer[0]);
+  FileHeader.MemType = MM_MemType_RAM;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_RleEncode), 2);
+  UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_DumpMemToCompressedFile(FileHandle, FileName, &FileHeader, &Crc);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.LastAction, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+      "OS_write error received: RC = %d, Expected = %u, File = '%s'");
+}
+
+void Test_MM_DumpRegionsToFile_Nominal(void) {
+  char FileName[CFE_MISSION_MAX_PATH_LEN];
+  CFE_FS_Header_t CFEHeader;
+  MM_LoadDumpFileHeader_t MMHeader;
+  int32 Result;
+  uint8 Data1[4] = {0};
+  uint8 Data2[6] = {0};
+
+  strncpy(FileName, "filename", sizeof(FileName) - 1);
+  FileName[sizeof(FileName) - 1] = '\0';
+
+  memset(&MMHeader, 0, sizeof(MMHeader));
+  memset(MM_AppData.RegionDir, 0, sizeof(MM_AppData.RegionDir));
+  MMHeader.NumOfBytes = 2 * sizeof(MM_LoadDumpFileHeader_t);
+  MM_AppData.RegionDir[0].SymAddress.Offset = CFE_ES_MEMADDRESS_C(Data1);
+  MM_AppData.RegionDir[0].NumOfBytes = sizeof(Data1);
+  MM_AppData.RegionDir[0].MemType = MM_MemType_RAM;
+  MM_AppData.RegionDir[1].SymAddress.Offset = CFE_ES_MEMADDRESS_C(Data2);
+  MM_AppData.RegionDir[1].NumOfBytes = sizeof(Data2);
+  MM_AppData.RegionDir[1].MemType = MM_MemType_EEPROM;
+
+  UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateFileCRC), 0x5A5A);
+
+  /* Execute the function being tested */
+  Result = MM_DumpRegionsToFile(MM_UT_OBJID_1, FileName, &CFEHeader, &MMHeader);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_SUCCESS);
+  UtAssert_UINT32_EQ(MM_AppData.RegionDir[0].Crc, 0x5A5A);
+  UtAssert_UINT32_EQ(MM_AppData.RegionDir[1].Crc, 0x5A5A);
+  UtAssert_UINT32_EQ(MMHeader.Crc, 0x5A5A);
+
+  /*
+  ** The headers and directory are written before and after the regions,
+  ** each region is written once
+  */
+  UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 2);
+  UtAssert_STUB_COUNT(OS_write, 6);
+  UtAssert_STUB_COUNT(MM_CalculateFileCRC, 3);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_DumpRegionsToFile_WriteError(void) {
+  char FileName[CFE_MISSION_MAX_PATH_LEN];
+  CFE_FS_Header_t CFEHeader;
+  MM_LoadDumpFileHeader_t MMHeader;
+  int32 Result;
+  uint8 Data1[4] = {0};
+
+  strncpy(FileName, "filename", sizeof(FileName) - 1);
+  FileName[sizeof(FileName) - 1] = '\0';
+
+  memset(&MMHeader, 0, sizeof(MMHeader));
+  memset(MM_AppData.RegionDir, 0, sizeof(MM_AppData.RegionDir));
+  MMHeader.NumOfBytes = sizeof(MM_LoadDumpFileHeader_t);
+  MM_AppData.RegionDir[0].SymAddress.Offset = CFE_ES_MEMADDRESS_C(Data1);
+  MM_AppData.RegionDir[0].NumOfBytes = sizeof(Data1);
+  MM_AppData.RegionDir[0].MemType = MM_MemType_RAM;
+
+  UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+
+  /* The region directory can't be written */
+  UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_DumpRegionsToFile(MM_UT_OBJID_1, FileName, &CFEHeader, &MMHeader);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_ERR_INVALID_SIZE);
+
+  /* No region is dumped */
+  UtAssert_STUB_COUNT(OS_write, 2);
+  UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+      "OS_write error received: RC = %d Expected = %u File = '%s'");
+}
+
 void Test_MM_WriteFileHeaders_Nominal(void) {
   char FileName[CFE_MISSION_MAX_PATH_LEN];
   osal_id_t FileHandle = MM_UT_OBJID_1;
@@ -727,6 +929,217 @@ void Test_MM_FillDumpInEventBuffer_MEM8ReadError(void) {
       "PSP read memory error: RC=%d, Src=%p, Tgt=%p, Type=MEM8");
 }
 
+void Test_MM_SendDumpTlm_Idle(void) {
+  /* Execute the function being tested */
+  MM_SendDumpTlm();
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(MM_CalculateCRC, 0);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_SendDumpTlm_Nominal(void) {
+  static uint8 SrcData[MM_INTERFACE_MAX_DUMP_TLM_DATA + 4];
+
+  memset(SrcData, 0xA5, sizeof(SrcData));
+
+  MM_AppData.DumpTlmState.Address = (cpuaddr)SrcData;
+  MM_AppData.DumpTlmState.MemType = MM_MemType_RAM;
+  MM_AppData.DumpTlmState.BytesRemaining = sizeof(SrcData);
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x5A5A);
+
+  /* Unused bytes of the last packet must be cleared */
+  memset(MM_AppData.DumpTlm.Payload.Data, 0xFF,
+         sizeof(MM_AppData.DumpTlm.Payload.Data));
+
+  /* Execute the function being tested */
+  MM_SendDumpTlm();
+
+  /* Verify results, the payload holds the last packet sent */
+  UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 2);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+  UtAssert_STUB_COUNT(MM_CalculateCRC, 2);
+
+  UtAssert_UINT32_EQ(MM_AppData.DumpTlm.Payload.Sequence, 1);
+  UtAssert_UINT32_EQ(MM_AppData.DumpTlm.Payload.NumOfBytes, 4);
+  UtAssert_UINT32_EQ(MM_AppData.DumpTlm.Payload.BytesRemaining, 0);
+  UtAssert_UINT32_EQ(MM_AppData.DumpTlm.Payload.Crc, 0x5A5A);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.DumpTlm.Payload.Address),
+      &SrcData[MM_INTERFACE_MAX_DUMP_TLM_DATA]);
+  UtAssert_UINT8_EQ(MM_AppData.DumpTlm.Payload.Data[3], 0xA5);
+  UtAssert_UINT8_EQ(MM_AppData.DumpTlm.Payload.Data[4], 0);
+
+  UtAssert_UINT32_EQ(MM_AppData.DumpTlmState.BytesRemaining, 0);
+  UtAssert_UINT32_EQ(MM_AppData.DumpTlmState.Sequence, 2);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_SendDumpTlm_PacketBudget(void) {
+  static uint8 SrcData[(MM_INTERNAL_DUMP_TLM_PACKETS_PER_CYCLE + 1) *
+                       MM_INTERFACE_MAX_DUMP_TLM_DATA];
+
+  MM_AppData.DumpTlmState.Address = (cpuaddr)SrcData;
+  MM_AppData.DumpTlmState.MemType = MM_MemType_RAM;
+  MM_AppData.DumpTlmState.BytesRemaining = sizeof(SrcData);
+
+  /* Execute the function being tested */
+  MM_SendDumpTlm();
+
+  /* Verify results, the last packet waits for the next request */
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg,
+                      MM_INTERNAL_DUMP_TLM_PACKETS_PER_CYCLE);
+  UtAssert_UINT32_EQ(MM_AppData.DumpTlmState.BytesRemaining,
+                     MM_INTERFACE_MAX_DUMP_TLM_DATA);
+  UtAssert_UINT32_EQ(MM_AppData.DumpTlmState.Sequence,
+                     MM_INTERNAL_DUMP_TLM_PACKETS_PER_CYCLE);
+  UtAssert_ADDRESS_EQ(MM_AppData.DumpTlmState.Address,
+                      &SrcData[MM_INTERNAL_DUMP_TLM_PACKETS_PER_CYCLE *
+                               MM_INTERFACE_MAX_DUMP_TLM_DATA]);
+
+  /* Execute the function being tested again */
+  MM_SendDumpTlm();
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg,
+                      MM_INTERNAL_DUMP_TLM_PACKETS_PER_CYCLE + 1);
+  UtAssert_UINT32_EQ(MM_AppData.DumpTlmState.BytesRemaining, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_SendDumpTlm_ReadError(void) {
+  MM_AppData.DumpTlmState.Address = 0;
+  MM_AppData.DumpTlmState.MemType = MM_MemType_MEM8;
+  MM_AppData.DumpTlmState.BytesRemaining = 2 * MM_INTERFACE_MAX_DUMP_TLM_DATA;
+
+  /* Set to generate error message MM_PSP_READ_ERR_EID */
+  UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead8), 1,
+                        CFE_PSP_ERROR_NOT_IMPLEMENTED);
+
+  /* Execute the function being tested */
+  MM_SendDumpTlm();
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+  UtAssert_UINT32_EQ(MM_AppData.DumpTlmState.BytesRemaining, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+  MM_Test_Verify_Event(
+      0, MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+      "PSP read memory error: RC=%d, Src=%p, Tgt=%p, Type=MEM8");
+  MM_Test_Verify_Event(1, MM_DUMP_TLM_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Dump to telemetry ended by read error: Packet = %u "
+                       "Addr = %p");
+}
+
+void Test_MM_ChecksumMem_RAM(void) {
+  uint8 Data[(2 * MM_INTERNAL_MAX_DUMP_DATA_SEG) + 4] = {0};
+  uint32 Crc = 0;
+  int32 Result;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x5A5A);
+
+  /* Execute the function being tested */
+  Result = MM_ChecksumMem((cpuaddr)Data, MM_MemType_RAM, sizeof(Data), &Crc);
+
+  /* Verify results, two full segments and one partial segment */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_UINT32_EQ(Crc, 0x5A5A);
+  UtAssert_STUB_COUNT(MM_CalculateCRC, 3);
+  UtAssert_STUB_COUNT(MM_SegmentBreak, 2);
+
+  /* no command-handling function should be updating the cmd or err counter
+   * itself */
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_ChecksumMem_MEM32(void) {
+  uint32 Crc = 0;
+  int32 Result;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x5A5A);
+
+  /* Execute the function being tested */
+  Result = MM_ChecksumMem(0, MM_MemType_MEM32, 8, &Crc);
+
+  /* Verify results, the memory is read through the PSP */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_UINT32_EQ(Crc, 0x5A5A);
+  UtAssert_STUB_COUNT(CFE_PSP_MemRead32, 2);
+  UtAssert_STUB_COUNT(MM_CalculateCRC, 1);
+  UtAssert_STUB_COUNT(MM_SegmentBreak, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_ChecksumMem_ReadError(void) {
+  uint32 Crc = 0x1234;
+  int32 Result;
+
+  /* Set to generate error message MM_PSP_READ_ERR_EID */
+  UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead8), 1, CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_ChecksumMem(0, MM_MemType_MEM8, 8, &Crc);
+
+  /* Verify results, the CRC is not updated */
+  UtAssert_INT32_EQ(Result, CFE_PSP_ERROR);
+  UtAssert_UINT32_EQ(Crc, 0x1234);
+  UtAssert_STUB_COUNT(MM_CalculateCRC, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+      "PSP read memory error: RC=%d, Src=%p, Tgt=%p, Type=MEM8");
+}
+
+void Test_MM_CalculateMemCRC_EEPROM(void) {
+  uint8 Data[16] = {0};
+  uint32 Buffer[4];
+  uint32 Crc = 0x1234;
+  int32 Result;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x5A5A);
+
+  /* Execute the function being tested */
+  Result = MM_CalculateMemCRC((cpuaddr)Data, MM_MemType_EEPROM, sizeof(Data),
+                              Buffer, &Crc);
+
+  /* Verify results, EEPROM is folded into the CRC in place */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_UINT32_EQ(Crc, 0x5A5A);
+  UtAssert_STUB_COUNT(MM_CalculateCRC, 1);
+  UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_CalculateMemCRC_MEM16(void) {
+  uint32 Buffer[4];
+  uint32 Crc = 0x1234;
+  int32 Result;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x5A5A);
+
+  /* Execute the function being tested */
+  Result = MM_CalculateMemCRC(0, MM_MemType_MEM16, 8, Buffer, &Crc);
+
+  /* Verify results, the memory is read into the buffer through the PSP */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_UINT32_EQ(Crc, 0x5A5A);
+  UtAssert_STUB_COUNT(CFE_PSP_MemRead16, 4);
+  UtAssert_STUB_COUNT(MM_CalculateCRC, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
@@ -738,9 +1151,15 @@ void UtTest_Setup(void) {
   ADD_TEST(Test_MM_PeekMem_DWord);
   ADD_TEST(Test_MM_PeekMem_DWordError);
   ADD_TEST(Test_MM_PeekMem_DefaultSwitch);
+  ADD_TEST(Test_MM_PeekValue_Word);
+  ADD_TEST(Test_MM_PeekValue_DefaultSwitch);
   ADD_TEST(Test_MM_DumpMemToFile_Nominal);
   ADD_TEST(Test_MM_DumpMemToFile_CPUHogging);
   ADD_TEST(Test_MM_DumpMemToFile_WriteError);
+  ADD_TEST(Test_MM_DumpMemToCompressedFile_Nominal);
+  ADD_TEST(Test_MM_DumpMemToCompressedFile_WriteError);
+  ADD_TEST(Test_MM_DumpRegionsToFile_Nominal);
+  ADD_TEST(Test_MM_DumpRegionsToFile_WriteError);
   ADD_TEST(Test_MM_WriteFileHeaders_Nominal);
   ADD_TEST(Test_MM_WriteFileHeaders_WriteHeaderError);
   ADD_TEST(Test_MM_WriteFileHeaders_WriteError);
@@ -753,4 +1172,13 @@ void UtTest_Setup(void) {
   ADD_TEST(Test_MM_FillDumpInEventBuffer_MEM32ReadError);
   ADD_TEST(Test_MM_FillDumpInEventBuffer_MEM16ReadError);
   ADD_TEST(Test_MM_FillDumpInEventBuffer_MEM8ReadError);
+  ADD_TEST(Test_MM_SendDumpTlm_Idle);
+  ADD_TEST(Test_MM_SendDumpTlm_Nominal);
+  ADD_TEST(Test_MM_SendDumpTlm_PacketBudget);
+  ADD_TEST(Test_MM_SendDumpTlm_ReadError);
+  ADD_TEST(Test_MM_ChecksumMem_RAM);
+  ADD_TEST(Test_MM_ChecksumMem_MEM32);
+  ADD_TEST(Test_MM_ChecksumMem_ReadError);
+  ADD_TEST(Test_MM_CalculateMemCRC_EEPROM);
+  ADD_TEST(Test_MM_CalculateMemCRC_MEM16);
 }
@@ -59,10 +59,44 @@ void Test_MM_TaskPipe(void) {
   UtAssert_VOIDCALL(MM_TaskPipe(&UtBuf));
 }
 
+void Test_MM_TaskPipe_Cmd(void) {
+  CFE_SB_Buffer_t UtBuf;
+  CFE_SB_MsgId_t MsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+  UT_SetDeferredRetcode(UT_KEY(CFE_EDSMSG_Dispatch), 1, CFE_SUCCESS);
+
+  memset(&UtBuf, 0, sizeof(UtBuf));
+  UtAssert_VOIDCALL(MM_TaskPipe(&UtBuf));
+
+  /* Ground commands wait for the worker task */
+  UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+  UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void Test_MM_TaskPipe_SendHk(void) {
+  CFE_SB_Buffer_t UtBuf;
+  CFE_SB_MsgId_t MsgId = CFE_SB_ValueToMsgId(MM_SEND_HK_MID);
+
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+  UT_SetDeferredRetcode(UT_KEY(CFE_EDSMSG_Dispatch), 1, CFE_SUCCESS);
+
+  memset(&UtBuf, 0, sizeof(UtBuf));
+  UtAssert_VOIDCALL(MM_TaskPipe(&UtBuf));
+
+  /* Housekeeping requests don't wait for the worker task */
+  UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+  UtAssert_STUB_COUNT(OS_MutSemGive, 0);
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
 void UtTest_Setup(void) {
   UtTest_Add(Test_MM_TaskPipe, MM_Test_Setup, MM_Test_TearDown,
              "Test_MM_TaskPipe");
+  UtTest_Add(Test_MM_TaskPipe_Cmd, MM_Test_Setup, MM_Test_TearDown,
+             "Test_MM_TaskPipe_Cmd");
+  UtTest_Add(Test_MM_TaskPipe_SendHk, MM_Test_Setup, MM_Test_TearDown,
+             "Test_MM_TaskPipe_SendHk");
 }
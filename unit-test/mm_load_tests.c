@@ -24,6 +24,7 @@
 /************************************************************************
 ** Includes
 *************************************************************************/
+#include "mm_crc.h"
 #include "mm_eventids.h"
 #include "mm_filedefs.h"
 #include "mm_load.h"
@@ -33,6 +34,7 @@
 #include "mm_msg.h"
 #include "mm_msgdefs.h"
 #include "mm_msgids.h"
+#include "mm_rle.h"
 #include "mm_test_utils.h"
 #include "mm_utils.h"
 #include "mm_version.h"
@@ -49,6 +51,31 @@
 #include <stdlib.h>
 #include <unistd.h>
 
+/*
+ * Segment size used by MM_LoadMemFromFile
+ */
+#ifdef MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD
+#define MM_UT_LOAD_FILE_SEG MM_INTERNAL_MAX_DIRECT_LOAD_DATA_SEG
+#else
+#define MM_UT_LOAD_FILE_SEG MM_INTERNAL_MAX_LOAD_DATA_SEG
+#endif
+
+/*
+ * File offset of the load data, after the cFE and MM file headers
+ */
+#define MM_UT_LOAD_DATA_OFFSET                                                 \
+  (sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t))
+
+/*
+ * Segment size used by MM_LoadMemFromFile for EEPROM, which is copied through
+ * the load i/o buffer when writes are compared
+ */
+#ifdef MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+#define MM_UT_EEPROM_LOAD_FILE_SEG MM_INTERNAL_MAX_LOAD_DATA_SEG
+#else
+#define MM_UT_EEPROM_LOAD_FILE_SEG MM_UT_LOAD_FILE_SEG
+#endif
+
 /*
  * Function Definitions
  */
@@ -299,6 +326,52 @@ void Test_MM_PokeMem_32bitError(void) {
       "PSP write memory error: RC=0x%08X, Address=%p, MemType=MEM%u");
 }
 
+void Test_MM_PokeValue_Ram(void) {
+  int32 Result;
+
+  /* Execute the function being tested */
+  Result = MM_PokeValue(1, MM_MemType_MEM16, MM_INTERNAL_WORD_BIT_WIDTH,
+                        0x12345678);
+
+  /* Verify results, the PSP memory accessor is used */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite16, 1);
+  UtAssert_STUB_COUNT(CFE_PSP_EepromWrite16, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_PokeValue_Eeprom(void) {
+  int32 Result;
+
+  UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_EepromWrite32), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_PokeValue(4, MM_MemType_EEPROM, MM_INTERNAL_DWORD_BIT_WIDTH, 5);
+
+  /* Verify results, the PSP EEPROM accessor is used */
+  UtAssert_INT32_EQ(Result, CFE_PSP_ERROR);
+  UtAssert_STUB_COUNT(CFE_PSP_EepromWrite32, 1);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite32, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_PokeValue_NoDataSize(void) {
+  int32 Result;
+
+  /* Execute the function being tested */
+  Result = MM_PokeValue(1, MM_MemType_RAM, 0, 5);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_PSP_ERROR_NOT_IMPLEMENTED);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite8, 0);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite16, 0);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite32, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void Test_MM_PokeEeprom_NoDataSize(void) {
   MM_PokeCmd_t CmdPacket;
   cpuaddr DestAddress;
@@ -539,22 +612,119 @@ void Test_MM_PokeEeprom_32bitError(void) {
       "CFE_PSP_EepromWrite32 error received: RC = 0x%08X, Addr = %p");
 }
 
+#ifdef MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+void Test_MM_PokeEeprom_Unchanged(void) {
+  MM_PokeCmd_t CmdPacket;
+  cpuaddr DestAddress;
+  CFE_Status_t Result;
+  uint32 CurrentValue = 0x12345678;
+
+  CmdPacket.Payload.MemType = MM_MemType_EEPROM;
+  CmdPacket.Payload.DataSize = MM_INTERNAL_DWORD_BIT_WIDTH;
+  CmdPacket.Payload.Data = 0x12345678;
+
+  DestAddress = 1;
+
+  /* The EEPROM already holds the poke data */
+  UT_SetDataBuffer(UT_KEY(CFE_PSP_MemRead32), &CurrentValue,
+                   sizeof(CurrentValue), false);
+
+  /* Execute the function being tested */
+  Result = MM_PokeEeprom(&CmdPacket, DestAddress);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_STUB_COUNT(CFE_PSP_EepromWrite32, 0);
+
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.LastAction, MM_LastAction_POKE);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed, 4);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.EepromBytesWritten, 0);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.EepromBytesSkipped, 4);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_POKE_DWORD_INF_EID, CFE_EVS_EventType_INFORMATION,
+      "Poke Command: Addr = %p, Size = 32 bits, Data = 0x%08X");
+}
+#endif /* MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE */
+
+void Test_MM_WriteEepromValue_Nominal(void) {
+  int32 Result;
+
+  /* Execute the function being tested */
+  Result = MM_WriteEepromValue(1, MM_INTERNAL_WORD_BIT_WIDTH, 0x1234);
+
+  /* Verify results, the write is neither reported nor the last action */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_STUB_COUNT(CFE_PSP_EepromWrite16, 1);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_NOACTION);
+
+#ifdef MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.EepromBytesWritten, 2);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.EepromBytesSkipped, 0);
+#endif
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WriteEepromValue_Error(void) {
+  int32 Result;
+
+  UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_EepromWrite8), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_WriteEepromValue(1, MM_INTERNAL_BYTE_BIT_WIDTH, 5);
+
+  /* Verify results, the caller reports the error */
+  UtAssert_INT32_EQ(Result, CFE_PSP_ERROR);
+  UtAssert_STUB_COUNT(CFE_PSP_EepromWrite8, 1);
+
+#ifdef MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.EepromBytesWritten, 0);
+#endif
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+#ifdef MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+void Test_MM_WriteEepromValue_Unchanged(void) {
+  int32 Result;
+  uint32 CurrentValue = 0x12345678;
+
+  /* The EEPROM already holds the data */
+  UT_SetDataBuffer(UT_KEY(CFE_PSP_MemRead32), &CurrentValue,
+                   sizeof(CurrentValue), false);
+
+  /* Execute the function being tested */
+  Result = MM_WriteEepromValue(1, MM_INTERNAL_DWORD_BIT_WIDTH, 0x12345678);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_STUB_COUNT(CFE_PSP_EepromWrite32, 0);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.EepromBytesWritten, 0);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.EepromBytesSkipped, 4);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+#endif /* MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE */
+
 void Test_MM_LoadMemFromFile_PreventCPUHogging(void) {
   int32 Result;
   MM_LoadDumpFileHeader_t FileHeader;
   char FileName[] = "filename";
   cpuaddr DestAddress;
-  uint8 OutBuff[(2 * MM_INTERNAL_MAX_LOAD_DATA_SEG) + 2];
+  uint8 OutBuff[(2 * MM_UT_EEPROM_LOAD_FILE_SEG) + 2];
 
   memset(MM_AppData.LoadBuffer, 0,
          sizeof(uint32) * (MM_INTERNAL_MAX_LOAD_DATA_SEG / 4));
+  memset(OutBuff, 0xFF, sizeof(OutBuff));
   FileHeader.MemType = MM_MemType_EEPROM;
-  FileHeader.NumOfBytes = 2 * MM_INTERNAL_MAX_LOAD_DATA_SEG;
+  FileHeader.NumOfBytes = 2 * MM_UT_EEPROM_LOAD_FILE_SEG;
   DestAddress = (cpuaddr)OutBuff;
 
-  /* Set to satisfy condition "(ReadLength = OS_read(FileHandle, ioBuffer,
-   * SegmentSize)) == SegmentSize" */
-  UT_SetDefaultReturnValue(UT_KEY(OS_read), MM_INTERNAL_MAX_LOAD_DATA_SEG);
+  /* Set to satisfy condition "ReadLength == SegmentSize" */
+  UT_SetDefaultReturnValue(UT_KEY(OS_read), MM_UT_EEPROM_LOAD_FILE_SEG);
 
   /* Execute the function being tested */
   Result =
@@ -569,18 +739,27 @@ void Test_MM_LoadMemFromFile_PreventCPUHogging(void) {
                 "MM_AppData.HkTlm.Payload.MemType == MM_MemType_EEPROM");
   UtAssert_ADDRESS_EQ(CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), DestAddress);
   UtAssert_True(MM_AppData.HkTlm.Payload.BytesProcessed ==
-                    2 * MM_INTERNAL_MAX_LOAD_DATA_SEG,
+                    2 * MM_UT_EEPROM_LOAD_FILE_SEG,
                 "MM_AppData.HkTlm.Payload.BytesProcessed == "
-                "2*MM_INTERNAL_MAX_LOAD_DATA_SEG");
+                "2*MM_UT_EEPROM_LOAD_FILE_SEG");
   UtAssert_STRINGBUF_EQ(MM_AppData.HkTlm.Payload.FileName,
                         sizeof(MM_AppData.HkTlm.Payload.FileName), FileName,
                         sizeof(FileName));
 
+#ifdef MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+  /* Every byte differed from the EEPROM contents */
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.EepromBytesWritten,
+                     2 * MM_UT_EEPROM_LOAD_FILE_SEG);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.EepromBytesSkipped, 0);
+#endif
+
   /* No command-handling function should be updating the cmd or err counter
    * itself */
   UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
+  UtAssert_STUB_COUNT(OS_read, 2);
+  UtAssert_STUB_COUNT(MM_SegmentBreak, 1);
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
@@ -619,15 +798,22 @@ void Test_MM_LoadMemFromFile_NotEepromMemType(void) {
   MM_LoadDumpFileHeader_t FileHeader;
   char FileName[] = "filename";
   cpuaddr DestAddress;
-  uint8 OutBuff[(2 * MM_INTERNAL_MAX_LOAD_DATA_SEG) + 2];
+  uint8 OutBuff[(2 * MM_UT_LOAD_FILE_SEG) + 2];
 
   FileHeader.MemType = MM_MemType_MEM8;
-  FileHeader.NumOfBytes = 2 * MM_INTERNAL_MAX_LOAD_DATA_SEG;
+  FileHeader.NumOfBytes = 2 * MM_UT_LOAD_FILE_SEG;
   DestAddress = (cpuaddr)OutBuff;
 
-  /* Set to satisfy condition "(ReadLength = OS_read(FileHandle, ioBuffer,
-   * SegmentSize)) == SegmentSize" */
-  UT_SetDefaultReturnValue(UT_KEY(OS_read), MM_INTERNAL_MAX_LOAD_DATA_SEG);
+#ifdef MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD
+  /* The rest of the file is exactly the load data */
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1,
+                        MM_UT_LOAD_DATA_OFFSET + (2 * MM_UT_LOAD_FILE_SEG));
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+#endif
+
+  /* Set to satisfy condition "ReadLength == SegmentSize" */
+  UT_SetDefaultReturnValue(UT_KEY(OS_read), MM_UT_LOAD_FILE_SEG);
 
   /* Execute the function being tested */
   Result =
@@ -642,9 +828,9 @@ void Test_MM_LoadMemFromFile_NotEepromMemType(void) {
                 "MM_AppData.HkTlm.Payload.MemType == MM_MemType_MEM8");
   UtAssert_ADDRESS_EQ(CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), DestAddress);
   UtAssert_True(MM_AppData.HkTlm.Payload.BytesProcessed ==
-                    2 * MM_INTERNAL_MAX_LOAD_DATA_SEG,
+                    2 * MM_UT_LOAD_FILE_SEG,
                 "MM_AppData.HkTlm.Payload.BytesProcessed == "
-                "2*MM_INTERNAL_MAX_LOAD_DATA_SEG");
+                "2*MM_UT_LOAD_FILE_SEG");
   UtAssert_STRINGBUF_EQ(MM_AppData.HkTlm.Payload.FileName,
                         sizeof(MM_AppData.HkTlm.Payload.FileName), FileName,
                         sizeof(FileName));
@@ -654,148 +840,1197 @@ void Test_MM_LoadMemFromFile_NotEepromMemType(void) {
   UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
+  UtAssert_STUB_COUNT(OS_read, 2);
+  UtAssert_STUB_COUNT(MM_SegmentBreak, 1);
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_MM_VerifyLoadFileSize_Nominal(void) {
-  int32 Status;
+#ifdef MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD
+void Test_MM_LoadMemFromFile_DirectSizeError(void) {
+  int32 Result;
   MM_LoadDumpFileHeader_t FileHeader;
-  os_fstat_t FileStats;
+  cpuaddr DestAddress = 0;
 
-  memset(&FileHeader, 0, sizeof(MM_LoadDumpFileHeader_t));
-  FileHeader.NumOfBytes = 1;
+  FileHeader.MemType = MM_MemType_RAM;
+  FileHeader.NumOfBytes = 2 * MM_UT_LOAD_FILE_SEG;
 
-  memset(&FileStats, 0, sizeof(os_fstat_t));
-  FileStats.FileSize = FileHeader.NumOfBytes + sizeof(CFE_FS_Header_t) +
-                       sizeof(MM_LoadDumpFileHeader_t);
+  /* The file is one byte short */
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1,
+                        MM_UT_LOAD_DATA_OFFSET + (2 * MM_UT_LOAD_FILE_SEG) - 1);
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
 
-  UT_SetDefaultReturnValue(UT_KEY(OS_stat), OS_SUCCESS);
-  UT_SetDataBuffer(UT_KEY(OS_stat), &FileStats, sizeof(os_fstat_t), false);
+  /* Execute the function being tested */
+  Result = MM_LoadMemFromFile(MM_UT_OBJID_1, (char *)"filename", &FileHeader,
+                              DestAddress);
+
+  /* Verify results, nothing is read into the destination */
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+  UtAssert_STUB_COUNT(OS_read, 0);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_NOACTION);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_LD_FILE_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Direct load file size error: Remaining = %d "
+                       "Expected = %u File = '%s'");
+}
+
+void Test_MM_LoadMemFromFile_DirectSeekError(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+  cpuaddr DestAddress = 0;
+
+  FileHeader.MemType = MM_MemType_RAM;
+  FileHeader.NumOfBytes = 4;
+
+  /* The end of the file can't be found */
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, OS_ERROR);
 
   /* Execute the function being tested */
-  Status = MM_VerifyLoadFileSize(NULL, &FileHeader);
+  Result = MM_LoadMemFromFile(MM_UT_OBJID_1, (char *)"filename", &FileHeader,
+                              DestAddress);
 
   /* Verify results */
-  UtAssert_EQ(int32, Status, OS_SUCCESS);
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+  UtAssert_STUB_COUNT(OS_read, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_LD_FILE_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Direct load file size error: Remaining = %d "
+                       "Expected = %u File = '%s'");
 }
 
-void Test_MM_VerifyLoadFileSize_StatError(void) {
+void Test_MM_LoadMemFromFile_DirectReadError(void) {
   int32 Result;
   MM_LoadDumpFileHeader_t FileHeader;
+  uint8 OutBuff[(2 * MM_UT_LOAD_FILE_SEG) + 2];
+  cpuaddr DestAddress = (cpuaddr)OutBuff;
 
-  /* Set to generate error message MM_OS_MEMVALIDATE_ERR_EID */
-  UT_SetDeferredRetcode(UT_KEY(OS_stat), 1, OS_FS_ERR_PATH_INVALID);
+  FileHeader.MemType = MM_MemType_RAM;
+  FileHeader.NumOfBytes = 2 * MM_UT_LOAD_FILE_SEG;
+
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1,
+                        MM_UT_LOAD_DATA_OFFSET + (2 * MM_UT_LOAD_FILE_SEG));
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+
+  /* The second segment read fails after the first was loaded */
+  UT_SetDefaultReturnValue(UT_KEY(OS_read), MM_UT_LOAD_FILE_SEG);
+  UT_SetDeferredRetcode(UT_KEY(OS_read), 2, OS_ERROR);
 
   /* Execute the function being tested */
-  Result = MM_VerifyLoadFileSize((char *)"filename", &FileHeader);
+  Result = MM_LoadMemFromFile(MM_UT_OBJID_1, (char *)"filename", &FileHeader,
+                              DestAddress);
 
   /* Verify results */
-  UtAssert_True(Result == OS_FS_ERR_PATH_INVALID,
-                "Result == OS_FS_ERR_PATH_INVALID");
-
-  /* No command-handling function should be updating the cmd or err counter
-   * itself */
-  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
-  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+  UtAssert_STUB_COUNT(OS_read, 2);
 
-  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_OS_STAT_ERR_EID, CFE_EVS_EventType_ERROR,
-                       "OS_stat error received: RC = 0x%08X File = '%s'");
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+  MM_Test_Verify_Event(
+      0, MM_OS_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+      "OS_read error received: RC = 0x%08X Expected = %u File = '%s'");
+  MM_Test_Verify_Event(1, MM_DIRECT_LOAD_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Direct load stopped, memory partly loaded: "
+                       "Loaded = %u of %u bytes Addr = %p File = '%s'");
 }
+#endif /* MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD */
 
-void Test_MM_VerifyLoadFileSize_SizeError(void) {
+void Test_MM_StageLoadFile_Nominal(void) {
   int32 Result;
   MM_LoadDumpFileHeader_t FileHeader;
+  uint32 Crc = 0;
 
-  FileHeader.NumOfBytes = 99;
+  FileHeader.MemType = MM_MemType_RAM;
+  FileHeader.NumOfBytes = (2 * MM_INTERNAL_MAX_LOAD_DATA_SEG) + 4;
+
+  UT_SetDeferredRetcode(UT_KEY(OS_read), 1, MM_INTERNAL_MAX_LOAD_DATA_SEG);
+  UT_SetDeferredRetcode(UT_KEY(OS_read), 1, MM_INTERNAL_MAX_LOAD_DATA_SEG);
+  UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 4);
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateFileCRC), 0x1234);
 
   /* Execute the function being tested */
-  Result = MM_VerifyLoadFileSize((char *)"filename", &FileHeader);
+  Result = MM_StageLoadFile(MM_UT_OBJID_1, "filename", &FileHeader, &Crc);
 
   /* Verify results */
-  UtAssert_True(Result == OS_ERR_INVALID_SIZE, "Result == OS_ERR_INVALID_SIZE");
+  UtAssert_INT32_EQ(Result, OS_SUCCESS);
+  UtAssert_UINT32_EQ(Crc, 0x1234);
 
-  /* No command-handling function should be updating the cmd or err counter
-   * itself */
+  /* The CRC is computed as each segment is read */
+  UtAssert_STUB_COUNT(OS_read, 3);
+  UtAssert_STUB_COUNT(MM_CalculateFileCRC, 3);
+  UtAssert_STUB_COUNT(MM_SegmentBreak, 2);
+
+  /* Staging a file doesn't update the "last action" data */
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.LastAction, 0);
   UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_StageLoadFile_ReadError(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+  uint32 Crc = 99;
+
+  FileHeader.MemType = MM_MemType_RAM;
+  FileHeader.NumOfBytes = 2 * MM_INTERNAL_MAX_LOAD_DATA_SEG;
+
+  UT_SetDeferredRetcode(UT_KEY(OS_read), 1, MM_INTERNAL_MAX_LOAD_DATA_SEG);
+  UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+
+  /* Execute the function being tested */
+  Result = MM_StageLoadFile(MM_UT_OBJID_1, "filename", &FileHeader, &Crc);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+  UtAssert_UINT32_EQ(Crc, 99);
+
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
   MM_Test_Verify_Event(
-      0, MM_LD_FILE_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
-      "Load file size error: Reported by OS = %d Expected = %u File = '%s'");
+      0, MM_OS_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+      "OS_read error received: RC = 0x%08X Expected = %u File = '%s'");
 }
 
-void Test_MM_ReadFileHeaders_Nominal(void) {
-  int32 Status;
-  osal_id_t FileHandle = MM_UT_OBJID_1;
-  CFE_FS_Header_t CFEHeader;
-  MM_LoadDumpFileHeader_t MMHeader;
+void Test_MM_LoadMemFromStage_Eeprom(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+  char FileName[] = "filename";
+  uint8 OutBuff[8];
 
-  UT_SetDefaultReturnValue(UT_KEY(CFE_FS_ReadHeader), sizeof(CFE_FS_Header_t));
-  UT_SetDefaultReturnValue(UT_KEY(OS_read), sizeof(MM_LoadDumpFileHeader_t));
+  memset(OutBuff, 0, sizeof(OutBuff));
+  memset(MM_AppData.StageBuffer, 0xA5, sizeof(OutBuff));
+  FileHeader.MemType = MM_MemType_EEPROM;
+  FileHeader.NumOfBytes = sizeof(OutBuff);
 
   /* Execute the function being tested */
-  Status = MM_ReadFileHeaders(NULL, FileHandle, &CFEHeader, &MMHeader);
+  Result = MM_LoadMemFromStage(FileName, &FileHeader, (cpuaddr)OutBuff);
 
   /* Verify results */
-  UtAssert_EQ(int32, Status, OS_SUCCESS);
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_MemCmp(OutBuff, MM_AppData.StageBuffer, sizeof(OutBuff),
+                  "Staged data written to memory");
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_LOAD_FROM_FILE);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.MemType, MM_MemType_EEPROM);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), OutBuff);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed, sizeof(OutBuff));
+  UtAssert_STRINGBUF_EQ(MM_AppData.HkTlm.Payload.FileName,
+                        sizeof(MM_AppData.HkTlm.Payload.FileName), FileName,
+                        sizeof(FileName));
+
+  UtAssert_STUB_COUNT(CFE_ES_PerfLogAdd, 2);
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void Test_MM_ReadFileHeaders_ReadHeaderError(void) {
+void Test_MM_LoadMemFromStage_WriteError(void) {
   int32 Result;
-  osal_id_t FileHandle = MM_UT_OBJID_1;
-  CFE_FS_Header_t CFEHeader;
-  MM_LoadDumpFileHeader_t MMHeader;
+  MM_LoadDumpFileHeader_t FileHeader;
 
-  /* Set to satisfy condition "OS_Status != sizeof(CFE_FS_Header_t)" */
-  UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, CFE_FS_BAD_ARGUMENT);
+  FileHeader.MemType = MM_MemType_MEM8;
+  FileHeader.NumOfBytes = 4;
+
+  UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_MemWrite8), CFE_PSP_ERROR);
 
   /* Execute the function being tested */
-  Result =
-      MM_ReadFileHeaders((char *)"filename", FileHandle, &CFEHeader, &MMHeader);
+  Result = MM_LoadMemFromStage("filename", &FileHeader, 0);
 
   /* Verify results */
-  UtAssert_True(Result == OS_ERR_INVALID_SIZE, "Result == OS_ERR_INVALID_SIZE");
-
-  /* No command-handling function should be updating the cmd or err counter
-   * itself */
-  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
-  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_INT32_EQ(Result, CFE_PSP_ERROR);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.LastAction, 0);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed, 0);
 
+  UtAssert_STUB_COUNT(CFE_ES_PerfLogAdd, 0);
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-  MM_Test_Verify_Event(0, MM_CFE_FS_READHDR_ERR_EID, CFE_EVS_EventType_ERROR,
-                       "CFE_FS_ReadHeader error received: RC = 0x%08X Expected "
-                       "= %u File = '%s'");
+  MM_Test_Verify_Event(
+      0, MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "PSP write memory error: RC=0x%08X, Address=%p, MemType=%d");
 }
 
-void Test_MM_ReadFileHeaders_ReadError(void) {
+/*
+ * Adds a patch run to the staging buffer at *RecordOffset
+ */
+void MM_Test_StagePatchRun(uint32 *RecordOffset, uint32 Offset, uint32 Length,
+                           uint8 Value) {
+  uint8 *StagePointer = (uint8 *)&MM_AppData.StageBuffer[0];
+  MM_PatchRunHeader_t RunHeader;
+
+  RunHeader.Offset = Offset;
+  RunHeader.Length = Length;
+  memcpy(&StagePointer[*RecordOffset], &RunHeader, sizeof(RunHeader));
+  memset(&StagePointer[*RecordOffset + sizeof(RunHeader)], Value, Length);
+
+  *RecordOffset += sizeof(RunHeader) + Length;
+}
+
+void Test_MM_StageLoadFile_TooLarge(void) {
   int32 Result;
-  osal_id_t FileHandle = MM_UT_OBJID_1;
-  CFE_FS_Header_t CFEHeader;
-  MM_LoadDumpFileHeader_t MMHeader;
+  MM_LoadDumpFileHeader_t FileHeader;
+  uint32 Crc = 99;
 
-  /* Set to generate error message MM_OS_READ_ERR_EID */
-  UT_SetDeferredRetcode(UT_KEY(OS_read), 1, OS_ERROR);
+  FileHeader.MemType = MM_MemType_RAM;
+  FileHeader.NumOfBytes = MM_INTERNAL_MAX_STAGED_LOAD_BYTES + 4;
 
   /* Execute the function being tested */
-  Result =
-      MM_ReadFileHeaders((char *)"filename", FileHandle, &CFEHeader, &MMHeader);
+  Result = MM_StageLoadFile(MM_UT_OBJID_1, "filename", &FileHeader, &Crc);
 
   /* Verify results */
-  UtAssert_True(Result == OS_ERR_INVALID_SIZE, "Result == OS_ERR_INVALID_SIZE");
-
-  /* No command-handling function should be updating the cmd or err counter
-   * itself */
-  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
-  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+  UtAssert_UINT32_EQ(Crc, 99);
+  UtAssert_STUB_COUNT(OS_read, 0);
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
   MM_Test_Verify_Event(
-      0, MM_OS_READ_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
-      "OS_read error received: RC = 0x%08X Expected = %u File = '%s'");
+      0, MM_STAGE_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "Load file too large to stage: Bytes = %u Max = %u File = '%s'");
+}
+
+void Test_MM_LoadPatchFromStage_Nominal(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+  char FileName[] = "filename";
+  uint8 Target[16];
+  uint8 Expected[16];
+  uint32 RecordOffset = 0;
+
+  memset(Target, 0, sizeof(Target));
+  memset(Expected, 0, sizeof(Expected));
+  memset(&Expected[0], 0x11, 4);
+  memset(&Expected[8], 0x22, 2);
+
+  MM_Test_StagePatchRun(&RecordOffset, 0, 4, 0x11);
+  MM_Test_StagePatchRun(&RecordOffset, 8, 2, 0x22);
+
+  FileHeader.MemType = MM_MemType_RAM;
+  FileHeader.NumOfBytes = RecordOffset;
+
+  /* Execute the function being tested */
+  Result = MM_LoadPatchFromStage(FileName, &FileHeader, (cpuaddr)Target);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_SUCCESS);
+  UtAssert_MemCmp(Target, Expected, sizeof(Target), "Only the runs are loaded");
+
+  /* Each run is checked on its own */
+  UtAssert_STUB_COUNT(MM_VerifyLoadDumpParams, 2);
+
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_LOAD_FROM_FILE);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.MemType, MM_MemType_RAM);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), Target);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed, 6);
+  UtAssert_STRINGBUF_EQ(MM_AppData.HkTlm.Payload.FileName,
+                        sizeof(MM_AppData.HkTlm.Payload.FileName), FileName,
+                        sizeof(FileName));
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_LoadPatchFromStage_TruncatedRun(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+  uint8 Target[16];
+  uint8 Expected[16];
+  uint32 RecordOffset = 0;
+
+  memset(Target, 0, sizeof(Target));
+  memset(Expected, 0, sizeof(Expected));
+
+  /* The second run claims more data than the file holds */
+  MM_Test_StagePatchRun(&RecordOffset, 0, 4, 0x11);
+  MM_Test_StagePatchRun(&RecordOffset, 8, 8, 0x22);
+
+  FileHeader.MemType = MM_MemType_RAM;
+  FileHeader.NumOfBytes = RecordOffset - 4;
+
+  /* Execute the function being tested */
+  Result = MM_LoadPatchFromStage("filename", &FileHeader, (cpuaddr)Target);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+  UtAssert_MemCmp(Target, Expected, sizeof(Target), "Memory is not written");
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.LastAction, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_PATCH_RUN_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Patch file run %u invalid at byte %u: File = '%s'");
+}
+
+void Test_MM_LoadPatchFromStage_VerifyParamsError(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+  uint8 Target[16];
+  uint8 Expected[16];
+  uint32 RecordOffset = 0;
+
+  memset(Target, 0, sizeof(Target));
+  memset(Expected, 0, sizeof(Expected));
+
+  MM_Test_StagePatchRun(&RecordOffset, 0, 4, 0x11);
+  MM_Test_StagePatchRun(&RecordOffset, 8, 2, 0x22);
+
+  FileHeader.MemType = MM_MemType_RAM;
+  FileHeader.NumOfBytes = RecordOffset;
+
+  /* The second run fails the load parameter checks */
+  UT_SetDeferredRetcode(UT_KEY(MM_VerifyLoadDumpParams), 2, CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_LoadPatchFromStage("filename", &FileHeader, (cpuaddr)Target);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+  UtAssert_MemCmp(Target, Expected, sizeof(Target),
+                  "No run is written when any run is invalid");
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_PATCH_RUN_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Patch file run %u invalid at byte %u: File = '%s'");
+}
+
+void Test_MM_LoadPatchFromStage_NoRuns(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+
+  FileHeader.MemType = MM_MemType_RAM;
+  FileHeader.NumOfBytes = 0;
+
+  /* Execute the function being tested */
+  Result = MM_LoadPatchFromStage("filename", &FileHeader, 0);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_PATCH_RUN_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Patch file run %u invalid at byte %u: File = '%s'");
+}
+
+/*
+ * Resolves a symbolic address to its offset
+ */
+void UT_Handler_MM_ResolveSymAddrOffset(void *UserObj, UT_EntryKey_t FuncKey,
+                                        const UT_StubContext_t *Context) {
+  MM_SymAddr_t *SymAddr =
+      UT_Hook_GetArgValueByName(Context, "SymAddr", MM_SymAddr_t *);
+  cpuaddr *ResolvedAddr =
+      UT_Hook_GetArgValueByName(Context, "ResolvedAddr", cpuaddr *);
+
+  *ResolvedAddr = (cpuaddr)CFE_ES_MEMADDRESS_TO_PTR(SymAddr->Offset);
+}
+
+/*
+ * Region file with two RAM regions, read back by OS_read in file order
+ */
+typedef struct {
+  MM_LoadDumpFileHeader_t Dir[2];
+  uint8 Data[10];
+} MM_Test_RegionFile_t;
+
+void MM_Test_SetupRegionFile(MM_Test_RegionFile_t *RegionFile,
+                             MM_LoadDumpFileHeader_t *FileHeader,
+                             uint8 *Target1, uint8 *Target2) {
+  static os_fstat_t FileStats;
+
+  memset(RegionFile, 0, sizeof(*RegionFile));
+  memset(FileHeader, 0, sizeof(*FileHeader));
+
+  RegionFile->Dir[0].SymAddress.Offset = CFE_ES_MEMADDRESS_C(Target1);
+  RegionFile->Dir[0].NumOfBytes = 4;
+  RegionFile->Dir[0].MemType = MM_MemType_RAM;
+  RegionFile->Dir[1].SymAddress.Offset = CFE_ES_MEMADDRESS_C(Target2);
+  RegionFile->Dir[1].NumOfBytes = 6;
+  RegionFile->Dir[1].MemType = MM_MemType_RAM;
+  memset(&RegionFile->Data[0], 0x11, 4);
+  memset(&RegionFile->Data[4], 0x22, 6);
+
+  FileHeader->NumOfBytes = sizeof(RegionFile->Dir);
+
+  memset(&FileStats, 0, sizeof(FileStats));
+  FileStats.FileSize = MM_UT_LOAD_DATA_OFFSET + sizeof(*RegionFile);
+  UT_SetDataBuffer(UT_KEY(OS_stat), &FileStats, sizeof(FileStats), false);
+
+  UT_SetDataBuffer(UT_KEY(OS_read), RegionFile, sizeof(*RegionFile), false);
+  UT_SetHandlerFunction(UT_KEY(MM_ResolveSymAddr),
+                        UT_Handler_MM_ResolveSymAddrOffset, NULL);
+}
+
+void Test_MM_LoadRegionsFromFile_Nominal(void) {
+  int32 Result;
+  MM_Test_RegionFile_t RegionFile;
+  MM_LoadDumpFileHeader_t FileHeader;
+  char FileName[] = "filename";
+  uint8 Target1[4];
+  uint8 Target2[6];
+  uint8 Expected[6];
+
+  memset(Target1, 0, sizeof(Target1));
+  memset(Target2, 0, sizeof(Target2));
+  MM_Test_SetupRegionFile(&RegionFile, &FileHeader, Target1, Target2);
+
+  /* Execute the function being tested */
+  Result = MM_LoadRegionsFromFile(MM_UT_OBJID_1, FileName, &FileHeader);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_SUCCESS);
+  memset(Expected, 0x11, sizeof(Expected));
+  UtAssert_MemCmp(Target1, Expected, sizeof(Target1), "First region loaded");
+  memset(Expected, 0x22, sizeof(Expected));
+  UtAssert_MemCmp(Target2, Expected, sizeof(Target2), "Second region loaded");
+
+  /* The directory and each region are read once, in file order */
+  UtAssert_STUB_COUNT(OS_read, 3);
+  UtAssert_STUB_COUNT(OS_lseek, 0);
+  UtAssert_STUB_COUNT(OS_stat, 1);
+  UtAssert_STUB_COUNT(MM_CalculateFileCRC, 3);
+  UtAssert_STUB_COUNT(MM_VerifyLoadDumpParams, 2);
+
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_LOAD_FROM_FILE);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.MemType, MM_MemType_RAM);
+  UtAssert_ADDRESS_EQ(
+      CFE_ES_MEMADDRESS_TO_PTR(MM_AppData.HkTlm.Payload.Address), Target1);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed, 10);
+  UtAssert_STRINGBUF_EQ(MM_AppData.HkTlm.Payload.FileName,
+                        sizeof(MM_AppData.HkTlm.Payload.FileName), FileName,
+                        sizeof(FileName));
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_LoadRegionsFromFile_BadDirectory(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+
+  memset(&FileHeader, 0, sizeof(FileHeader));
+
+  /* A directory that isn't a whole number of entries */
+  FileHeader.NumOfBytes = sizeof(MM_LoadDumpFileHeader_t) + 1;
+
+  /* Execute the function being tested */
+  Result = MM_LoadRegionsFromFile(MM_UT_OBJID_1, "filename", &FileHeader);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+  UtAssert_STUB_COUNT(OS_read, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Region file directory invalid: Size = %u Max Regions "
+                       "= %u File = '%s'");
+}
+
+void Test_MM_LoadRegionsFromFile_DirectoryCRCError(void) {
+  int32 Result;
+  MM_Test_RegionFile_t RegionFile;
+  MM_LoadDumpFileHeader_t FileHeader;
+  uint8 Target1[4];
+  uint8 Target2[6];
+
+  MM_Test_SetupRegionFile(&RegionFile, &FileHeader, Target1, Target2);
+  FileHeader.Crc = 1;
+
+  /* Execute the function being tested */
+  Result = MM_LoadRegionsFromFile(MM_UT_OBJID_1, "filename", &FileHeader);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+  UtAssert_STUB_COUNT(OS_read, 1);
+  UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_LOAD_FILE_CRC_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Load file CRC failure: Expected = 0x%X "
+                       "Calculated = 0x%X File = '%s'");
+}
+
+void Test_MM_LoadRegionsFromFile_VerifyParamsError(void) {
+  int32 Result;
+  MM_Test_RegionFile_t RegionFile;
+  MM_LoadDumpFileHeader_t FileHeader;
+  uint8 Target1[4];
+  uint8 Target2[6];
+  uint8 Expected[6];
+
+  memset(Target1, 0, sizeof(Target1));
+  memset(Target2, 0, sizeof(Target2));
+  memset(Expected, 0, sizeof(Expected));
+  MM_Test_SetupRegionFile(&RegionFile, &FileHeader, Target1, Target2);
+
+  /* The second region fails the load parameter checks */
+  UT_SetDeferredRetcode(UT_KEY(MM_VerifyLoadDumpParams), 2, CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_LoadRegionsFromFile(MM_UT_OBJID_1, "filename", &FileHeader);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+  UtAssert_MemCmp(Target1, Expected, sizeof(Target1),
+                  "No region is written when any region is invalid");
+
+  /* No region data is read */
+  UtAssert_STUB_COUNT(OS_read, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Region %u failed parameters check: File = '%s'");
+}
+
+void Test_MM_LoadRegionsFromFile_RegionCRCError(void) {
+  int32 Result;
+  MM_Test_RegionFile_t RegionFile;
+  MM_LoadDumpFileHeader_t FileHeader;
+  uint8 Target1[4];
+  uint8 Target2[6];
+  uint8 Expected[6];
+
+  memset(Target1, 0, sizeof(Target1));
+  memset(Target2, 0, sizeof(Target2));
+  memset(Expected, 0, sizeof(Expected));
+  MM_Test_SetupRegionFile(&RegionFile, &FileHeader, Target1, Target2);
+
+  /* The CRC of the second region doesn't match its directory entry */
+  UT_SetDeferredRetcode(UT_KEY(MM_CalculateFileCRC), 3, 5);
+
+  /* Execute the function being tested */
+  Result = MM_LoadRegionsFromFile(MM_UT_OBJID_1, "filename", &FileHeader);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+  UtAssert_MemCmp(Target1, Expected, sizeof(Target1),
+                  "No region is written when any region CRC fails");
+  UtAssert_MemCmp(Target2, Expected, sizeof(Target2),
+                  "No region is written when any region CRC fails");
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.LastAction, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_REGION_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Region %u CRC failure: Expected = 0x%X Calculated = "
+                       "0x%X File = '%s'");
+}
+
+void Test_MM_LoadRegionsFromFile_FileSizeError(void) {
+  int32 Result;
+  MM_Test_RegionFile_t RegionFile;
+  MM_LoadDumpFileHeader_t FileHeader;
+  os_fstat_t FileStats;
+  uint8 Target1[4];
+  uint8 Target2[6];
+  uint8 Expected[6];
+
+  memset(Target1, 0, sizeof(Target1));
+  memset(Target2, 0, sizeof(Target2));
+  memset(Expected, 0, sizeof(Expected));
+  MM_Test_SetupRegionFile(&RegionFile, &FileHeader, Target1, Target2);
+
+  /* The file ends part way through the second region */
+  memset(&FileStats, 0, sizeof(FileStats));
+  FileStats.FileSize = MM_UT_LOAD_DATA_OFFSET + sizeof(RegionFile) - 1;
+  UT_SetDataBuffer(UT_KEY(OS_stat), &FileStats, sizeof(FileStats), false);
+
+  /* Execute the function being tested */
+  Result = MM_LoadRegionsFromFile(MM_UT_OBJID_1, "filename", &FileHeader);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_ERR_INVALID_SIZE);
+  UtAssert_MemCmp(Target1, Expected, sizeof(Target1),
+                  "No region is written when the file is truncated");
+
+  /* Only the directory is read */
+  UtAssert_STUB_COUNT(OS_read, 1);
+  UtAssert_STUB_COUNT(OS_stat, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_LD_FILE_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "Load file size error: Reported by OS = %d Expected = %u File = '%s'");
+}
+
+/*
+ * Decodes as much data as fits, treating the input as already decoded
+ */
+void UT_Handler_MM_RleDecode(void *UserObj, UT_EntryKey_t FuncKey,
+                             const UT_StubContext_t *Context) {
+  const uint8 *InBuffer =
+      UT_Hook_GetArgValueByName(Context, "InBuffer", const uint8 *);
+  size_t InSize = UT_Hook_GetArgValueByName(Context, "InSize", size_t);
+  size_t *InUsed = UT_Hook_GetArgValueByName(Context, "InUsed", size_t *);
+  uint8 *OutBuffer = UT_Hook_GetArgValueByName(Context, "OutBuffer", uint8 *);
+  size_t OutSize = UT_Hook_GetArgValueByName(Context, "OutSize", size_t);
+  size_t Length = (InSize < OutSize) ? InSize : OutSize;
+
+  memcpy(OutBuffer, InBuffer, Length);
+  *InUsed = Length;
+
+  UT_Stub_SetReturnValue(FuncKey, Length);
+}
+
+void Test_MM_LoadMemFromCompressedFile_Nominal(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+  uint32 Crc = 0;
+  uint8 Expected[(2 * MM_INTERNAL_MAX_LOAD_DATA_SEG) + 4];
+  uint8 Dest[(2 * MM_INTERNAL_MAX_LOAD_DATA_SEG) + 4];
+
+  FileHeader.MemType = MM_MemType_EEPROM;
+  FileHeader.NumOfBytes = sizeof(Dest);
+
+  memset(Expected, 0x5A, sizeof(Expected));
+  memset(Dest, 0, sizeof(Dest));
+  memset(MM_AppData.CodecBuffer, 0x5A, sizeof(MM_AppData.CodecBuffer));
+
+  /* The test decoder uses one compressed byte per load byte */
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1,
+                        MM_UT_LOAD_DATA_OFFSET + sizeof(Dest));
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+
+  UT_SetDefaultReturnValue(UT_KEY(OS_read), sizeof(MM_AppData.CodecBuffer));
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateFileCRC), 0x1234);
+  UT_SetHandlerFunction(UT_KEY(MM_RleDecode), UT_Handler_MM_RleDecode, NULL);
+
+  /* Execute the function being tested */
+  Result = MM_LoadMemFromCompressedFile(MM_UT_OBJID_1, "filename", &FileHeader,
+                                        (cpuaddr)Dest, true, &Crc);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_SUCCESS);
+  UtAssert_UINT32_EQ(Crc, 0x1234);
+  UtAssert_MemCmp(Dest, Expected, sizeof(Dest), "Decompressed data loaded");
+
+  /* Compressed data is read in pieces that don't line up with segments */
+  UtAssert_STUB_COUNT(OS_read, 2);
+  UtAssert_STUB_COUNT(MM_CalculateFileCRC, 3);
+  UtAssert_STUB_COUNT(MM_SegmentBreak, 2);
+
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.LastAction,
+                    MM_LastAction_LOAD_FROM_FILE);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.BytesProcessed, sizeof(Dest));
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_LoadMemFromCompressedFile_CrcOnly(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+  uint32 Crc = 0;
+
+  FileHeader.MemType = MM_MemType_RAM;
+  FileHeader.NumOfBytes = 4;
+
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET + 4);
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+
+  UT_SetDefaultReturnValue(UT_KEY(OS_read), sizeof(MM_AppData.CodecBuffer));
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateFileCRC), 0x1234);
+  UT_SetHandlerFunction(UT_KEY(MM_RleDecode), UT_Handler_MM_RleDecode, NULL);
+
+  /* Execute the function being tested, no memory is written */
+  Result = MM_LoadMemFromCompressedFile(MM_UT_OBJID_1, "filename", &FileHeader,
+                                        0, false, &Crc);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_SUCCESS);
+  UtAssert_UINT32_EQ(Crc, 0x1234);
+
+  /* Checking the CRC doesn't update the "last action" data */
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.LastAction, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_LoadMemFromCompressedFile_Truncated(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+  uint32 Crc = 99;
+
+  FileHeader.MemType = MM_MemType_RAM;
+  FileHeader.NumOfBytes = 2 * MM_INTERNAL_MAX_LOAD_DATA_SEG;
+
+  /* The file shrinks after its size was checked */
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1,
+                        MM_UT_LOAD_DATA_OFFSET +
+                            (2 * MM_INTERNAL_MAX_LOAD_DATA_SEG));
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+
+  UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 4);
+  UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+  UT_SetHandlerFunction(UT_KEY(MM_RleDecode), UT_Handler_MM_RleDecode, NULL);
+
+  /* Execute the function being tested */
+  Result = MM_LoadMemFromCompressedFile(MM_UT_OBJID_1, "filename", &FileHeader,
+                                        0, false, &Crc);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+  UtAssert_UINT32_EQ(Crc, 99);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_DECOMPRESS_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Compressed load file ended after %u of %u bytes: "
+                       "RC = 0x%08X File = '%s'");
+}
+
+void Test_MM_LoadMemFromCompressedFile_SizeError(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+  uint32 Crc = 99;
+
+  FileHeader.MemType = MM_MemType_RAM;
+  FileHeader.NumOfBytes = 4 * MM_RLE_MAX_RUN;
+
+  /* One record can't hold more than MM_RLE_MAX_RUN bytes */
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET + 2);
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+
+  /* Execute the function being tested */
+  Result = MM_LoadMemFromCompressedFile(MM_UT_OBJID_1, "filename", &FileHeader,
+                                        0, false, &Crc);
+
+  /* Verify results, nothing is decoded */
+  UtAssert_INT32_EQ(Result, OS_ERR_INVALID_SIZE);
+  UtAssert_UINT32_EQ(Crc, 99);
+  UtAssert_STUB_COUNT(OS_read, 0);
+  UtAssert_STUB_COUNT(MM_RleDecode, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_DECOMPRESS_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Compressed load file size error: Size = %d "
+                       "Min = %u Max = %u File = '%s'");
+}
+
+void Test_MM_LoadMemFromCompressedFile_TrailingData(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+  uint32 Crc = 99;
+
+  FileHeader.MemType = MM_MemType_RAM;
+  FileHeader.NumOfBytes = 4;
+
+  /* Two bytes follow the last record of the load data */
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET + 6);
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+
+  UT_SetDefaultReturnValue(UT_KEY(OS_read), 6);
+  UT_SetHandlerFunction(UT_KEY(MM_RleDecode), UT_Handler_MM_RleDecode, NULL);
+
+  /* Execute the function being tested */
+  Result = MM_LoadMemFromCompressedFile(MM_UT_OBJID_1, "filename", &FileHeader,
+                                        0, false, &Crc);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+  UtAssert_UINT32_EQ(Crc, 99);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_DECOMPRESS_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Compressed load file doesn't end with the load data: "
+                       "Used %u of %u bytes File = '%s'");
+}
+
+void UT_Handler_MM_RleDecode_Overrun(void *UserObj, UT_EntryKey_t FuncKey,
+                                     const UT_StubContext_t *Context) {
+  MM_RleDecoder_t *Decoder =
+      UT_Hook_GetArgValueByName(Context, "Decoder", MM_RleDecoder_t *);
+
+  UT_Handler_MM_RleDecode(UserObj, FuncKey, Context);
+
+  /* The last record decodes to more bytes than the load needs */
+  Decoder->State = MM_RLE_STATE_REPEAT;
+  Decoder->Count = 3;
+}
+
+void Test_MM_LoadMemFromCompressedFile_RecordOverrun(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+  uint32 Crc = 99;
+
+  FileHeader.MemType = MM_MemType_RAM;
+  FileHeader.NumOfBytes = 4;
+
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET + 4);
+  UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, MM_UT_LOAD_DATA_OFFSET);
+
+  UT_SetDefaultReturnValue(UT_KEY(OS_read), 4);
+  UT_SetHandlerFunction(UT_KEY(MM_RleDecode), UT_Handler_MM_RleDecode_Overrun,
+                        NULL);
+
+  /* Execute the function being tested */
+  Result = MM_LoadMemFromCompressedFile(MM_UT_OBJID_1, "filename", &FileHeader,
+                                        0, false, &Crc);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+  UtAssert_UINT32_EQ(Crc, 99);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_DECOMPRESS_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Compressed load file doesn't end with the load data: "
+                       "Used %u of %u bytes File = '%s'");
+}
+
+void Test_MM_WriteMemFromBuffer_Ram(void) {
+  CFE_Status_t Result;
+  uint8 InBuff[(2 * MM_INTERNAL_MAX_LOAD_DATA_SEG) + 2];
+  uint8 OutBuff[(2 * MM_INTERNAL_MAX_LOAD_DATA_SEG) + 2];
+
+  memset(InBuff, 0x5A, sizeof(InBuff));
+  memset(OutBuff, 0, sizeof(OutBuff));
+
+  /* Execute the function being tested */
+  Result = MM_WriteMemFromBuffer((cpuaddr)OutBuff, MM_MemType_RAM, InBuff,
+                                 sizeof(OutBuff));
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_MemCmp(OutBuff, InBuff, sizeof(OutBuff), "Buffer copied to RAM");
+  UtAssert_STUB_COUNT(MM_SegmentBreak, 2);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WriteMemFromBuffer_Eeprom(void) {
+  CFE_Status_t Result;
+  uint8 InBuff[(2 * MM_INTERNAL_MAX_LOAD_DATA_SEG) + 2];
+  uint8 OutBuff[(2 * MM_INTERNAL_MAX_LOAD_DATA_SEG) + 2];
+
+  memset(InBuff, 0x5A, sizeof(InBuff));
+  memset(OutBuff, 0, sizeof(OutBuff));
+
+  /* Execute the function being tested */
+  Result = MM_WriteMemFromBuffer((cpuaddr)OutBuff, MM_MemType_EEPROM, InBuff,
+                                 sizeof(OutBuff));
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_MemCmp(OutBuff, InBuff, sizeof(OutBuff), "Buffer copied to EEPROM");
+  UtAssert_STUB_COUNT(MM_SegmentBreak, 2);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+#ifdef MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+void Test_MM_WriteEeprom_SkipUnchanged(void) {
+  uint8 InBuff[14];
+  uint8 OutBuff[14];
+  uint8 Expected[14];
+
+  /*
+  ** Word 0 differs, word 1 matches, words 2 and 3 differ with the last
+  ** word only 2 bytes long
+  */
+  memset(InBuff, 0x5A, sizeof(InBuff));
+  memset(OutBuff, 0x5A, sizeof(OutBuff));
+  OutBuff[1] = 0;
+  OutBuff[8] = 0;
+  OutBuff[13] = 0;
+  memcpy(Expected, InBuff, sizeof(Expected));
+
+  /* Execute the function being tested */
+  MM_WriteEeprom((cpuaddr)OutBuff, InBuff, sizeof(InBuff));
+
+  /* Verify results */
+  UtAssert_MemCmp(OutBuff, Expected, sizeof(OutBuff), "Changed words written");
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.EepromBytesWritten, 10);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.EepromBytesSkipped, 4);
+}
+
+void Test_MM_WriteEeprom_AllUnchanged(void) {
+  uint8 InBuff[10];
+  uint8 OutBuff[10];
+
+  memset(InBuff, 0x5A, sizeof(InBuff));
+  memset(OutBuff, 0x5A, sizeof(OutBuff));
+
+  /* Execute the function being tested */
+  MM_WriteEeprom((cpuaddr)OutBuff, InBuff, sizeof(InBuff));
+
+  /* Verify results */
+  UtAssert_MemCmp(OutBuff, InBuff, sizeof(OutBuff), "EEPROM unchanged");
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.EepromBytesWritten, 0);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.EepromBytesSkipped,
+                     sizeof(InBuff));
+}
+#endif /* MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE */
+
+void Test_MM_WriteMemFromBuffer_Mem32(void) {
+  CFE_Status_t Result;
+  uint8 InBuff[MM_INTERNAL_MAX_LOAD_DATA_SEG + 4];
+
+  memset(InBuff, 0, sizeof(InBuff));
+
+  /* Execute the function being tested */
+  Result = MM_WriteMemFromBuffer(0, MM_MemType_MEM32, InBuff, sizeof(InBuff));
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite32, sizeof(InBuff) / sizeof(uint32));
+  UtAssert_STUB_COUNT(MM_SegmentBreak, 1);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WriteMemFromBuffer_Mem32Error(void) {
+  CFE_Status_t Result;
+  uint8 InBuff[8];
+
+  memset(InBuff, 0, sizeof(InBuff));
+  UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemWrite32), 2, CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_WriteMemFromBuffer(0, MM_MemType_MEM32, InBuff, sizeof(InBuff));
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_PSP_ERROR);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite32, 2);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "PSP write memory error: RC=0x%08X, Address=%p, MemType=%d");
+}
+
+void Test_MM_WriteMemFromBuffer_Mem16(void) {
+  CFE_Status_t Result;
+  uint8 InBuff[8];
+
+  memset(InBuff, 0, sizeof(InBuff));
+
+  /* Execute the function being tested */
+  Result = MM_WriteMemFromBuffer(0, MM_MemType_MEM16, InBuff, sizeof(InBuff));
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite16, sizeof(InBuff) / sizeof(uint16));
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WriteMemFromBuffer_Mem16Error(void) {
+  CFE_Status_t Result;
+  uint8 InBuff[8];
+
+  memset(InBuff, 0, sizeof(InBuff));
+  UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_MemWrite16), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_WriteMemFromBuffer(0, MM_MemType_MEM16, InBuff, sizeof(InBuff));
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_PSP_ERROR);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite16, 1);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "PSP write memory error: RC=0x%08X, Address=%p, MemType=%d");
+}
+
+void Test_MM_WriteMemFromBuffer_Mem8(void) {
+  CFE_Status_t Result;
+  uint8 InBuff[8];
+
+  memset(InBuff, 0, sizeof(InBuff));
+
+  /* Execute the function being tested */
+  Result = MM_WriteMemFromBuffer(0, MM_MemType_MEM8, InBuff, sizeof(InBuff));
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite8, sizeof(InBuff));
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WriteMemFromBuffer_BadType(void) {
+  CFE_Status_t Result;
+  uint8 InBuff[8];
+
+  memset(InBuff, 0, sizeof(InBuff));
+
+  /* Execute the function being tested */
+  Result = MM_WriteMemFromBuffer(0, 42, InBuff, sizeof(InBuff));
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_PSP_ERROR);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "PSP write memory error: RC=0x%08X, Address=%p, MemType=%d");
+}
+
+void Test_MM_VerifyLoadFileSize_Nominal(void) {
+  int32 Status;
+  MM_LoadDumpFileHeader_t FileHeader;
+  os_fstat_t FileStats;
+
+  memset(&FileHeader, 0, sizeof(MM_LoadDumpFileHeader_t));
+  FileHeader.NumOfBytes = 1;
+
+  memset(&FileStats, 0, sizeof(os_fstat_t));
+  FileStats.FileSize = FileHeader.NumOfBytes + sizeof(CFE_FS_Header_t) +
+                       sizeof(MM_LoadDumpFileHeader_t);
+
+  UT_SetDefaultReturnValue(UT_KEY(OS_stat), OS_SUCCESS);
+  UT_SetDataBuffer(UT_KEY(OS_stat), &FileStats, sizeof(os_fstat_t), false);
+
+  /* Execute the function being tested */
+  Status = MM_VerifyLoadFileSize(NULL, &FileHeader);
+
+  /* Verify results */
+  UtAssert_EQ(int32, Status, OS_SUCCESS);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_VerifyLoadFileSize_StatError(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+
+  /* Set to generate error message MM_OS_MEMVALIDATE_ERR_EID */
+  UT_SetDeferredRetcode(UT_KEY(OS_stat), 1, OS_FS_ERR_PATH_INVALID);
+
+  /* Execute the function being tested */
+  Result = MM_VerifyLoadFileSize((char *)"filename", &FileHeader);
+
+  /* Verify results */
+  UtAssert_True(Result == OS_FS_ERR_PATH_INVALID,
+                "Result == OS_FS_ERR_PATH_INVALID");
+
+  /* No command-handling function should be updating the cmd or err counter
+   * itself */
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_OS_STAT_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "OS_stat error received: RC = 0x%08X File = '%s'");
+}
+
+void Test_MM_VerifyLoadFileSize_SizeError(void) {
+  int32 Result;
+  MM_LoadDumpFileHeader_t FileHeader;
+
+  FileHeader.NumOfBytes = 99;
+
+  /* Execute the function being tested */
+  Result = MM_VerifyLoadFileSize((char *)"filename", &FileHeader);
+
+  /* Verify results */
+  UtAssert_True(Result == OS_ERR_INVALID_SIZE, "Result == OS_ERR_INVALID_SIZE");
+
+  /* No command-handling function should be updating the cmd or err counter
+   * itself */
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_LD_FILE_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "Load file size error: Reported by OS = %d Expected = %u File = '%s'");
+}
+
+void Test_MM_ReadFileHeaders_Nominal(void) {
+  int32 Status;
+  osal_id_t FileHandle = MM_UT_OBJID_1;
+  CFE_FS_Header_t CFEHeader;
+  MM_LoadDumpFileHeader_t MMHeader;
+
+  memset(&MMHeader, 0, sizeof(MMHeader));
+
+  UT_SetDefaultReturnValue(UT_KEY(CFE_FS_ReadHeader), sizeof(CFE_FS_Header_t));
+  UT_SetDefaultReturnValue(UT_KEY(OS_read), sizeof(MM_LoadDumpFileHeader_t));
+
+  /* Execute the function being tested */
+  Status = MM_ReadFileHeaders(NULL, FileHandle, &CFEHeader, &MMHeader);
+
+  /* Verify results */
+  UtAssert_EQ(int32, Status, OS_SUCCESS);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_ReadFileHeaders_ReadHeaderError(void) {
+  int32 Result;
+  osal_id_t FileHandle = MM_UT_OBJID_1;
+  CFE_FS_Header_t CFEHeader;
+  MM_LoadDumpFileHeader_t MMHeader;
+
+  /* Set to satisfy condition "OS_Status != sizeof(CFE_FS_Header_t)" */
+  UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, CFE_FS_BAD_ARGUMENT);
+
+  /* Execute the function being tested */
+  Result =
+      MM_ReadFileHeaders((char *)"filename", FileHandle, &CFEHeader, &MMHeader);
+
+  /* Verify results */
+  UtAssert_True(Result == OS_ERR_INVALID_SIZE, "Result == OS_ERR_INVALID_SIZE");
+
+  /* No command-handling function should be updating the cmd or err counter
+   * itself */
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_CFE_FS_READHDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "CFE_FS_ReadHeader error received: RC = 0x%08X Expected "
+                       "= %u File = '%s'");
+}
+
+void Test_MM_ReadFileHeaders_ReadError(void) {
+  int32 Result;
+  osal_id_t FileHandle = MM_UT_OBJID_1;
+  CFE_FS_Header_t CFEHeader;
+  MM_LoadDumpFileHeader_t MMHeader;
+
+  /* Set to generate error message MM_OS_READ_ERR_EID */
+  UT_SetDeferredRetcode(UT_KEY(OS_read), 1, OS_ERROR);
+
+  /* Execute the function being tested */
+  Result =
+      MM_ReadFileHeaders((char *)"filename", FileHandle, &CFEHeader, &MMHeader);
+
+  /* Verify results */
+  UtAssert_True(Result == OS_ERR_INVALID_SIZE, "Result == OS_ERR_INVALID_SIZE");
+
+  /* No command-handling function should be updating the cmd or err counter
+   * itself */
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_OS_READ_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+      "OS_read error received: RC = 0x%08X Expected = %u File = '%s'");
+}
+
+void Test_MM_ReadFileHeaders_CrcTypeError(void) {
+  int32 Result;
+  osal_id_t FileHandle = MM_UT_OBJID_1;
+  CFE_FS_Header_t CFEHeader;
+  MM_LoadDumpFileHeader_t MMHeader;
+
+  /* Set to generate error message MM_FILE_CRC_TYPE_ERR_EID */
+  memset(&MMHeader, 0, sizeof(MMHeader));
+  MMHeader.CrcType = MM_CRC_MAX_FILE_TYPE + 1;
+
+  UT_SetDefaultReturnValue(UT_KEY(CFE_FS_ReadHeader), sizeof(CFE_FS_Header_t));
+  UT_SetDefaultReturnValue(UT_KEY(OS_read), sizeof(MM_LoadDumpFileHeader_t));
+
+  /* Execute the function being tested */
+  Result =
+      MM_ReadFileHeaders((char *)"filename", FileHandle, &CFEHeader, &MMHeader);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, OS_ERROR);
+
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_FILE_CRC_TYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Load file CRC type error: Type = %u File = '%s'");
 }
 
 void Test_MM_FillMem_Eeprom(void) {
@@ -832,6 +2067,7 @@ void Test_MM_FillMem_Eeprom(void) {
 
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
   UtAssert_STUB_COUNT(CFE_ES_PerfLogAdd, 2);
+  UtAssert_STUB_COUNT(MM_BuildFillBuffer, 1);
 }
 
 void Test_MM_FillMem_NonEeprom(void) {
@@ -918,6 +2154,9 @@ void UtTest_Setup(void) {
   ADD_TEST(Test_MM_PokeMem_16bitError);
   ADD_TEST(Test_MM_PokeMem_32bit);
   ADD_TEST(Test_MM_PokeMem_32bitError);
+  ADD_TEST(Test_MM_PokeValue_Ram);
+  ADD_TEST(Test_MM_PokeValue_Eeprom);
+  ADD_TEST(Test_MM_PokeValue_NoDataSize);
   ADD_TEST(Test_MM_PokeEeprom_NoDataSize);
   ADD_TEST(Test_MM_PokeEeprom_8bit);
   ADD_TEST(Test_MM_PokeEeprom_8bitError);
@@ -925,15 +2164,62 @@ void UtTest_Setup(void) {
   ADD_TEST(Test_MM_PokeEeprom_16bitError);
   ADD_TEST(Test_MM_PokeEeprom_32bit);
   ADD_TEST(Test_MM_PokeEeprom_32bitError);
+#ifdef MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+  ADD_TEST(Test_MM_PokeEeprom_Unchanged);
+#endif
+  ADD_TEST(Test_MM_WriteEepromValue_Nominal);
+  ADD_TEST(Test_MM_WriteEepromValue_Error);
+#ifdef MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+  ADD_TEST(Test_MM_WriteEepromValue_Unchanged);
+#endif
   ADD_TEST(Test_MM_LoadMemFromFile_PreventCPUHogging);
   ADD_TEST(Test_MM_LoadMemFromFile_ReadError);
   ADD_TEST(Test_MM_LoadMemFromFile_NotEepromMemType);
+#ifdef MM_INTERNAL_OPT_CODE_DIRECT_FILE_LOAD
+  ADD_TEST(Test_MM_LoadMemFromFile_DirectSizeError);
+  ADD_TEST(Test_MM_LoadMemFromFile_DirectSeekError);
+  ADD_TEST(Test_MM_LoadMemFromFile_DirectReadError);
+#endif
+  ADD_TEST(Test_MM_StageLoadFile_Nominal);
+  ADD_TEST(Test_MM_StageLoadFile_ReadError);
+  ADD_TEST(Test_MM_StageLoadFile_TooLarge);
+  ADD_TEST(Test_MM_LoadMemFromStage_Eeprom);
+  ADD_TEST(Test_MM_LoadMemFromStage_WriteError);
+  ADD_TEST(Test_MM_LoadPatchFromStage_Nominal);
+  ADD_TEST(Test_MM_LoadPatchFromStage_TruncatedRun);
+  ADD_TEST(Test_MM_LoadPatchFromStage_VerifyParamsError);
+  ADD_TEST(Test_MM_LoadPatchFromStage_NoRuns);
+  ADD_TEST(Test_MM_LoadRegionsFromFile_Nominal);
+  ADD_TEST(Test_MM_LoadRegionsFromFile_BadDirectory);
+  ADD_TEST(Test_MM_LoadRegionsFromFile_DirectoryCRCError);
+  ADD_TEST(Test_MM_LoadRegionsFromFile_VerifyParamsError);
+  ADD_TEST(Test_MM_LoadRegionsFromFile_RegionCRCError);
+  ADD_TEST(Test_MM_LoadRegionsFromFile_FileSizeError);
+  ADD_TEST(Test_MM_LoadMemFromCompressedFile_Nominal);
+  ADD_TEST(Test_MM_LoadMemFromCompressedFile_CrcOnly);
+  ADD_TEST(Test_MM_LoadMemFromCompressedFile_Truncated);
+  ADD_TEST(Test_MM_LoadMemFromCompressedFile_SizeError);
+  ADD_TEST(Test_MM_LoadMemFromCompressedFile_TrailingData);
+  ADD_TEST(Test_MM_LoadMemFromCompressedFile_RecordOverrun);
+  ADD_TEST(Test_MM_WriteMemFromBuffer_Ram);
+  ADD_TEST(Test_MM_WriteMemFromBuffer_Eeprom);
+#ifdef MM_INTERNAL_OPT_CODE_EEPROM_WRITE_COMPARE
+  ADD_TEST(Test_MM_WriteEeprom_SkipUnchanged);
+  ADD_TEST(Test_MM_WriteEeprom_AllUnchanged);
+#endif
+  ADD_TEST(Test_MM_WriteMemFromBuffer_Mem32);
+  ADD_TEST(Test_MM_WriteMemFromBuffer_Mem32Error);
+  ADD_TEST(Test_MM_WriteMemFromBuffer_Mem16);
+  ADD_TEST(Test_MM_WriteMemFromBuffer_Mem16Error);
+  ADD_TEST(Test_MM_WriteMemFromBuffer_Mem8);
+  ADD_TEST(Test_MM_WriteMemFromBuffer_BadType);
   ADD_TEST(Test_MM_VerifyLoadFileSize_Nominal);
   ADD_TEST(Test_MM_VerifyLoadFileSize_StatError);
   ADD_TEST(Test_MM_VerifyLoadFileSize_SizeError);
   ADD_TEST(Test_MM_ReadFileHeaders_Nominal);
   ADD_TEST(Test_MM_ReadFileHeaders_ReadHeaderError);
   ADD_TEST(Test_MM_ReadFileHeaders_ReadError);
+  ADD_TEST(Test_MM_ReadFileHeaders_CrcTypeError);
   ADD_TEST(Test_MM_FillMem_Eeprom);
   ADD_TEST(Test_MM_FillMem_NonEeprom);
   ADD_TEST(Test_MM_FillMem_MaxFillDataSegment);
@@ -24,6 +24,7 @@
 /************************************************************************
 ** Includes
 *************************************************************************/
+#include "mm_crc.h"
 #include "mm_eventids.h"
 #include "mm_filedefs.h"
 #include "mm_mem32.h"
@@ -198,6 +199,7 @@ void MM_LoadMem32FromFile_Test_WriteError(void) {
 
 void MM_DumpMem32ToFile_Test_Nominal(void) {
   int32 Result;
+  uint32 Crc = 0;
   osal_id_t FileHandle = MM_UT_OBJID_1;
   MM_LoadDumpFileHeader_t FileHeader;
 
@@ -207,11 +209,15 @@ void MM_DumpMem32ToFile_Test_Nominal(void) {
   /* CFE_PSP_MemRead32 stub returns success with non-zero address */
   FileHeader.SymAddress.Offset = CFE_ES_MEMADDRESS_C(1);
 
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateFileCRC), 0x5A5A);
+
   /* Execute the function being tested */
-  Result = MM_DumpMem32ToFile(FileHandle, (char *)"filename", &FileHeader);
+  Result = MM_DumpMem32ToFile(FileHandle, (char *)"filename", &FileHeader,
+                              &Crc);
 
   /* Verify results */
   UtAssert_True(Result == CFE_PSP_SUCCESS, "Result == CFE_PSP_SUCCESS");
+  UtAssert_UINT32_EQ(Crc, 0x5A5A);
   UtAssert_True(
       MM_AppData.HkTlm.Payload.LastAction == MM_LastAction_DUMP_TO_FILE,
       "MM_AppData.HkTlm.Payload.LastAction == MM_LastAction_DUMP_TO_FILE");
@@ -236,6 +242,7 @@ void MM_DumpMem32ToFile_Test_Nominal(void) {
 
 void MM_DumpMem32ToFile_Test_CPUHogging(void) {
   int32 Result;
+  uint32 Crc = 0;
   osal_id_t FileHandle = MM_UT_OBJID_1;
   MM_LoadDumpFileHeader_t FileHeader;
 
@@ -243,11 +250,18 @@ void MM_DumpMem32ToFile_Test_CPUHogging(void) {
   /* CFE_PSP_MemRead32 stub returns success with non-zero address */
   FileHeader.SymAddress.Offset = CFE_ES_MEMADDRESS_C(1);
 
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateFileCRC), 0x5A5A);
+
   /* Execute the function being tested */
-  Result = MM_DumpMem32ToFile(FileHandle, (char *)"filename", &FileHeader);
+  Result = MM_DumpMem32ToFile(FileHandle, (char *)"filename", &FileHeader,
+                              &Crc);
 
   /* Verify results */
   UtAssert_True(Result == CFE_PSP_SUCCESS, "Result == CFE_PSP_SUCCESS");
+  UtAssert_UINT32_EQ(Crc, 0x5A5A);
+
+  /* The CRC is folded in as each segment is dumped */
+  UtAssert_STUB_COUNT(MM_CalculateFileCRC, 4);
   UtAssert_True(
       MM_AppData.HkTlm.Payload.LastAction == MM_LastAction_DUMP_TO_FILE,
       "MM_AppData.HkTlm.Payload.LastAction == MM_LastAction_DUMP_TO_FILE");
@@ -272,6 +286,7 @@ void MM_DumpMem32ToFile_Test_CPUHogging(void) {
 
 void MM_DumpMem32ToFile_Test_ReadError(void) {
   int32 Result;
+  uint32 Crc = 0;
   osal_id_t FileHandle = MM_UT_OBJID_1;
   MM_LoadDumpFileHeader_t FileHeader;
 
@@ -284,7 +299,8 @@ void MM_DumpMem32ToFile_Test_ReadError(void) {
                         CFE_PSP_ERROR_NOT_IMPLEMENTED);
 
   /* Execute the function being tested */
-  Result = MM_DumpMem32ToFile(FileHandle, (char *)"filename", &FileHeader);
+  Result = MM_DumpMem32ToFile(FileHandle, (char *)"filename", &FileHeader,
+                              &Crc);
 
   /* Verify results */
   UtAssert_True(Result == CFE_PSP_ERROR_NOT_IMPLEMENTED,
@@ -303,6 +319,7 @@ void MM_DumpMem32ToFile_Test_ReadError(void) {
 
 void MM_DumpMem32ToFile_Test_WriteError(void) {
   int32 Result;
+  uint32 Crc = 0;
   osal_id_t FileHandle = MM_UT_OBJID_1;
   MM_LoadDumpFileHeader_t FileHeader;
 
@@ -314,7 +331,8 @@ void MM_DumpMem32ToFile_Test_WriteError(void) {
   UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_ERROR);
 
   /* Execute the function being tested */
-  Result = MM_DumpMem32ToFile(FileHandle, (char *)"filename", &FileHeader);
+  Result = MM_DumpMem32ToFile(FileHandle, (char *)"filename", &FileHeader,
+                              &Crc);
 
   /* Verify results */
   UtAssert_True(Result == CFE_PSP_ERROR, "Result == CFE_PSP_ERROR");
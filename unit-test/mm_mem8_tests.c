@@ -24,6 +24,7 @@
 /************************************************************************
 ** Includes
 *************************************************************************/
+#include "mm_crc.h"
 #include "mm_eventids.h"
 #include "mm_filedefs.h"
 #include "mm_mem8.h"
@@ -197,6 +198,7 @@ void Test_MM_LoadMem8FromFile_WriteError(void) {
 
 void Test_MM_DumpMem8ToFile_Nominal(void) {
   int32 Result;
+  uint32 Crc = 0;
   osal_id_t FileHandle = MM_UT_OBJID_1;
   MM_LoadDumpFileHeader_t FileHeader;
 
@@ -206,11 +208,15 @@ void Test_MM_DumpMem8ToFile_Nominal(void) {
   /* CFE_PSP_MemRead8 stub returns success with non-zero address */
   FileHeader.SymAddress.Offset = CFE_ES_MEMADDRESS_C(1);
 
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateFileCRC), 0x5A5A);
+
   /* Execute the function being tested */
-  Result = MM_DumpMem8ToFile(FileHandle, (char *)"filename", &FileHeader);
+  Result = MM_DumpMem8ToFile(FileHandle, (char *)"filename", &FileHeader,
+                             &Crc);
 
   /* Verify results */
   UtAssert_True(Result == CFE_PSP_SUCCESS, "Result == CFE_PSP_SUCCESS");
+  UtAssert_UINT32_EQ(Crc, 0x5A5A);
   UtAssert_True(
       MM_AppData.HkTlm.Payload.LastAction == MM_LastAction_DUMP_TO_FILE,
       "MM_AppData.HkTlm.Payload.LastAction == MM_LastAction_DUMP_TO_FILE");
@@ -236,6 +242,7 @@ void Test_MM_DumpMem8ToFile_Nominal(void) {
 
 void Test_MM_DumpMem8ToFile_CPUHogging(void) {
   int32 Result;
+  uint32 Crc = 0;
   osal_id_t FileHandle = MM_UT_OBJID_1;
   MM_LoadDumpFileHeader_t FileHeader;
 
@@ -243,11 +250,18 @@ void Test_MM_DumpMem8ToFile_CPUHogging(void) {
   /* CFE_PSP_MemRead8 stub returns success with non-zero address */
   FileHeader.SymAddress.Offset = CFE_ES_MEMADDRESS_C(1);
 
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateFileCRC), 0x5A5A);
+
   /* Execute the function being tested */
-  Result = MM_DumpMem8ToFile(FileHandle, (char *)"filename", &FileHeader);
+  Result = MM_DumpMem8ToFile(FileHandle, (char *)"filename", &FileHeader,
+                             &Crc);
 
   /* Verify results */
   UtAssert_True(Result == CFE_PSP_SUCCESS, "Result == CFE_PSP_SUCCESS");
+  UtAssert_UINT32_EQ(Crc, 0x5A5A);
+
+  /* The CRC is folded in as each segment is dumped */
+  UtAssert_STUB_COUNT(MM_CalculateFileCRC, 2);
   UtAssert_True(
       MM_AppData.HkTlm.Payload.LastAction == MM_LastAction_DUMP_TO_FILE,
       "MM_AppData.HkTlm.Payload.LastAction == MM_LastAction_DUMP_TO_FILE");
@@ -273,6 +287,7 @@ void Test_MM_DumpMem8ToFile_CPUHogging(void) {
 
 void Test_MM_DumpMem8ToFile_ReadError(void) {
   int32 Result;
+  uint32 Crc = 0;
   osal_id_t FileHandle = MM_UT_OBJID_1;
   MM_LoadDumpFileHeader_t FileHeader;
 
@@ -285,7 +300,8 @@ void Test_MM_DumpMem8ToFile_ReadError(void) {
                         CFE_PSP_ERROR_NOT_IMPLEMENTED);
 
   /* Execute the function being tested */
-  Result = MM_DumpMem8ToFile(FileHandle, (char *)"filename", &FileHeader);
+  Result = MM_DumpMem8ToFile(FileHandle, (char *)"filename", &FileHeader,
+                             &Crc);
 
   /* Verify results */
   UtAssert_True(Result == CFE_PSP_ERROR_NOT_IMPLEMENTED,
@@ -304,6 +320,7 @@ void Test_MM_DumpMem8ToFile_ReadError(void) {
 
 void Test_MM_DumpMem8ToFile_WriteError(void) {
   int32 Result;
+  uint32 Crc = 0;
   osal_id_t FileHandle = MM_UT_OBJID_1;
   MM_LoadDumpFileHeader_t FileHeader;
 
@@ -315,7 +332,8 @@ void Test_MM_DumpMem8ToFile_WriteError(void) {
   UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_ERROR);
 
   /* Execute the function being tested */
-  Result = MM_DumpMem8ToFile(FileHandle, (char *)"filename", &FileHeader);
+  Result = MM_DumpMem8ToFile(FileHandle, (char *)"filename", &FileHeader,
+                             &Crc);
 
   /* Verify results */
   UtAssert_True(Result == CFE_PSP_ERROR, "Result == CFE_PSP_ERROR");
@@ -0,0 +1,345 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit tests for mm_memtest.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_app.h"
+#include "mm_eventids.h"
+#include "mm_internal_cfg.h"
+#include "mm_memtest.h"
+#include "mm_test_utils.h"
+#include "mm_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "utassert.h"
+#include "utstubs.h"
+#include "uttest.h"
+
+#include "cfe.h"
+
+/*
+ * Memory under test and the bits stuck at one in it
+ */
+uint32 UT_TestMemory[16];
+cpuaddr UT_StuckAddress;
+bool UT_StuckAll;
+uint32 UT_StuckOnes;
+
+/*
+ * Function Definitions
+ */
+
+static uint32 UT_StuckBits(cpuaddr MemoryAddress) {
+  uint32 Bits = 0;
+
+  if (UT_StuckAll || (MemoryAddress == UT_StuckAddress)) {
+    Bits = UT_StuckOnes;
+  }
+
+  return Bits;
+}
+
+void UT_Handler_CFE_PSP_MemWrite32(void *UserObj, UT_EntryKey_t FuncKey,
+                                   const UT_StubContext_t *Context) {
+  cpuaddr MemoryAddress =
+      UT_Hook_GetArgValueByName(Context, "MemoryAddress", cpuaddr);
+  uint32 Value = UT_Hook_GetArgValueByName(Context, "uint32Value", uint32);
+
+  *((uint32 *)MemoryAddress) = Value | UT_StuckBits(MemoryAddress);
+}
+
+void UT_Handler_CFE_PSP_MemRead32(void *UserObj, UT_EntryKey_t FuncKey,
+                                  const UT_StubContext_t *Context) {
+  cpuaddr MemoryAddress =
+      UT_Hook_GetArgValueByName(Context, "MemoryAddress", cpuaddr);
+  uint32 *Value = UT_Hook_GetArgValueByName(Context, "uint32Value", uint32 *);
+
+  *Value = *((uint32 *)MemoryAddress);
+}
+
+void UT_Handler_CFE_PSP_MemWrite16(void *UserObj, UT_EntryKey_t FuncKey,
+                                   const UT_StubContext_t *Context) {
+  cpuaddr MemoryAddress =
+      UT_Hook_GetArgValueByName(Context, "MemoryAddress", cpuaddr);
+  uint16 Value = UT_Hook_GetArgValueByName(Context, "uint16Value", uint16);
+
+  *((uint16 *)MemoryAddress) = Value | (uint16)UT_StuckBits(MemoryAddress);
+}
+
+void UT_Handler_CFE_PSP_MemRead16(void *UserObj, UT_EntryKey_t FuncKey,
+                                  const UT_StubContext_t *Context) {
+  cpuaddr MemoryAddress =
+      UT_Hook_GetArgValueByName(Context, "MemoryAddress", cpuaddr);
+  uint16 *Value = UT_Hook_GetArgValueByName(Context, "uint16Value", uint16 *);
+
+  *Value = *((uint16 *)MemoryAddress);
+}
+
+void UT_Handler_CFE_PSP_MemWrite8(void *UserObj, UT_EntryKey_t FuncKey,
+                                  const UT_StubContext_t *Context) {
+  cpuaddr MemoryAddress =
+      UT_Hook_GetArgValueByName(Context, "MemoryAddress", cpuaddr);
+  uint8 Value = UT_Hook_GetArgValueByName(Context, "ByteValue", uint8);
+
+  *((uint8 *)MemoryAddress) = Value | (uint8)UT_StuckBits(MemoryAddress);
+}
+
+void UT_Handler_CFE_PSP_MemRead8(void *UserObj, UT_EntryKey_t FuncKey,
+                                 const UT_StubContext_t *Context) {
+  cpuaddr MemoryAddress =
+      UT_Hook_GetArgValueByName(Context, "MemoryAddress", cpuaddr);
+  uint8 *Value = UT_Hook_GetArgValueByName(Context, "ByteValue", uint8 *);
+
+  *Value = *((uint8 *)MemoryAddress);
+}
+
+static void UT_SetupTestMemory(void) {
+  memset(UT_TestMemory, 0xA5, sizeof(UT_TestMemory));
+  UT_StuckAddress = 0;
+  UT_StuckAll = false;
+  UT_StuckOnes = 0;
+
+  UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemWrite32),
+                        UT_Handler_CFE_PSP_MemWrite32, NULL);
+  UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemRead32), UT_Handler_CFE_PSP_MemRead32,
+                        NULL);
+  UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemWrite16),
+                        UT_Handler_CFE_PSP_MemWrite16, NULL);
+  UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemRead16), UT_Handler_CFE_PSP_MemRead16,
+                        NULL);
+  UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemWrite8), UT_Handler_CFE_PSP_MemWrite8,
+                        NULL);
+  UT_SetHandlerFunction(UT_KEY(CFE_PSP_MemRead8), UT_Handler_CFE_PSP_MemRead8,
+                        NULL);
+}
+
+void Test_MM_MemTest_Mem32AllPatterns(void) {
+  MM_MemTestTlm_Payload_t Payload;
+  cpuaddr Address = (cpuaddr)UT_TestMemory;
+  uint32 Accesses;
+  int32 Result;
+
+  UT_SetupTestMemory();
+
+  /* Execute the function being tested */
+  Result = MM_MemTest(Address, MM_MemType_MEM32, sizeof(UT_TestMemory),
+                      MM_MEM_TEST_ALL_PATTERNS, &Payload);
+
+  /* Verify results, each word gets 5 march, 32 walking, and 2 address
+   * writes, each followed by a read */
+  Accesses = 16 * (5 + 32 + 2);
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite32, Accesses);
+  UtAssert_STUB_COUNT(CFE_PSP_MemRead32, Accesses);
+  UtAssert_STUB_COUNT(MM_SegmentBreak, (2 * Accesses * sizeof(uint32)) /
+                                           MM_INTERNAL_MAX_FILL_DATA_SEG);
+
+  UtAssert_ADDRESS_EQ(CFE_ES_MEMADDRESS_TO_PTR(Payload.Address), Address);
+  UtAssert_UINT32_EQ(Payload.MemType, MM_MemType_MEM32);
+  UtAssert_UINT32_EQ(Payload.NumOfBytes, sizeof(UT_TestMemory));
+  UtAssert_UINT8_EQ(Payload.Patterns, MM_MEM_TEST_ALL_PATTERNS);
+  UtAssert_UINT8_EQ(Payload.FailedPatterns, 0);
+  UtAssert_UINT32_EQ(Payload.NumFailures, 0);
+  UtAssert_UINT32_EQ(Payload.NumReported, 0);
+
+  /* The region is left holding the complement of each word address */
+  UtAssert_UINT32_EQ(UT_TestMemory[1], ~(uint32)(Address + 4));
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_MemTest_MarchStuckBit(void) {
+  MM_MemTestTlm_Payload_t Payload;
+  int32 Result;
+
+  UT_SetupTestMemory();
+  UT_StuckAddress = (cpuaddr)&UT_TestMemory[3];
+  UT_StuckOnes = 0x00000100;
+
+  /* Execute the function being tested */
+  Result = MM_MemTest((cpuaddr)UT_TestMemory, MM_MemType_MEM32,
+                      sizeof(UT_TestMemory), MM_MemTestPattern_MARCH_C,
+                      &Payload);
+
+  /* Verify results, each r0 of the stuck word fails */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_UINT8_EQ(Payload.FailedPatterns, MM_MemTestPattern_MARCH_C);
+  UtAssert_UINT32_EQ(Payload.NumFailures, 3);
+  UtAssert_UINT32_EQ(Payload.NumReported, 3);
+  UtAssert_ADDRESS_EQ(CFE_ES_MEMADDRESS_TO_PTR(Payload.Failures[0].Address),
+                      &UT_TestMemory[3]);
+  UtAssert_UINT32_EQ(Payload.Failures[0].Expected, 0);
+  UtAssert_UINT32_EQ(Payload.Failures[0].Actual, 0x00000100);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_MemTest_ReportLimit(void) {
+  MM_MemTestTlm_Payload_t Payload;
+  int32 Result;
+
+  UT_SetupTestMemory();
+  UT_StuckAll = true;
+  UT_StuckOnes = 0x80000000;
+
+  /* Execute the function being tested */
+  Result = MM_MemTest((cpuaddr)UT_TestMemory, MM_MemType_MEM32,
+                      sizeof(UT_TestMemory), MM_MemTestPattern_MARCH_C,
+                      &Payload);
+
+  /* Verify results, only the first failures are reported */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_UINT32_EQ(Payload.NumFailures, 3 * 16);
+  UtAssert_UINT32_EQ(Payload.NumReported, MM_INTERFACE_MAX_MEM_TEST_FAILURES);
+  UtAssert_ADDRESS_EQ(CFE_ES_MEMADDRESS_TO_PTR(Payload.Failures[0].Address),
+                      &UT_TestMemory[0]);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_MemTest_Mem16WalkingOnes(void) {
+  MM_MemTestTlm_Payload_t Payload;
+  int32 Result;
+
+  UT_SetupTestMemory();
+  UT_StuckAddress = (cpuaddr)&UT_TestMemory[1];
+  UT_StuckOnes = 0x0001;
+
+  /* Execute the function being tested */
+  Result = MM_MemTest((cpuaddr)UT_TestMemory, MM_MemType_MEM16, 8,
+                      MM_MemTestPattern_WALKING_ONES, &Payload);
+
+  /* Verify results, every bit but bit 0 of the stuck word fails */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite16, 4 * 16);
+  UtAssert_STUB_COUNT(CFE_PSP_MemRead16, 4 * 16);
+  UtAssert_UINT8_EQ(Payload.FailedPatterns, MM_MemTestPattern_WALKING_ONES);
+  UtAssert_UINT32_EQ(Payload.NumFailures, 15);
+  UtAssert_UINT32_EQ(Payload.Failures[0].Expected, 0x0002);
+  UtAssert_UINT32_EQ(Payload.Failures[0].Actual, 0x0003);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_MemTest_RamBytes(void) {
+  MM_MemTestTlm_Payload_t Payload;
+  int32 Result;
+
+  UT_SetupTestMemory();
+  UT_SetDefaultReturnValue(UT_KEY(MM_Verify32Aligned), false);
+
+  /* Execute the function being tested */
+  Result = MM_MemTest((cpuaddr)UT_TestMemory, MM_MemType_RAM, 7,
+                      MM_MemTestPattern_ADDRESS, &Payload);
+
+  /* Verify results, an unaligned RAM region is tested a byte at a time */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite8, 2 * 7);
+  UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 2 * 7);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite32, 0);
+  UtAssert_UINT32_EQ(Payload.NumOfBytes, 7);
+  UtAssert_UINT32_EQ(Payload.NumFailures, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_MemTest_RamWords(void) {
+  MM_MemTestTlm_Payload_t Payload;
+  int32 Result;
+
+  UT_SetupTestMemory();
+  UT_SetDefaultReturnValue(UT_KEY(MM_Verify32Aligned), true);
+
+  /* Execute the function being tested */
+  Result = MM_MemTest((cpuaddr)UT_TestMemory, MM_MemType_RAM, 8,
+                      MM_MemTestPattern_ADDRESS, &Payload);
+
+  /* Verify results, an aligned RAM region is tested 32 bits at a time */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite32, 2 * 2);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite8, 0);
+  UtAssert_UINT32_EQ(Payload.NumFailures, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_MemTest_WriteError(void) {
+  MM_MemTestTlm_Payload_t Payload;
+  int32 Result;
+
+  UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemWrite32), 1, CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_MemTest((cpuaddr)UT_TestMemory, MM_MemType_MEM32,
+                      sizeof(UT_TestMemory), MM_MEM_TEST_ALL_PATTERNS,
+                      &Payload);
+
+  /* Verify results, the test stops at the first error */
+  UtAssert_INT32_EQ(Result, CFE_PSP_ERROR);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite32, 1);
+  UtAssert_STUB_COUNT(CFE_PSP_MemRead32, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "PSP write memory error: RC=%d, Address=%p, MemType=MEM%u");
+}
+
+void Test_MM_MemTest_ReadError(void) {
+  MM_MemTestTlm_Payload_t Payload;
+  int32 Result;
+
+  UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead8), 1, CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_MemTest((cpuaddr)UT_TestMemory, MM_MemType_MEM8, 4,
+                      MM_MemTestPattern_WALKING_ONES, &Payload);
+
+  /* Verify results, the test stops at the first error */
+  UtAssert_INT32_EQ(Result, CFE_PSP_ERROR);
+  UtAssert_STUB_COUNT(CFE_PSP_MemWrite8, 1);
+  UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 1);
+  UtAssert_UINT32_EQ(Payload.NumFailures, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+      "PSP read memory error: RC=%d, Address=%p, MemType=MEM%u");
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void) {
+  ADD_TEST(Test_MM_MemTest_Mem32AllPatterns);
+  ADD_TEST(Test_MM_MemTest_MarchStuckBit);
+  ADD_TEST(Test_MM_MemTest_ReportLimit);
+  ADD_TEST(Test_MM_MemTest_Mem16WalkingOnes);
+  ADD_TEST(Test_MM_MemTest_RamBytes);
+  ADD_TEST(Test_MM_MemTest_RamWords);
+  ADD_TEST(Test_MM_MemTest_WriteError);
+  ADD_TEST(Test_MM_MemTest_ReadError);
+}
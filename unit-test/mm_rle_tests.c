@@ -0,0 +1,203 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit tests for mm_rle.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_rle.h"
+#include "mm_test_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "utassert.h"
+#include "utstubs.h"
+#include "uttest.h"
+
+#include "cfe.h"
+#include <string.h>
+
+/*
+ * Function Definitions
+ */
+
+void Test_MM_RleEncode_Repeat(void) {
+  uint8 InBuffer[10];
+  uint8 OutBuffer[MM_RLE_MAX_ENCODED_SIZE(sizeof(InBuffer))];
+  const uint8 Expected[] = {(uint8)-9, 0xAA};
+  size_t Result;
+
+  memset(InBuffer, 0xAA, sizeof(InBuffer));
+
+  /* Execute the function being tested */
+  Result = MM_RleEncode(InBuffer, sizeof(InBuffer), OutBuffer);
+
+  /* Verify results */
+  UtAssert_UINT32_EQ(Result, sizeof(Expected));
+  UtAssert_MemCmp(OutBuffer, Expected, sizeof(Expected), "Repeat record");
+}
+
+void Test_MM_RleEncode_Literal(void) {
+  const uint8 InBuffer[] = {1, 2, 3, 3, 4};
+  uint8 OutBuffer[MM_RLE_MAX_ENCODED_SIZE(sizeof(InBuffer))];
+  const uint8 Expected[] = {4, 1, 2, 3, 3, 4};
+  size_t Result;
+
+  /* Execute the function being tested */
+  Result = MM_RleEncode(InBuffer, sizeof(InBuffer), OutBuffer);
+
+  /* Verify results, a pair of bytes doesn't break up a literal record */
+  UtAssert_UINT32_EQ(Result, sizeof(Expected));
+  UtAssert_MemCmp(OutBuffer, Expected, sizeof(Expected), "Literal record");
+}
+
+void Test_MM_RleEncode_MaxRun(void) {
+  uint8 InBuffer[MM_RLE_MAX_RUN + 2];
+  uint8 OutBuffer[MM_RLE_MAX_ENCODED_SIZE(sizeof(InBuffer))];
+  const uint8 Expected[] = {(uint8)-127, 0, (uint8)-1, 0};
+  size_t Result;
+
+  memset(InBuffer, 0, sizeof(InBuffer));
+
+  /* Execute the function being tested */
+  Result = MM_RleEncode(InBuffer, sizeof(InBuffer), OutBuffer);
+
+  /* Verify results */
+  UtAssert_UINT32_EQ(Result, sizeof(Expected));
+  UtAssert_MemCmp(OutBuffer, Expected, sizeof(Expected), "Split repeat");
+}
+
+void Test_MM_RleEncode_WorstCase(void) {
+  uint8 InBuffer[2 * MM_RLE_MAX_RUN];
+  uint8 OutBuffer[MM_RLE_MAX_ENCODED_SIZE(sizeof(InBuffer))];
+  size_t Result;
+  size_t i;
+
+  for (i = 0; i < sizeof(InBuffer); i++) {
+    InBuffer[i] = (uint8)i;
+  }
+
+  /* Execute the function being tested */
+  Result = MM_RleEncode(InBuffer, sizeof(InBuffer), OutBuffer);
+
+  /* Verify results */
+  UtAssert_UINT32_EQ(Result, sizeof(OutBuffer));
+  UtAssert_UINT8_EQ(OutBuffer[0], MM_RLE_MAX_RUN - 1);
+  UtAssert_UINT8_EQ(OutBuffer[MM_RLE_MAX_RUN + 1], MM_RLE_MAX_RUN - 1);
+}
+
+void Test_MM_RleDecode_RoundTrip(void) {
+  uint8 InBuffer[600];
+  uint8 Encoded[MM_RLE_MAX_ENCODED_SIZE(sizeof(InBuffer))];
+  uint8 OutBuffer[sizeof(InBuffer)];
+  MM_RleDecoder_t Decoder;
+  size_t EncodedSize;
+  size_t InPos = 0;
+  size_t OutPos = 0;
+  size_t InUsed;
+  size_t i;
+
+  /* Mix repeats of all lengths with literal data */
+  for (i = 0; i < sizeof(InBuffer); i++) {
+    InBuffer[i] = (uint8)((i % 97) < 40 ? (i / 97) : (i * 7));
+  }
+  memset(OutBuffer, 0, sizeof(OutBuffer));
+
+  EncodedSize = MM_RleEncode(InBuffer, sizeof(InBuffer), Encoded);
+
+  /* Execute the function being tested, splitting records across calls */
+  MM_RleDecoderInit(&Decoder);
+  while (OutPos < sizeof(OutBuffer)) {
+    OutPos += MM_RleDecode(&Decoder, &Encoded[InPos],
+                           (InPos < EncodedSize) ? 1 : 0, &InUsed,
+                           &OutBuffer[OutPos],
+                           (sizeof(OutBuffer) - OutPos < 7)
+                               ? (sizeof(OutBuffer) - OutPos)
+                               : 7);
+    InPos += InUsed;
+  }
+
+  /* Verify results */
+  UtAssert_UINT32_EQ(InPos, EncodedSize);
+  UtAssert_MemCmp(OutBuffer, InBuffer, sizeof(InBuffer), "Decoded data");
+}
+
+void Test_MM_RleDecode_OutputFull(void) {
+  const uint8 Encoded[] = {(uint8)-9, 0xAA};
+  uint8 OutBuffer[10];
+  MM_RleDecoder_t Decoder;
+  size_t InUsed;
+  size_t Result;
+
+  memset(OutBuffer, 0, sizeof(OutBuffer));
+  MM_RleDecoderInit(&Decoder);
+
+  /* Execute the function being tested */
+  Result = MM_RleDecode(&Decoder, Encoded, sizeof(Encoded), &InUsed,
+                        OutBuffer, 4);
+
+  /* Verify results */
+  UtAssert_UINT32_EQ(Result, 4);
+  UtAssert_UINT32_EQ(InUsed, sizeof(Encoded));
+  UtAssert_UINT8_EQ(Decoder.State, MM_RLE_STATE_REPEAT);
+
+  /* The rest of the repeat record needs no more input */
+  Result = MM_RleDecode(&Decoder, NULL, 0, &InUsed, &OutBuffer[4], 6);
+
+  UtAssert_UINT32_EQ(Result, 6);
+  UtAssert_UINT32_EQ(InUsed, 0);
+  UtAssert_UINT8_EQ(Decoder.State, MM_RLE_STATE_HEADER);
+  UtAssert_UINT8_EQ(OutBuffer[9], 0xAA);
+}
+
+void Test_MM_RleDecode_NoOpHeader(void) {
+  const uint8 Encoded[] = {0x80, 0x00, 0x41};
+  uint8 OutBuffer[4];
+  MM_RleDecoder_t Decoder;
+  size_t InUsed;
+  size_t Result;
+
+  MM_RleDecoderInit(&Decoder);
+
+  /* Execute the function being tested */
+  Result = MM_RleDecode(&Decoder, Encoded, sizeof(Encoded), &InUsed,
+                        OutBuffer, sizeof(OutBuffer));
+
+  /* Verify results, a -128 header is skipped */
+  UtAssert_UINT32_EQ(Result, 1);
+  UtAssert_UINT32_EQ(InUsed, sizeof(Encoded));
+  UtAssert_UINT8_EQ(OutBuffer[0], 0x41);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void) {
+  ADD_TEST(Test_MM_RleEncode_Repeat);
+  ADD_TEST(Test_MM_RleEncode_Literal);
+  ADD_TEST(Test_MM_RleEncode_MaxRun);
+  ADD_TEST(Test_MM_RleEncode_WorstCase);
+  ADD_TEST(Test_MM_RleDecode_RoundTrip);
+  ADD_TEST(Test_MM_RleDecode_OutputFull);
+  ADD_TEST(Test_MM_RleDecode_NoOpHeader);
+}
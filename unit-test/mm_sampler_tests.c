@@ -0,0 +1,154 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit tests for mm_sampler.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_app.h"
+#include "mm_dump.h"
+#include "mm_internal_cfg.h"
+#include "mm_sampler.h"
+#include "mm_test_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "utassert.h"
+#include "utstubs.h"
+#include "uttest.h"
+
+#include "cfe.h"
+
+/*
+ * Function Definitions
+ */
+
+/*
+ * Returns the address as the value read by MM_PeekValue
+ */
+void UT_Handler_MM_PeekValue(void *UserObj, UT_EntryKey_t FuncKey,
+                             const UT_StubContext_t *Context) {
+  uint32 *DataValue =
+      UT_Hook_GetArgValueByName(Context, "DataValue", uint32 *);
+
+  *DataValue = UT_Hook_GetArgValueByName(Context, "SrcAddress", cpuaddr);
+}
+
+void Test_MM_SamplerStep_Stopped(void) {
+  MM_AppData.Sampler.Period = 0;
+  MM_AppData.Sampler.Entries[0].Address = 0x100;
+  MM_AppData.Sampler.Entries[0].DataSize = MM_INTERNAL_BYTE_BIT_WIDTH;
+
+  /* Execute the function being tested */
+  MM_SamplerStep();
+
+  /* Verify results */
+  UtAssert_UINT32_EQ(MM_AppData.Sampler.Count, 0);
+  UtAssert_STUB_COUNT(MM_PeekValue, 0);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+}
+
+void Test_MM_SamplerStep_NotDue(void) {
+  MM_AppData.Sampler.Period = 3;
+  MM_AppData.Sampler.Count = 1;
+  MM_AppData.Sampler.Entries[0].Address = 0x100;
+  MM_AppData.Sampler.Entries[0].DataSize = MM_INTERNAL_BYTE_BIT_WIDTH;
+
+  /* Execute the function being tested */
+  MM_SamplerStep();
+
+  /* Verify results */
+  UtAssert_UINT32_EQ(MM_AppData.Sampler.Count, 2);
+  UtAssert_STUB_COUNT(MM_PeekValue, 0);
+  UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+}
+
+void Test_MM_SamplerStep_Due(void) {
+  MM_AppData.Sampler.Period = 3;
+  MM_AppData.Sampler.Count = 2;
+  MM_AppData.Sampler.Sequence = 7;
+  MM_AppData.Sampler.Entries[0].Address = 0x100;
+  MM_AppData.Sampler.Entries[0].DataSize = MM_INTERNAL_BYTE_BIT_WIDTH;
+  MM_AppData.Sampler.Entries[MM_INTERFACE_MAX_WATCH_ENTRIES - 1].Address =
+      0x200;
+  MM_AppData.Sampler.Entries[MM_INTERFACE_MAX_WATCH_ENTRIES - 1].DataSize =
+      MM_INTERNAL_DWORD_BIT_WIDTH;
+  MM_AppData.WatchTlm.Payload.Values[1] = 0x55;
+
+  UT_SetHandlerFunction(UT_KEY(MM_PeekValue), UT_Handler_MM_PeekValue, NULL);
+
+  /* Execute the function being tested */
+  MM_SamplerStep();
+
+  /* Verify results, only the defined entries are read */
+  UtAssert_UINT32_EQ(MM_AppData.Sampler.Count, 0);
+  UtAssert_STUB_COUNT(MM_PeekValue, 2);
+  UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+  UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+  UtAssert_UINT32_EQ(MM_AppData.WatchTlm.Payload.Sequence, 7);
+  UtAssert_UINT32_EQ(MM_AppData.Sampler.Sequence, 8);
+  UtAssert_UINT32_EQ(MM_AppData.WatchTlm.Payload.ValidMask,
+                     1 | ((uint32)1 << (MM_INTERFACE_MAX_WATCH_ENTRIES - 1)));
+  UtAssert_UINT32_EQ(MM_AppData.WatchTlm.Payload.Values[0], 0x100);
+  UtAssert_UINT32_EQ(MM_AppData.WatchTlm.Payload.Values[1], 0);
+  UtAssert_UINT32_EQ(
+      MM_AppData.WatchTlm.Payload.Values[MM_INTERFACE_MAX_WATCH_ENTRIES - 1],
+      0x200);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_SamplerStep_ReadError(void) {
+  MM_AppData.Sampler.Period = 1;
+  MM_AppData.Sampler.Entries[0].Address = 0x100;
+  MM_AppData.Sampler.Entries[0].DataSize = MM_INTERNAL_WORD_BIT_WIDTH;
+  MM_AppData.Sampler.Entries[1].Address = 0x104;
+  MM_AppData.Sampler.Entries[1].DataSize = MM_INTERNAL_WORD_BIT_WIDTH;
+  MM_AppData.WatchTlm.Payload.Values[0] = 0x55;
+
+  UT_SetDeferredRetcode(UT_KEY(MM_PeekValue), 1, CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  MM_SamplerStep();
+
+  /* Verify results, the failed read is sent as zero and marked invalid */
+  UtAssert_STUB_COUNT(MM_PeekValue, 2);
+  UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+  UtAssert_UINT32_EQ(MM_AppData.WatchTlm.Payload.ValidMask, 2);
+  UtAssert_UINT32_EQ(MM_AppData.WatchTlm.Payload.Values[0], 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void) {
+  ADD_TEST(Test_MM_SamplerStep_Stopped);
+  ADD_TEST(Test_MM_SamplerStep_NotDue);
+  ADD_TEST(Test_MM_SamplerStep_Due);
+  ADD_TEST(Test_MM_SamplerStep_ReadError);
+}
@@ -0,0 +1,252 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit tests for mm_scrub.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_app.h"
+#include "mm_dump.h"
+#include "mm_eventids.h"
+#include "mm_internal_cfg.h"
+#include "mm_scrub.h"
+#include "mm_test_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "utassert.h"
+#include "utstubs.h"
+#include "uttest.h"
+
+#include "cfe.h"
+
+/*
+ * Function Definitions
+ */
+
+void UT_Handler_MM_CalculateMemCRC(void *UserObj, UT_EntryKey_t FuncKey,
+                                   const UT_StubContext_t *Context) {
+  uint32 *CrcPtr = UT_Hook_GetArgValueByName(Context, "CrcPtr", uint32 *);
+
+  *CrcPtr = *((uint32 *)UserObj);
+}
+
+void Test_MM_ScrubRestartRegion_Defined(void) {
+  MM_AppData.Scrub.Regions[2].NumOfBytes = 8;
+  MM_AppData.HkTlm.Payload.ScrubStatus[2] = MM_ScrubStatus_BAD;
+  MM_AppData.Scrub.Region = 2;
+  MM_AppData.Scrub.Offset = 4;
+  MM_AppData.Scrub.Crc = 0x1234;
+  MM_AppData.Scrub.Index[2].NumBlocks = 3;
+
+  /* Execute the function being tested */
+  MM_ScrubRestartRegion(2);
+
+  /* Verify results, the partial pass over the region is dropped */
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.ScrubStatus[2],
+                    MM_ScrubStatus_PENDING);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Region, 2);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Offset, 0);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Crc, 0);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Index[2].NumBlocks, 0);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Generation[2], 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_ScrubRestartRegion_Undefined(void) {
+  MM_AppData.HkTlm.Payload.ScrubStatus[2] = MM_ScrubStatus_GOOD;
+  MM_AppData.Scrub.Region = 1;
+  MM_AppData.Scrub.Offset = 4;
+  MM_AppData.Scrub.Crc = 0x1234;
+
+  /* Execute the function being tested */
+  MM_ScrubRestartRegion(2);
+
+  /* Verify results, the pass over another region is not affected */
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.ScrubStatus[2],
+                    MM_ScrubStatus_UNUSED);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Offset, 4);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Crc, 0x1234);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Generation[2], 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_ScrubStep_NoRegions(void) {
+  /* Execute the function being tested */
+  MM_ScrubStep();
+
+  /* Verify results, one pass over the empty table */
+  UtAssert_STUB_COUNT(MM_CalculateMemCRC, 0);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Region, 0);
+  UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+  UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_ScrubStep_Match(void) {
+  uint32 Crc = 0xCAFEF00D;
+
+  MM_AppData.Scrub.Regions[3].MemType = MM_MemType_RAM;
+  MM_AppData.Scrub.Regions[3].NumOfBytes = 8;
+  MM_AppData.Scrub.Regions[3].GoldenCrc = 0xCAFEF00D;
+  MM_AppData.HkTlm.Payload.ScrubStatus[3] = MM_ScrubStatus_PENDING;
+
+  UT_SetHandlerFunction(UT_KEY(MM_CalculateMemCRC),
+                        UT_Handler_MM_CalculateMemCRC, &Crc);
+
+  /* Execute the function being tested */
+  MM_ScrubStep();
+
+  /* Verify results, the region is checked once per pass over the table */
+  UtAssert_STUB_COUNT(MM_CalculateMemCRC, 1);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.ScrubStatus[3],
+                    MM_ScrubStatus_GOOD);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.ScrubMismatches, 0);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Region, 0);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Offset, 0);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Crc, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_ScrubStep_Mismatch(void) {
+  uint32 Crc = 0xDEADBEEF;
+
+  MM_AppData.Scrub.Regions[0].MemType = MM_MemType_RAM;
+  MM_AppData.Scrub.Regions[0].NumOfBytes = 8;
+  MM_AppData.Scrub.Regions[0].GoldenCrc = 0xCAFEF00D;
+  MM_AppData.HkTlm.Payload.ScrubStatus[0] = MM_ScrubStatus_PENDING;
+
+  UT_SetHandlerFunction(UT_KEY(MM_CalculateMemCRC),
+                        UT_Handler_MM_CalculateMemCRC, &Crc);
+
+  /* Execute the function being tested twice */
+  MM_ScrubStep();
+  MM_ScrubStep();
+
+  /* Verify results, the mismatch is only reported once */
+  UtAssert_STUB_COUNT(MM_CalculateMemCRC, 2);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.ScrubStatus[0],
+                    MM_ScrubStatus_BAD);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.ScrubMismatches, 2);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SCRUB_MISMATCH_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Scrub region %u CRC mismatch: Expected = 0x%08X "
+                       "Calculated = 0x%08X Addr = %p Bytes = %u");
+}
+
+void Test_MM_ScrubStep_MatchAgain(void) {
+  uint32 Crc = 0xCAFEF00D;
+
+  MM_AppData.Scrub.Regions[0].MemType = MM_MemType_RAM;
+  MM_AppData.Scrub.Regions[0].NumOfBytes = 8;
+  MM_AppData.Scrub.Regions[0].GoldenCrc = 0xCAFEF00D;
+  MM_AppData.HkTlm.Payload.ScrubStatus[0] = MM_ScrubStatus_BAD;
+
+  UT_SetHandlerFunction(UT_KEY(MM_CalculateMemCRC),
+                        UT_Handler_MM_CalculateMemCRC, &Crc);
+
+  /* Execute the function being tested */
+  MM_ScrubStep();
+
+  /* Verify results */
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.ScrubStatus[0],
+                    MM_ScrubStatus_GOOD);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_SCRUB_MATCH_INF_EID,
+                       CFE_EVS_EventType_INFORMATION,
+                       "Scrub region %u CRC matches again");
+}
+
+void Test_MM_ScrubStep_ReadError(void) {
+  MM_AppData.Scrub.Regions[0].MemType = MM_MemType_MEM8;
+  MM_AppData.Scrub.Regions[0].NumOfBytes = 8;
+  MM_AppData.HkTlm.Payload.ScrubStatus[0] = MM_ScrubStatus_PENDING;
+
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateMemCRC), CFE_PSP_ERROR);
+
+  /* Execute the function being tested */
+  MM_ScrubStep();
+
+  /* Verify results, the region is not counted as a mismatch */
+  UtAssert_STUB_COUNT(MM_CalculateMemCRC, 1);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.ScrubStatus[0],
+                    MM_ScrubStatus_READ_ERROR);
+  UtAssert_UINT32_EQ(MM_AppData.HkTlm.Payload.ScrubMismatches, 0);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Region, 0);
+
+  /* Error event is issued in MM_CalculateMemCRC and thus not visible here */
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_ScrubStep_ByteBudget(void) {
+  uint32 Segments = (MM_INTERNAL_SCRUB_BYTES_PER_CYCLE +
+                     MM_INTERNAL_MAX_DUMP_DATA_SEG - 1) /
+                    MM_INTERNAL_MAX_DUMP_DATA_SEG;
+
+  MM_AppData.Scrub.Regions[1].MemType = MM_MemType_RAM;
+  MM_AppData.Scrub.Regions[1].NumOfBytes =
+      (Segments + 1) * MM_INTERNAL_MAX_DUMP_DATA_SEG;
+  MM_AppData.HkTlm.Payload.ScrubStatus[1] = MM_ScrubStatus_PENDING;
+
+  /* Execute the function being tested */
+  MM_ScrubStep();
+
+  /* Verify results, the pass resumes on the next call */
+  UtAssert_STUB_COUNT(MM_CalculateMemCRC, Segments);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Region, 1);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Offset,
+                     Segments * MM_INTERNAL_MAX_DUMP_DATA_SEG);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.ScrubStatus[1],
+                    MM_ScrubStatus_PENDING);
+
+  /* Execute the function being tested again */
+  MM_ScrubStep();
+
+  /* Verify results, the final segment completes the pass */
+  UtAssert_STUB_COUNT(MM_CalculateMemCRC, Segments + 1);
+  UtAssert_UINT8_EQ(MM_AppData.HkTlm.Payload.ScrubStatus[1],
+                    MM_ScrubStatus_GOOD);
+  UtAssert_UINT32_EQ(MM_AppData.Scrub.Region, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void) {
+  ADD_TEST(Test_MM_ScrubRestartRegion_Defined);
+  ADD_TEST(Test_MM_ScrubRestartRegion_Undefined);
+  ADD_TEST(Test_MM_ScrubStep_NoRegions);
+  ADD_TEST(Test_MM_ScrubStep_Match);
+  ADD_TEST(Test_MM_ScrubStep_Mismatch);
+  ADD_TEST(Test_MM_ScrubStep_MatchAgain);
+  ADD_TEST(Test_MM_ScrubStep_ReadError);
+  ADD_TEST(Test_MM_ScrubStep_ByteBudget);
+}
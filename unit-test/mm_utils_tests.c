@@ -24,6 +24,7 @@
 /************************************************************************
 ** Includes
 *************************************************************************/
+#include "mm_crc.h"
 #include "mm_dump.h"
 #include "mm_eventids.h"
 #include "mm_fcncodes.h"
@@ -87,6 +88,9 @@ void Test_MM_ResetHk(void) {
 }
 
 void Test_MM_SegmentBreak_Nominal(void) {
+  /* A zero budget gives up the CPU at every segment break */
+  MM_AppData.HkTlm.Payload.CpuBudget = 0;
+
   /* Execute the function being tested */
   MM_SegmentBreak();
 
@@ -95,6 +99,61 @@ void Test_MM_SegmentBreak_Nominal(void) {
   UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
   UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
 
+  /* The command mutex is released for the duration of the delay */
+  UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+  UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+  UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+
+  /* A new budget is started after the delay */
+  UtAssert_STUB_COUNT(OS_GetLocalTime, 2);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_SegmentBreak_BudgetNotSpent(void) {
+  OS_time_t CurrentTime = OS_TimeAssembleFromMicroseconds(1, 999);
+
+  MM_AppData.HkTlm.Payload.CpuBudget = 1000;
+  MM_AppData.SegmentStartTime = OS_TimeAssembleFromMicroseconds(1, 0);
+  UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &CurrentTime, sizeof(CurrentTime),
+                   false);
+
+  /* Execute the function being tested */
+  MM_SegmentBreak();
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(OS_MutSemGive, 0);
+  UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+  UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+  UtAssert_STUB_COUNT(OS_GetLocalTime, 1);
+  UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(MM_AppData.SegmentStartTime),
+                    1000000);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_SegmentBreak_BudgetSpent(void) {
+  OS_time_t Times[2];
+
+  Times[0] = OS_TimeAssembleFromMicroseconds(1, 1000);
+  Times[1] = OS_TimeAssembleFromMicroseconds(1, 3000);
+
+  MM_AppData.HkTlm.Payload.CpuBudget = 1000;
+  MM_AppData.SegmentStartTime = OS_TimeAssembleFromMicroseconds(1, 0);
+  UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), Times, sizeof(Times), false);
+
+  /* Execute the function being tested */
+  MM_SegmentBreak();
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+  UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+  UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+
+  /* The new budget starts when the delay ends */
+  UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(MM_AppData.SegmentStartTime),
+                    1003000);
+
   UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
@@ -2472,6 +2531,39 @@ void Test_MM_VerifyLoadDumpParams_WIDDataSizeErrorTooLarge(void) {
       "Data size in bytes invalid or exceeds limits: Data Size = %u");
 }
 
+void Test_MM_VerifyLoadDumpParams_InTlmNominal(void) {
+  uint32 Address = 0;
+  size_t SizeInBytes = MM_INTERFACE_MAX_DUMP_TLM_DATA;
+  int32 Result;
+
+  /* Execute the function being tested */
+  Result = MM_VerifyLoadDumpParams(Address, MM_MemType_RAM, SizeInBytes,
+                                   MM_VERIFY_INTLM);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_PSP_SUCCESS);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_VerifyLoadDumpParams_InTlmDataSizeErrorTooLarge(void) {
+  uint32 Address = 0;
+  size_t SizeInBytes = MM_INTERFACE_MAX_DUMP_TLM_DATA + 1;
+  int32 Result;
+
+  /* Execute the function being tested */
+  Result = MM_VerifyLoadDumpParams(Address, MM_MemType_RAM, SizeInBytes,
+                                   MM_VERIFY_INTLM);
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_PSP_ERROR);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_DATA_SIZE_BYTES_ERR_EID, CFE_EVS_EventType_ERROR,
+      "Data size in bytes invalid or exceeds limits: Data Size = %u");
+}
+
 void Test_MM_Verify32Aligned(void) {
   bool Result;
   cpuaddr Addr;
@@ -2597,18 +2689,18 @@ void Test_MM_ResolveSymAddr_SymLookupErr(void) {
 void Test_MM_ComputeCRCFromFile(void) {
   osal_id_t FileHandle;
   uint32 CrcPtr;
-  uint32 TypeCRC;
+  MM_CrcType_Enum_t TypeCRC;
   int32 Result;
 
   FileHandle = MM_UT_OBJID_1;
   CrcPtr = 0;
-  TypeCRC = 0;
+  TypeCRC = MM_CrcType_DEFAULT;
 
   UT_SetDataBuffer(UT_KEY(OS_read), &FileHandle, sizeof(FileHandle), false);
   UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 1);
   UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
 
-  UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateFileCRC), 1);
 
   /* Execute the function being tested */
   Result = MM_ComputeCRCFromFile(FileHandle, &CrcPtr, TypeCRC);
@@ -2622,7 +2714,7 @@ void Test_MM_ComputeCRCFromFile(void) {
   UT_SetDataBuffer(UT_KEY(OS_read), &FileHandle, sizeof(FileHandle), false);
   UT_SetDeferredRetcode(UT_KEY(OS_read), 1, OS_ERROR);
 
-  UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
+  UT_SetDefaultReturnValue(UT_KEY(MM_CalculateFileCRC), 1);
 
   /* Execute the function being tested */
   Result = MM_ComputeCRCFromFile(FileHandle, &CrcPtr, TypeCRC);
@@ -2631,12 +2723,160 @@ void Test_MM_ComputeCRCFromFile(void) {
   UtAssert_True(Result == OS_ERROR, "Result == OS_ERROR");
 }
 
+void Test_MM_FormatHexBytes_Nominal(void) {
+  const uint8 Src[] = {0x00, 0xA5, 0x3C, 0xFF};
+  char Dest[32];
+  size_t Result;
+
+  memset(Dest, 'X', sizeof(Dest));
+
+  /* Execute the function being tested */
+  Result = MM_FormatHexBytes(Dest, sizeof(Dest), Src, sizeof(Src));
+
+  /* Verify results */
+  UtAssert_UINT32_EQ(Result, sizeof(Src) * MM_HEX_CHARS_PER_BYTE);
+  UtAssert_STRINGBUF_EQ(Dest, sizeof(Dest), "0x00 0xA5 0x3C 0xFF ", -1);
+}
+
+void Test_MM_FormatHexBytes_Truncated(void) {
+  const uint8 Src[] = {0x12, 0x34, 0x56};
+  char Dest[(2 * MM_HEX_CHARS_PER_BYTE) + 1];
+  size_t Result;
+
+  /* Execute the function being tested, only two bytes and the NUL fit */
+  Result = MM_FormatHexBytes(Dest, sizeof(Dest), Src, sizeof(Src));
+
+  /* Verify results */
+  UtAssert_UINT32_EQ(Result, 2 * MM_HEX_CHARS_PER_BYTE);
+  UtAssert_STRINGBUF_EQ(Dest, sizeof(Dest), "0x12 0x34 ", -1);
+
+  /* Execute the function being tested, nothing fits */
+  Result = MM_FormatHexBytes(Dest, MM_HEX_CHARS_PER_BYTE, Src, sizeof(Src));
+
+  /* Verify results */
+  UtAssert_UINT32_EQ(Result, 0);
+  UtAssert_STRINGBUF_EQ(Dest, sizeof(Dest), "", -1);
+}
+
+void Test_MM_VerifyFillPattern_Nominal(void) {
+  MM_FillMemCmd_Payload_t Payload;
+  uint8 Sizes[] = {0, 1, 2, 4, 8};
+  uint32 Failures = 0;
+  uint32 i;
+
+  memset(&Payload, 0, sizeof(Payload));
+
+  /* Execute the function being tested with every valid pattern size */
+  for (i = 0; i < sizeof(Sizes); i++) {
+    Payload.PatternSize = Sizes[i];
+    if (MM_VerifyFillPattern(&Payload) != OS_SUCCESS) {
+      Failures++;
+    }
+  }
+
+  /* Verify results */
+  UtAssert_UINT32_EQ(Failures, 0);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_VerifyFillPattern_SizeError(void) {
+  MM_FillMemCmd_Payload_t Payload;
+
+  memset(&Payload, 0, sizeof(Payload));
+
+  /* Execute the function being tested, doesn't divide the largest size */
+  Payload.PatternSize = 3;
+  UtAssert_INT32_EQ(MM_VerifyFillPattern(&Payload), OS_ERROR);
+
+  /* Execute the function being tested, larger than the largest size */
+  Payload.PatternSize = MM_FILL_MAX_PATTERN_SIZE * 2;
+  UtAssert_INT32_EQ(MM_VerifyFillPattern(&Payload), OS_ERROR);
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+  MM_Test_Verify_Event(0, MM_FILL_PATTERN_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Fill pattern size error: Size = %u");
+}
+
+void Test_MM_BuildFillBuffer_Byte(void) {
+  MM_FillMemCmd_Payload_t Payload;
+  const uint8 *FillBuffer = (const uint8 *)&MM_AppData.FillBuffer[0];
+  uint32 Mismatches = 0;
+  uint32 i;
+
+  memset(&Payload, 0, sizeof(Payload));
+  Payload.FillPattern = 0x123456A5;
+
+  /* Execute the function being tested, pattern size from access size */
+  MM_BuildFillBuffer(&Payload, sizeof(uint8));
+
+  /* Verify results, the whole fill segment holds the low byte */
+  for (i = 0; i < MM_INTERNAL_MAX_FILL_DATA_SEG; i++) {
+    if (FillBuffer[i] != 0xA5) {
+      Mismatches++;
+    }
+  }
+
+  UtAssert_UINT32_EQ(Mismatches, 0);
+}
+
+void Test_MM_BuildFillBuffer_Word(void) {
+  MM_FillMemCmd_Payload_t Payload;
+  const uint32 *FillBuffer32 = (const uint32 *)&MM_AppData.FillBuffer[0];
+  uint32 Mismatches = 0;
+  uint32 i;
+
+  memset(&Payload, 0, sizeof(Payload));
+  Payload.FillPattern = 0x12345678;
+
+  /* Execute the function being tested, pattern size from access size */
+  MM_BuildFillBuffer(&Payload, sizeof(uint32));
+
+  /* Verify results, every word reads back as the pattern */
+  for (i = 0; i < (MM_INTERNAL_MAX_FILL_DATA_SEG / sizeof(uint32)); i++) {
+    if (FillBuffer32[i] != 0x12345678) {
+      Mismatches++;
+    }
+  }
+
+  UtAssert_UINT32_EQ(Mismatches, 0);
+}
+
+void Test_MM_BuildFillBuffer_Wide(void) {
+  MM_FillMemCmd_Payload_t Payload;
+  const uint8 *FillBuffer = (const uint8 *)&MM_AppData.FillBuffer[0];
+  uint64 Pattern = 0x0123456789ABCDEFULL;
+  uint64 Value;
+  uint32 Mismatches = 0;
+  uint32 i;
+
+  memset(&Payload, 0, sizeof(Payload));
+  Payload.FillPattern = 0x89ABCDEF;
+  Payload.FillPatternHigh = 0x01234567;
+  Payload.PatternSize = sizeof(uint64);
+
+  /* Execute the function being tested, the access size isn't used */
+  MM_BuildFillBuffer(&Payload, sizeof(uint8));
+
+  /* Verify results, every 64-bit word reads back as the pattern */
+  for (i = 0; i < MM_INTERNAL_MAX_FILL_DATA_SEG; i += sizeof(uint64)) {
+    memcpy(&Value, &FillBuffer[i], sizeof(Value));
+    if (Value != Pattern) {
+      Mismatches++;
+    }
+  }
+
+  UtAssert_UINT32_EQ(Mismatches, 0);
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
 void UtTest_Setup(void) {
   ADD_TEST(Test_MM_ResetHk);
   ADD_TEST(Test_MM_SegmentBreak_Nominal);
+  ADD_TEST(Test_MM_SegmentBreak_BudgetNotSpent);
+  ADD_TEST(Test_MM_SegmentBreak_BudgetSpent);
   ADD_TEST(Test_MM_VerifyPeekPokeParams_ByteWidthRAM);
   ADD_TEST(Test_MM_VerifyPeekPokeParams_WordWidthMEM16);
   ADD_TEST(Test_MM_VerifyPeekPokeParams_DWordWidthMEM32);
@@ -2733,10 +2973,19 @@ void UtTest_Setup(void) {
   ADD_TEST(Test_MM_VerifyLoadDumpParams_WIDMemValidateError);
   ADD_TEST(Test_MM_VerifyLoadDumpParams_WIDDataSizeErrorTooSmall);
   ADD_TEST(Test_MM_VerifyLoadDumpParams_WIDDataSizeErrorTooLarge);
+  ADD_TEST(Test_MM_VerifyLoadDumpParams_InTlmNominal);
+  ADD_TEST(Test_MM_VerifyLoadDumpParams_InTlmDataSizeErrorTooLarge);
   ADD_TEST(Test_MM_Verify32Aligned);
   ADD_TEST(Test_MM_Verify16Aligned);
   ADD_TEST(Test_MM_ResolveSymAddr_Nominal);
   ADD_TEST(Test_MM_ResolveSymAddr_NullString);
   ADD_TEST(Test_MM_ResolveSymAddr_SymLookupErr);
   ADD_TEST(Test_MM_ComputeCRCFromFile);
+  ADD_TEST(Test_MM_FormatHexBytes_Nominal);
+  ADD_TEST(Test_MM_FormatHexBytes_Truncated);
+  ADD_TEST(Test_MM_VerifyFillPattern_Nominal);
+  ADD_TEST(Test_MM_VerifyFillPattern_SizeError);
+  ADD_TEST(Test_MM_BuildFillBuffer_Byte);
+  ADD_TEST(Test_MM_BuildFillBuffer_Word);
+  ADD_TEST(Test_MM_BuildFillBuffer_Wide);
 }
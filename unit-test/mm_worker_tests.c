@@ -0,0 +1,491 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit tests for mm_worker.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_cmds.h"
+#include "mm_eventids.h"
+#include "mm_fcncodes.h"
+#include "mm_msg.h"
+#include "mm_test_utils.h"
+#include "mm_utils.h"
+#include "mm_worker.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "utassert.h"
+#include "utstubs.h"
+#include "uttest.h"
+
+#include "cfe.h"
+
+/*
+ * Function Definitions
+ */
+
+void Test_MM_WorkerInit_Nominal(void) {
+  CFE_Status_t Result;
+
+  /* Execute the function being tested */
+  Result = MM_WorkerInit();
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+
+  UtAssert_STUB_COUNT(OS_MutSemCreate, 1);
+  UtAssert_STUB_COUNT(OS_QueueCreate, 1);
+  UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WorkerInit_MutexError(void) {
+  CFE_Status_t Result;
+
+  UT_SetDefaultReturnValue(UT_KEY(OS_MutSemCreate), OS_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_WorkerInit();
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+  UtAssert_STUB_COUNT(OS_QueueCreate, 0);
+  UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_WORKER_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Error Creating Command Mutex, RC = %d");
+}
+
+void Test_MM_WorkerInit_QueueError(void) {
+  CFE_Status_t Result;
+
+  UT_SetDefaultReturnValue(UT_KEY(OS_QueueCreate), OS_ERROR);
+
+  /* Execute the function being tested */
+  Result = MM_WorkerInit();
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+  UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_WORKER_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Error Creating Worker Queue, RC = %d");
+}
+
+void Test_MM_WorkerInit_TaskError(void) {
+  CFE_Status_t Result;
+
+  UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CreateChildTask),
+                           CFE_ES_ERR_CHILD_TASK_CREATE);
+
+  /* Execute the function being tested */
+  Result = MM_WorkerInit();
+
+  /* Verify results */
+  UtAssert_INT32_EQ(Result, CFE_ES_ERR_CHILD_TASK_CREATE);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_WORKER_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Error Creating Worker Task, RC = 0x%08X");
+}
+
+void Test_MM_WorkerTask_Nominal(void) {
+  CFE_MSG_FcnCode_t CommandCode = MM_FILL_MEM_CC;
+
+  /* Process one job, then fail the queue read to end the task */
+  UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 2, OS_ERROR);
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  /* Execute the function being tested */
+  MM_WorkerTask();
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(OS_QueueGet, 2);
+  UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+  UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+  UtAssert_STUB_COUNT(MM_FillMemCmd, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_WORKER_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Worker Queue Read Error, Worker will exit. RC = %d");
+}
+
+void Test_MM_WorkerTask_QueueError(void) {
+  UT_SetDefaultReturnValue(UT_KEY(OS_QueueGet), OS_ERROR);
+
+  /* Execute the function being tested */
+  MM_WorkerTask();
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(OS_QueueGet, 1);
+  UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_WORKER_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Worker Queue Read Error, Worker will exit. RC = %d");
+}
+
+void Test_MM_WorkerSubmit_Nominal(void) {
+  MM_FillMemCmd_t CmdPacket;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+
+  /* Execute the function being tested */
+  MM_WorkerSubmit((CFE_SB_Buffer_t *)&CmdPacket, sizeof(CmdPacket));
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(OS_QueuePut, 1);
+
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 0);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WorkerSubmit_QueueFull(void) {
+  MM_FillMemCmd_t CmdPacket;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+
+  UT_SetDefaultReturnValue(UT_KEY(OS_QueuePut), OS_QUEUE_FULL);
+
+  /* Execute the function being tested */
+  MM_WorkerSubmit((CFE_SB_Buffer_t *)&CmdPacket, sizeof(CmdPacket));
+
+  /* Verify results */
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.CmdCounter, 0);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_WORKER_QUEUE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "Worker queue error, command rejected: CC = %u, RC = %d");
+}
+
+void Test_MM_WorkerSubmit_LoadCommit(void) {
+  MM_LoadCommitCmd_t CmdPacket;
+  CFE_MSG_FcnCode_t CommandCode = MM_LOAD_COMMIT_CC;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  /* Execute the function being tested */
+  MM_WorkerSubmit((CFE_SB_Buffer_t *)&CmdPacket, sizeof(CmdPacket));
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(OS_QueuePut, 1);
+  UtAssert_UINT32_EQ(MM_AppData.ChunkLoad.CommitsQueued, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WorkerSubmit_LoadRAMCommit(void) {
+  MM_LoadRAMCommitCmd_t CmdPacket;
+  CFE_MSG_FcnCode_t CommandCode = MM_LOAD_RAM_COMMIT_CC;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  /* Execute the function being tested */
+  MM_WorkerSubmit((CFE_SB_Buffer_t *)&CmdPacket, sizeof(CmdPacket));
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(OS_QueuePut, 1);
+  UtAssert_UINT32_EQ(MM_AppData.ChunkLoad.CommitsQueued, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WorkerSubmit_LoadCommitQueueFull(void) {
+  MM_LoadCommitCmd_t CmdPacket;
+  CFE_MSG_FcnCode_t CommandCode = MM_LOAD_COMMIT_CC;
+
+  memset(&CmdPacket, 0, sizeof(CmdPacket));
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  UT_SetDefaultReturnValue(UT_KEY(OS_QueuePut), OS_QUEUE_FULL);
+
+  /* Execute the function being tested */
+  MM_WorkerSubmit((CFE_SB_Buffer_t *)&CmdPacket, sizeof(CmdPacket));
+
+  /* Verify results, a commit that isn't queued doesn't hold the buffer */
+  UtAssert_UINT32_EQ(MM_AppData.ChunkLoad.CommitsQueued, 0);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(
+      0, MM_WORKER_QUEUE_ERR_EID, CFE_EVS_EventType_ERROR,
+      "Worker queue error, command rejected: CC = %u, RC = %d");
+}
+
+void Test_MM_WorkerProcessJob_LoadMemFromFile(void) {
+  MM_WorkerJob_t Job;
+  CFE_MSG_FcnCode_t CommandCode = MM_LOAD_MEM_FROM_FILE_CC;
+
+  memset(&Job, 0, sizeof(Job));
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  /* Execute the function being tested */
+  MM_WorkerProcessJob(&Job);
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(MM_ResetHk, 1);
+  UtAssert_STUB_COUNT(OS_GetLocalTime, 1);
+  UtAssert_STUB_COUNT(MM_LoadMemFromFileCmd, 1);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WorkerProcessJob_DumpMemToFile(void) {
+  MM_WorkerJob_t Job;
+  CFE_MSG_FcnCode_t CommandCode = MM_DUMP_MEM_TO_FILE_CC;
+
+  memset(&Job, 0, sizeof(Job));
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  /* Execute the function being tested */
+  MM_WorkerProcessJob(&Job);
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(MM_ResetHk, 1);
+  UtAssert_STUB_COUNT(MM_DumpMemToFileCmd, 1);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WorkerProcessJob_DumpMemToCompressedFile(void) {
+  MM_WorkerJob_t Job;
+  CFE_MSG_FcnCode_t CommandCode = MM_DUMP_MEM_TO_COMPRESSED_FILE_CC;
+
+  memset(&Job, 0, sizeof(Job));
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  /* Execute the function being tested */
+  MM_WorkerProcessJob(&Job);
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(MM_ResetHk, 1);
+  UtAssert_STUB_COUNT(MM_DumpMemToCompressedFileCmd, 1);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WorkerProcessJob_DumpRegionsToFile(void) {
+  MM_WorkerJob_t Job;
+  CFE_MSG_FcnCode_t CommandCode = MM_DUMP_REGIONS_TO_FILE_CC;
+
+  memset(&Job, 0, sizeof(Job));
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  /* Execute the function being tested */
+  MM_WorkerProcessJob(&Job);
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(MM_ResetHk, 1);
+  UtAssert_STUB_COUNT(MM_DumpRegionsToFileCmd, 1);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WorkerProcessJob_FillMem(void) {
+  MM_WorkerJob_t Job;
+  CFE_MSG_FcnCode_t CommandCode = MM_FILL_MEM_CC;
+
+  memset(&Job, 0, sizeof(Job));
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  /* Execute the function being tested */
+  MM_WorkerProcessJob(&Job);
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(MM_ResetHk, 1);
+  UtAssert_STUB_COUNT(MM_FillMemCmd, 1);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WorkerProcessJob_LoadCommit(void) {
+  MM_WorkerJob_t Job;
+  CFE_MSG_FcnCode_t CommandCode = MM_LOAD_COMMIT_CC;
+
+  memset(&Job, 0, sizeof(Job));
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  MM_AppData.ChunkLoad.CommitsQueued = 2;
+
+  /* Execute the function being tested */
+  MM_WorkerProcessJob(&Job);
+
+  /* Verify results, the buffer is still held for the other commit */
+  UtAssert_STUB_COUNT(MM_ResetHk, 1);
+  UtAssert_STUB_COUNT(MM_LoadCommitCmd, 1);
+  UtAssert_UINT32_EQ(MM_AppData.ChunkLoad.CommitsQueued, 1);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WorkerProcessJob_LoadRAMCommit(void) {
+  MM_WorkerJob_t Job;
+  CFE_MSG_FcnCode_t CommandCode = MM_LOAD_RAM_COMMIT_CC;
+
+  memset(&Job, 0, sizeof(Job));
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  MM_AppData.ChunkLoad.CommitsQueued = 1;
+
+  /* Execute the function being tested */
+  MM_WorkerProcessJob(&Job);
+
+  /* Verify results, the load buffer is released */
+  UtAssert_STUB_COUNT(MM_ResetHk, 1);
+  UtAssert_STUB_COUNT(MM_LoadRAMCommitCmd, 1);
+  UtAssert_UINT32_EQ(MM_AppData.ChunkLoad.CommitsQueued, 0);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WorkerProcessJob_ChecksumMem(void) {
+  MM_WorkerJob_t Job;
+  CFE_MSG_FcnCode_t CommandCode = MM_CHECKSUM_MEM_CC;
+
+  memset(&Job, 0, sizeof(Job));
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  /* Execute the function being tested */
+  MM_WorkerProcessJob(&Job);
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(MM_ResetHk, 1);
+  UtAssert_STUB_COUNT(MM_ChecksumMemCmd, 1);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WorkerProcessJob_BuildScrubIndex(void) {
+  MM_WorkerJob_t Job;
+  CFE_MSG_FcnCode_t CommandCode = MM_BUILD_SCRUB_INDEX_CC;
+
+  memset(&Job, 0, sizeof(Job));
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  /* Execute the function being tested */
+  MM_WorkerProcessJob(&Job);
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(MM_ResetHk, 1);
+  UtAssert_STUB_COUNT(MM_BuildScrubIndexCmd, 1);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WorkerProcessJob_CompareScrubIndex(void) {
+  MM_WorkerJob_t Job;
+  CFE_MSG_FcnCode_t CommandCode = MM_COMPARE_SCRUB_INDEX_CC;
+
+  memset(&Job, 0, sizeof(Job));
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  /* Execute the function being tested */
+  MM_WorkerProcessJob(&Job);
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(MM_ResetHk, 1);
+  UtAssert_STUB_COUNT(MM_CompareScrubIndexCmd, 1);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WorkerProcessJob_MemTest(void) {
+  MM_WorkerJob_t Job;
+  CFE_MSG_FcnCode_t CommandCode = MM_MEM_TEST_CC;
+
+  memset(&Job, 0, sizeof(Job));
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  /* Execute the function being tested */
+  MM_WorkerProcessJob(&Job);
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(MM_ResetHk, 1);
+  UtAssert_STUB_COUNT(MM_MemTestCmd, 1);
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_MM_WorkerProcessJob_InvalidCommandCode(void) {
+  MM_WorkerJob_t Job;
+  CFE_MSG_FcnCode_t CommandCode = MM_PEEK_CC;
+
+  memset(&Job, 0, sizeof(Job));
+  UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &CommandCode,
+                   sizeof(CommandCode), false);
+
+  /* Execute the function being tested */
+  MM_WorkerProcessJob(&Job);
+
+  /* Verify results */
+  UtAssert_STUB_COUNT(MM_PeekCmd, 0);
+  UtAssert_INT32_EQ(MM_AppData.HkTlm.Payload.ErrCounter, 1);
+
+  UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+  MM_Test_Verify_Event(0, MM_CC_ERR_EID, CFE_EVS_EventType_ERROR,
+                       "Invalid worker command code %d");
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void) {
+  ADD_TEST(Test_MM_WorkerInit_Nominal);
+  ADD_TEST(Test_MM_WorkerInit_MutexError);
+  ADD_TEST(Test_MM_WorkerInit_QueueError);
+  ADD_TEST(Test_MM_WorkerInit_TaskError);
+  ADD_TEST(Test_MM_WorkerTask_Nominal);
+  ADD_TEST(Test_MM_WorkerTask_QueueError);
+  ADD_TEST(Test_MM_WorkerSubmit_Nominal);
+  ADD_TEST(Test_MM_WorkerSubmit_QueueFull);
+  ADD_TEST(Test_MM_WorkerSubmit_LoadCommit);
+  ADD_TEST(Test_MM_WorkerSubmit_LoadRAMCommit);
+  ADD_TEST(Test_MM_WorkerSubmit_LoadCommitQueueFull);
+  ADD_TEST(Test_MM_WorkerProcessJob_LoadMemFromFile);
+  ADD_TEST(Test_MM_WorkerProcessJob_DumpMemToFile);
+  ADD_TEST(Test_MM_WorkerProcessJob_DumpMemToCompressedFile);
+  ADD_TEST(Test_MM_WorkerProcessJob_DumpRegionsToFile);
+  ADD_TEST(Test_MM_WorkerProcessJob_FillMem);
+  ADD_TEST(Test_MM_WorkerProcessJob_LoadCommit);
+  ADD_TEST(Test_MM_WorkerProcessJob_LoadRAMCommit);
+  ADD_TEST(Test_MM_WorkerProcessJob_ChecksumMem);
+  ADD_TEST(Test_MM_WorkerProcessJob_BuildScrubIndex);
+  ADD_TEST(Test_MM_WorkerProcessJob_CompareScrubIndex);
+  ADD_TEST(Test_MM_WorkerProcessJob_MemTest);
+  ADD_TEST(Test_MM_WorkerProcessJob_InvalidCommandCode);
+}
@@ -25,6 +25,131 @@
 #include "mm_cmds.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_BatchPeekCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_BatchPeekCmd(const MM_BatchPeekCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_BatchPeekCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_BatchPeekCmd, const MM_BatchPeekCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_BatchPeekCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_BatchPeekCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_BatchPokeCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_BatchPokeCmd(const MM_BatchPokeCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_BatchPokeCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_BatchPokeCmd, const MM_BatchPokeCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_BatchPokeCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_BatchPokeCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_BuildScrubIndexCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_BuildScrubIndexCmd(const MM_BuildScrubIndexCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_BuildScrubIndexCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_BuildScrubIndexCmd, const MM_BuildScrubIndexCmd_t *,
+                      Msg);
+
+  UT_GenStub_Execute(MM_BuildScrubIndexCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_BuildScrubIndexCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_ChecksumMemCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_ChecksumMemCmd(const MM_ChecksumMemCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_ChecksumMemCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_ChecksumMemCmd, const MM_ChecksumMemCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_ChecksumMemCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_ChecksumMemCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_ClearScrubRegionCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_ClearScrubRegionCmd(const MM_ClearScrubRegionCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_ClearScrubRegionCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_ClearScrubRegionCmd, const MM_ClearScrubRegionCmd_t *,
+                      Msg);
+
+  UT_GenStub_Execute(MM_ClearScrubRegionCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_ClearScrubRegionCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_ClearWatchEntryCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_ClearWatchEntryCmd(const MM_ClearWatchEntryCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_ClearWatchEntryCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_ClearWatchEntryCmd,
+                      const MM_ClearWatchEntryCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_ClearWatchEntryCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_ClearWatchEntryCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_CompareScrubIndexCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_CompareScrubIndexCmd(const MM_CompareScrubIndexCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_CompareScrubIndexCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_CompareScrubIndexCmd,
+                      const MM_CompareScrubIndexCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_CompareScrubIndexCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_CompareScrubIndexCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_ConditionalPokeCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_ConditionalPokeCmd(const MM_ConditionalPokeCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_ConditionalPokeCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_ConditionalPokeCmd,
+                      const MM_ConditionalPokeCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_ConditionalPokeCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_ConditionalPokeCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_DumpInEventCmd()
@@ -40,6 +165,39 @@ CFE_Status_t MM_DumpInEventCmd(const MM_DumpInEventCmd_t *Msg) {
   return UT_GenStub_GetReturnValue(MM_DumpInEventCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_DumpInTlmCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_DumpInTlmCmd(const MM_DumpInTlmCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_DumpInTlmCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_DumpInTlmCmd, const MM_DumpInTlmCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_DumpInTlmCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_DumpInTlmCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_DumpMemToCompressedFileCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t
+MM_DumpMemToCompressedFileCmd(const MM_DumpMemToCompressedFileCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_DumpMemToCompressedFileCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_DumpMemToCompressedFileCmd,
+                      const MM_DumpMemToCompressedFileCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_DumpMemToCompressedFileCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_DumpMemToCompressedFileCmd,
+                                   CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_DumpMemToFileCmd()
@@ -55,6 +213,37 @@ CFE_Status_t MM_DumpMemToFileCmd(const MM_DumpMemToFileCmd_t *Msg) {
   return UT_GenStub_GetReturnValue(MM_DumpMemToFileCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_DumpMemToTlmCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_DumpMemToTlmCmd(const MM_DumpMemToTlmCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_DumpMemToTlmCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_DumpMemToTlmCmd, const MM_DumpMemToTlmCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_DumpMemToTlmCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_DumpMemToTlmCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_DumpRegionsToFileCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_DumpRegionsToFileCmd(const MM_DumpRegionsToFileCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_DumpRegionsToFileCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_DumpRegionsToFileCmd,
+                      const MM_DumpRegionsToFileCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_DumpRegionsToFileCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_DumpRegionsToFileCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_EepromWriteDisCmd()
@@ -102,6 +291,51 @@ CFE_Status_t MM_FillMemCmd(const MM_FillMemCmd_t *Msg) {
   return UT_GenStub_GetReturnValue(MM_FillMemCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_LoadBeginCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_LoadBeginCmd(const MM_LoadBeginCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_LoadBeginCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_LoadBeginCmd, const MM_LoadBeginCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_LoadBeginCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_LoadBeginCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_LoadCommitCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_LoadCommitCmd(const MM_LoadCommitCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_LoadCommitCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_LoadCommitCmd, const MM_LoadCommitCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_LoadCommitCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_LoadCommitCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_LoadDataCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_LoadDataCmd(const MM_LoadDataCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_LoadDataCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_LoadDataCmd, const MM_LoadDataCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_LoadDataCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_LoadDataCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_LoadMemFromFileCmd()
@@ -133,6 +367,21 @@ CFE_Status_t MM_LoadMemWIDCmd(const MM_LoadMemWIDCmd_t *Msg) {
   return UT_GenStub_GetReturnValue(MM_LoadMemWIDCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_LoadRAMCommitCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_LoadRAMCommitCmd(const MM_LoadRAMCommitCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_LoadRAMCommitCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_LoadRAMCommitCmd, const MM_LoadRAMCommitCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_LoadRAMCommitCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_LoadRAMCommitCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_LookupSymCmd()
@@ -148,6 +397,36 @@ CFE_Status_t MM_LookupSymCmd(const MM_LookupSymCmd_t *Msg) {
   return UT_GenStub_GetReturnValue(MM_LookupSymCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_MaskedPokeCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_MaskedPokeCmd(const MM_MaskedPokeCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_MaskedPokeCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_MaskedPokeCmd, const MM_MaskedPokeCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_MaskedPokeCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_MaskedPokeCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_MemTestCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_MemTestCmd(const MM_MemTestCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_MemTestCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_MemTestCmd, const MM_MemTestCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_MemTestCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_MemTestCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_NoopCmd()
@@ -223,6 +502,84 @@ CFE_Status_t MM_SendHkCmd(const MM_SendHkCmd_t *Msg) {
   return UT_GenStub_GetReturnValue(MM_SendHkCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_SetCpuBudgetCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_SetCpuBudgetCmd(const MM_SetCpuBudgetCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_SetCpuBudgetCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_SetCpuBudgetCmd, const MM_SetCpuBudgetCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_SetCpuBudgetCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_SetCpuBudgetCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_SetDumpCrcTypeCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_SetDumpCrcTypeCmd(const MM_SetDumpCrcTypeCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_SetDumpCrcTypeCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_SetDumpCrcTypeCmd, const MM_SetDumpCrcTypeCmd_t *,
+                      Msg);
+
+  UT_GenStub_Execute(MM_SetDumpCrcTypeCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_SetDumpCrcTypeCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_SetSamplePeriodCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_SetSamplePeriodCmd(const MM_SetSamplePeriodCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_SetSamplePeriodCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_SetSamplePeriodCmd,
+                      const MM_SetSamplePeriodCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_SetSamplePeriodCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_SetSamplePeriodCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_SetScrubRegionCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_SetScrubRegionCmd(const MM_SetScrubRegionCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_SetScrubRegionCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_SetScrubRegionCmd, const MM_SetScrubRegionCmd_t *,
+                      Msg);
+
+  UT_GenStub_Execute(MM_SetScrubRegionCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_SetScrubRegionCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_SetWatchEntryCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_SetWatchEntryCmd(const MM_SetWatchEntryCmd_t *Msg) {
+  UT_GenStub_SetupReturnBuffer(MM_SetWatchEntryCmd, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_SetWatchEntryCmd, const MM_SetWatchEntryCmd_t *, Msg);
+
+  UT_GenStub_Execute(MM_SetWatchEntryCmd, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_SetWatchEntryCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_SymTblToFileCmd()
@@ -0,0 +1,67 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in mm_crc header
+ */
+
+#include "mm_crc.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_CalculateCRC()
+ * ----------------------------------------------------
+ */
+uint32 MM_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC,
+                       CFE_ES_CrcType_Enum_t TypeCRC) {
+  UT_GenStub_SetupReturnBuffer(MM_CalculateCRC, uint32);
+
+  UT_GenStub_AddParam(MM_CalculateCRC, const void *, DataPtr);
+  UT_GenStub_AddParam(MM_CalculateCRC, size_t, DataLength);
+  UT_GenStub_AddParam(MM_CalculateCRC, uint32, InputCRC);
+  UT_GenStub_AddParam(MM_CalculateCRC, CFE_ES_CrcType_Enum_t, TypeCRC);
+
+  UT_GenStub_Execute(MM_CalculateCRC, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_CalculateCRC, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_CalculateFileCRC()
+ * ----------------------------------------------------
+ */
+uint32 MM_CalculateFileCRC(const void *DataPtr, size_t DataLength,
+                           uint32 InputCRC, MM_CrcType_Enum_t CrcType,
+                           CFE_ES_CrcType_Enum_t DefaultType) {
+  UT_GenStub_SetupReturnBuffer(MM_CalculateFileCRC, uint32);
+
+  UT_GenStub_AddParam(MM_CalculateFileCRC, const void *, DataPtr);
+  UT_GenStub_AddParam(MM_CalculateFileCRC, size_t, DataLength);
+  UT_GenStub_AddParam(MM_CalculateFileCRC, uint32, InputCRC);
+  UT_GenStub_AddParam(MM_CalculateFileCRC, MM_CrcType_Enum_t, CrcType);
+  UT_GenStub_AddParam(MM_CalculateFileCRC, CFE_ES_CrcType_Enum_t,
+                      DefaultType);
+
+  UT_GenStub_Execute(MM_CalculateFileCRC, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_CalculateFileCRC, uint32);
+}
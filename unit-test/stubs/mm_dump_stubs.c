@@ -25,25 +25,108 @@
 #include "mm_dump.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_CalculateMemCRC()
+ * ----------------------------------------------------
+ */
+int32 MM_CalculateMemCRC(cpuaddr SrcAddress, MM_MemType_Enum_t MemType,
+                         size_t NumBytes, void *Buffer, uint32 *CrcPtr) {
+  UT_GenStub_SetupReturnBuffer(MM_CalculateMemCRC, int32);
+
+  UT_GenStub_AddParam(MM_CalculateMemCRC, cpuaddr, SrcAddress);
+  UT_GenStub_AddParam(MM_CalculateMemCRC, MM_MemType_Enum_t, MemType);
+  UT_GenStub_AddParam(MM_CalculateMemCRC, size_t, NumBytes);
+  UT_GenStub_AddParam(MM_CalculateMemCRC, void *, Buffer);
+  UT_GenStub_AddParam(MM_CalculateMemCRC, uint32 *, CrcPtr);
+
+  UT_GenStub_Execute(MM_CalculateMemCRC, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_CalculateMemCRC, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_ChecksumMem()
+ * ----------------------------------------------------
+ */
+int32 MM_ChecksumMem(cpuaddr SrcAddress, MM_MemType_Enum_t MemType,
+                     uint32 NumBytes, uint32 *CrcPtr) {
+  UT_GenStub_SetupReturnBuffer(MM_ChecksumMem, int32);
+
+  UT_GenStub_AddParam(MM_ChecksumMem, cpuaddr, SrcAddress);
+  UT_GenStub_AddParam(MM_ChecksumMem, MM_MemType_Enum_t, MemType);
+  UT_GenStub_AddParam(MM_ChecksumMem, uint32, NumBytes);
+  UT_GenStub_AddParam(MM_ChecksumMem, uint32 *, CrcPtr);
+
+  UT_GenStub_Execute(MM_ChecksumMem, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_ChecksumMem, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_DumpMemToCompressedFile()
+ * ----------------------------------------------------
+ */
+int32 MM_DumpMemToCompressedFile(osal_id_t FileHandle, const char *FileName,
+                                 const MM_LoadDumpFileHeader_t *FileHeader,
+                                 uint32 *CrcPtr) {
+  UT_GenStub_SetupReturnBuffer(MM_DumpMemToCompressedFile, int32);
+
+  UT_GenStub_AddParam(MM_DumpMemToCompressedFile, osal_id_t, FileHandle);
+  UT_GenStub_AddParam(MM_DumpMemToCompressedFile, const char *, FileName);
+  UT_GenStub_AddParam(MM_DumpMemToCompressedFile,
+                      const MM_LoadDumpFileHeader_t *, FileHeader);
+  UT_GenStub_AddParam(MM_DumpMemToCompressedFile, uint32 *, CrcPtr);
+
+  UT_GenStub_Execute(MM_DumpMemToCompressedFile, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_DumpMemToCompressedFile, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_DumpMemToFile()
  * ----------------------------------------------------
  */
 int32 MM_DumpMemToFile(osal_id_t FileHandle, const char *FileName,
-                       const MM_LoadDumpFileHeader_t *FileHeader) {
+                       const MM_LoadDumpFileHeader_t *FileHeader,
+                       uint32 *CrcPtr) {
   UT_GenStub_SetupReturnBuffer(MM_DumpMemToFile, int32);
 
   UT_GenStub_AddParam(MM_DumpMemToFile, osal_id_t, FileHandle);
   UT_GenStub_AddParam(MM_DumpMemToFile, const char *, FileName);
   UT_GenStub_AddParam(MM_DumpMemToFile, const MM_LoadDumpFileHeader_t *,
                       FileHeader);
+  UT_GenStub_AddParam(MM_DumpMemToFile, uint32 *, CrcPtr);
 
   UT_GenStub_Execute(MM_DumpMemToFile, Basic, NULL);
 
   return UT_GenStub_GetReturnValue(MM_DumpMemToFile, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_DumpRegionsToFile()
+ * ----------------------------------------------------
+ */
+int32 MM_DumpRegionsToFile(osal_id_t FileHandle, const char *FileName,
+                           CFE_FS_Header_t *CFEHeader,
+                           MM_LoadDumpFileHeader_t *MMHeader) {
+  UT_GenStub_SetupReturnBuffer(MM_DumpRegionsToFile, int32);
+
+  UT_GenStub_AddParam(MM_DumpRegionsToFile, osal_id_t, FileHandle);
+  UT_GenStub_AddParam(MM_DumpRegionsToFile, const char *, FileName);
+  UT_GenStub_AddParam(MM_DumpRegionsToFile, CFE_FS_Header_t *, CFEHeader);
+  UT_GenStub_AddParam(MM_DumpRegionsToFile, MM_LoadDumpFileHeader_t *,
+                      MMHeader);
+
+  UT_GenStub_Execute(MM_DumpRegionsToFile, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_DumpRegionsToFile, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_FillDumpInEventBuffer()
@@ -80,6 +163,49 @@ int32 MM_PeekMem(const MM_PeekCmd_t *CmdPtr, cpuaddr SrcAddress) {
   return UT_GenStub_GetReturnValue(MM_PeekMem, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_PeekValue()
+ * ----------------------------------------------------
+ */
+int32 MM_PeekValue(cpuaddr SrcAddress, uint32 DataSize, uint32 *DataValue) {
+  UT_GenStub_SetupReturnBuffer(MM_PeekValue, int32);
+
+  UT_GenStub_AddParam(MM_PeekValue, cpuaddr, SrcAddress);
+  UT_GenStub_AddParam(MM_PeekValue, uint32, DataSize);
+  UT_GenStub_AddParam(MM_PeekValue, uint32 *, DataValue);
+
+  UT_GenStub_Execute(MM_PeekValue, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_PeekValue, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_ReadMemToBuffer()
+ * ----------------------------------------------------
+ */
+int32 MM_ReadMemToBuffer(cpuaddr SrcAddress, MM_MemType_Enum_t MemType,
+                         size_t NumBytes, void *DumpBuffer) {
+  UT_GenStub_SetupReturnBuffer(MM_ReadMemToBuffer, int32);
+
+  UT_GenStub_AddParam(MM_ReadMemToBuffer, cpuaddr, SrcAddress);
+  UT_GenStub_AddParam(MM_ReadMemToBuffer, MM_MemType_Enum_t, MemType);
+  UT_GenStub_AddParam(MM_ReadMemToBuffer, size_t, NumBytes);
+  UT_GenStub_AddParam(MM_ReadMemToBuffer, void *, DumpBuffer);
+
+  UT_GenStub_Execute(MM_ReadMemToBuffer, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_ReadMemToBuffer, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_SendDumpTlm()
+ * ----------------------------------------------------
+ */
+void MM_SendDumpTlm(void) { UT_GenStub_Execute(MM_SendDumpTlm, Basic, NULL); }
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_WriteFileHeaders()
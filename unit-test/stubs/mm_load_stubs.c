@@ -37,6 +37,30 @@ void MM_FillMem(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr) {
   UT_GenStub_Execute(MM_FillMem, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_LoadMemFromCompressedFile()
+ * ----------------------------------------------------
+ */
+int32 MM_LoadMemFromCompressedFile(osal_id_t FileHandle, const char *FileName,
+                                   const MM_LoadDumpFileHeader_t *FileHeader,
+                                   cpuaddr DestAddress, bool WriteMem,
+                                   uint32 *CrcPtr) {
+  UT_GenStub_SetupReturnBuffer(MM_LoadMemFromCompressedFile, int32);
+
+  UT_GenStub_AddParam(MM_LoadMemFromCompressedFile, osal_id_t, FileHandle);
+  UT_GenStub_AddParam(MM_LoadMemFromCompressedFile, const char *, FileName);
+  UT_GenStub_AddParam(MM_LoadMemFromCompressedFile,
+                      const MM_LoadDumpFileHeader_t *, FileHeader);
+  UT_GenStub_AddParam(MM_LoadMemFromCompressedFile, cpuaddr, DestAddress);
+  UT_GenStub_AddParam(MM_LoadMemFromCompressedFile, bool, WriteMem);
+  UT_GenStub_AddParam(MM_LoadMemFromCompressedFile, uint32 *, CrcPtr);
+
+  UT_GenStub_Execute(MM_LoadMemFromCompressedFile, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_LoadMemFromCompressedFile, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_LoadMemFromFile()
@@ -58,6 +82,26 @@ int32 MM_LoadMemFromFile(osal_id_t FileHandle, const char *FileName,
   return UT_GenStub_GetReturnValue(MM_LoadMemFromFile, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_LoadMemFromStage()
+ * ----------------------------------------------------
+ */
+int32 MM_LoadMemFromStage(const char *FileName,
+                          const MM_LoadDumpFileHeader_t *FileHeader,
+                          cpuaddr DestAddress) {
+  UT_GenStub_SetupReturnBuffer(MM_LoadMemFromStage, int32);
+
+  UT_GenStub_AddParam(MM_LoadMemFromStage, const char *, FileName);
+  UT_GenStub_AddParam(MM_LoadMemFromStage, const MM_LoadDumpFileHeader_t *,
+                      FileHeader);
+  UT_GenStub_AddParam(MM_LoadMemFromStage, cpuaddr, DestAddress);
+
+  UT_GenStub_Execute(MM_LoadMemFromStage, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_LoadMemFromStage, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_LoadMemWID()
@@ -74,6 +118,45 @@ bool MM_LoadMemWID(const MM_LoadMemWIDCmd_t *CmdPtr, cpuaddr DestAddress) {
   return UT_GenStub_GetReturnValue(MM_LoadMemWID, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_LoadPatchFromStage()
+ * ----------------------------------------------------
+ */
+int32 MM_LoadPatchFromStage(const char *FileName,
+                            const MM_LoadDumpFileHeader_t *FileHeader,
+                            cpuaddr BaseAddress) {
+  UT_GenStub_SetupReturnBuffer(MM_LoadPatchFromStage, int32);
+
+  UT_GenStub_AddParam(MM_LoadPatchFromStage, const char *, FileName);
+  UT_GenStub_AddParam(MM_LoadPatchFromStage, const MM_LoadDumpFileHeader_t *,
+                      FileHeader);
+  UT_GenStub_AddParam(MM_LoadPatchFromStage, cpuaddr, BaseAddress);
+
+  UT_GenStub_Execute(MM_LoadPatchFromStage, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_LoadPatchFromStage, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_LoadRegionsFromFile()
+ * ----------------------------------------------------
+ */
+int32 MM_LoadRegionsFromFile(osal_id_t FileHandle, const char *FileName,
+                             const MM_LoadDumpFileHeader_t *FileHeader) {
+  UT_GenStub_SetupReturnBuffer(MM_LoadRegionsFromFile, int32);
+
+  UT_GenStub_AddParam(MM_LoadRegionsFromFile, osal_id_t, FileHandle);
+  UT_GenStub_AddParam(MM_LoadRegionsFromFile, const char *, FileName);
+  UT_GenStub_AddParam(MM_LoadRegionsFromFile, const MM_LoadDumpFileHeader_t *,
+                      FileHeader);
+
+  UT_GenStub_Execute(MM_LoadRegionsFromFile, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_LoadRegionsFromFile, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_PokeEeprom()
@@ -106,6 +189,25 @@ CFE_Status_t MM_PokeMem(const MM_PokeCmd_t *CmdPtr, cpuaddr DestAddress) {
   return UT_GenStub_GetReturnValue(MM_PokeMem, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_PokeValue()
+ * ----------------------------------------------------
+ */
+int32 MM_PokeValue(cpuaddr DestAddress, MM_MemType_Enum_t MemType,
+                   uint32 DataSize, uint32 DataValue) {
+  UT_GenStub_SetupReturnBuffer(MM_PokeValue, int32);
+
+  UT_GenStub_AddParam(MM_PokeValue, cpuaddr, DestAddress);
+  UT_GenStub_AddParam(MM_PokeValue, MM_MemType_Enum_t, MemType);
+  UT_GenStub_AddParam(MM_PokeValue, uint32, DataSize);
+  UT_GenStub_AddParam(MM_PokeValue, uint32, DataValue);
+
+  UT_GenStub_Execute(MM_PokeValue, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_PokeValue, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_ReadFileHeaders()
@@ -126,6 +228,27 @@ int32 MM_ReadFileHeaders(const char *FileName, osal_id_t FileHandle,
   return UT_GenStub_GetReturnValue(MM_ReadFileHeaders, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_StageLoadFile()
+ * ----------------------------------------------------
+ */
+int32 MM_StageLoadFile(osal_id_t FileHandle, const char *FileName,
+                       const MM_LoadDumpFileHeader_t *FileHeader,
+                       uint32 *CrcPtr) {
+  UT_GenStub_SetupReturnBuffer(MM_StageLoadFile, int32);
+
+  UT_GenStub_AddParam(MM_StageLoadFile, osal_id_t, FileHandle);
+  UT_GenStub_AddParam(MM_StageLoadFile, const char *, FileName);
+  UT_GenStub_AddParam(MM_StageLoadFile, const MM_LoadDumpFileHeader_t *,
+                      FileHeader);
+  UT_GenStub_AddParam(MM_StageLoadFile, uint32 *, CrcPtr);
+
+  UT_GenStub_Execute(MM_StageLoadFile, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_StageLoadFile, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_VerifyLoadFileSize()
@@ -143,3 +266,55 @@ int32 MM_VerifyLoadFileSize(const char *FileName,
 
   return UT_GenStub_GetReturnValue(MM_VerifyLoadFileSize, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_WriteEeprom()
+ * ----------------------------------------------------
+ */
+void MM_WriteEeprom(cpuaddr DestAddress, const uint8 *Buffer,
+                    size_t NumBytes) {
+  UT_GenStub_AddParam(MM_WriteEeprom, cpuaddr, DestAddress);
+  UT_GenStub_AddParam(MM_WriteEeprom, const uint8 *, Buffer);
+  UT_GenStub_AddParam(MM_WriteEeprom, size_t, NumBytes);
+
+  UT_GenStub_Execute(MM_WriteEeprom, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_WriteEepromValue()
+ * ----------------------------------------------------
+ */
+int32 MM_WriteEepromValue(cpuaddr DestAddress, uint32 DataSize,
+                          uint32 DataValue) {
+  UT_GenStub_SetupReturnBuffer(MM_WriteEepromValue, int32);
+
+  UT_GenStub_AddParam(MM_WriteEepromValue, cpuaddr, DestAddress);
+  UT_GenStub_AddParam(MM_WriteEepromValue, uint32, DataSize);
+  UT_GenStub_AddParam(MM_WriteEepromValue, uint32, DataValue);
+
+  UT_GenStub_Execute(MM_WriteEepromValue, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_WriteEepromValue, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_WriteMemFromBuffer()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_WriteMemFromBuffer(cpuaddr DestAddress,
+                                   MM_MemType_Enum_t MemType,
+                                   const uint8 *Buffer, size_t NumBytes) {
+  UT_GenStub_SetupReturnBuffer(MM_WriteMemFromBuffer, CFE_Status_t);
+
+  UT_GenStub_AddParam(MM_WriteMemFromBuffer, cpuaddr, DestAddress);
+  UT_GenStub_AddParam(MM_WriteMemFromBuffer, MM_MemType_Enum_t, MemType);
+  UT_GenStub_AddParam(MM_WriteMemFromBuffer, const uint8 *, Buffer);
+  UT_GenStub_AddParam(MM_WriteMemFromBuffer, size_t, NumBytes);
+
+  UT_GenStub_Execute(MM_WriteMemFromBuffer, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_WriteMemFromBuffer, CFE_Status_t);
+}
@@ -31,13 +31,15 @@
  * ----------------------------------------------------
  */
 int32 MM_DumpMem32ToFile(osal_id_t FileHandle, const char *FileName,
-                         const MM_LoadDumpFileHeader_t *FileHeader) {
+                         const MM_LoadDumpFileHeader_t *FileHeader,
+                         uint32 *CrcPtr) {
   UT_GenStub_SetupReturnBuffer(MM_DumpMem32ToFile, int32);
 
   UT_GenStub_AddParam(MM_DumpMem32ToFile, osal_id_t, FileHandle);
   UT_GenStub_AddParam(MM_DumpMem32ToFile, const char *, FileName);
   UT_GenStub_AddParam(MM_DumpMem32ToFile, const MM_LoadDumpFileHeader_t *,
                       FileHeader);
+  UT_GenStub_AddParam(MM_DumpMem32ToFile, uint32 *, CrcPtr);
 
   UT_GenStub_Execute(MM_DumpMem32ToFile, Basic, NULL);
 
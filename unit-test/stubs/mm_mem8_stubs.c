@@ -31,13 +31,15 @@
  * ----------------------------------------------------
  */
 int32 MM_DumpMem8ToFile(osal_id_t FileHandle, const char *FileName,
-                        const MM_LoadDumpFileHeader_t *FileHeader) {
+                        const MM_LoadDumpFileHeader_t *FileHeader,
+                        uint32 *CrcPtr) {
   UT_GenStub_SetupReturnBuffer(MM_DumpMem8ToFile, int32);
 
   UT_GenStub_AddParam(MM_DumpMem8ToFile, osal_id_t, FileHandle);
   UT_GenStub_AddParam(MM_DumpMem8ToFile, const char *, FileName);
   UT_GenStub_AddParam(MM_DumpMem8ToFile, const MM_LoadDumpFileHeader_t *,
                       FileHeader);
+  UT_GenStub_AddParam(MM_DumpMem8ToFile, uint32 *, CrcPtr);
 
   UT_GenStub_Execute(MM_DumpMem8ToFile, Basic, NULL);
 
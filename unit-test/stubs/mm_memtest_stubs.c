@@ -0,0 +1,48 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in mm_memtest
+ * header
+ */
+
+#include "mm_memtest.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_MemTest()
+ * ----------------------------------------------------
+ */
+int32 MM_MemTest(cpuaddr Address, MM_MemType_Enum_t MemType,
+                 uint32 NumOfBytes, uint8 Patterns,
+                 MM_MemTestTlm_Payload_t *Payload) {
+  UT_GenStub_SetupReturnBuffer(MM_MemTest, int32);
+
+  UT_GenStub_AddParam(MM_MemTest, cpuaddr, Address);
+  UT_GenStub_AddParam(MM_MemTest, MM_MemType_Enum_t, MemType);
+  UT_GenStub_AddParam(MM_MemTest, uint32, NumOfBytes);
+  UT_GenStub_AddParam(MM_MemTest, uint8, Patterns);
+  UT_GenStub_AddParam(MM_MemTest, MM_MemTestTlm_Payload_t *, Payload);
+
+  UT_GenStub_Execute(MM_MemTest, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_MemTest, int32);
+}
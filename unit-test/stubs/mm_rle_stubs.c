@@ -0,0 +1,76 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in mm_rle header
+ */
+
+#include "mm_rle.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_RleDecode()
+ * ----------------------------------------------------
+ */
+size_t MM_RleDecode(MM_RleDecoder_t *Decoder, const uint8 *InBuffer,
+                    size_t InSize, size_t *InUsed, uint8 *OutBuffer,
+                    size_t OutSize) {
+  UT_GenStub_SetupReturnBuffer(MM_RleDecode, size_t);
+
+  UT_GenStub_AddParam(MM_RleDecode, MM_RleDecoder_t *, Decoder);
+  UT_GenStub_AddParam(MM_RleDecode, const uint8 *, InBuffer);
+  UT_GenStub_AddParam(MM_RleDecode, size_t, InSize);
+  UT_GenStub_AddParam(MM_RleDecode, size_t *, InUsed);
+  UT_GenStub_AddParam(MM_RleDecode, uint8 *, OutBuffer);
+  UT_GenStub_AddParam(MM_RleDecode, size_t, OutSize);
+
+  UT_GenStub_Execute(MM_RleDecode, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_RleDecode, size_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_RleDecoderInit()
+ * ----------------------------------------------------
+ */
+void MM_RleDecoderInit(MM_RleDecoder_t *Decoder) {
+  UT_GenStub_AddParam(MM_RleDecoderInit, MM_RleDecoder_t *, Decoder);
+
+  UT_GenStub_Execute(MM_RleDecoderInit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_RleEncode()
+ * ----------------------------------------------------
+ */
+size_t MM_RleEncode(const uint8 *InBuffer, size_t InSize, uint8 *OutBuffer) {
+  UT_GenStub_SetupReturnBuffer(MM_RleEncode, size_t);
+
+  UT_GenStub_AddParam(MM_RleEncode, const uint8 *, InBuffer);
+  UT_GenStub_AddParam(MM_RleEncode, size_t, InSize);
+  UT_GenStub_AddParam(MM_RleEncode, uint8 *, OutBuffer);
+
+  UT_GenStub_Execute(MM_RleEncode, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_RleEncode, size_t);
+}
@@ -25,24 +25,57 @@
 #include "mm_utils.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_BuildFillBuffer()
+ * ----------------------------------------------------
+ */
+void MM_BuildFillBuffer(const MM_FillMemCmd_Payload_t *Payload,
+                        size_t AccessSize) {
+  UT_GenStub_AddParam(MM_BuildFillBuffer, const MM_FillMemCmd_Payload_t *,
+                      Payload);
+  UT_GenStub_AddParam(MM_BuildFillBuffer, size_t, AccessSize);
+
+  UT_GenStub_Execute(MM_BuildFillBuffer, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_ComputeCRCFromFile()
  * ----------------------------------------------------
  */
 int32 MM_ComputeCRCFromFile(osal_id_t FileHandle, uint32 *CrcPtr,
-                            uint32 TypeCRC) {
+                            MM_CrcType_Enum_t CrcType) {
   UT_GenStub_SetupReturnBuffer(MM_ComputeCRCFromFile, int32);
 
   UT_GenStub_AddParam(MM_ComputeCRCFromFile, osal_id_t, FileHandle);
   UT_GenStub_AddParam(MM_ComputeCRCFromFile, uint32 *, CrcPtr);
-  UT_GenStub_AddParam(MM_ComputeCRCFromFile, uint32, TypeCRC);
+  UT_GenStub_AddParam(MM_ComputeCRCFromFile, MM_CrcType_Enum_t, CrcType);
 
   UT_GenStub_Execute(MM_ComputeCRCFromFile, Basic, NULL);
 
   return UT_GenStub_GetReturnValue(MM_ComputeCRCFromFile, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_FormatHexBytes()
+ * ----------------------------------------------------
+ */
+size_t MM_FormatHexBytes(char *Dest, size_t DestSize, const uint8 *Src,
+                         size_t NumBytes) {
+  UT_GenStub_SetupReturnBuffer(MM_FormatHexBytes, size_t);
+
+  UT_GenStub_AddParam(MM_FormatHexBytes, char *, Dest);
+  UT_GenStub_AddParam(MM_FormatHexBytes, size_t, DestSize);
+  UT_GenStub_AddParam(MM_FormatHexBytes, const uint8 *, Src);
+  UT_GenStub_AddParam(MM_FormatHexBytes, size_t, NumBytes);
+
+  UT_GenStub_Execute(MM_FormatHexBytes, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_FormatHexBytes, size_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_ResetHk()
@@ -105,6 +138,22 @@ bool MM_Verify32Aligned(cpuaddr Address, size_t Size) {
   return UT_GenStub_GetReturnValue(MM_Verify32Aligned, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_VerifyFillPattern()
+ * ----------------------------------------------------
+ */
+int32 MM_VerifyFillPattern(const MM_FillMemCmd_Payload_t *Payload) {
+  UT_GenStub_SetupReturnBuffer(MM_VerifyFillPattern, int32);
+
+  UT_GenStub_AddParam(MM_VerifyFillPattern, const MM_FillMemCmd_Payload_t *,
+                      Payload);
+
+  UT_GenStub_Execute(MM_VerifyFillPattern, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_VerifyFillPattern, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for MM_VerifyLoadDumpParams()
@@ -0,0 +1,70 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in mm_worker
+ * header
+ */
+
+#include "mm_worker.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_WorkerInit()
+ * ----------------------------------------------------
+ */
+CFE_Status_t MM_WorkerInit(void) {
+  UT_GenStub_SetupReturnBuffer(MM_WorkerInit, CFE_Status_t);
+
+  UT_GenStub_Execute(MM_WorkerInit, Basic, NULL);
+
+  return UT_GenStub_GetReturnValue(MM_WorkerInit, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_WorkerProcessJob()
+ * ----------------------------------------------------
+ */
+void MM_WorkerProcessJob(const MM_WorkerJob_t *Job) {
+  UT_GenStub_AddParam(MM_WorkerProcessJob, const MM_WorkerJob_t *, Job);
+
+  UT_GenStub_Execute(MM_WorkerProcessJob, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_WorkerSubmit()
+ * ----------------------------------------------------
+ */
+void MM_WorkerSubmit(const CFE_SB_Buffer_t *BufPtr, size_t MsgSize) {
+  UT_GenStub_AddParam(MM_WorkerSubmit, const CFE_SB_Buffer_t *, BufPtr);
+  UT_GenStub_AddParam(MM_WorkerSubmit, size_t, MsgSize);
+
+  UT_GenStub_Execute(MM_WorkerSubmit, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for MM_WorkerTask()
+ * ----------------------------------------------------
+ */
+void MM_WorkerTask(void) { UT_GenStub_Execute(MM_WorkerTask, Basic, NULL); }